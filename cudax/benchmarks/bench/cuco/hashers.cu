@@ -97,6 +97,12 @@ struct murmurhash3_32_tag
   using fn = cudax::cuco::hash<Key, cudax::cuco::hash_algorithm::murmurhash3_32>;
 };
 
+struct xxhash3_64_tag
+{
+  template <typename Key>
+  using fn = cudax::cuco::hash<Key, cudax::cuco::hash_algorithm::xxhash3_64>;
+};
+
 #if _CCCL_HAS_INT128()
 
 struct murmurhash3_x86_128_tag
@@ -111,6 +117,12 @@ struct murmurhash3_x64_128_tag
   using fn = cudax::cuco::hash<Key, cudax::cuco::hash_algorithm::murmurhash3_x64_128>;
 };
 
+struct xxhash3_128_tag
+{
+  template <typename Key>
+  using fn = cudax::cuco::hash<Key, cudax::cuco::hash_algorithm::xxhash3_128>;
+};
+
 #endif // _CCCL_HAS_INT128()
 
 NVBENCH_BENCH_TYPES(
@@ -118,11 +130,13 @@ NVBENCH_BENCH_TYPES(
   NVBENCH_TYPE_AXES(
     nvbench::type_list<xxhash_32_tag,
                        xxhash_64_tag,
-                       murmurhash3_32_tag
+                       murmurhash3_32_tag,
+                       xxhash3_64_tag
 #if _CCCL_HAS_INT128()
                        ,
                        murmurhash3_x86_128_tag,
-                       murmurhash3_x64_128_tag
+                       murmurhash3_x64_128_tag,
+                       xxhash3_128_tag
 #endif // _CCCL_HAS_INT128()
                        >,
     nvbench::type_list<cuda::std::int32_t, large_key<4>, large_key<8>, large_key<16>, large_key<32>>))
@@ -0,0 +1,76 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDAX___CUCO___HASH_FUNCTIONS_BULK_HASH_CUH
+#define _CUDAX___CUCO___HASH_FUNCTIONS_BULK_HASH_CUH
+
+#include <cuda/__cccl_config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/__utility/static_for.h>
+#include <cuda/std/__cccl/assert.h>
+#include <cuda/std/cstddef>
+#include <cuda/std/span>
+
+#include <cuda/std/__cccl/prologue.h>
+
+namespace cuda::experimental::cuco
+{
+//! @brief Adds hashing of many keys per call to the hash function `_Hash`.
+//!
+//! @tparam _Hash The hash function, deriving from this class
+//! @tparam _Key The type of the values to hash
+//! @tparam _Value The type of the hash values
+template <class _Hash, class _Key, class _Value>
+struct _Bulk_hash
+{
+  //! The number of keys hashed per iteration. Their hash computations are independent and interleaved, so the compiler
+  //! can overlap them or combine them into vector instructions.
+  static constexpr ::cuda::std::size_t __bulk_lanes = 4;
+
+  //! @brief Hashes every key of `__keys` into the element of `__values` with the same index.
+  //!
+  //! `__values[__i]` equals the hash value of `__keys[__i]`.
+  //!
+  //! @param __keys The keys to hash
+  //! @param __values The resulting hash values, at least as many as `__keys`
+  _CCCL_API constexpr void
+  operator()(::cuda::std::span<const _Key> __keys, ::cuda::std::span<_Value> __values) const noexcept
+  {
+    _CCCL_ASSERT(__values.size() >= __keys.size(), "cuco::hash: the output holds fewer hash values than keys");
+
+    const auto& __hasher = static_cast<const _Hash&>(*this);
+    const auto __size    = __keys.size();
+
+    ::cuda::std::size_t __i = 0;
+    for (; __i + __bulk_lanes <= __size; __i += __bulk_lanes)
+    {
+      ::cuda::static_for<__bulk_lanes>([&](auto __j) {
+        __values[__i + __j] = __hasher(__keys[__i + __j]);
+      });
+    }
+    for (; __i < __size; ++__i)
+    {
+      __values[__i] = __hasher(__keys[__i]);
+    }
+  }
+};
+} // namespace cuda::experimental::cuco
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDAX___CUCO___HASH_FUNCTIONS_BULK_HASH_CUH
@@ -0,0 +1,639 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+/*
+ * `_XXHash3_64` and `_XXHash3_128` implementation from
+ * https://github.com/Cyan4973/xxHash
+ * -----------------------------------------------------------------------------
+ * xxHash - Extremely Fast Hash algorithm
+ * Header File
+ * Copyright (C) 2012-2021 Yann Collet
+ *
+ * BSD 2-Clause License (https://www.opensource.org/licenses/bsd-license.php)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above
+ *      copyright notice, this list of conditions and the following disclaimer
+ *      in the documentation and/or other materials provided with the
+ *      distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _CUDAX___CUCO___HASH_FUNCTIONS_XXHASH3_CUH
+#define _CUDAX___CUCO___HASH_FUNCTIONS_XXHASH3_CUH
+
+#include <cuda/__cccl_config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/__cmath/mul_hi.h>
+#include <cuda/std/__bit/byteswap.h>
+#include <cuda/std/__bit/rotate.h>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstdint>
+#include <cuda/std/cstring>
+#include <cuda/std/span>
+
+#include <cuda/std/__cccl/prologue.h>
+
+namespace cuda::experimental::cuco
+{
+//! @brief The default secret of XXH3
+// clang-format off
+_CCCL_GLOBAL_CONSTANT ::cuda::std::uint8_t __xxh3_default_secret[192] = {
+  0xb8, 0xfe, 0x6c, 0x39, 0x23, 0xa4, 0x4b, 0xbe, 0x7c, 0x01, 0x81, 0x2c, 0xf7, 0x21, 0xad, 0x1c,
+  0xde, 0xd4, 0x6d, 0xe9, 0x83, 0x90, 0x97, 0xdb, 0x72, 0x40, 0xa4, 0xa4, 0xb7, 0xb3, 0x67, 0x1f,
+  0xcb, 0x79, 0xe6, 0x4e, 0xcc, 0xc0, 0xe5, 0x78, 0x82, 0x5a, 0xd0, 0x7d, 0xcc, 0xff, 0x72, 0x21,
+  0xb8, 0x08, 0x46, 0x74, 0xf7, 0x43, 0x24, 0x8e, 0xe0, 0x35, 0x90, 0xe6, 0x81, 0x3a, 0x26, 0x4c,
+  0x3c, 0x28, 0x52, 0xbb, 0x91, 0xc3, 0x00, 0xcb, 0x88, 0xd0, 0x65, 0x8b, 0x1b, 0x53, 0x2e, 0xa3,
+  0x71, 0x64, 0x48, 0x97, 0xa2, 0x0d, 0xf9, 0x4e, 0x38, 0x19, 0xef, 0x46, 0xa9, 0xde, 0xac, 0xd8,
+  0xa8, 0xfa, 0x76, 0x3f, 0xe3, 0x9c, 0x34, 0x3f, 0xf9, 0xdc, 0xbb, 0xc7, 0xc7, 0x0b, 0x4f, 0x1d,
+  0x8a, 0x51, 0xe0, 0x4b, 0xcd, 0xb4, 0x59, 0x31, 0xc8, 0x9f, 0x7e, 0xc9, 0xd9, 0x78, 0x73, 0x64,
+  0xea, 0xc5, 0xac, 0x83, 0x34, 0xd3, 0xeb, 0xc3, 0xc5, 0x81, 0xa0, 0xff, 0xfa, 0x13, 0x63, 0xeb,
+  0x17, 0x0d, 0xdd, 0x51, 0xb7, 0xf0, 0xda, 0x49, 0xd3, 0x16, 0x55, 0x26, 0x29, 0xd4, 0x68, 0x9e,
+  0x2b, 0x16, 0xbe, 0x58, 0x7d, 0x47, 0xa1, 0xfc, 0x8f, 0xf8, 0xb8, 0xd1, 0x7a, 0xd0, 0x31, 0xce,
+  0x45, 0xcb, 0x3a, 0x8f, 0x95, 0x16, 0x04, 0x28, 0xaf, 0xd7, 0xfb, 0xca, 0xbb, 0x4b, 0x40, 0x7e,
+};
+// clang-format on
+
+//! @brief Building blocks shared by the 64-bit and 128-bit variants of XXH3
+struct _XXHash3_base
+{
+protected:
+  static constexpr ::cuda::std::uint32_t __prime32_1 = 0x9e3779b1u;
+  static constexpr ::cuda::std::uint32_t __prime32_2 = 0x85ebca77u;
+  static constexpr ::cuda::std::uint32_t __prime32_3 = 0xc2b2ae3du;
+  static constexpr ::cuda::std::uint64_t __prime64_1 = 0x9e3779b185ebca87ull;
+  static constexpr ::cuda::std::uint64_t __prime64_2 = 0xc2b2ae3d27d4eb4full;
+  static constexpr ::cuda::std::uint64_t __prime64_3 = 0x165667b19e3779f9ull;
+  static constexpr ::cuda::std::uint64_t __prime64_4 = 0x85ebca77c2b2ae63ull;
+  static constexpr ::cuda::std::uint64_t __prime64_5 = 0x27d4eb2f165667c5ull;
+  static constexpr ::cuda::std::uint64_t __prime_mx1 = 0x165667919e3779f9ull;
+  static constexpr ::cuda::std::uint64_t __prime_mx2 = 0x9fb21c651e98df25ull;
+
+  static constexpr ::cuda::std::size_t __secret_size     = sizeof(__xxh3_default_secret);
+  static constexpr ::cuda::std::size_t __secret_size_min = 136;
+  static constexpr ::cuda::std::size_t __stripe_len      = 64;
+  static constexpr ::cuda::std::size_t __midsize_max     = 240;
+  static constexpr ::cuda::std::size_t __num_acc         = 8;
+
+  //! @brief The low and high halves of a 128-bit value
+  struct __uint128
+  {
+    ::cuda::std::uint64_t __low;
+    ::cuda::std::uint64_t __high;
+  };
+
+  template <class _Tp>
+  [[nodiscard]] _CCCL_API static _Tp __read(const void* __ptr) noexcept
+  {
+    _Tp __value;
+    ::cuda::std::memcpy(&__value, __ptr, sizeof(_Tp));
+    return __value;
+  }
+
+  [[nodiscard]] _CCCL_API static ::cuda::std::uint64_t __read64(const void* __ptr) noexcept
+  {
+    return __read<::cuda::std::uint64_t>(__ptr);
+  }
+
+  [[nodiscard]] _CCCL_API static ::cuda::std::uint32_t __read32(const void* __ptr) noexcept
+  {
+    return __read<::cuda::std::uint32_t>(__ptr);
+  }
+
+  [[nodiscard]] _CCCL_API static constexpr __uint128
+  __mul128(::cuda::std::uint64_t __lhs, ::cuda::std::uint64_t __rhs) noexcept
+  {
+    return {__lhs * __rhs, ::cuda::mul_hi(__lhs, __rhs)};
+  }
+
+  [[nodiscard]] _CCCL_API static constexpr ::cuda::std::uint64_t
+  __mul128_fold64(::cuda::std::uint64_t __lhs, ::cuda::std::uint64_t __rhs) noexcept
+  {
+    const auto __product = __mul128(__lhs, __rhs);
+    return __product.__low ^ __product.__high;
+  }
+
+  [[nodiscard]] _CCCL_API static constexpr ::cuda::std::uint64_t __xxh64_avalanche(::cuda::std::uint64_t __h) noexcept
+  {
+    __h ^= __h >> 33;
+    __h *= __prime64_2;
+    __h ^= __h >> 29;
+    __h *= __prime64_3;
+    __h ^= __h >> 32;
+    return __h;
+  }
+
+  [[nodiscard]] _CCCL_API static constexpr ::cuda::std::uint64_t __avalanche(::cuda::std::uint64_t __h) noexcept
+  {
+    __h ^= __h >> 37;
+    __h *= __prime_mx1;
+    __h ^= __h >> 32;
+    return __h;
+  }
+
+  [[nodiscard]] _CCCL_API static constexpr ::cuda::std::uint64_t
+  __rrmxmx(::cuda::std::uint64_t __h, ::cuda::std::uint64_t __len) noexcept
+  {
+    __h ^= ::cuda::std::rotl(__h, 49) ^ ::cuda::std::rotl(__h, 24);
+    __h *= __prime_mx2;
+    __h ^= (__h >> 35) + __len;
+    __h *= __prime_mx2;
+    return __h ^ (__h >> 28);
+  }
+
+  [[nodiscard]] _CCCL_API static ::cuda::std::uint64_t
+  __mix16(const ::cuda::std::byte* __input, const ::cuda::std::uint8_t* __secret, ::cuda::std::uint64_t __seed) noexcept
+  {
+    return __mul128_fold64(__read64(__input) ^ (__read64(__secret) + __seed),
+                           __read64(__input + 8) ^ (__read64(__secret + 8) - __seed));
+  }
+
+  //! @brief Derives the secret used for long inputs from a non-zero seed
+  _CCCL_API static void
+  __init_custom_secret(::cuda::std::uint8_t* __custom_secret, ::cuda::std::uint64_t __seed) noexcept
+  {
+    for (::cuda::std::size_t __i = 0; __i < __secret_size; __i += 16)
+    {
+      const auto __lo = __read64(__xxh3_default_secret + __i) + __seed;
+      const auto __hi = __read64(__xxh3_default_secret + __i + 8) - __seed;
+      ::cuda::std::memcpy(__custom_secret + __i, &__lo, sizeof(__lo));
+      ::cuda::std::memcpy(__custom_secret + __i + 8, &__hi, sizeof(__hi));
+    }
+  }
+
+  //! @brief Runs the accumulation loop over inputs longer than `__midsize_max` bytes
+  _CCCL_API static void __hash_long_loop(::cuda::std::uint64_t (&__acc)[__num_acc],
+                                         const ::cuda::std::byte* __input,
+                                         ::cuda::std::size_t __len,
+                                         const ::cuda::std::uint8_t* __secret) noexcept
+  {
+    constexpr ::cuda::std::size_t __stripes_per_block = (__secret_size - __stripe_len) / 8;
+    constexpr ::cuda::std::size_t __block_len         = __stripe_len * __stripes_per_block;
+
+    const auto __num_blocks = (__len - 1) / __block_len;
+    for (::cuda::std::size_t __n = 0; __n < __num_blocks; ++__n)
+    {
+      __accumulate(__acc, __input + __n * __block_len, __secret, __stripes_per_block);
+      __scramble(__acc, __secret + __secret_size - __stripe_len);
+    }
+
+    // last partial block, and the last stripe which may overlap it
+    const auto __num_stripes = ((__len - 1) - __block_len * __num_blocks) / __stripe_len;
+    __accumulate(__acc, __input + __num_blocks * __block_len, __secret, __num_stripes);
+    __accumulate_stripe(__acc, __input + __len - __stripe_len, __secret + __secret_size - __stripe_len - 7);
+  }
+
+  [[nodiscard]] _CCCL_API static ::cuda::std::uint64_t __merge_accs(
+    const ::cuda::std::uint64_t (&__acc)[__num_acc],
+    const ::cuda::std::uint8_t* __secret,
+    ::cuda::std::uint64_t __start) noexcept
+  {
+    auto __result = __start;
+    for (::cuda::std::size_t __i = 0; __i < 4; ++__i)
+    {
+      __result += __mul128_fold64(
+        __acc[2 * __i] ^ __read64(__secret + 16 * __i), __acc[2 * __i + 1] ^ __read64(__secret + 16 * __i + 8));
+    }
+    return __avalanche(__result);
+  }
+
+  _CCCL_API static void __init_accs(::cuda::std::uint64_t (&__acc)[__num_acc]) noexcept
+  {
+    __acc[0] = __prime32_3;
+    __acc[1] = __prime64_1;
+    __acc[2] = __prime64_2;
+    __acc[3] = __prime64_3;
+    __acc[4] = __prime64_4;
+    __acc[5] = __prime32_2;
+    __acc[6] = __prime64_5;
+    __acc[7] = __prime32_1;
+  }
+
+private:
+  _CCCL_API static void __accumulate_stripe(::cuda::std::uint64_t (&__acc)[__num_acc],
+                                            const ::cuda::std::byte* __input,
+                                            const ::cuda::std::uint8_t* __secret) noexcept
+  {
+    // The lanes are independent, which lets the host compiler vectorize the stripe
+    for (::cuda::std::size_t __i = 0; __i < __num_acc; ++__i)
+    {
+      const auto __data_val = __read64(__input + 8 * __i);
+      const auto __data_key = __data_val ^ __read64(__secret + 8 * __i);
+      __acc[__i ^ 1] += __data_val;
+      __acc[__i] += (__data_key & 0xffffffffull) * (__data_key >> 32);
+    }
+  }
+
+  _CCCL_API static void __accumulate(::cuda::std::uint64_t (&__acc)[__num_acc],
+                                     const ::cuda::std::byte* __input,
+                                     const ::cuda::std::uint8_t* __secret,
+                                     ::cuda::std::size_t __num_stripes) noexcept
+  {
+    for (::cuda::std::size_t __n = 0; __n < __num_stripes; ++__n)
+    {
+      __accumulate_stripe(__acc, __input + __n * __stripe_len, __secret + __n * 8);
+    }
+  }
+
+  _CCCL_API static void
+  __scramble(::cuda::std::uint64_t (&__acc)[__num_acc], const ::cuda::std::uint8_t* __secret) noexcept
+  {
+    for (::cuda::std::size_t __i = 0; __i < __num_acc; ++__i)
+    {
+      auto __acc64 = __acc[__i];
+      __acc64 ^= __acc64 >> 47;
+      __acc64 ^= __read64(__secret + 8 * __i);
+      __acc64 *= __prime32_1;
+      __acc[__i] = __acc64;
+    }
+  }
+};
+
+//! @brief A `_XXHash3_64` hash function to hash the given argument on host and device.
+//!
+//! @note XXH3 is considerably faster than XXH64 on short keys, while producing 64-bit hash values of similar quality.
+//!
+//! @tparam _Key The type of the values to hash
+template <typename _Key>
+struct _XXHash3_64 : private _XXHash3_base
+{
+  //! @brief Constructs a XXH3 64-bit hash function with the given `seed`.
+  //!
+  //! @param __seed A custom number to randomize the resulting hash value
+  _CCCL_API constexpr _XXHash3_64(::cuda::std::uint64_t __seed = 0)
+      : __seed_{__seed}
+  {}
+
+  //! @brief Returns a hash value for its argument, as a value of type `::cuda::std::uint64_t`.
+  //!
+  //! @param __key The input argument to hash
+  //! @return The resulting hash value for `__key`
+  [[nodiscard]] _CCCL_API constexpr ::cuda::std::uint64_t operator()(const _Key& __key) const noexcept
+  {
+    if constexpr (sizeof(_Key) <= 16)
+    {
+      const _Key __copy{__key};
+      return __compute_hash(reinterpret_cast<const ::cuda::std::byte*>(&__copy), sizeof(_Key));
+    }
+    else
+    {
+      return __compute_hash(reinterpret_cast<const ::cuda::std::byte*>(&__key), sizeof(_Key));
+    }
+  }
+
+  //! @brief Returns a hash value for its argument, as a value of type `::cuda::std::uint64_t`.
+  //!
+  //! @tparam _Extent The extent type
+  //! @param __keys span of keys to hash
+  //! @return The resulting hash value
+  template <size_t _Extent>
+  [[nodiscard]] _CCCL_API constexpr ::cuda::std::uint64_t
+  operator()(::cuda::std::span<_Key, _Extent> __keys) const noexcept
+  {
+    return __compute_hash(::cuda::std::as_bytes(__keys).data(), __keys.size_bytes());
+  }
+
+private:
+  [[nodiscard]] _CCCL_API ::cuda::std::uint64_t
+  __compute_hash(const ::cuda::std::byte* __input, ::cuda::std::size_t __len) const noexcept
+  {
+    const auto* __secret = __xxh3_default_secret;
+    if (__len <= 16)
+    {
+      return __len_0to16(__input, __len, __secret);
+    }
+    if (__len <= 128)
+    {
+      auto __acc = __len * __prime64_1;
+      if (__len > 32)
+      {
+        if (__len > 64)
+        {
+          if (__len > 96)
+          {
+            __acc += __mix16(__input + 48, __secret + 96, __seed_);
+            __acc += __mix16(__input + __len - 64, __secret + 112, __seed_);
+          }
+          __acc += __mix16(__input + 32, __secret + 64, __seed_);
+          __acc += __mix16(__input + __len - 48, __secret + 80, __seed_);
+        }
+        __acc += __mix16(__input + 16, __secret + 32, __seed_);
+        __acc += __mix16(__input + __len - 32, __secret + 48, __seed_);
+      }
+      __acc += __mix16(__input, __secret, __seed_);
+      __acc += __mix16(__input + __len - 16, __secret + 16, __seed_);
+      return __avalanche(__acc);
+    }
+    if (__len <= __midsize_max)
+    {
+      auto __acc = __len * __prime64_1;
+      for (::cuda::std::size_t __i = 0; __i < 8; ++__i)
+      {
+        __acc += __mix16(__input + 16 * __i, __secret + 16 * __i, __seed_);
+      }
+      __acc = __avalanche(__acc);
+
+      auto __acc_end          = __mix16(__input + __len - 16, __secret + __secret_size_min - 17, __seed_);
+      const auto __num_rounds = __len / 16;
+      for (::cuda::std::size_t __i = 8; __i < __num_rounds; ++__i)
+      {
+        __acc_end += __mix16(__input + 16 * __i, __secret + 16 * (__i - 8) + 3, __seed_);
+      }
+      return __avalanche(__acc + __acc_end);
+    }
+    return __hash_long(__input, __len);
+  }
+
+  [[nodiscard]] _CCCL_API ::cuda::std::uint64_t __len_0to16(
+    const ::cuda::std::byte* __input, ::cuda::std::size_t __len, const ::cuda::std::uint8_t* __secret) const noexcept
+  {
+    if (__len > 8)
+    {
+      const auto __bitflip1 = (__read64(__secret + 24) ^ __read64(__secret + 32)) + __seed_;
+      const auto __bitflip2 = (__read64(__secret + 40) ^ __read64(__secret + 48)) - __seed_;
+      const auto __input_lo = __read64(__input) ^ __bitflip1;
+      const auto __input_hi = __read64(__input + __len - 8) ^ __bitflip2;
+      const auto __acc =
+        __len + ::cuda::std::byteswap(__input_lo) + __input_hi + __mul128_fold64(__input_lo, __input_hi);
+      return __avalanche(__acc);
+    }
+    if (__len >= 4)
+    {
+      const auto __seed =
+        __seed_ ^ (::cuda::std::uint64_t{::cuda::std::byteswap(static_cast<::cuda::std::uint32_t>(__seed_))} << 32);
+      const auto __input1  = __read32(__input);
+      const auto __input2  = __read32(__input + __len - 4);
+      const auto __bitflip = (__read64(__secret + 8) ^ __read64(__secret + 16)) - __seed;
+      const auto __input64 = __input2 + (::cuda::std::uint64_t{__input1} << 32);
+      return __rrmxmx(__input64 ^ __bitflip, __len);
+    }
+    if (__len > 0)
+    {
+      const auto __c1       = ::cuda::std::to_integer<::cuda::std::uint32_t>(__input[0]);
+      const auto __c2       = ::cuda::std::to_integer<::cuda::std::uint32_t>(__input[__len >> 1]);
+      const auto __c3       = ::cuda::std::to_integer<::cuda::std::uint32_t>(__input[__len - 1]);
+      const auto __combined = (__c1 << 16) | (__c2 << 24) | __c3 | (static_cast<::cuda::std::uint32_t>(__len) << 8);
+      const auto __bitflip  = ::cuda::std::uint64_t{__read32(__secret) ^ __read32(__secret + 4)} + __seed_;
+      return __xxh64_avalanche(::cuda::std::uint64_t{__combined} ^ __bitflip);
+    }
+    return __xxh64_avalanche(__seed_ ^ (__read64(__secret + 56) ^ __read64(__secret + 64)));
+  }
+
+  [[nodiscard]] _CCCL_API ::cuda::std::uint64_t
+  __hash_long(const ::cuda::std::byte* __input, ::cuda::std::size_t __len) const noexcept
+  {
+    ::cuda::std::uint8_t __custom_secret[__secret_size] = {};
+    const ::cuda::std::uint8_t* __secret                 = __xxh3_default_secret;
+    if (__seed_ != 0)
+    {
+      __init_custom_secret(__custom_secret, __seed_);
+      __secret = __custom_secret;
+    }
+
+    ::cuda::std::uint64_t __acc[__num_acc];
+    __init_accs(__acc);
+    __hash_long_loop(__acc, __input, __len, __secret);
+    return __merge_accs(__acc, __secret + 11, __len * __prime64_1);
+  }
+
+  ::cuda::std::uint64_t __seed_;
+};
+
+#if _CCCL_HAS_INT128()
+
+//! @brief A `_XXHash3_128` hash function to hash the given argument on host and device.
+//!
+//! @note The low 64 bits of the result hold the `low64` half of the reference `XXH128_hash_t`.
+//!
+//! @tparam _Key The type of the values to hash
+template <typename _Key>
+struct _XXHash3_128 : private _XXHash3_base
+{
+  //! @brief Constructs a XXH3 128-bit hash function with the given `seed`.
+  //!
+  //! @param __seed A custom number to randomize the resulting hash value
+  _CCCL_API constexpr _XXHash3_128(::cuda::std::uint64_t __seed = 0)
+      : __seed_{__seed}
+  {}
+
+  //! @brief Returns a hash value for its argument, as a value of type `__uint128_t`.
+  //!
+  //! @param __key The input argument to hash
+  //! @return The resulting hash value for `__key`
+  [[nodiscard]] _CCCL_API constexpr __uint128_t operator()(const _Key& __key) const noexcept
+  {
+    if constexpr (sizeof(_Key) <= 16)
+    {
+      const _Key __copy{__key};
+      return __compute_hash(reinterpret_cast<const ::cuda::std::byte*>(&__copy), sizeof(_Key));
+    }
+    else
+    {
+      return __compute_hash(reinterpret_cast<const ::cuda::std::byte*>(&__key), sizeof(_Key));
+    }
+  }
+
+  //! @brief Returns a hash value for its argument, as a value of type `__uint128_t`.
+  //!
+  //! @tparam _Extent The extent type
+  //! @param __keys span of keys to hash
+  //! @return The resulting hash value
+  template <size_t _Extent>
+  [[nodiscard]] _CCCL_API constexpr __uint128_t operator()(::cuda::std::span<_Key, _Extent> __keys) const noexcept
+  {
+    return __compute_hash(::cuda::std::as_bytes(__keys).data(), __keys.size_bytes());
+  }
+
+private:
+  [[nodiscard]] _CCCL_API static constexpr __uint128_t __to_uint128(__uint128 __h) noexcept
+  {
+    return (static_cast<__uint128_t>(__h.__high) << 64) | __h.__low;
+  }
+
+  [[nodiscard]] _CCCL_API static __uint128 __mix32(
+    __uint128 __acc,
+    const ::cuda::std::byte* __input1,
+    const ::cuda::std::byte* __input2,
+    const ::cuda::std::uint8_t* __secret,
+    ::cuda::std::uint64_t __seed) noexcept
+  {
+    __acc.__low += __mix16(__input1, __secret, __seed);
+    __acc.__low ^= __read64(__input2) + __read64(__input2 + 8);
+    __acc.__high += __mix16(__input2, __secret + 16, __seed);
+    __acc.__high ^= __read64(__input1) + __read64(__input1 + 8);
+    return __acc;
+  }
+
+  [[nodiscard]] _CCCL_API __uint128 __finalize_mid(__uint128 __acc, ::cuda::std::size_t __len) const noexcept
+  {
+    __uint128 __h;
+    __h.__low  = __avalanche(__acc.__low + __acc.__high);
+    __h.__high = ::cuda::std::uint64_t{0}
+               - __avalanche(__acc.__low * __prime64_1 + __acc.__high * __prime64_4 + (__len - __seed_) * __prime64_2);
+    return __h;
+  }
+
+  [[nodiscard]] _CCCL_API __uint128_t
+  __compute_hash(const ::cuda::std::byte* __input, ::cuda::std::size_t __len) const noexcept
+  {
+    const auto* __secret = __xxh3_default_secret;
+    if (__len <= 16)
+    {
+      return __to_uint128(__len_0to16(__input, __len, __secret));
+    }
+    if (__len <= 128)
+    {
+      __uint128 __acc{__len * __prime64_1, 0};
+      if (__len > 32)
+      {
+        if (__len > 64)
+        {
+          if (__len > 96)
+          {
+            __acc = __mix32(__acc, __input + 48, __input + __len - 64, __secret + 96, __seed_);
+          }
+          __acc = __mix32(__acc, __input + 32, __input + __len - 48, __secret + 64, __seed_);
+        }
+        __acc = __mix32(__acc, __input + 16, __input + __len - 32, __secret + 32, __seed_);
+      }
+      __acc = __mix32(__acc, __input, __input + __len - 16, __secret, __seed_);
+      return __to_uint128(__finalize_mid(__acc, __len));
+    }
+    if (__len <= __midsize_max)
+    {
+      __uint128 __acc{__len * __prime64_1, 0};
+      for (::cuda::std::size_t __i = 0; __i < 4; ++__i)
+      {
+        __acc = __mix32(__acc, __input + 32 * __i, __input + 32 * __i + 16, __secret + 32 * __i, __seed_);
+      }
+      __acc.__low  = __avalanche(__acc.__low);
+      __acc.__high = __avalanche(__acc.__high);
+
+      // `<= __len` duplicates the last 32 bytes if `__len` is a multiple of 32, as the reference implementation does
+      for (::cuda::std::size_t __i = 160; __i <= __len; __i += 32)
+      {
+        __acc = __mix32(__acc, __input + __i - 32, __input + __i - 16, __secret + 3 + __i - 160, __seed_);
+      }
+      __acc = __mix32(__acc,
+                      __input + __len - 16,
+                      __input + __len - 32,
+                      __secret + __secret_size_min - 17 - 16,
+                      ::cuda::std::uint64_t{0} - __seed_);
+      return __to_uint128(__finalize_mid(__acc, __len));
+    }
+    return __to_uint128(__hash_long(__input, __len));
+  }
+
+  [[nodiscard]] _CCCL_API __uint128 __len_0to16(
+    const ::cuda::std::byte* __input, ::cuda::std::size_t __len, const ::cuda::std::uint8_t* __secret) const noexcept
+  {
+    if (__len > 8)
+    {
+      const auto __bitflipl = (__read64(__secret + 32) ^ __read64(__secret + 40)) - __seed_;
+      const auto __bitfliph = (__read64(__secret + 48) ^ __read64(__secret + 56)) + __seed_;
+      const auto __input_lo = __read64(__input);
+      auto __input_hi       = __read64(__input + __len - 8);
+      auto __m128           = __mul128(__input_lo ^ __input_hi ^ __bitflipl, __prime64_1);
+      __m128.__low += static_cast<::cuda::std::uint64_t>(__len - 1) << 54;
+      __input_hi ^= __bitfliph;
+      __m128.__high +=
+        __input_hi + ::cuda::std::uint64_t{static_cast<::cuda::std::uint32_t>(__input_hi)} * (__prime32_2 - 1);
+      __m128.__low ^= ::cuda::std::byteswap(__m128.__high);
+
+      auto __h128 = __mul128(__m128.__low, __prime64_2);
+      __h128.__high += __m128.__high * __prime64_2;
+      __h128.__low  = __avalanche(__h128.__low);
+      __h128.__high = __avalanche(__h128.__high);
+      return __h128;
+    }
+    if (__len >= 4)
+    {
+      const auto __seed =
+        __seed_ ^ (::cuda::std::uint64_t{::cuda::std::byteswap(static_cast<::cuda::std::uint32_t>(__seed_))} << 32);
+      const auto __input_lo = __read32(__input);
+      const auto __input_hi = __read32(__input + __len - 4);
+      const auto __input64  = __input_lo + (::cuda::std::uint64_t{__input_hi} << 32);
+      const auto __bitflip  = (__read64(__secret + 16) ^ __read64(__secret + 24)) + __seed;
+      auto __m128           = __mul128(__input64 ^ __bitflip, __prime64_1 + (__len << 2));
+      __m128.__high += __m128.__low << 1;
+      __m128.__low ^= __m128.__high >> 3;
+      __m128.__low ^= __m128.__low >> 35;
+      __m128.__low *= __prime_mx2;
+      __m128.__low ^= __m128.__low >> 28;
+      __m128.__high = __avalanche(__m128.__high);
+      return __m128;
+    }
+    if (__len > 0)
+    {
+      const auto __c1        = ::cuda::std::to_integer<::cuda::std::uint32_t>(__input[0]);
+      const auto __c2        = ::cuda::std::to_integer<::cuda::std::uint32_t>(__input[__len >> 1]);
+      const auto __c3        = ::cuda::std::to_integer<::cuda::std::uint32_t>(__input[__len - 1]);
+      const auto __combinedl = (__c1 << 16) | (__c2 << 24) | __c3 | (static_cast<::cuda::std::uint32_t>(__len) << 8);
+      const auto __combinedh = ::cuda::std::rotl(::cuda::std::byteswap(__combinedl), 13);
+      const auto __bitflipl  = ::cuda::std::uint64_t{__read32(__secret) ^ __read32(__secret + 4)} + __seed_;
+      const auto __bitfliph  = ::cuda::std::uint64_t{__read32(__secret + 8) ^ __read32(__secret + 12)} - __seed_;
+      return {__xxh64_avalanche(::cuda::std::uint64_t{__combinedl} ^ __bitflipl),
+              __xxh64_avalanche(::cuda::std::uint64_t{__combinedh} ^ __bitfliph)};
+    }
+    return {__xxh64_avalanche(__seed_ ^ (__read64(__secret + 64) ^ __read64(__secret + 72))),
+            __xxh64_avalanche(__seed_ ^ (__read64(__secret + 80) ^ __read64(__secret + 88)))};
+  }
+
+  [[nodiscard]] _CCCL_API __uint128
+  __hash_long(const ::cuda::std::byte* __input, ::cuda::std::size_t __len) const noexcept
+  {
+    ::cuda::std::uint8_t __custom_secret[__secret_size] = {};
+    const ::cuda::std::uint8_t* __secret                 = __xxh3_default_secret;
+    if (__seed_ != 0)
+    {
+      __init_custom_secret(__custom_secret, __seed_);
+      __secret = __custom_secret;
+    }
+
+    ::cuda::std::uint64_t __acc[__num_acc];
+    __init_accs(__acc);
+    __hash_long_loop(__acc, __input, __len, __secret);
+    return {__merge_accs(__acc, __secret + 11, __len * __prime64_1),
+            __merge_accs(__acc, __secret + __secret_size - sizeof(__acc) - 11, ~(__len * __prime64_2))};
+  }
+
+  ::cuda::std::uint64_t __seed_;
+};
+
+#endif // _CCCL_HAS_INT128()
+} // namespace cuda::experimental::cuco
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDAX___CUCO___HASH_FUNCTIONS_XXHASH3_CUH
@@ -0,0 +1,184 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDAX___CUCO___HYPERLOGLOG_HOST_KERNELS_CUH
+#define _CUDAX___CUCO___HYPERLOGLOG_HOST_KERNELS_CUH
+
+#include <cuda/__cccl_config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__algorithm/max.h>
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/__cstddef/types.h>
+#include <cuda/std/cstdint>
+
+#include <thread>
+#include <vector>
+
+#include <cuda/std/__cccl/prologue.h>
+
+namespace cuda::experimental::cuco::__hyperloglog_ns
+{
+//! Registers are processed in blocks of this many elements. Sketches always hold a multiple of 16 registers, so the
+//! fixed trip count lets the compiler vectorize the inner loop without a scalar remainder.
+inline constexpr ::cuda::std::size_t __host_register_block = 16;
+
+//! Minimum number of items a host thread adds to its private sketch
+inline constexpr ::cuda::std::int64_t __host_add_grain = ::cuda::std::int64_t{1} << 16;
+
+//! Minimum number of registers a host thread merges
+inline constexpr ::cuda::std::size_t __host_merge_grain = ::cuda::std::size_t{1} << 14;
+
+//! @brief Returns the number of host threads used for `__work` units of work of at least `__grain` units each
+//!
+//! @param __work Amount of work
+//! @param __grain Minimum amount of work per thread
+//!
+//! @return The number of threads, at least 1
+template <class _Size>
+[[nodiscard]] _CCCL_HOST int __host_num_threads(_Size __work, _Size __grain) noexcept
+{
+  const auto __hardware = static_cast<_Size>(::cuda::std::max(1u, ::std::thread::hardware_concurrency()));
+  return static_cast<int>(::cuda::std::max(_Size{1}, ::cuda::std::min(__hardware, __work / __grain)));
+}
+
+//! @brief Invokes `__fn(__t)` for every `__t` in [0, __num_threads), each on its own host thread
+//!
+//! The calling thread executes `__fn(0)` and waits for the others to finish.
+//!
+//! @param __num_threads Number of threads
+//! @param __fn Function invoked with the thread index
+template <class _Fn>
+_CCCL_HOST void __host_parallel_for(int __num_threads, const _Fn& __fn)
+{
+  ::std::vector<::std::thread> __threads;
+  __threads.reserve(__num_threads - 1);
+  for (int __t = 1; __t < __num_threads; ++__t)
+  {
+    __threads.emplace_back(__fn, __t);
+  }
+  __fn(0);
+  for (auto& __worker : __threads)
+  {
+    __worker.join();
+  }
+}
+
+//! @brief Returns the subrange [__begin, __end) of [0, __n) processed by thread `__t` out of `__num_threads`
+//!
+//! Bounds are multiples of `__align` except for the end of the last subrange.
+template <class _Size>
+[[nodiscard]] _CCCL_HOST constexpr _Size
+__host_partition_bound(_Size __n, int __t, int __num_threads, _Size __align = _Size{1}) noexcept
+{
+  const auto __blocks = (__n + __align - 1) / __align;
+  return ::cuda::std::min(__n, __blocks * __t / __num_threads * __align);
+}
+
+//! @brief Computes `__dst[__i] = max(__dst[__i], __src[__i])` for all `__i` in [0, __n)
+//!
+//! @note `__n` must be a multiple of `__host_register_block`.
+//!
+//! @param __dst Registers to update
+//! @param __src Registers to merge into `__dst`
+//! @param __n Number of registers
+template <class _Register>
+_CCCL_HOST void __host_register_max(
+  _Register* _CCCL_RESTRICT __dst, const _Register* _CCCL_RESTRICT __src, ::cuda::std::size_t __n) noexcept
+{
+  for (::cuda::std::size_t __i = 0; __i < __n; __i += __host_register_block)
+  {
+    for (::cuda::std::size_t __j = __i; __j < __i + __host_register_block; ++__j)
+    {
+      // Written as a select so that it lowers to a vector max
+      __dst[__j] = __dst[__j] < __src[__j] ? __src[__j] : __dst[__j];
+    }
+  }
+}
+
+//! @brief Merges the registers of `__src` into `__dst`, partitioning the registers among host threads
+//!
+//! @param __dst Registers to update
+//! @param __src Registers to merge into `__dst`
+//! @param __n Number of registers, a multiple of `__host_register_block`
+//! @param __parallel Whether multiple host threads may be used
+template <class _Register>
+_CCCL_HOST void __host_merge(_Register* __dst, const _Register* __src, ::cuda::std::size_t __n, bool __parallel)
+{
+  const int __num_threads = __parallel ? __host_num_threads(__n, __host_merge_grain) : 1;
+  __host_parallel_for(__num_threads, [=](int __t) {
+    const auto __begin = __host_partition_bound(__n, __t, __num_threads, __host_register_block);
+    const auto __end   = __host_partition_bound(__n, __t + 1, __num_threads, __host_register_block);
+    __host_register_max(__dst + __begin, __src + __begin, __end - __begin);
+  });
+}
+
+//! @brief Adds the items in [__first, __first + __n) to the registers of `__ref`
+//!
+//! Every thread fills a private sketch from a contiguous part of the input. The private sketches are then reduced into
+//! the registers of `__ref` with a register-wise max, partitioning the registers among the same threads.
+//!
+//! @param __first Beginning of the sequence of items
+//! @param __n Number of items
+//! @param __ref Estimator the items are added to
+//! @param __parallel Whether multiple host threads may be used
+template <class _InputIt, class _RefType>
+_CCCL_HOST void __host_add(_InputIt __first, ::cuda::std::int64_t __n, _RefType& __ref, bool __parallel)
+{
+  using __register_type = typename _RefType::__register_type;
+
+  auto* const __sketch  = __ref.__registers();
+  const auto __num_regs = __ref.__num_registers();
+
+  // A private sketch only pays off if a thread adds considerably more items than there are registers
+  const auto __grain      = ::cuda::std::max(__host_add_grain, static_cast<::cuda::std::int64_t>(4 * __num_regs));
+  const int __num_threads = __parallel ? __host_num_threads(__n, __grain) : 1;
+  if (__num_threads == 1)
+  {
+    for (::cuda::std::int64_t __i = 0; __i < __n; ++__i)
+    {
+      __ref.__add_unsynchronized(__sketch, *(__first + __i));
+    }
+    return;
+  }
+
+  // The first thread works on the destination registers directly
+  ::std::vector<__register_type> __local_sketches(static_cast<::cuda::std::size_t>(__num_threads - 1) * __num_regs);
+  __host_parallel_for(__num_threads, [&](int __t) {
+    auto* const __regs = __t == 0 ? __sketch : __local_sketches.data() + (__t - 1) * __num_regs;
+    const auto __begin = __host_partition_bound(__n, __t, __num_threads);
+    const auto __end   = __host_partition_bound(__n, __t + 1, __num_threads);
+    for (auto __i = __begin; __i < __end; ++__i)
+    {
+      __ref.__add_unsynchronized(__regs, *(__first + __i));
+    }
+  });
+
+  __host_parallel_for(__num_threads, [&](int __t) {
+    const auto __begin = __host_partition_bound(__num_regs, __t, __num_threads, __host_register_block);
+    const auto __end   = __host_partition_bound(__num_regs, __t + 1, __num_threads, __host_register_block);
+    for (int __l = 0; __l < __num_threads - 1; ++__l)
+    {
+      __host_register_max(__sketch + __begin, __local_sketches.data() + __l * __num_regs + __begin, __end - __begin);
+    }
+  });
+}
+} // namespace cuda::experimental::cuco::__hyperloglog_ns
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDAX___CUCO___HYPERLOGLOG_HOST_KERNELS_CUH
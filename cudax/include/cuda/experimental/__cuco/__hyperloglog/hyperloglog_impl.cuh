@@ -36,10 +36,13 @@
 #include <cuda/std/__iterator/concepts.h>
 #include <cuda/std/__memory/addressof.h>
 #include <cuda/std/__memory/pointer_traits.h>
+#include <cuda/std/__type_traits/enable_if.h>
+#include <cuda/std/__type_traits/is_execution_policy.h>
 #include <cuda/std/__utility/declval.h>
 #include <cuda/std/span>
 
 #include <cuda/experimental/__cuco/__hyperloglog/finalizer.cuh>
+#include <cuda/experimental/__cuco/__hyperloglog/host_kernels.cuh>
 #include <cuda/experimental/__cuco/__hyperloglog/kernels.cuh>
 #include <cuda/experimental/__cuco/__utility/strong_type.cuh>
 #include <cuda/experimental/__cuco/hash_functions.cuh>
@@ -126,7 +129,8 @@ public:
   //!
   //! @param __group CUDA Cooperative group this operation is executed in
   template <class _CG>
-  _CCCL_DEVICE constexpr void __clear(_CG __group) noexcept
+  _CCCL_DEVICE constexpr ::cuda::std::enable_if_t<!::cuda::std::is_execution_policy_v<_CG>>
+  __clear(_CG __group) noexcept
   {
     for (int __i = __group.thread_rank(); __i < __sketch.size(); __i += __group.size())
     {
@@ -155,6 +159,20 @@ public:
     ::cuda::experimental::cuco::__hyperloglog_ns::__clear<<<1, __block_size, 0, __stream.get()>>>(*this);
   }
 
+  //! @brief Resets the estimator on the host, i.e., clears the current count estimate.
+  //!
+  //! @note The sketch storage must be host accessible.
+  //!
+  //! @tparam _Policy Host execution policy type
+  template <class _Policy>
+  _CCCL_HOST ::cuda::std::enable_if_t<::cuda::std::is_execution_policy_v<_Policy>> __clear(const _Policy&) noexcept
+  {
+    for (auto& __reg : __sketch)
+    {
+      __reg = 0;
+    }
+  }
+
   //! @brief Adds an item to the estimator.
   //!
   //! @param __item The item to be counted
@@ -326,6 +344,34 @@ public:
     __stream.sync();
   }
 
+  //! @brief Adds to be counted items to the estimator on the host.
+  //!
+  //! Parallel policies split the items among host threads which fill private sketches that are then reduced into
+  //! `*this` with a register-wise max. The resulting registers are identical to the ones computed by the device.
+  //!
+  //! @note The sketch storage must be host accessible.
+  //!
+  //! @tparam _Policy Host execution policy type
+  //! @tparam _InputIt Host accessible random access input iterator where
+  //! <tt>std::is_convertible<std::iterator_traits<_InputIt>::value_type,
+  //! _Tp></tt> is `true`
+  //!
+  //! @param __first Beginning of the sequence of items
+  //! @param __last End of the sequence of items
+  template <class _Policy, class _InputIt>
+  _CCCL_HOST ::cuda::std::enable_if_t<::cuda::std::is_execution_policy_v<_Policy>>
+  __add(const _Policy&, _InputIt __first, _InputIt __last)
+  {
+    const auto __num_items = static_cast<::cuda::std::int64_t>(::cuda::std::distance(__first, __last));
+    if (__num_items == 0)
+    {
+      return;
+    }
+
+    ::cuda::experimental::cuco::__hyperloglog_ns::__host_add(
+      __first, __num_items, *this, ::cuda::std::__is_parallel_execution_policy_v<_Policy>);
+  }
+
   //! @brief Merges the result of `other` estimator reference into `*this` estimator reference.
   //!
   //! @throw If __sketch_bytes() != other.__sketch_bytes(), then terminates execution with a device __trap()
@@ -336,7 +382,8 @@ public:
   //! @param __group CUDA Cooperative group this operation is executed in
   //! @param __other Other estimator reference to be merged into `*this`
   template <class _CG, ::cuda::thread_scope _OtherScope>
-  _CCCL_DEVICE constexpr void __merge(_CG __group, __hyperloglog_impl<_Tp, _OtherScope, _Hash>& __other)
+  _CCCL_DEVICE constexpr ::cuda::std::enable_if_t<!::cuda::std::is_execution_policy_v<_CG>>
+  __merge(_CG __group, __hyperloglog_impl<_Tp, _OtherScope, _Hash>& __other)
   {
     if (__other.__precision != __precision)
     {
@@ -390,6 +437,32 @@ public:
     __stream.sync();
   }
 
+  //! @brief Merges the result of `other` estimator reference into `*this` estimator on the host.
+  //!
+  //! @note The sketch storage of both estimators must be host accessible.
+  //!
+  //! @throw If __sketch_bytes() != __other.__sketch_bytes()
+  //!
+  //! @tparam _Policy Host execution policy type
+  //! @tparam _OtherScope Thread scope of `other` estimator
+  //!
+  //! @param __other Other estimator reference to be merged into `*this`
+  template <class _Policy, ::cuda::thread_scope _OtherScope>
+  _CCCL_HOST ::cuda::std::enable_if_t<::cuda::std::is_execution_policy_v<_Policy>>
+  __merge(const _Policy&, const __hyperloglog_impl<_Tp, _OtherScope, _Hash>& __other)
+  {
+    if (__other.__precision != __precision)
+    {
+      _CCCL_THROW(::std::invalid_argument, "Cannot merge estimators with different sketch sizes");
+    }
+
+    ::cuda::experimental::cuco::__hyperloglog_ns::__host_merge(
+      __sketch.data(),
+      __other.__sketch.data(),
+      __sketch.size(),
+      ::cuda::std::__is_parallel_execution_policy_v<_Policy>);
+  }
+
   //! @brief Compute the estimated distinct items count.
   //!
   //! @param __group CUDA thread block group this operation is executed in
@@ -461,20 +534,21 @@ public:
       __host_sketch_buf.data(), __sketch.data(), sizeof(__register_type) * __num_regs, __stream.get());
     __stream.sync();
 
-    __fp_type __sum = 0;
-    int __zeroes    = 0;
-
-    // geometric mean computation + count registers with 0s
-    for (const auto __reg : __host_sketch_buf)
-    {
-      __sum += __fp_type{1} / static_cast<__fp_type>(1ull << __reg);
-      __zeroes += __reg == 0;
-    }
-
-    const auto __finalize = ::cuda::experimental::cuco::__hyperloglog_ns::_Finalizer(__precision);
+    return __estimate_registers(__host_sketch_buf.data(), __num_regs);
+  }
 
-    // pass intermediate result to _Finalizer for bias correction, etc.
-    return __finalize(__sum, __zeroes);
+  //! @brief Compute the estimated distinct items count on the host.
+  //!
+  //! @note The sketch storage must be host accessible.
+  //!
+  //! @tparam _Policy Host execution policy type
+  //!
+  //! @return Approximate distinct items count
+  template <class _Policy>
+  [[nodiscard]] _CCCL_HOST ::cuda::std::enable_if_t<::cuda::std::is_execution_policy_v<_Policy>, ::cuda::std::size_t>
+  __estimate(const _Policy&) const
+  {
+    return __estimate_registers(__sketch.data(), __sketch.size());
   }
 
   // #endif
@@ -560,6 +634,35 @@ public:
     return alignof(__register_type);
   }
 
+  //! @brief Gets the registers of the sketch.
+  //!
+  //! @return Pointer to the first register
+  [[nodiscard]] _CCCL_API constexpr __register_type* __registers() const noexcept
+  {
+    return __sketch.data();
+  }
+
+  //! @brief Gets the number of registers of the sketch.
+  //!
+  //! @return The number of registers
+  [[nodiscard]] _CCCL_API constexpr ::cuda::std::size_t __num_registers() const noexcept
+  {
+    return __sketch.size();
+  }
+
+  //! @brief Adds an item to the given registers without synchronization.
+  //!
+  //! @param __regs Registers laid out like the sketch of `*this`
+  //! @param __item The item to be counted
+  _CCCL_API constexpr void __add_unsynchronized(__register_type* __regs, const _Tp& __item) const noexcept
+  {
+    const auto __h      = __hash(__item);
+    const auto __reg    = __h & __register_mask();
+    const auto __zeroes = ::cuda::std::countl_zero(__h | __register_mask()) + 1;
+
+    __regs[__reg] = ::cuda::std::max(__regs[__reg], static_cast<__register_type>(__zeroes));
+  }
+
 private:
   //!
   //! @brief Gets the register mask used to separate register index from count.
@@ -570,6 +673,32 @@ private:
     return (1ull << __precision) - 1;
   }
 
+  //! @brief Computes the estimate from host accessible registers.
+  //!
+  //! @param __regs Pointer to the first register
+  //! @param __num_regs Number of registers
+  //!
+  //! @return Approximate distinct items count
+  [[nodiscard]] _CCCL_HOST ::cuda::std::size_t
+  __estimate_registers(const __register_type* __regs, ::cuda::std::size_t __num_regs) const noexcept
+  {
+    __fp_type __sum = 0;
+    int __zeroes    = 0;
+
+    // geometric mean computation + count registers with 0s
+    for (::cuda::std::size_t __i = 0; __i < __num_regs; ++__i)
+    {
+      const auto __reg = __regs[__i];
+      __sum += __fp_type{1} / static_cast<__fp_type>(1ull << __reg);
+      __zeroes += __reg == 0;
+    }
+
+    const auto __finalize = ::cuda::experimental::cuco::__hyperloglog_ns::_Finalizer(__precision);
+
+    // pass intermediate result to _Finalizer for bias correction, etc.
+    return __finalize(__sum, __zeroes);
+  }
+
   //! @brief Atomically updates the register at position `i` with `max(reg[i], value)`.
   //!
   //! @param __i Register index
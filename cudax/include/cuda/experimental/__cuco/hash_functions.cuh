@@ -21,8 +21,12 @@
 #  pragma system_header
 #endif // no system header
 
+#include <cuda/std/cstdint>
+
+#include <cuda/experimental/__cuco/__hash_functions/bulk_hash.cuh>
 #include <cuda/experimental/__cuco/__hash_functions/murmurhash3.cuh>
 #include <cuda/experimental/__cuco/__hash_functions/xxhash.cuh>
+#include <cuda/experimental/__cuco/__hash_functions/xxhash3.cuh>
 
 #include <cuda/std/__cccl/prologue.h>
 
@@ -32,61 +36,103 @@ enum class hash_algorithm
 {
   xxhash_32,
   xxhash_64,
-  murmurhash3_32
+  murmurhash3_32,
+  xxhash3_64
 #if _CCCL_HAS_INT128()
   ,
   murmurhash3_x86_128,
-  murmurhash3_x64_128
+  murmurhash3_x64_128,
+  xxhash3_128
 #endif // _CCCL_HAS_INT128()
 };
 
 //! @brief A hash function class specialized for different hash algorithms.
 //!
+//! Besides hashing a single key, every specialization hashes a span of keys into a span of hash values with
+//! `hasher(keys, values)`.
+//!
 //! @tparam _Key The type of the values to hash
 //! @tparam _S The hash strategy to use, defaults to `hash_algorithm::xxhash_32`
 template <typename _Key, hash_algorithm _S = hash_algorithm::xxhash_32>
 class hash;
 
 template <typename _Key>
-class hash<_Key, hash_algorithm::xxhash_32> : private ::cuda::experimental::cuco::_XXHash_32<_Key>
+class hash<_Key, hash_algorithm::xxhash_32>
+    : private ::cuda::experimental::cuco::_XXHash_32<_Key>
+    , public _Bulk_hash<hash<_Key, hash_algorithm::xxhash_32>, _Key, ::cuda::std::uint32_t>
 {
 public:
   using ::cuda::experimental::cuco::_XXHash_32<_Key>::_XXHash_32;
   using ::cuda::experimental::cuco::_XXHash_32<_Key>::operator();
+  using ::cuda::experimental::cuco::_Bulk_hash<hash, _Key, ::cuda::std::uint32_t>::operator();
 };
 
 template <typename _Key>
-class hash<_Key, hash_algorithm::xxhash_64> : private ::cuda::experimental::cuco::_XXHash_64<_Key>
+class hash<_Key, hash_algorithm::xxhash_64>
+    : private ::cuda::experimental::cuco::_XXHash_64<_Key>
+    , public _Bulk_hash<hash<_Key, hash_algorithm::xxhash_64>, _Key, ::cuda::std::uint64_t>
 {
 public:
   using ::cuda::experimental::cuco::_XXHash_64<_Key>::_XXHash_64;
   using ::cuda::experimental::cuco::_XXHash_64<_Key>::operator();
+  using ::cuda::experimental::cuco::_Bulk_hash<hash, _Key, ::cuda::std::uint64_t>::operator();
 };
 
 template <typename _Key>
-class hash<_Key, hash_algorithm::murmurhash3_32> : private ::cuda::experimental::cuco::_MurmurHash3_32<_Key>
+class hash<_Key, hash_algorithm::murmurhash3_32>
+    : private ::cuda::experimental::cuco::_MurmurHash3_32<_Key>
+    , public _Bulk_hash<hash<_Key, hash_algorithm::murmurhash3_32>, _Key, ::cuda::std::uint32_t>
 {
 public:
   using ::cuda::experimental::cuco::_MurmurHash3_32<_Key>::_MurmurHash3_32;
   using ::cuda::experimental::cuco::_MurmurHash3_32<_Key>::operator();
+  using ::cuda::experimental::cuco::_Bulk_hash<hash, _Key, ::cuda::std::uint32_t>::operator();
+};
+
+template <typename _Key>
+class hash<_Key, hash_algorithm::xxhash3_64>
+    : private ::cuda::experimental::cuco::_XXHash3_64<_Key>
+    , public _Bulk_hash<hash<_Key, hash_algorithm::xxhash3_64>, _Key, ::cuda::std::uint64_t>
+{
+public:
+  using ::cuda::experimental::cuco::_XXHash3_64<_Key>::_XXHash3_64;
+  using ::cuda::experimental::cuco::_XXHash3_64<_Key>::operator();
+  using ::cuda::experimental::cuco::_Bulk_hash<hash, _Key, ::cuda::std::uint64_t>::operator();
 };
 
 #if _CCCL_HAS_INT128()
 
 template <typename _Key>
-class hash<_Key, hash_algorithm::murmurhash3_x86_128> : private ::cuda::experimental::cuco::_MurmurHash3_x86_128<_Key>
+class hash<_Key, hash_algorithm::murmurhash3_x86_128>
+    : private ::cuda::experimental::cuco::_MurmurHash3_x86_128<_Key>
+    , public _Bulk_hash<hash<_Key, hash_algorithm::murmurhash3_x86_128>, _Key, __uint128_t>
 {
 public:
   using ::cuda::experimental::cuco::_MurmurHash3_x86_128<_Key>::_MurmurHash3_x86_128;
   using ::cuda::experimental::cuco::_MurmurHash3_x86_128<_Key>::operator();
+  using ::cuda::experimental::cuco::_Bulk_hash<hash, _Key, __uint128_t>::operator();
 };
 
 template <typename _Key>
-class hash<_Key, hash_algorithm::murmurhash3_x64_128> : private ::cuda::experimental::cuco::_MurmurHash3_x64_128<_Key>
+class hash<_Key, hash_algorithm::murmurhash3_x64_128>
+    : private ::cuda::experimental::cuco::_MurmurHash3_x64_128<_Key>
+    , public _Bulk_hash<hash<_Key, hash_algorithm::murmurhash3_x64_128>, _Key, __uint128_t>
 {
 public:
   using ::cuda::experimental::cuco::_MurmurHash3_x64_128<_Key>::_MurmurHash3_x64_128;
   using ::cuda::experimental::cuco::_MurmurHash3_x64_128<_Key>::operator();
+  using ::cuda::experimental::cuco::_Bulk_hash<hash, _Key, __uint128_t>::operator();
+};
+
+template <typename _Key>
+class hash<_Key, hash_algorithm::xxhash3_128>
+    : private ::cuda::experimental::cuco::_XXHash3_128<_Key>
+    , public _Bulk_hash<hash<_Key, hash_algorithm::xxhash3_128>, _Key, __uint128_t>
+{
+public:
+  using ::cuda::experimental::cuco::_XXHash3_128<_Key>::_XXHash3_128;
+  using ::cuda::experimental::cuco::_XXHash3_128<_Key>::operator();
+  using ::cuda::experimental::cuco::_Bulk_hash<hash, _Key, __uint128_t>::operator();
 };
 
 #endif // _CCCL_HAS_INT128()
@@ -24,6 +24,7 @@
 #include <cuda/std/__cstddef/types.h>
 #include <cuda/std/__type_traits/enable_if.h>
 #include <cuda/std/__type_traits/is_convertible.h>
+#include <cuda/std/__type_traits/is_execution_policy.h>
 #include <cuda/std/span>
 #include <cuda/stream>
 
@@ -107,7 +108,8 @@ public:
   //!
   //! @param __group CUDA Cooperative group this operation is executed in
   template <class _CG>
-  _CCCL_DEVICE constexpr ::cuda::std::enable_if_t<!::cuda::std::is_convertible_v<_CG, ::cuda::stream_ref>>
+  _CCCL_DEVICE constexpr ::cuda::std::enable_if_t<!::cuda::std::is_convertible_v<_CG, ::cuda::stream_ref>
+                                                  && !::cuda::std::is_execution_policy_v<_CG>>
   clear(_CG __group) noexcept
   {
     // The enable_if above is to work around an incompatibility between host and device
@@ -161,6 +163,20 @@ public:
     __impl.__clear(__stream);
   }
 
+  //! @brief Resets the estimator on the host, i.e., clears the current count estimate.
+  //!
+  //! @note The sketch storage must be host accessible.
+  //!
+  //! @tparam _Policy Host execution policy type, e.g. `cuda::std::execution::par`
+  //!
+  //! @param __policy Execution policy this operation is executed with
+  template <class _Policy>
+  _CCCL_HOST ::cuda::std::enable_if_t<::cuda::std::is_execution_policy_v<_Policy>>
+  clear(const _Policy& __policy) noexcept
+  {
+    __impl.__clear(__policy);
+  }
+
   //! @brief Adds an item to the estimator.
   //!
   //! @param __item The item to be counted
@@ -204,6 +220,28 @@ public:
     __impl.__add(__first, __last, __stream);
   }
 
+  //! @brief Adds to be counted items to the estimator on the host.
+  //!
+  //! The registers are updated exactly like on the device, so the sketch can be exchanged with device estimators
+  //! byte-for-byte. Parallel policies distribute the items among host threads.
+  //!
+  //! @note The sketch storage must be host accessible.
+  //!
+  //! @tparam _Policy Host execution policy type, e.g. `cuda::std::execution::par`
+  //! @tparam _InputIt Host accessible random access input iterator where
+  //! <tt>std::is_convertible<std::iterator_traits<_InputIt>::value_type,
+  //! _Tp></tt> is `true`
+  //!
+  //! @param __policy Execution policy this operation is executed with
+  //! @param __first Beginning of the sequence of items
+  //! @param __last End of the sequence of items
+  template <class _Policy, class _InputIt>
+  _CCCL_HOST ::cuda::std::enable_if_t<::cuda::std::is_execution_policy_v<_Policy>>
+  add(const _Policy& __policy, _InputIt __first, _InputIt __last)
+  {
+    __impl.__add(__policy, __first, __last);
+  }
+
   //! @brief Merges the result of `other` estimator reference into `*this` estimator reference.
   //!
   //! @throw If sketch_bytes() != __other.sketch_bytes(), then terminates execution with a device __trap()
@@ -214,7 +252,8 @@ public:
   //! @param __group CUDA Cooperative group this operation is executed in
   //! @param __other Other estimator reference to be merged into `*this`
   template <class _CG, ::cuda::thread_scope _OtherScope>
-  _CCCL_DEVICE constexpr void merge(_CG __group, const hyperloglog_ref<_Tp, _OtherScope, _Hash>& __other)
+  _CCCL_DEVICE constexpr ::cuda::std::enable_if_t<!::cuda::std::is_execution_policy_v<_CG>>
+  merge(_CG __group, const hyperloglog_ref<_Tp, _OtherScope, _Hash>& __other)
   {
     __impl.__merge(__group, __other.__impl);
   }
@@ -254,6 +293,24 @@ public:
     __impl.__merge(__other.__impl, __stream);
   }
 
+  //! @brief Merges the result of `other` estimator reference into `*this` estimator on the host.
+  //!
+  //! @note The sketch storage of both estimators must be host accessible.
+  //!
+  //! @throw If sketch_bytes() != __other.sketch_bytes()
+  //!
+  //! @tparam _Policy Host execution policy type, e.g. `cuda::std::execution::par`
+  //! @tparam _OtherScope Thread scope of `other` estimator
+  //!
+  //! @param __policy Execution policy this operation is executed with
+  //! @param __other Other estimator reference to be merged into `*this`
+  template <class _Policy, ::cuda::thread_scope _OtherScope>
+  _CCCL_HOST ::cuda::std::enable_if_t<::cuda::std::is_execution_policy_v<_Policy>>
+  merge(const _Policy& __policy, const hyperloglog_ref<_Tp, _OtherScope, _Hash>& __other)
+  {
+    __impl.__merge(__policy, __other.__impl);
+  }
+
   //! @brief Compute the estimated distinct items count.
   //!
   //! @param __group CUDA thread block group this operation is executed in
@@ -277,12 +334,30 @@ public:
   //!
   //! @return Approximate distinct items count
   template <typename _HostMemoryResource = ::cuda::mr::legacy_pinned_memory_resource>
-  [[nodiscard]] _CCCL_HOST constexpr ::cuda::std::size_t estimate(
-    _HostMemoryResource __host_mr = {}, ::cuda::stream_ref __stream = ::cuda::stream_ref{cudaStream_t{nullptr}}) const
+  [[nodiscard]] _CCCL_HOST constexpr ::cuda::std::
+    enable_if_t<!::cuda::std::is_execution_policy_v<_HostMemoryResource>, ::cuda::std::size_t>
+    estimate(_HostMemoryResource __host_mr = {},
+             ::cuda::stream_ref __stream   = ::cuda::stream_ref{cudaStream_t{nullptr}}) const
   {
     return __impl.__estimate(__host_mr, __stream);
   }
 
+  //! @brief Compute the estimated distinct items count on the host.
+  //!
+  //! @note The sketch storage must be host accessible.
+  //!
+  //! @tparam _Policy Host execution policy type, e.g. `cuda::std::execution::par`
+  //!
+  //! @param __policy Execution policy this operation is executed with
+  //!
+  //! @return Approximate distinct items count
+  template <class _Policy>
+  [[nodiscard]] _CCCL_HOST ::cuda::std::enable_if_t<::cuda::std::is_execution_policy_v<_Policy>, ::cuda::std::size_t>
+  estimate(const _Policy& __policy) const
+  {
+    return __impl.__estimate(__policy);
+  }
+
   //! @brief Gets the hash function.
   //!
   //! @return The hash function
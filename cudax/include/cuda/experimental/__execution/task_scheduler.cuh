@@ -190,6 +190,11 @@ private:
   template <class>
   friend struct __detail::__task_bulk_sender;
   friend struct __detail::__task_sender;
+  friend struct thread_pool;
+
+  _CCCL_API explicit task_scheduler(__detail::__backend_ptr_t __backend) noexcept
+      : __backend_(_CCCL_MOVE(__backend))
+  {}
 
   __detail::__backend_ptr_t __backend_;
 };
@@ -279,16 +284,20 @@ struct __task_bulk_receiver
       using __values_t = ::cuda::std::__decayed_tuple<_As...>;
       __state_->__values_.template __emplace<__values_t>(static_cast<_As&&>(__as)...);
 
-      // Start the bulk operation.
+      // Start the bulk operation. Without a parallel policy, execute runs the whole shape
+      // at once, so the backend must be asked for a single item only.
+      constexpr bool __parallelize =
+        ::cuda::std::is_same_v<_Policy, ::cuda::std::execution::parallel_policy>
+        || ::cuda::std::is_same_v<_Policy, ::cuda::std::execution::parallel_unsequenced_policy>;
+      const size_t __size = __parallelize ? __state_->__shape_ : size_t(1);
+
       if constexpr (__same_as<_BulkTag, bulk_chunked_t>)
       {
-        __state_->__backend_->schedule_bulk_chunked(
-          __state_->__shape_, *__state_, ::cuda::std::span{__state_->__storage_});
+        __state_->__backend_->schedule_bulk_chunked(__size, *__state_, ::cuda::std::span{__state_->__storage_});
       }
       else
       {
-        __state_->__backend_->schedule_bulk_unchunked(
-          __state_->__shape_, *__state_, ::cuda::std::span{__state_->__storage_});
+        __state_->__backend_->schedule_bulk_unchunked(__size, *__state_, ::cuda::std::span{__state_->__storage_});
       }
     }
     _CCCL_CATCH_ALL
@@ -0,0 +1,727 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef __CUDAX_EXECUTION_THREAD_POOL
+#define __CUDAX_EXECUTION_THREAD_POOL
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/__cmath/ceil_div.h>
+#include <cuda/__utility/immovable.h>
+#include <cuda/std/__algorithm/max.h>
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/__exception/terminate.h>
+#include <cuda/std/atomic>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstdint>
+#include <cuda/std/span>
+
+#include <cuda/experimental/__execution/intrusive_queue.cuh>
+#include <cuda/experimental/__execution/parallel_scheduler_backend.cuh>
+#include <cuda/experimental/__execution/task_scheduler.cuh>
+
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <vector>
+
+#include <cuda/experimental/__execution/prologue.cuh>
+
+namespace cuda::experimental::execution
+{
+namespace __detail
+{
+struct __pool_worker;
+
+//! @brief A unit of work executed by a worker of a thread_pool.
+struct _CCCL_TYPE_VISIBILITY_DEFAULT __pool_task : __immovable
+{
+  using __execute_fn_t _CCCL_NODEBUG_ALIAS = void(__pool_task*, __pool_worker&) noexcept;
+
+  _CCCL_HIDE_FROM_ABI __pool_task() = default;
+  _CCCL_HOST_API explicit __pool_task(__execute_fn_t* __execute_fn) noexcept
+      : __execute_fn_(__execute_fn)
+  {}
+
+  _CCCL_HOST_API void __execute(__pool_worker& __worker) noexcept
+  {
+    (*__execute_fn_)(this, __worker);
+  }
+
+  __execute_fn_t* __execute_fn_ = nullptr;
+  __pool_task* __next_          = nullptr;
+};
+
+//! @brief The Chase-Lev work-stealing deque, with the memory orderings from "Correct and
+//! Efficient Work-Stealing for Weak Memory Models" (Lê et al., PPoPP 2013).
+//!
+//! The owning worker pushes and pops at the bottom in LIFO order, and every other worker
+//! may steal from the top. Outgrown rings are kept alive until the deque is destroyed
+//! because a concurrent thief may still be reading from them.
+class _CCCL_TYPE_VISIBILITY_DEFAULT __work_stealing_deque : __immovable
+{
+  struct __ring
+  {
+    _CCCL_HOST_API explicit __ring(::cuda::std::ptrdiff_t __capacity)
+        : __mask_(__capacity - 1)
+        , __slots_(new ::cuda::std::atomic<__pool_task*>[static_cast<size_t>(__capacity)])
+    {}
+
+    [[nodiscard]] _CCCL_HOST_API auto __capacity() const noexcept -> ::cuda::std::ptrdiff_t
+    {
+      return __mask_ + 1;
+    }
+
+    [[nodiscard]] _CCCL_HOST_API auto __load(::cuda::std::ptrdiff_t __index) const noexcept -> __pool_task*
+    {
+      return __slots_[__index & __mask_].load(::cuda::std::memory_order_relaxed);
+    }
+
+    _CCCL_HOST_API void __store(::cuda::std::ptrdiff_t __index, __pool_task* __task) noexcept
+    {
+      __slots_[__index & __mask_].store(__task, ::cuda::std::memory_order_relaxed);
+    }
+
+    ::cuda::std::ptrdiff_t __mask_;
+    ::std::unique_ptr<::cuda::std::atomic<__pool_task*>[]> __slots_;
+  };
+
+public:
+  static constexpr ::cuda::std::ptrdiff_t __initial_capacity = 256;
+
+  _CCCL_HOST_API __work_stealing_deque()
+  {
+    __rings_.push_back(::std::make_unique<__ring>(__initial_capacity));
+    __ring_.store(__rings_.back().get(), ::cuda::std::memory_order_relaxed);
+  }
+
+  //! Pushes a task at the bottom of the deque. May only be called by the owner. Returns
+  //! false if the deque is full and could not be grown.
+  [[nodiscard]] _CCCL_HOST_API auto __push(__pool_task* __task) noexcept -> bool
+  {
+    const ::cuda::std::ptrdiff_t __bottom = __bottom_.load(::cuda::std::memory_order_relaxed);
+    const ::cuda::std::ptrdiff_t __top    = __top_.load(::cuda::std::memory_order_acquire);
+    __ring* __r                           = __ring_.load(::cuda::std::memory_order_relaxed);
+
+    if (__bottom - __top >= __r->__capacity())
+    {
+      __r = __grow(__r, __top, __bottom);
+      if (__r == nullptr)
+      {
+        return false;
+      }
+    }
+
+    __r->__store(__bottom, __task);
+    __bottom_.store(__bottom + 1, ::cuda::std::memory_order_release);
+    return true;
+  }
+
+  //! Pops the most recently pushed task. May only be called by the owner.
+  [[nodiscard]] _CCCL_HOST_API auto __pop() noexcept -> __pool_task*
+  {
+    const ::cuda::std::ptrdiff_t __bottom = __bottom_.load(::cuda::std::memory_order_relaxed) - 1;
+    __ring* __r                           = __ring_.load(::cuda::std::memory_order_relaxed);
+    __bottom_.store(__bottom, ::cuda::std::memory_order_relaxed);
+    ::cuda::std::atomic_thread_fence(::cuda::std::memory_order_seq_cst);
+    ::cuda::std::ptrdiff_t __top = __top_.load(::cuda::std::memory_order_relaxed);
+
+    if (__top > __bottom)
+    {
+      // The deque was already empty.
+      __bottom_.store(__bottom + 1, ::cuda::std::memory_order_relaxed);
+      return nullptr;
+    }
+
+    __pool_task* __task = __r->__load(__bottom);
+    if (__top == __bottom)
+    {
+      // This is the last task, so race the thieves for it.
+      if (!__top_.compare_exchange_strong(
+            __top, __top + 1, ::cuda::std::memory_order_seq_cst, ::cuda::std::memory_order_relaxed))
+      {
+        __task = nullptr;
+      }
+      __bottom_.store(__bottom + 1, ::cuda::std::memory_order_relaxed);
+    }
+    return __task;
+  }
+
+  //! Steals the least recently pushed task. Returns nullptr if the deque is empty or if
+  //! another thread took the task first.
+  [[nodiscard]] _CCCL_HOST_API auto __steal() noexcept -> __pool_task*
+  {
+    ::cuda::std::ptrdiff_t __top = __top_.load(::cuda::std::memory_order_acquire);
+    ::cuda::std::atomic_thread_fence(::cuda::std::memory_order_seq_cst);
+    const ::cuda::std::ptrdiff_t __bottom = __bottom_.load(::cuda::std::memory_order_acquire);
+
+    if (__top >= __bottom)
+    {
+      return nullptr;
+    }
+
+    __pool_task* __task = __ring_.load(::cuda::std::memory_order_acquire)->__load(__top);
+    if (!__top_.compare_exchange_strong(
+          __top, __top + 1, ::cuda::std::memory_order_seq_cst, ::cuda::std::memory_order_relaxed))
+    {
+      return nullptr;
+    }
+    return __task;
+  }
+
+  //! Returns true if the deque looks empty. Only exact when called by the owner.
+  [[nodiscard]] _CCCL_HOST_API auto __empty() const noexcept -> bool
+  {
+    return __bottom_.load(::cuda::std::memory_order_relaxed) <= __top_.load(::cuda::std::memory_order_relaxed);
+  }
+
+private:
+  _CCCL_HOST_API auto __grow(__ring* __old, ::cuda::std::ptrdiff_t __top, ::cuda::std::ptrdiff_t __bottom) noexcept
+    -> __ring*
+  {
+    _CCCL_TRY
+    {
+      __rings_.reserve(__rings_.size() + 1);
+      auto __new = ::std::make_unique<__ring>(2 * __old->__capacity());
+      for (::cuda::std::ptrdiff_t __i = __top; __i != __bottom; ++__i)
+      {
+        __new->__store(__i, __old->__load(__i));
+      }
+      __rings_.push_back(::cuda::std::move(__new));
+      __ring_.store(__rings_.back().get(), ::cuda::std::memory_order_release);
+      return __rings_.back().get();
+    }
+    _CCCL_CATCH_ALL
+    {
+      return nullptr;
+    }
+  }
+
+  alignas(64)::cuda::std::atomic<::cuda::std::ptrdiff_t> __top_{0};
+  alignas(64)::cuda::std::atomic<::cuda::std::ptrdiff_t> __bottom_{0};
+  ::cuda::std::atomic<__ring*> __ring_{nullptr};
+  ::std::vector<::std::unique_ptr<__ring>> __rings_;
+};
+
+class __thread_pool_backend;
+
+struct alignas(64) __pool_worker : __immovable
+{
+  // xorshift64; only used to pick victims, so the quality requirements are modest.
+  [[nodiscard]] _CCCL_HOST_API auto __next_random() noexcept -> ::cuda::std::uint64_t
+  {
+    __rng_ ^= __rng_ << 13;
+    __rng_ ^= __rng_ >> 7;
+    __rng_ ^= __rng_ << 17;
+    return __rng_;
+  }
+
+  __work_stealing_deque __deque_;
+  __thread_pool_backend* __pool_ = nullptr;
+  size_t __index_                = 0;
+  ::cuda::std::uint64_t __rng_   = 0;
+};
+
+//! @brief A parallel_scheduler_backend that runs work on a fixed set of worker threads.
+//!
+//! Every worker owns a work-stealing deque. Tasks started from a worker are pushed onto
+//! its own deque and popped in LIFO order, which keeps the data they touch warm in that
+//! worker's cache; tasks started from any other thread go through a shared queue. A
+//! worker that runs out of work steals from the top of the deque of a randomly chosen
+//! victim, and goes to sleep once it can find nothing to steal.
+//!
+//! Bulk operations use lazy binary splitting: a worker that executes a range of the
+//! shape splits off the upper half for thieves whenever its own deque is empty, and
+//! otherwise works through the range one grain at a time. The range is therefore only
+//! divided as far as there are idle workers to take the pieces.
+class _CCCL_TYPE_VISIBILITY_DEFAULT __thread_pool_backend : public __task_scheduler_backend
+{
+  // Ranges of a bulk operation are divided at most into this many grains per worker.
+  static constexpr size_t __grains_per_worker = 8;
+
+  // Number of rounds a worker looks for work before it goes to sleep.
+  static constexpr int __spin_rounds = 16;
+
+  struct __schedule_task : __pool_task
+  {
+    _CCCL_HOST_API explicit __schedule_task(receiver_proxy& __rcvr, bool __in_situ) noexcept
+        : __pool_task{&__execute_impl}
+        , __rcvr_(&__rcvr)
+        , __in_situ_(__in_situ)
+    {}
+
+    _CCCL_HOST_API static void __execute_impl(__pool_task* __p, __pool_worker&) noexcept
+    {
+      auto* __self           = static_cast<__schedule_task*>(__p);
+      receiver_proxy& __rcvr = *__self->__rcvr_;
+
+      if (__self->__in_situ_)
+      {
+        __self->~__schedule_task();
+      }
+      else
+      {
+        delete __self;
+      }
+
+      if (__rcvr.get_env().query(get_stop_token_t{}).stop_requested())
+      {
+        __rcvr.set_stopped();
+      }
+      else
+      {
+        __rcvr.set_value();
+      }
+    }
+
+    receiver_proxy* __rcvr_;
+    bool __in_situ_;
+  };
+
+  struct __bulk_state;
+
+  struct __bulk_task : __pool_task
+  {
+    _CCCL_HIDE_FROM_ABI __bulk_task() = default;
+
+    _CCCL_HOST_API static void __execute_impl(__pool_task* __p, __pool_worker& __worker) noexcept
+    {
+      auto* __self          = static_cast<__bulk_task*>(__p);
+      __bulk_state& __state = *__self->__state_;
+      size_t __begin        = __self->__begin_;
+      size_t __end          = __self->__end_;
+      size_t __done         = 0;
+
+      const bool __stopped = __state.__stop_requested();
+
+      while (__begin != __end)
+      {
+        // Only split while this worker's deque is empty: a non-empty deque means that no
+        // thief has come for the previous piece yet, so there is no one to give a new one
+        // to.
+        if (!__stopped && __end - __begin > __state.__grain_ && __worker.__deque_.__empty())
+        {
+          const size_t __mid = __begin + (__end - __begin) / 2;
+          if (__bulk_task* __task = __state.__new_task(__mid, __end))
+          {
+            __state.__pool_->__submit(__task);
+            __end = __mid;
+            continue;
+          }
+        }
+
+        const size_t __last = __begin + (::cuda::std::min) (__state.__grain_, __end - __begin);
+        if (!__stopped)
+        {
+          __state.__execute(__begin, __last);
+        }
+        __done += __last - __begin;
+        __begin = __last;
+      }
+
+      __state.__complete(__done);
+    }
+
+    __bulk_state* __state_ = nullptr;
+    size_t __begin_        = 0;
+    size_t __end_          = 0;
+  };
+
+  //! The state shared by all tasks of a bulk operation. The tasks are preallocated: every
+  //! task keeps at least half a grain of its range for itself, so there can never be
+  //! more than one task per half grain.
+  struct __bulk_state
+  {
+    _CCCL_HOST_API explicit __bulk_state(
+      __thread_pool_backend* __pool, bulk_item_receiver_proxy& __rcvr, size_t __shape, size_t __grain, bool __chunked)
+        : __pool_(__pool)
+        , __rcvr_(&__rcvr)
+        , __grain_(__grain)
+        , __max_tasks_(__shape / ((__grain + 1) / 2) + 1)
+        , __chunked_(__chunked)
+        , __remaining_(__shape)
+        , __tasks_(new __bulk_task[__max_tasks_])
+    {}
+
+    [[nodiscard]] _CCCL_HOST_API auto __new_task(size_t __begin, size_t __end) noexcept -> __bulk_task*
+    {
+      const size_t __index = __next_task_.fetch_add(1, ::cuda::std::memory_order_relaxed);
+      if (__index >= __max_tasks_)
+      {
+        return nullptr;
+      }
+
+      __bulk_task& __task  = __tasks_[__index];
+      __task.__execute_fn_ = &__bulk_task::__execute_impl;
+      __task.__state_      = this;
+      __task.__begin_      = __begin;
+      __task.__end_        = __end;
+      return &__task;
+    }
+
+    [[nodiscard]] _CCCL_HOST_API auto __stop_requested() noexcept -> bool
+    {
+      if (__rcvr_->get_env().query(get_stop_token_t{}).stop_requested())
+      {
+        __stopped_.store(true, ::cuda::std::memory_order_relaxed);
+        return true;
+      }
+      return false;
+    }
+
+    _CCCL_HOST_API void __execute(size_t __begin, size_t __end) noexcept
+    {
+      if (__chunked_)
+      {
+        __rcvr_->execute(__begin, __end);
+      }
+      else
+      {
+        for (; __begin != __end; ++__begin)
+        {
+          __rcvr_->execute(__begin, __begin + 1);
+        }
+      }
+    }
+
+    //! Records that `__count` more elements of the shape have been processed. The task
+    //! that processes the last of them completes the bulk operation.
+    _CCCL_HOST_API void __complete(size_t __count) noexcept
+    {
+      if (__remaining_.fetch_sub(__count, ::cuda::std::memory_order_acq_rel) == __count)
+      {
+        bulk_item_receiver_proxy& __rcvr = *__rcvr_;
+        const bool __stopped             = __stopped_.load(::cuda::std::memory_order_relaxed);
+        delete this;
+
+        if (__stopped)
+        {
+          __rcvr.set_stopped();
+        }
+        else
+        {
+          __rcvr.set_value();
+        }
+      }
+    }
+
+    __thread_pool_backend* __pool_;
+    bulk_item_receiver_proxy* __rcvr_;
+    size_t __grain_;
+    size_t __max_tasks_;
+    bool __chunked_;
+    ::cuda::std::atomic<bool> __stopped_{false};
+    ::cuda::std::atomic<size_t> __remaining_;
+    ::cuda::std::atomic<size_t> __next_task_{0};
+    ::std::unique_ptr<__bulk_task[]> __tasks_;
+  };
+
+public:
+  _CCCL_HOST_API explicit __thread_pool_backend(size_t __num_threads)
+      : __num_threads_((::cuda::std::max) (__num_threads, size_t{1}))
+      , __workers_(new __pool_worker[__num_threads_])
+  {
+    __threads_.reserve(__num_threads_);
+    for (size_t __i = 0; __i < __num_threads_; ++__i)
+    {
+      __pool_worker& __worker = __workers_[__i];
+      __worker.__pool_        = this;
+      __worker.__index_       = __i;
+      // any nonzero seed will do:
+      __worker.__rng_ = 0x9e3779b97f4a7c15ull * (__i + 1);
+    }
+
+    _CCCL_TRY
+    {
+      for (size_t __i = 0; __i < __num_threads_; ++__i)
+      {
+        __threads_.emplace_back([this, __i] {
+          __run(__workers_[__i]);
+        });
+      }
+    }
+    _CCCL_CATCH_ALL
+    {
+      __stop();
+      _CCCL_RETHROW;
+    }
+  }
+
+  _CCCL_HOST_API ~__thread_pool_backend() override
+  {
+    __stop();
+  }
+
+  //! Lets the workers finish the work that has been started and joins them.
+  _CCCL_HOST_API void __stop() noexcept
+  {
+    ::std::lock_guard<::std::mutex> __guard{__join_mutex_};
+
+    __stop_requested_.store(true, ::cuda::std::memory_order_seq_cst);
+    __epoch_.fetch_add(1, ::cuda::std::memory_order_seq_cst);
+    __epoch_.notify_all();
+
+    for (auto& __thrd : __threads_)
+    {
+      if (__thrd.joinable())
+      {
+        __thrd.join();
+      }
+    }
+  }
+
+  [[nodiscard]] _CCCL_HOST_API auto __size() const noexcept -> size_t
+  {
+    return __num_threads_;
+  }
+
+  _CCCL_API void schedule(receiver_proxy& __rcvr_proxy,
+                          ::cuda::std::span<::cuda::std::byte> __storage) noexcept final override
+  {
+    NV_IF_TARGET(NV_IS_HOST, (__host_schedule(__rcvr_proxy, __storage);), (::cuda::std::terminate();))
+  }
+
+  _CCCL_API void schedule_bulk_chunked(size_t __size,
+                                       bulk_item_receiver_proxy& __rcvr_proxy,
+                                       ::cuda::std::span<::cuda::std::byte>) noexcept final override
+  {
+    NV_IF_TARGET(NV_IS_HOST, (__host_schedule_bulk(__size, __rcvr_proxy, true);), (::cuda::std::terminate();))
+  }
+
+  _CCCL_API void schedule_bulk_unchunked(size_t __size,
+                                         bulk_item_receiver_proxy& __rcvr_proxy,
+                                         ::cuda::std::span<::cuda::std::byte>) noexcept final override
+  {
+    NV_IF_TARGET(NV_IS_HOST, (__host_schedule_bulk(__size, __rcvr_proxy, false);), (::cuda::std::terminate();))
+  }
+
+  [[nodiscard]]
+  _CCCL_API auto query(get_forward_progress_guarantee_t) const noexcept -> forward_progress_guarantee final override
+  {
+    return forward_progress_guarantee::parallel;
+  }
+
+  [[nodiscard]]
+  _CCCL_API bool __equal_to(const void*, ::cuda::std::__type_info_ref) final override
+  {
+    // A thread pool is only reachable through task_schedulers, which compare equal when
+    // they share a backend.
+    return false;
+  }
+
+private:
+  // The worker of this pool that the current thread runs, if any.
+  static inline thread_local __pool_worker* __current_worker_ = nullptr;
+
+  _CCCL_HOST_API void __host_schedule(receiver_proxy& __rcvr_proxy, ::cuda::std::span<::cuda::std::byte> __storage)
+  {
+    const bool __in_situ = __storage.size() >= sizeof(__schedule_task)
+                        && reinterpret_cast<::cuda::std::uintptr_t>(__storage.data()) % alignof(__schedule_task) == 0;
+
+    _CCCL_TRY
+    {
+      __submit(__in_situ ? ::new (__storage.data()) __schedule_task{__rcvr_proxy, true}
+                         : new __schedule_task{__rcvr_proxy, false});
+    }
+    _CCCL_CATCH_ALL
+    {
+      __rcvr_proxy.set_error(execution::current_exception());
+    }
+  }
+
+  _CCCL_HOST_API void __host_schedule_bulk(size_t __shape, bulk_item_receiver_proxy& __rcvr_proxy, bool __chunked)
+  {
+    const size_t __grain = (::cuda::std::max) (::cuda::ceil_div(__shape, __grains_per_worker * __num_threads_), size_t{1});
+
+    _CCCL_TRY
+    {
+      auto* __state = new __bulk_state{this, __rcvr_proxy, __shape, __grain, __chunked};
+      __submit(__state->__new_task(0, __shape));
+    }
+    _CCCL_CATCH_ALL
+    {
+      __rcvr_proxy.set_error(execution::current_exception());
+    }
+  }
+
+  _CCCL_HOST_API void __submit(__pool_task* __task) noexcept
+  {
+    __pool_worker* __worker = __current_worker_;
+
+    if (__worker == nullptr || __worker->__pool_ != this || !__worker->__deque_.__push(__task))
+    {
+      ::std::lock_guard<::std::mutex> __guard{__queue_mutex_};
+      __queue_.push_back(__task);
+      __queue_size_.fetch_add(1, ::cuda::std::memory_order_relaxed);
+    }
+
+    // Pairs with the fence in __run: either the sleeping worker sees the new task when it
+    // looks for work one last time, or we see that it is about to sleep and wake it up.
+    ::cuda::std::atomic_thread_fence(::cuda::std::memory_order_seq_cst);
+    if (__sleepers_.load(::cuda::std::memory_order_relaxed) != 0)
+    {
+      __epoch_.fetch_add(1, ::cuda::std::memory_order_release);
+      __epoch_.notify_one();
+    }
+  }
+
+  [[nodiscard]] _CCCL_HOST_API auto __find_task(__pool_worker& __worker) noexcept -> __pool_task*
+  {
+    if (__pool_task* __task = __worker.__deque_.__pop())
+    {
+      return __task;
+    }
+
+    if (__queue_size_.load(::cuda::std::memory_order_relaxed) != 0)
+    {
+      ::std::lock_guard<::std::mutex> __guard{__queue_mutex_};
+      if (!__queue_.empty())
+      {
+        __queue_size_.fetch_sub(1, ::cuda::std::memory_order_relaxed);
+        return __queue_.pop_front();
+      }
+    }
+
+    // Try to steal from randomly chosen victims.
+    for (size_t __attempt = 0; __num_threads_ > 1 && __attempt < 2 * __num_threads_; ++__attempt)
+    {
+      const size_t __victim = static_cast<size_t>(__worker.__next_random() % __num_threads_);
+      if (__victim != __worker.__index_)
+      {
+        if (__pool_task* __task = __workers_[__victim].__deque_.__steal())
+        {
+          return __task;
+        }
+      }
+    }
+
+    return nullptr;
+  }
+
+  _CCCL_HOST_API void __run(__pool_worker& __worker) noexcept
+  {
+    __current_worker_ = &__worker;
+
+    while (true)
+    {
+      __pool_task* __task = nullptr;
+      for (int __round = 0; __task == nullptr && __round < __spin_rounds; ++__round)
+      {
+        __task = __find_task(__worker);
+        if (__task == nullptr)
+        {
+          ::std::this_thread::yield();
+        }
+      }
+
+      if (__task == nullptr)
+      {
+        // Announce that we are going to sleep, then look for work one last time.
+        const ::cuda::std::uint32_t __epoch = __epoch_.load(::cuda::std::memory_order_acquire);
+        __sleepers_.fetch_add(1, ::cuda::std::memory_order_relaxed);
+        ::cuda::std::atomic_thread_fence(::cuda::std::memory_order_seq_cst);
+
+        __task = __find_task(__worker);
+        if (__task == nullptr)
+        {
+          if (__stop_requested_.load(::cuda::std::memory_order_acquire))
+          {
+            __sleepers_.fetch_sub(1, ::cuda::std::memory_order_relaxed);
+            break;
+          }
+          __epoch_.wait(__epoch, ::cuda::std::memory_order_acquire);
+        }
+        __sleepers_.fetch_sub(1, ::cuda::std::memory_order_relaxed);
+      }
+
+      if (__task != nullptr)
+      {
+        __task->__execute(__worker);
+      }
+    }
+
+    __current_worker_ = nullptr;
+  }
+
+  size_t __num_threads_;
+  ::std::unique_ptr<__pool_worker[]> __workers_;
+  ::std::vector<::std::thread> __threads_;
+  ::std::mutex __join_mutex_;
+  ::std::mutex __queue_mutex_;
+  __intrusive_queue<&__pool_task::__next_> __queue_;
+  ::cuda::std::atomic<size_t> __queue_size_{0};
+  ::cuda::std::atomic<::cuda::std::uint32_t> __epoch_{0};
+  ::cuda::std::atomic<::cuda::std::uint32_t> __sleepers_{0};
+  ::cuda::std::atomic<bool> __stop_requested_{false};
+};
+} // namespace __detail
+
+//! @brief A pool of worker threads that schedules work with work stealing.
+//!
+//! The scheduler of a `thread_pool` is a @c task_scheduler, so `bulk`, `bulk_chunked`
+//! and `bulk_unchunked` operations that complete on it are dispatched to the pool and
+//! divided among its workers.
+//!
+//! @code
+//! thread_pool pool;
+//! auto sndr = starts_on(pool.get_scheduler(), just()) | bulk(par, n, fn);
+//! sync_wait(std::move(sndr));
+//! @endcode
+struct _CCCL_TYPE_VISIBILITY_DEFAULT thread_pool
+{
+  _CCCL_HOST_API thread_pool()
+      : thread_pool(::std::thread::hardware_concurrency())
+  {}
+
+  _CCCL_HOST_API explicit thread_pool(size_t __num_threads)
+      : __backend_(experimental::__make_shared<__detail::__thread_pool_backend>(__num_threads))
+  {}
+
+  thread_pool(thread_pool&&) = delete;
+
+  _CCCL_HOST_API ~thread_pool() noexcept
+  {
+    join();
+  }
+
+  //! Waits for all started work to complete and joins the worker threads. Work must not
+  //! be started on the pool afterwards.
+  _CCCL_HOST_API void join() noexcept
+  {
+    __backend_->__stop();
+  }
+
+  [[nodiscard]] _CCCL_HOST_API auto get_scheduler() const noexcept -> task_scheduler
+  {
+    return task_scheduler{__backend_};
+  }
+
+  [[nodiscard]] _CCCL_HOST_API auto size() const noexcept -> size_t
+  {
+    return __backend_->__size();
+  }
+
+private:
+  __shared_ptr<__detail::__thread_pool_backend> __backend_;
+};
+} // namespace cuda::experimental::execution
+
+#include <cuda/experimental/__execution/epilogue.cuh>
+
+#endif // __CUDAX_EXECUTION_THREAD_POOL
@@ -25,12 +25,16 @@
 #  pragma system_header
 #endif // no system header
 
+#include <cuda/std/__bit/countr.h>
+
 #include <cuda/experimental/__stf/allocators/block_allocator.cuh>
 #include <cuda/experimental/__stf/internal/async_prereq.cuh>
 #include <cuda/experimental/__stf/internal/backend_ctx.cuh>
 #include <cuda/experimental/__stf/internal/stf_places_extended_exports.cuh>
 #include <cuda/experimental/__stf/utility/pretty_print.cuh>
 
+#include <unordered_map>
+
 namespace cuda::experimental::stf
 {
 namespace reserved
@@ -60,6 +64,82 @@ private:
     event_list prereqs; // dependencies to use that block
   };
 
+  /**
+   * @brief Available blocks of one level
+   *
+   * Blocks are stored in a vector indexed by a hash map from their location to their position in the vector, so that
+   * inserting a block, taking any block, and taking the block at a given location are all done in constant time.
+   */
+  class free_list
+  {
+  public:
+    bool empty() const
+    {
+      return blocks.empty();
+    }
+
+    void push(size_t index, event_list prereqs)
+    {
+      _CCCL_ASSERT(positions.count(index) == 0, "Block is already free");
+      positions.emplace(index, blocks.size());
+      blocks.emplace_back(index, mv(prereqs));
+    }
+
+    // Removes the most recently freed block
+    avail_block pop()
+    {
+      _CCCL_ASSERT(!empty(), "No block to pop");
+      avail_block b = mv(blocks.back());
+      blocks.pop_back();
+      positions.erase(b.index);
+      return b;
+    }
+
+    // Removes the block at location `index` if it is available, and merges its dependencies into `prereqs`
+    bool extract(size_t index, event_list& prereqs)
+    {
+      auto it = positions.find(index);
+      if (it == positions.end())
+      {
+        return false;
+      }
+
+      const size_t pos = it->second;
+      positions.erase(it);
+      prereqs.merge(mv(blocks[pos].prereqs));
+
+      // Fill the hole with the last block
+      if (pos + 1 != blocks.size())
+      {
+        blocks[pos]                  = mv(blocks.back());
+        positions[blocks[pos].index] = pos;
+      }
+      blocks.pop_back();
+      return true;
+    }
+
+    auto begin()
+    {
+      return blocks.begin();
+    }
+    auto end()
+    {
+      return blocks.end();
+    }
+    auto begin() const
+    {
+      return blocks.begin();
+    }
+    auto end() const
+    {
+      return blocks.end();
+    }
+
+  private:
+    ::std::vector<avail_block> blocks;
+    ::std::unordered_map<size_t, size_t> positions; // block location -> position in blocks
+  };
+
 public:
   buddy_allocator_metadata(size_t size, event_list init_prereqs)
       : free_lists_(int_log2(next_power_of_two(size)) + 1)
@@ -67,7 +147,7 @@ public:
     _CCCL_ASSERT(size && (size & (size - 1)) == 0,
                  "Allocation requests for this allocator must pass a size that is a power of two.");
     // Initially, the whole memory is free, but depends on init_prereqs
-    free_lists_.back().emplace_back(0, mv(init_prereqs));
+    push_block(free_lists_.size() - 1, 0, mv(init_prereqs));
   }
 
   ::std::ptrdiff_t allocate(size_t size, event_list& prereqs)
@@ -102,25 +182,21 @@ public:
     while (level < max_level)
     {
       const size_t buddy_index = get_buddy_index(index, level);
-      auto& buddy_list         = free_lists_[level];
-      auto it = ::std::find_if(buddy_list.begin(), buddy_list.end(), [buddy_index](const avail_block& block) {
-        return block.index == buddy_index;
-      });
-
-      if (it == buddy_list.end())
+      if (!free_lists_[level].extract(buddy_index, block_prereqs))
       {
         // No buddy available to merge, stop here
         break;
       }
-      // Merge with buddy
-      block_prereqs.merge(it->prereqs);
+      if (free_lists_[level].empty())
+      {
+        non_empty_levels_ &= ~(size_t(1) << level);
+      }
 
-      buddy_list.erase(it);
       index = ::std::min(index, ::std::ptrdiff_t(buddy_index));
       level++;
     }
 
-    free_lists_[level].emplace_back(index, prereqs);
+    push_block(level, index, mv(block_prereqs));
   }
 
   void deinit(event_list& prereqs)
@@ -185,34 +261,40 @@ private:
     return log;
   }
 
+  void push_block(size_t level, size_t index, event_list prereqs)
+  {
+    free_lists_[level].push(index, mv(prereqs));
+    non_empty_levels_ |= size_t(1) << level;
+  }
+
   ::std::ptrdiff_t find_free_block(size_t level, event_list& prereqs)
   {
-    for (size_t current_level : each(level, free_lists_.size()))
+    // Smallest level at least as large as the requested one which has an available block
+    const size_t candidates = non_empty_levels_ >> level;
+    if (candidates == 0)
     {
-      if (free_lists_[current_level].empty())
-      {
-        continue;
-      }
-      auto& b              = free_lists_[current_level].back();
-      size_t block_index   = b.index;
-      event_list b_prereqs = mv(b.prereqs);
-      free_lists_[current_level].pop_back();
-
-      // Dependencies to reuse that block
-      prereqs.merge(b_prereqs);
+      return -1; // No block available
+    }
+    size_t current_level = level + ::cuda::std::countr_zero(candidates);
 
-      // If we are not at the requested level, split blocks
-      while (current_level > level)
-      {
-        current_level--;
-        size_t buddy_index = block_index + (1ull << current_level);
-        // split blocks depend on the previous dependencies of the whole unsplit block
-        free_lists_[current_level].emplace_back(buddy_index, b_prereqs);
-      }
-      return block_index;
+    avail_block b = free_lists_[current_level].pop();
+    if (free_lists_[current_level].empty())
+    {
+      non_empty_levels_ &= ~(size_t(1) << current_level);
     }
 
-    return -1; // No block available
+    // Dependencies to reuse that block
+    prereqs.merge(b.prereqs);
+
+    // If we are not at the requested level, split blocks
+    while (current_level > level)
+    {
+      current_level--;
+      size_t buddy_index = b.index + (1ull << current_level);
+      // split blocks depend on the previous dependencies of the whole unsplit block
+      push_block(current_level, buddy_index, b.prereqs);
+    }
+    return b.index;
   }
 
   size_t get_buddy_index(size_t index, size_t level)
@@ -221,7 +303,10 @@ private:
     return index ^ (1ull << level); // XOR to find the buddy block
   }
 
-  ::std::vector<::std::vector<avail_block>> free_lists_;
+  ::std::vector<free_list> free_lists_;
+
+  // Bit `l` is set if and only if free_lists_[l] is not empty
+  size_t non_empty_levels_ = 0;
 };
 } // end namespace reserved
 
@@ -363,5 +448,39 @@ UNITTEST("buddy allocator meta data")
   // allocator.debug_print();
 };
 
+UNITTEST("buddy allocator meta data with many small blocks")
+{
+  const size_t size       = 1024 * 1024;
+  const size_t block_size = 64;
+  reserved::buddy_allocator_metadata allocator(size, event_list());
+
+  event_list dummy;
+
+  // Fill the whole buffer with small blocks, which must not overlap
+  ::std::vector<::std::ptrdiff_t> offsets;
+  for (size_t i = 0; i < size / block_size; i++)
+  {
+    offsets.push_back(allocator.allocate(block_size, dummy));
+    EXPECT(offsets.back() != -1);
+    EXPECT(offsets.back() % block_size == 0);
+  }
+  ::std::vector<::std::ptrdiff_t> sorted_offsets(offsets);
+  ::std::sort(sorted_offsets.begin(), sorted_offsets.end());
+  EXPECT(::std::adjacent_find(sorted_offsets.begin(), sorted_offsets.end()) == sorted_offsets.end());
+
+  // Free every other block first so that buddies are not freed in order
+  for (size_t i = 0; i < offsets.size(); i += 2)
+  {
+    allocator.deallocate(offsets[i], block_size, dummy);
+  }
+  for (size_t i = 1; i < offsets.size(); i += 2)
+  {
+    allocator.deallocate(offsets[i], block_size, dummy);
+  }
+
+  // All buddies were merged back into a single block
+  EXPECT(allocator.allocate(size, dummy) == 0);
+};
+
 #endif // UNITTESTED_FILE
 } // end namespace cuda::experimental::stf
@@ -9,10 +9,12 @@
 //===----------------------------------------------------------------------===//
 
 #include <thrust/device_vector.h>
+#include <thrust/host_vector.h>
 #include <thrust/sequence.h>
 
 #include <cuda/functional>
 #include <cuda/std/cstddef>
+#include <cuda/std/execution>
 #include <cuda/std/span>
 
 #include <cuda/experimental/__cuco/hash_functions.cuh>
@@ -143,6 +145,61 @@ C2H_TEST("HyperLogLog unique sequence", "[hyperloglog]", test_types)
   REQUIRE(relative_error < tolerance_factor * relative_standard_deviation);
 }
 
+C2H_TEST("HyperLogLog host execution", "[hyperloglog]", test_types)
+{
+  using T              = c2h::get<0, TestType>;
+  using estimator_type = cudax::cuco::hyperloglog<T>;
+  using ref_type       = typename estimator_type::template ref_type<>;
+  using register_type  = typename ref_type::register_type;
+
+  const std::size_t num_items = GENERATE(0, 1000, 1 << 22);
+  const int hll_precision     = GENERATE(4, 10, 18);
+  const typename estimator_type::precision precision(hll_precision);
+
+  CAPTURE(num_items, hll_precision);
+
+  thrust::host_vector<T> host_items(num_items);
+  thrust::sequence(host_items.begin(), host_items.end(), T{0});
+  const thrust::device_vector<T> device_items = host_items;
+
+  estimator_type estimator{precision};
+  estimator.add(device_items.begin(), device_items.end());
+
+  const auto sketch_bytes = estimator_type::sketch_bytes(precision);
+  thrust::host_vector<register_type> device_sketch(sketch_bytes / sizeof(register_type));
+  REQUIRE(cudaMemcpy(device_sketch.data(), estimator.sketch().data(), sketch_bytes, cudaMemcpyDeviceToHost)
+          == cudaSuccess);
+
+  thrust::host_vector<register_type> seq_sketch(device_sketch.size());
+  thrust::host_vector<register_type> par_sketch(device_sketch.size());
+  ref_type seq_ref{cuda::std::as_writable_bytes(cuda::std::span{seq_sketch.data(), seq_sketch.size()})};
+  ref_type par_ref{cuda::std::as_writable_bytes(cuda::std::span{par_sketch.data(), par_sketch.size()})};
+  seq_ref.clear(cuda::std::execution::seq);
+  par_ref.clear(cuda::std::execution::par);
+
+  // The host sketches are interchangeable with the device one
+  seq_ref.add(cuda::std::execution::seq, host_items.begin(), host_items.end());
+  par_ref.add(cuda::std::execution::par, host_items.data(), host_items.data() + num_items);
+  REQUIRE(seq_sketch == device_sketch);
+  REQUIRE(par_sketch == device_sketch);
+  REQUIRE(par_ref.estimate(cuda::std::execution::par) == estimator.estimate());
+
+  // Merging two halves yields the sketch of the whole sequence
+  const auto half = host_items.begin() + num_items / 2;
+  seq_ref.clear(cuda::std::execution::seq);
+  par_ref.clear(cuda::std::execution::seq);
+  seq_ref.add(cuda::std::execution::seq, host_items.begin(), half);
+  par_ref.add(cuda::std::execution::par, half, host_items.end());
+  par_ref.merge(cuda::std::execution::par, seq_ref);
+  REQUIRE(par_sketch == device_sketch);
+
+  // Host sketches can be copied to device estimators
+  REQUIRE(cudaMemcpy(estimator.sketch().data(), seq_sketch.data(), sketch_bytes, cudaMemcpyHostToDevice)
+          == cudaSuccess);
+  estimator.add(device_items.begin() + num_items / 2, device_items.end());
+  REQUIRE(estimator.estimate() == par_ref.estimate(cuda::std::execution::seq));
+}
+
 //! @brief The following unit tests mimic Spark's unit tests which can be found here:
 //! https://github.com/apache/spark/blob/d10dbaa31a44878df5c7e144f111e18261346531/sql/catalyst/src/test/scala/org/apache/spark/sql/catalyst/expressions/aggregate/HyperLogLogPlusPlusSuite.scala
 //!
@@ -51,6 +51,16 @@ struct hash_test
 
     CUDAX_REQUIRE(hasher(key) == expected);
     CUDAX_REQUIRE(hasher(cuda::std::span<Key>(thrust::raw_pointer_cast(arr_keys.data()), arr_keys.size())) == expected);
+
+    // Five keys cover both the interleaved part and the remainder of the bulk hash
+    cuda::std::array<Key, 5> bulk_keys = {key, key, key, key, key};
+    cuda::std::array<decltype(hasher(key)), 5> bulk_values{};
+    hasher(cuda::std::span<const Key>(bulk_keys.data(), bulk_keys.size()),
+           cuda::std::span<decltype(hasher(key))>(bulk_values.data(), bulk_values.size()));
+    for (auto const& value : bulk_values)
+    {
+      CUDAX_REQUIRE(value == expected);
+    }
   }
 };
 
@@ -102,6 +112,34 @@ struct test_xxhash64
   }
 };
 
+struct test_xxhash3_64
+{
+  hash_test<cudax::cuco::hash_algorithm::xxhash3_64> xxhash3_64_test;
+
+  _CCCL_HOST_DEVICE void operator()()
+  {
+    xxhash3_64_test(static_cast<char>(0), 14144645293874801883ull, 0);
+    xxhash3_64_test(static_cast<char>(42), 8777568547874204941ull, 0);
+    xxhash3_64_test(static_cast<char>(0), 6697150685477982789ull, 42);
+    xxhash3_64_test(static_cast<int32_t>(0), 5238470482016868669ull, 0);
+    xxhash3_64_test(static_cast<int32_t>(0), 14325386350854113765ull, 42);
+    xxhash3_64_test(static_cast<int32_t>(42), 2392174772787195229ull, 0);
+    xxhash3_64_test(static_cast<int32_t>(123456789), 5186869424260940993ull, 0);
+    xxhash3_64_test(static_cast<int64_t>(0), 14374147212387527897ull, 0);
+    xxhash3_64_test(static_cast<int64_t>(0), 5014318936221084462ull, 42);
+    xxhash3_64_test(static_cast<int64_t>(42), 15395265915043915720ull, 0);
+    xxhash3_64_test(static_cast<int64_t>(123456789), 2817400364357085909ull, 0);
+#if _CCCL_HAS_INT128()
+    xxhash3_64_test(static_cast<__int128_t>(123456789), 7602280935813847626ull, 0);
+#endif
+    xxhash3_64_test(large_key<8>(123456789), 6765752575053277420ull, 0);
+    xxhash3_64_test(large_key<32>(123456789), 9278458725499332637ull, 0);
+    xxhash3_64_test(large_key<48>(123456789), 18175377766974340274ull, 0);
+    xxhash3_64_test(large_key<128>(123456789), 5959042809843730309ull, 0);
+    xxhash3_64_test(large_key<128>(123456789), 17764345745688658488ull, 42);
+  }
+};
+
 struct test_murmurhash3_32
 {
   hash_test<cudax::cuco::hash_algorithm::murmurhash3_32> murmurhash3_32_test;
@@ -202,6 +240,37 @@ struct test_murmurhash3_x64_128
                              1024);
   }
 };
+
+struct test_xxhash3_128
+{
+  hash_test<cudax::cuco::hash_algorithm::xxhash3_128> xxhash3_128_test;
+
+  _CCCL_HOST_DEVICE __uint128_t conv(cuda::std::array<uint64_t, 2> const& arr) const
+  {
+    return cuda::std::bit_cast<__uint128_t>(arr);
+  }
+
+  _CCCL_HOST_DEVICE void operator()()
+  {
+    xxhash3_128_test(static_cast<char>(0), conv({14144645293874801883ull, 12019366968424402794ull}), 0);
+    xxhash3_128_test(static_cast<char>(42), conv({8777568547874204941ull, 1497920308546659268ull}), 0);
+    xxhash3_128_test(static_cast<char>(0), conv({6697150685477982789ull, 16862835990649298218ull}), 42);
+    xxhash3_128_test(static_cast<int32_t>(0), conv({15845180571247577957ull, 3040916486473433971ull}), 0);
+    xxhash3_128_test(static_cast<int32_t>(0), conv({10984597573276123308ull, 16532782743564947617ull}), 42);
+    xxhash3_128_test(static_cast<int32_t>(42), conv({1932769535858151055ull, 11116380877631057972ull}), 0);
+    xxhash3_128_test(static_cast<int32_t>(123456789), conv({12236985229114957765ull, 16708601316877094708ull}), 0);
+    xxhash3_128_test(static_cast<int64_t>(0), conv({5027060195534464434ull, 3173501280862895444ull}), 0);
+    xxhash3_128_test(static_cast<int64_t>(0), conv({15439181912508745583ull, 3241074915469697710ull}), 42);
+    xxhash3_128_test(static_cast<int64_t>(42), conv({7044217293765171781ull, 11217127669921611398ull}), 0);
+    xxhash3_128_test(static_cast<int64_t>(123456789), conv({5686821628512271274ull, 3113600892957498625ull}), 0);
+    xxhash3_128_test(static_cast<__int128_t>(123456789), conv({11659008988222534993ull, 4643130342062838206ull}), 0);
+    xxhash3_128_test(large_key<8>(123456789), conv({3401536157071583852ull, 12824725418982162394ull}), 0);
+    xxhash3_128_test(large_key<32>(123456789), conv({4197492376924200295ull, 11724804271630678269ull}), 0);
+    xxhash3_128_test(large_key<48>(123456789), conv({11558519142019828001ull, 18421782807902670675ull}), 0);
+    xxhash3_128_test(large_key<128>(123456789), conv({5959042809843730309ull, 2978484844484552168ull}), 0);
+    xxhash3_128_test(large_key<128>(123456789), conv({17764345745688658488ull, 10063299726465922610ull}), 42);
+  }
+};
 #endif // _CCCL_HAS_INT128()
 
 template <typename TestFn>
@@ -224,9 +293,11 @@ TEST_CASE("Test Hasher's on host and device", "")
     test_xxhash32{}();
     test_xxhash64{}();
     test_murmurhash3_32{}();
+    test_xxhash3_64{}();
 #if _CCCL_HAS_INT128()
     test_murmurhash3_x86_128{}();
     test_murmurhash3_x64_128{}();
+    test_xxhash3_128{}();
 #endif // _CCCL_HAS_INT128()
   }
 
@@ -235,9 +306,11 @@ TEST_CASE("Test Hasher's on host and device", "")
     test_hasher_on_device(test_xxhash32{});
     test_hasher_on_device(test_xxhash64{});
     test_hasher_on_device(test_murmurhash3_32{});
+    test_hasher_on_device(test_xxhash3_64{});
 #if _CCCL_HAS_INT128()
     test_hasher_on_device(test_murmurhash3_x86_128{});
     test_hasher_on_device(test_murmurhash3_x64_128{});
+    test_hasher_on_device(test_xxhash3_128{});
 #endif // _CCCL_HAS_INT128()
   }
 }
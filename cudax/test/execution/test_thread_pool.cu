@@ -0,0 +1,104 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/experimental/execution.cuh>
+
+#include <atomic>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "common/utility.cuh" // IWYU pragma: keep
+
+namespace ex = cuda::experimental::execution;
+
+namespace
+{
+C2H_TEST("thread_pool schedules work on its workers", "[scheduler][thread_pool]")
+{
+  ex::thread_pool pool{4};
+  CHECK(pool.size() == 4);
+
+  auto sched = pool.get_scheduler();
+  STATIC_CHECK(ex::scheduler<decltype(sched)>);
+  CHECK(ex::get_forward_progress_guarantee(sched) == ex::forward_progress_guarantee::parallel);
+
+  auto sndr  = ex::starts_on(sched, ex::just() | ex::then([] {
+                                     return ::std::this_thread::get_id();
+                                   }));
+  auto [tid] = ex::sync_wait(cuda::std::move(sndr)).value();
+  CHECK(tid != ::std::this_thread::get_id());
+}
+
+C2H_TEST("thread_pool runs every index of a bulk operation exactly once", "[scheduler][thread_pool]")
+{
+  ex::thread_pool pool{4};
+  auto sched = pool.get_scheduler();
+
+  for (int n : {0, 1, 7, 1000, 100003})
+  {
+    ::std::vector<::std::atomic<int>> counts(n);
+    auto sndr = ex::on(sched, ex::just(42) | ex::bulk(ex::par, n, [&counts](int i, int val) {
+                                counts[i] += val;
+                              }));
+    auto [val] = ex::sync_wait(cuda::std::move(sndr)).value();
+    CHECK(val == 42);
+
+    for (auto& count : counts)
+    {
+      CHECK(count == 42);
+    }
+  }
+}
+
+C2H_TEST("thread_pool divides bulk_chunked operations into disjoint chunks", "[scheduler][thread_pool]")
+{
+  ex::thread_pool pool{4};
+  auto sched = pool.get_scheduler();
+
+  constexpr int n = 1 << 16;
+  ::std::vector<int> counts(n);
+  ::std::mutex mtx;
+  ::std::set<::std::thread::id> threads;
+
+  auto sndr = ex::on(sched, ex::just() | ex::bulk_chunked(ex::par, n, [&](int begin, int end) {
+                              for (int i = begin; i < end; ++i)
+                              {
+                                ++counts[i];
+                              }
+                              ::std::lock_guard<::std::mutex> guard{mtx};
+                              threads.insert(::std::this_thread::get_id());
+                            }));
+  ex::sync_wait(cuda::std::move(sndr));
+
+  for (int count : counts)
+  {
+    CHECK(count == 1);
+  }
+  CHECK(threads.size() >= 1);
+  CHECK(threads.size() <= 4);
+}
+
+C2H_TEST("thread_pool runs sequenced bulk operations in one piece", "[scheduler][thread_pool]")
+{
+  ex::thread_pool pool{4};
+  auto sched = pool.get_scheduler();
+
+  int calls = 0;
+  auto sndr = ex::on(sched, ex::just() | ex::bulk_chunked(ex::seq, 1000, [&](int begin, int end) {
+                              CHECK(begin == 0);
+                              CHECK(end == 1000);
+                              ++calls;
+                            }));
+  ex::sync_wait(cuda::std::move(sndr));
+  CHECK(calls == 1);
+}
+} // namespace
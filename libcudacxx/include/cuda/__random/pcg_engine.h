@@ -29,7 +29,9 @@
 #include <cuda/std/__type_traits/integral_constant.h>
 #include <cuda/std/__utility/pair.h>
 #include <cuda/std/array>
+#include <cuda/std/cstddef>
 #include <cuda/std/cstdint>
+#include <cuda/std/span>
 
 #include <cuda/std/__cccl/prologue.h>
 
@@ -197,7 +199,7 @@ private:
     return ::cuda::std::rotr(result_type(__internal), __rot);
   }
 
-  [[nodiscard]] _CCCL_API constexpr ::cuda::std::pair<__pcg64_uint128_t, __pcg64_uint128_t>
+  [[nodiscard]] _CCCL_API static constexpr ::cuda::std::pair<__pcg64_uint128_t, __pcg64_uint128_t>
   __power_mod(__pcg64_uint128_t __delta) noexcept
   {
     __pcg64_uint128_t __acc_mult = 1;
@@ -290,6 +292,58 @@ public:
     return __output_transform(__x_);
   }
 
+  //! @brief Fill a range with pseudo-random values.
+  //!
+  //! Produces the same values as consecutive calls to operator(). The LCG is split into several interleaved
+  //! sequences, each of which jumps ahead by the number of sequences, so that the multiplications of neighboring
+  //! values are independent of each other instead of forming a single dependency chain.
+  //! @param __out The range to fill.
+  template <::cuda::std::size_t _Extent>
+  _CCCL_API constexpr void generate(::cuda::std::span<result_type, _Extent> __out) noexcept
+  {
+    constexpr ::cuda::std::size_t __lanes = 4;
+    constexpr auto __jump                 = __power_mod(__lanes);
+
+    result_type* __first    = __out.data();
+    ::cuda::std::size_t __n = __out.size();
+    if (__n >= __lanes)
+    {
+      // The loops over the lanes are unrolled so that the states stay in registers
+      __pcg64_uint128_t __states[__lanes] = {__x_ * __multiplier + __increment};
+      _CCCL_PRAGMA_UNROLL(4)
+      for (::cuda::std::size_t __l = 1; __l < __lanes; ++__l)
+      {
+        __states[__l] = __states[__l - 1] * __multiplier + __increment;
+      }
+
+      while (true)
+      {
+        _CCCL_PRAGMA_UNROLL(4)
+        for (::cuda::std::size_t __l = 0; __l < __lanes; ++__l)
+        {
+          __first[__l] = __output_transform(__states[__l]);
+        }
+        __first += __lanes;
+        __n -= __lanes;
+        if (__n < __lanes)
+        {
+          break;
+        }
+        _CCCL_PRAGMA_UNROLL(4)
+        for (::cuda::std::size_t __l = 0; __l < __lanes; ++__l)
+        {
+          __states[__l] = __states[__l] * __jump.first + __jump.second;
+        }
+      }
+      __x_ = __states[__lanes - 1];
+    }
+
+    for (; __n > 0; --__n)
+    {
+      *__first++ = (*this)();
+    }
+  }
+
   //! @brief Advance the engine state by `__z` steps, discarding outputs.
   //! @param __z Number of values to discard.
   _CCCL_API constexpr void discard(unsigned long long __z) noexcept
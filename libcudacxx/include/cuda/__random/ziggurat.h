@@ -0,0 +1,206 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA___RANDOM_ZIGGURAT_H
+#define _CUDA___RANDOM_ZIGGURAT_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/__random/ziggurat_tables.h>
+#include <cuda/std/__bit/integral.h>
+#include <cuda/std/__cmath/exponential_functions.h>
+#include <cuda/std/__cmath/logarithms.h>
+#include <cuda/std/__limits/numeric_limits.h>
+#include <cuda/std/__random/uniform_int_distribution.h>
+#include <cuda/std/__type_traits/conditional.h>
+#include <cuda/std/__type_traits/is_same.h>
+#include <cuda/std/cstdint>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA
+
+//! @brief Returns uniformly distributed bits filling all of @c _UInt
+//!
+//! Generators whose range is a power of two are used directly, combining two results if a single one has too few bits.
+//! Other generators go through uniform_int_distribution.
+template <class _UInt, class _URng>
+[[nodiscard]] _CCCL_API constexpr _UInt __ziggurat_random_bits(_URng& __g)
+{
+  constexpr auto __range    = static_cast<::cuda::std::uint64_t>(_URng::max() - _URng::min());
+  constexpr bool __is_pow2  = _URng::min() == 0 && (__range & (__range + 1)) == 0;
+  constexpr int __urng_bits = ::cuda::std::bit_width(__range);
+  constexpr int __uint_bits = ::cuda::std::numeric_limits<_UInt>::digits;
+
+  if constexpr (__is_pow2 && __urng_bits >= __uint_bits)
+  {
+    return static_cast<_UInt>(__g());
+  }
+  else if constexpr (__is_pow2 && 2 * __urng_bits >= __uint_bits)
+  {
+    const auto __hi = static_cast<_UInt>(__g());
+    const auto __lo = static_cast<_UInt>(__g());
+    return static_cast<_UInt>(__hi << __urng_bits) | __lo;
+  }
+  else
+  {
+    return ::cuda::std::uniform_int_distribution<_UInt>{}(__g);
+  }
+}
+
+//! @brief The floating-point type the Ziggurat of @c _RealType is evaluated in
+template <class _RealType>
+using __ziggurat_float_t = ::cuda::std::conditional_t<sizeof(_RealType) <= sizeof(float), float, double>;
+
+template <class _Float>
+using __ziggurat_uint_t =
+  ::cuda::std::conditional_t<::cuda::std::is_same_v<_Float, float>, ::cuda::std::uint32_t, ::cuda::std::uint64_t>;
+
+//! @brief Returns a uniformly distributed value in [0, 1)
+template <class _Float, class _URng>
+[[nodiscard]] _CCCL_API _Float __ziggurat_uniform(_URng& __g)
+{
+  using _UInt                = __ziggurat_uint_t<_Float>;
+  constexpr int __mant_bits  = ::cuda::std::numeric_limits<_Float>::digits;
+  constexpr int __drop_bits  = ::cuda::std::numeric_limits<_UInt>::digits - __mant_bits;
+  constexpr _Float __epsilon = _Float{1} / static_cast<_Float>(_UInt{1} << __mant_bits);
+  return static_cast<_Float>(::cuda::__ziggurat_random_bits<_UInt>(__g) >> __drop_bits) * __epsilon;
+}
+
+template <class _Float>
+[[nodiscard]] _CCCL_API constexpr const auto& __ziggurat_normal_table() noexcept
+{
+  if constexpr (::cuda::std::is_same_v<_Float, float>)
+  {
+    return __ziggurat_normal_table_f32;
+  }
+  else
+  {
+    return __ziggurat_normal_table_f64;
+  }
+}
+
+template <class _Float>
+[[nodiscard]] _CCCL_API constexpr const auto& __ziggurat_exponential_table() noexcept
+{
+  if constexpr (::cuda::std::is_same_v<_Float, float>)
+  {
+    return __ziggurat_exponential_table_f32;
+  }
+  else
+  {
+    return __ziggurat_exponential_table_f64;
+  }
+}
+
+//! @brief Draws a sample of the standard normal distribution with the Ziggurat method of Marsaglia and Tsang
+//!
+//! Every attempt consumes one random integer: 8 bits select the layer, one bit the sign and the remaining bits the
+//! abscissa. About 99% of the attempts are accepted after a single comparison against the table.
+template <class _Float, class _URng>
+[[nodiscard]] _CCCL_API _Float __ziggurat_standard_normal(_URng& __g)
+{
+  using _UInt               = __ziggurat_uint_t<_Float>;
+  constexpr int __mant_bits = ::cuda::std::is_same_v<_Float, float> ? 23 : 52; // The bits the table was computed for
+  constexpr _UInt __mask    = (_UInt{1} << __mant_bits) - 1;
+  const auto& __table       = ::cuda::__ziggurat_normal_table<_Float>();
+
+  while (true)
+  {
+    const _UInt __bits    = ::cuda::__ziggurat_random_bits<_UInt>(__g);
+    const int __layer     = static_cast<int>(__bits & 0xff);
+    const bool __negative = ((__bits >> 8) & 1) != 0;
+    const _UInt __u       = (__bits >> 9) & __mask;
+    const _Float __x      = static_cast<_Float>(__u) * __table.__w_[__layer];
+
+    if (__u < __table.__k_[__layer])
+    {
+      return __negative ? -__x : __x;
+    }
+
+    if (__layer == 0)
+    {
+      // The tail beyond r is sampled with the method of Marsaglia, the uniform values are in [0, 1) so log1p(-u) is
+      // finite
+      constexpr auto __r     = static_cast<_Float>(__ziggurat_normal_r);
+      constexpr auto __inv_r = static_cast<_Float>(1.0 / __ziggurat_normal_r);
+      while (true)
+      {
+        const _Float __xx = -__inv_r * ::cuda::std::log1p(-::cuda::__ziggurat_uniform<_Float>(__g));
+        const _Float __yy = -::cuda::std::log1p(-::cuda::__ziggurat_uniform<_Float>(__g));
+        if (__yy + __yy > __xx * __xx)
+        {
+          return __negative ? -(__r + __xx) : __r + __xx;
+        }
+      }
+    }
+
+    // The abscissa lies between the density at the edges of the layer, compare against the density itself
+    const _Float __y = (__table.__f_[__layer - 1] - __table.__f_[__layer]) * ::cuda::__ziggurat_uniform<_Float>(__g)
+                     + __table.__f_[__layer];
+    if (__y < ::cuda::std::exp(_Float{-0.5} * __x * __x))
+    {
+      return __negative ? -__x : __x;
+    }
+  }
+}
+
+//! @brief Draws a sample of the standard exponential distribution with the Ziggurat method of Marsaglia and Tsang
+//!
+//! Every attempt consumes one random integer: 8 bits select the layer and the remaining bits the abscissa.
+template <class _Float, class _URng>
+[[nodiscard]] _CCCL_API _Float __ziggurat_standard_exponential(_URng& __g)
+{
+  using _UInt               = __ziggurat_uint_t<_Float>;
+  constexpr int __mant_bits = ::cuda::std::is_same_v<_Float, float> ? 23 : 53; // The bits the table was computed for
+  constexpr _UInt __mask    = (_UInt{1} << __mant_bits) - 1;
+  const auto& __table       = ::cuda::__ziggurat_exponential_table<_Float>();
+
+  while (true)
+  {
+    const _UInt __bits = ::cuda::__ziggurat_random_bits<_UInt>(__g);
+    const int __layer  = static_cast<int>(__bits & 0xff);
+    const _UInt __u    = (__bits >> 8) & __mask;
+    const _Float __x   = static_cast<_Float>(__u) * __table.__w_[__layer];
+
+    if (__u < __table.__k_[__layer])
+    {
+      return __x;
+    }
+
+    if (__layer == 0)
+    {
+      // The exponential distribution is memoryless, so the tail is a shifted exponential distribution
+      return static_cast<_Float>(__ziggurat_exponential_r)
+           - ::cuda::std::log1p(-::cuda::__ziggurat_uniform<_Float>(__g));
+    }
+
+    const _Float __y = (__table.__f_[__layer - 1] - __table.__f_[__layer]) * ::cuda::__ziggurat_uniform<_Float>(__g)
+                     + __table.__f_[__layer];
+    if (__y < ::cuda::std::exp(-__x))
+    {
+      return __x;
+    }
+  }
+}
+
+_CCCL_END_NAMESPACE_CUDA
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA___RANDOM_ZIGGURAT_H
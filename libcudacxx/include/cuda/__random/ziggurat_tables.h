@@ -0,0 +1,623 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA___RANDOM_ZIGGURAT_TABLES_H
+#define _CUDA___RANDOM_ZIGGURAT_TABLES_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/cstdint>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA
+
+//! @brief The number of layers of the Ziggurat
+inline constexpr int __ziggurat_num_layers = 256;
+
+//! @brief The rightmost edge of the base layer of the normal Ziggurat, samples beyond it are drawn from the tail
+inline constexpr double __ziggurat_normal_r = 3.6541528853610087963519472518;
+
+//! @brief The rightmost edge of the base layer of the exponential Ziggurat
+inline constexpr double __ziggurat_exponential_r = 7.6971174701310497140446280481;
+
+//! @brief The layers of a Ziggurat of 256 layers of equal area, as computed by Marsaglia and Tsang
+//!
+//! Layer @c i covers @c [0, x_i) horizontally, where @c x_0 is the width of the rectangle that has the area of the base
+//! layer including the tail. A random integer @c u of @c _UInt maps to the abscissa @c u * __w_[i]. The abscissa lies
+//! inside the density if @c u < __k_[i], and @c __f_[i] is the density at the edge @c x_i of the layer.
+template <class _UInt, class _Float>
+struct __ziggurat_table
+{
+  _UInt __k_[__ziggurat_num_layers];
+  _Float __w_[__ziggurat_num_layers];
+  _Float __f_[__ziggurat_num_layers];
+};
+
+// The tables for double use 52 (normal) and 53 (exponential) bit integers, the tables for float use 23 bit integers.
+// The densities are exp(-x * x / 2) and exp(-x), without normalization.
+
+_CCCL_GLOBAL_CONSTANT __ziggurat_table<::cuda::std::uint64_t, double> __ziggurat_normal_table_f64 = {
+  {
+    0x000ef33d8025ef64, 0x0000000000000000, 0x000c08be98fbc6b4, 0x000da354fabd8145, 0x000e51f67ec1eeeb,
+    0x000eb255e9d3f77e, 0x000eef4b817ecab8, 0x000f19470afa44ab, 0x000f37ed61ffcb17, 0x000f4f469561255b,
+    0x000f61a5e41ba396, 0x000f707a755396a4, 0x000f7cb2ec28449b, 0x000f86f10c6357d2, 0x000f8fa6578325dd,
+    0x000f9724c74dd0d9, 0x000f9da907dbf508, 0x000fa360f581fa72, 0x000fa86fde5b4bf8, 0x000facf160d354db,
+    0x000fb0fb6718b90e, 0x000fb49f8d5374c5, 0x000fb7ec2366fe77, 0x000fbaece9a1e50c, 0x000fbdab9d040bed,
+    0x000fc03060ff6c57, 0x000fc2821037a248, 0x000fc4a67ae25bd1, 0x000fc6a2977aee30, 0x000fc87aa92896a4,
+    0x000fca325e4bde85, 0x000fcbcce902231a, 0x000fcd4d12f839c4, 0x000fceb54d8fec98, 0x000fd007bf1dc930,
+    0x000fd1464dd6c4e5, 0x000fd272a8e2f450, 0x000fd38e4ff0c91e, 0x000fd49a9990b479, 0x000fd598b8920f52,
+    0x000fd689c08e99ec, 0x000fd76ea9c8e832, 0x000fd848547b08e8, 0x000fd9178bad2c8b, 0x000fd9dd07a7add2,
+    0x000fda9970105e8b, 0x000fdb4d5dc02e1f, 0x000fdbf95c5bfcd0, 0x000fdc9debb99a7d, 0x000fdd3b8118729d,
+    0x000fddd288342f8f, 0x000fde6364369f63, 0x000fdeee708d514e, 0x000fdf7401a6b42e, 0x000fdff46599ed3e,
+    0x000fe06fe4bc24f1, 0x000fe0e6c225a258, 0x000fe1593c28b84b, 0x000fe1c78cbc3f98, 0x000fe231e9db1ca9,
+    0x000fe29885da1b91, 0x000fe2fb8fb54186, 0x000fe35b33558d4a, 0x000fe3b799d0002a, 0x000fe410e99ead7e,
+    0x000fe46746d47734, 0x000fe4bad34c095b, 0x000fe50baed29524, 0x000fe559f74ebc77, 0x000fe5a5c8e41212,
+    0x000fe5ef3e138689, 0x000fe6366fd91077, 0x000fe67b75c6d578, 0x000fe6be661e11aa, 0x000fe6ff55e5f4f2,
+    0x000fe73e5900a701, 0x000fe77b823e9e39, 0x000fe7b6e37070a1, 0x000fe7f08d774242, 0x000fe8289053f08c,
+    0x000fe85efb35173b, 0x000fe893dc840864, 0x000fe8c741f0cebc, 0x000fe8f9387d4ef6, 0x000fe929cc879b1c,
+    0x000fe95909d388ea, 0x000fe986fb939aa1, 0x000fe9b3ac714865, 0x000fe9df2694b6d5, 0x000fea0973abe67b,
+    0x000fea329cf166a4, 0x000fea5aab32952c, 0x000fea81a6d57419, 0x000feaa797de1cef, 0x000feacc85f3d91f,
+    0x000feaf07865e63c, 0x000feb13762fec12, 0x000feb3585fe2a4a, 0x000feb56ae3162b4, 0x000feb76f4e284f9,
+    0x000feb965fe62013, 0x000febb4f4cf9d7c, 0x000febd2b8f449cf, 0x000febefb16e2e3d, 0x000fec0be31ebde8,
+    0x000fec2752b15a14, 0x000fec42049dafd3, 0x000fec5bfd29f196, 0x000fec75406ceef4, 0x000fec8dd2500cb4,
+    0x000feca5b6911f10, 0x000fecbcf0c427fe, 0x000fecd38454fb15, 0x000fece97488c8b3, 0x000fecfec47f91b7,
+    0x000fed1377358528, 0x000fed278f844903, 0x000fed3b10242f4c, 0x000fed4dfbad586d, 0x000fed605498c3dc,
+    0x000fed721d414fe8, 0x000fed8357e4a981, 0x000fed9406a42cc8, 0x000feda42b85b704, 0x000fedb3c8746ab3,
+    0x000fedc2df416652, 0x000fedd171a46e52, 0x000feddf813c8ad2, 0x000feded0f90997f, 0x000fedfa1e0fd413,
+    0x000fee06ae124bc4, 0x000fee12c0d95a06, 0x000fee1e579006df, 0x000fee29734b6524, 0x000fee34150ae4bb,
+    0x000fee3e3db89b3c, 0x000fee47ee2982f3, 0x000fee51271db086, 0x000fee59e9407f41, 0x000fee623528b42d,
+    0x000fee6a0b5897f0, 0x000fee716c3e077a, 0x000fee7858327b81, 0x000fee7ecf7b06b9, 0x000fee84d2484ab2,
+    0x000fee8a60b66342, 0x000fee8f7accc851, 0x000fee94207e25da, 0x000fee9851a829eb, 0x000fee9c0e13485b,
+    0x000fee9f557273f3, 0x000feea22762ccae, 0x000feea4836b42ab, 0x000feea668fc2d71, 0x000feea7d76ed6f9,
+    0x000feea8ce04fa0a, 0x000feea94be8333b, 0x000feea95029640f, 0x000feea8d9c0075d, 0x000feea7e7897653,
+    0x000feea678481d24, 0x000feea48aa29e82, 0x000feea21d22e4d9, 0x000fee9f2e352024, 0x000fee9bbc26af2e,
+    0x000fee97c524f2e3, 0x000fee93473c0a39, 0x000fee8e40557515, 0x000fee88ae369c79, 0x000fee828e7f3dfc,
+    0x000fee7bdea7b887, 0x000fee749bff37ff, 0x000fee6cc3a9bd5e, 0x000fee64529e007f, 0x000fee5b45a32888,
+    0x000fee51994e57b5, 0x000fee474a0006ce, 0x000fee3c53e12c4f, 0x000fee30b2e02ad7, 0x000fee2462ad8204,
+    0x000fee175eb83c59, 0x000fee09a22a1447, 0x000fedfb27e349cb, 0x000fedebea76216c, 0x000feddbe422047d,
+    0x000fedcb0ece39d3, 0x000fedb964042cf3, 0x000feda6dce938c9, 0x000fed937237e98c, 0x000fed7f1c38a836,
+    0x000fed69d2b9c02a, 0x000fed538d06adff, 0x000fed3c41dea422, 0x000fed23e76a2fd7, 0x000fed0a732fe643,
+    0x000fecefda07fe33, 0x000fecd4100eb7b8, 0x000fecb708956eb4, 0x000fec98b61230c0, 0x000fec790a0da978,
+    0x000fec57f50f31fd, 0x000fec356686c961, 0x000fec114cb4b334, 0x000febeb948e6fd0, 0x000febc429a0b691,
+    0x000feb9af5ee0cdc, 0x000feb6fe1c98542, 0x000feb42d3ad1f9e, 0x000feb13b00b2d4b, 0x000feae2591a02e8,
+    0x000feaaeae992256, 0x000fea788d8ee326, 0x000fea3fcffd73e5, 0x000fea044c8dd9f6, 0x000fe9c5d62f563a,
+    0x000fe9843ba947a3, 0x000fe93f471d4728, 0x000fe8f6bd76c5d6, 0x000fe8aa5dc4e8e6, 0x000fe859e07ab1ea,
+    0x000fe804f690a93f, 0x000fe7ab488233bf, 0x000fe74c751f6aa5, 0x000fe6e8102aa201, 0x000fe67da0b6abd8,
+    0x000fe60c9f38307d, 0x000fe5947338f742, 0x000fe51470977280, 0x000fe48bd436f457, 0x000fe3f9bffd1e37,
+    0x000fe35d35eeb19b, 0x000fe2b5122fe4fd, 0x000fe20003995557, 0x000fe13c82788314, 0x000fe068c4ee67af,
+    0x000fdf82b02b71aa, 0x000fde87c57efeaa, 0x000fdd7509c63bfd, 0x000fdc46e529bf12, 0x000fdaf8f82e0282,
+    0x000fd985e1b2ba75, 0x000fd7e6ef48cf04, 0x000fd613adbd650b, 0x000fd40149e2f011, 0x000fd1a1a7b4c7ac,
+    0x000fcee204761f9e, 0x000fcba8d85e11b1, 0x000fc7d26ecd2d22, 0x000fc32b2f1e22ec, 0x000fbd6581c0b839,
+    0x000fb606c4005433, 0x000fac40582a2873, 0x000f9e971e014597, 0x000f89fa48a41dfb, 0x000f66c5f7f0302c,
+    0x000f1a5a4b331c49,
+  },
+  {
+    8.683627060801316e-16, 4.779330175727769e-17, 6.354352417405282e-17, 7.454870481247714e-17, 8.329366815793116e-17,
+    9.068060405059498e-17, 9.71486007656778e-17, 1.0294750314241034e-16, 1.0823430288447699e-16, 1.1311470196109048e-16,
+    1.1766359457022936e-16, 1.2193617278714376e-16, 1.2597439914637103e-16, 1.2981099886264041e-16,
+    1.3347203736824133e-16, 1.3697864842571216e-16, 1.4034823001242394e-16, 1.4359529452056958e-16,
+    1.4673208742364434e-16, 1.4976904668391052e-16, 1.5271515003596215e-16, 1.555781816946078e-16, 1.58364940092909e-16,
+    1.6108140175274945e-16, 1.6373285203969868e-16, 1.663239905842085e-16, 1.6885901708676609e-16,
+    1.7134170176559673e-16, 1.7377544365864874e-16, 1.761633192300101e-16, 1.7850812316976742e-16,
+    1.8081240285799165e-16, 1.8307848764826765e-16, 1.8530851388618034e-16, 1.8750444639373896e-16,
+    1.8966809700774774e-16, 1.9180114064838635e-16, 1.9390512930625118e-16, 1.9598150426628837e-16,
+    1.9803160683128186e-16, 2.000566877627334e-16, 2.0205791562071661e-16, 2.0403638415480222e-16,
+    2.0599311887403719e-16, 2.0792908290414027e-16, 2.0984518222370362e-16, 2.1174227035760352e-16,
+    2.1362115259449878e-16, 2.1548258978581468e-16, 2.1732730177564377e-16, 2.191559705042728e-16,
+    2.2096924282235327e-16, 2.2276773304789563e-16, 2.245520252941437e-16, 2.2632267559285693e-16,
+    2.280802138345019e-16, 2.2982514554424704e-16, 2.315579535104082e-16, 2.332790992800437e-16, 2.3498902453470975e-16,
+    2.366881523579162e-16, 2.383768884045426e-16, 2.4005562198135073e-16, 2.4172472704675035e-16,
+    2.4338456313711043e-16, 2.450354762261497e-16, 2.4667779952327065e-16, 2.483118542161089e-16,
+    2.4993795016204544e-16, 2.5155638653296593e-16, 2.5316745241713593e-16, 2.5477142738169457e-16,
+    2.563685819989398e-16, 2.579591783392868e-16, 2.595434704335171e-16, 2.6112170470670204e-16, 2.6269412038597266e-16,
+    2.642609498841191e-16, 2.6582241916083083e-16, 2.673787480632365e-16, 2.689301506472617e-16, 2.704768354811996e-16,
+    2.7201900593277335e-16, 2.7355686044086806e-16, 2.750905927730168e-16, 2.7662039226963913e-16,
+    2.781464440759545e-16, 2.796689293624231e-16, 2.8118802553450217e-16, 2.8270390643244797e-16, 2.842167425218407e-16,
+    2.857267010754602e-16, 2.8723394634709804e-16, 2.8873863973784824e-16, 2.902409399553843e-16, 2.917410031666946e-16,
+    2.9323898314471826e-16, 2.9473503140929354e-16, 2.962292973628067e-16, 2.9772192842090294e-16,
+    2.9921307013860136e-16, 3.0070286633213315e-16, 3.0219145919680625e-16, 3.0367898942118023e-16,
+    3.0516559629782197e-16, 3.0665141783089555e-16, 3.0813659084082977e-16, 3.0962125106629235e-16,
+    3.111055332636894e-16, 3.125895713044e-16, 3.140734982699447e-16, 3.1555744654528016e-16, 3.1704154791040295e-16,
+    3.1852593363044075e-16, 3.200107345444012e-16, 3.2149608115274475e-16, 3.229821037039416e-16,
+    3.2446893228016983e-16, 3.259566968823079e-16, 3.274455275143707e-16, 3.28935554267537e-16, 3.304269074039129e-16,
+    3.3191971744017523e-16, 3.3341411523123725e-16, 3.349102320540779e-16, 3.364081996918765e-16,
+    3.3790815051859503e-16, 3.39410217584149e-16, 3.4091453470031265e-16, 3.4242123652750187e-16, 3.439304586625832e-16,
+    3.4544233772785845e-16, 3.4695701146137845e-16, 3.4847461880874147e-16, 3.499953000165382e-16,
+    3.515191967276075e-16, 3.5304645207827406e-16, 3.5457721079774367e-16, 3.5611161930983894e-16,
+    3.5764982583726515e-16, 3.5919198050860314e-16, 3.607382354682353e-16, 3.6228874498941935e-16,
+    3.638436655907346e-16, 3.6540315615613714e-16, 3.6696737805887024e-16, 3.685364952894915e-16,
+    3.7011067458828993e-16, 3.7169008558238235e-16, 3.7327490092779445e-16, 3.748652964568489e-16,
+    3.764614513312029e-16, 3.780635482008961e-16, 3.7967177336979448e-16, 3.812863169678378e-16, 3.8290737313052437e-16,
+    3.8453514018609596e-16, 3.8616982085091493e-16, 3.8781162243355867e-16, 3.894607570481926e-16,
+    3.9111744183782054e-16, 3.927818992080542e-16, 3.944543570720877e-16, 3.9613504910761354e-16,
+    3.9782421502646826e-16, 3.995221008578565e-16, 4.012289592460629e-16, 4.029450497636328e-16, 4.04670639241075e-16,
+    4.0640600211422504e-16, 4.0815142079049387e-16, 4.099071860353266e-16, 4.1167359738030247e-16,
+    4.134509635544235e-16, 4.152396029402687e-16, 4.1703984405683144e-16, 4.188520260710111e-16, 4.206764993399014e-16,
+    4.2251362598620484e-16, 4.2436378050930775e-16, 4.262273504347798e-16, 4.2810473700531167e-16,
+    4.2999635591638323e-16, 4.3190263810026294e-16, 4.338240305622791e-16, 4.357609972736849e-16,
+    4.3771402012585875e-16, 4.3968359995105214e-16, 4.4167025761542035e-16, 4.4367453519065673e-16,
+    4.456969972112043e-16, 4.477382320247534e-16, 4.49798853244555e-16, 4.518795013130059e-16, 4.539808451870034e-16,
+    4.561035841567423e-16, 4.582484498109568e-16, 4.604162081631154e-16, 4.626076619547847e-16, 4.648236531543208e-16,
+    4.670650656712633e-16, 4.69332828309333e-16, 4.716279179838353e-16, 4.739513632325869e-16, 4.763042480533139e-16,
+    4.786877161048725e-16, 4.811029753147419e-16, 4.835513029411527e-16, 4.860340511450813e-16, 4.885526531353604e-16,
+    4.911086299595271e-16, 4.937035980240336e-16, 4.963392774403987e-16, 4.990175013091822e-16, 5.01740226071809e-16,
+    5.045095430818728e-16, 5.073276915733542e-16, 5.101970732341562e-16, 5.131202686306784e-16, 5.161000557743228e-16,
+    5.1913943117577e-16, 5.222416338000234e-16, 5.254101724177597e-16, 5.286488569504945e-16, 5.3196183453384e-16,
+    5.353536311816497e-16, 5.388292001334053e-16, 5.423939782201712e-16, 5.46053951907478e-16, 5.498157350892814e-16,
+    5.536866612467876e-16, 5.576748932926577e-16, 5.617895553555417e-16, 5.660408920082423e-16, 5.70440462129139e-16,
+    5.750013768919896e-16, 5.797385945724595e-16, 5.84669289345548e-16, 5.8981331764779e-16, 5.951938149641445e-16,
+    6.008379696271908e-16, 6.067780409333449e-16, 6.130527208725281e-16, 6.197089894581626e-16, 6.268046963301283e-16,
+    6.344122407127505e-16, 6.426239659548054e-16, 6.515603317344993e-16, 6.613827885097663e-16, 6.723150462505586e-16,
+    6.846803417564259e-16, 6.98971833638762e-16, 7.159994934830663e-16, 7.372424301798798e-16, 7.658936370805572e-16,
+    8.113849337656484e-16,
+  },
+  {
+    1.0, 0.9771017012676713, 0.9598790918001064, 0.9451989534422994, 0.9320600759592302, 0.9199915050393467,
+    0.9087264400521305, 0.8980959218983432, 0.887984660755833, 0.8783096558089171, 0.8690086880368567,
+    0.8600336211963313, 0.8513462584586777, 0.842915653112204, 0.8347162929868832, 0.8267268339462212,
+    0.818929191603702, 0.8113078743126559, 0.8038494831709639, 0.7965423304229586, 0.7893761435660241,
+    0.7823418326548021, 0.7754313049811867, 0.7686373157984858, 0.7619533468367949, 0.7553735065070958,
+    0.7488924472191565, 0.7425052963401507, 0.7362075981268623, 0.7299952645614758, 0.7238645334686298,
+    0.7178119326307216, 0.7118342488782481, 0.7059285013327539, 0.7000919181365113, 0.6943219161261164,
+    0.6886160830046715, 0.6829721616449944, 0.6773880362187732, 0.6718617198970818, 0.6663913439087499,
+    0.6609751477766629, 0.655611470579697, 0.6502987431108165, 0.6450354808208221, 0.6398202774530563,
+    0.6346517992876233, 0.6295287799248364, 0.6244500155470262, 0.6194143606058341, 0.6144207238889136,
+    0.6094680649257732, 0.6045553906974674, 0.5996817526191249, 0.594846243767987, 0.5900479963328256,
+    0.5852861792633709, 0.5805599961007905, 0.5758686829723533, 0.5712115067352528, 0.566587763256164,
+    0.561996775814524, 0.5574378936187656, 0.552910490425832, 0.5484139632552655, 0.5439477311900258,
+    0.5395112342569517, 0.5351039323804572, 0.5307253044036616, 0.526374847171684, 0.5220520746723215,
+    0.517756517229756, 0.5134877207473266, 0.5092452459957476, 0.5050286679434679, 0.5008375751261485,
+    0.4966715690524894, 0.4925302636438682, 0.48841328470545764, 0.48432026942668294, 0.4802508659090465,
+    0.47620473271950553, 0.4721815384677298, 0.46818096140569326, 0.464202689048174, 0.46024641781284253,
+    0.45631185267871616, 0.4523987068618483, 0.44850670150720284, 0.44463556539573923, 0.4407850346658038,
+    0.4369548525479854, 0.43314476911265215, 0.42935454102944137, 0.42558393133802186, 0.4218327092294958,
+    0.418100649837848, 0.41438753404089096, 0.41069314827018805, 0.4070172843294732, 0.40335973922111434,
+    0.39972031498019706, 0.39609881851583223, 0.3924950614593154, 0.3889088600187886, 0.3853400348400771,
+    0.3817884108733935, 0.37825381724561896, 0.3747360871378909, 0.3712350576682393, 0.3677505697790323,
+    0.3642824681290038, 0.3608306009896478, 0.3573948201457803, 0.3539749808000766, 0.35057094148140594,
+    0.34718256395679353, 0.3438097131468506, 0.3404522570445217, 0.33711006663700593, 0.3337830158307183,
+    0.3304709813791634, 0.32717384281360135, 0.3238914823763911, 0.32062378495690536, 0.3173706380299135,
+    0.3141319315963371, 0.31090755812628634, 0.30769741250429195, 0.3045013919766499, 0.30131939610080294,
+    0.29815132669668537, 0.2949970877999617, 0.29185658561709504, 0.28872972848218276, 0.2856164268155016,
+    0.28251659308370747, 0.2794301417616378, 0.2763569892956681, 0.2732970540685769, 0.27025025636587524,
+    0.26721651834356114, 0.2641957639972608, 0.2611879191327209, 0.25819291133761896, 0.2552106699546617,
+    0.25224112605594196, 0.2492842124185283, 0.24633986350126366, 0.24340801542275015, 0.24048860594050042,
+    0.23758157443123798, 0.23468686187232993, 0.2318044108243386, 0.22893416541468026, 0.22607607132238022,
+    0.22323007576391748, 0.22039612748015197, 0.21757417672433116, 0.2147641752511736, 0.21196607630703018,
+    0.20917983462112502, 0.20640540639788074, 0.20364274931033488, 0.2008918224946566, 0.19815258654577514,
+    0.1954250035141343, 0.19270903690358915, 0.19000465167046499, 0.18731181422380028, 0.18463049242679927,
+    0.18196065559952257, 0.17930227452284767, 0.17665532144373502, 0.17401977008183878, 0.17139559563750595,
+    0.1687827748012115, 0.16618128576448207, 0.16359110823236572, 0.1610122234375111, 0.1584446141559243,
+    0.15588826472447923, 0.15334316106026286, 0.1508092906818457, 0.14828664273257455, 0.14577520800599406,
+    0.14327497897351343, 0.1407859498144447, 0.13830811644855073, 0.13584147657125373, 0.13338602969166913,
+    0.13094177717364433, 0.12850872227999954, 0.12608687022018586, 0.12367622820159656, 0.12127680548479022,
+    0.11888861344290999, 0.11651166562561081, 0.11414597782783836, 0.111791568163838, 0.10944845714681165,
+    0.10711666777468365, 0.1047962256224869, 0.1024871589419351, 0.10018949876880982, 0.0979032790388623,
+    0.09562853671300883, 0.09336531191269087, 0.09111364806637363, 0.0888735920682758, 0.08664519445055796,
+    0.08442850957035337, 0.08222359581320286, 0.08003051581466307, 0.07784933670209605, 0.07568013035892708,
+    0.07352297371398127, 0.07137794905889037, 0.06924514439700677, 0.0671246538277885, 0.06501657797124286,
+    0.06292102443775813, 0.06083810834953987, 0.058767952920933765, 0.0567106901062029, 0.05466646132488892,
+    0.05263541827679218, 0.05061772386094777, 0.04861355321586853, 0.04662309490193037, 0.04464655225129445,
+    0.04268414491647444, 0.04073611065594093, 0.03880270740452612, 0.03688421568856729, 0.034980941461716084,
+    0.03309321945857852, 0.03122141719192025, 0.029365939758133317, 0.027527235669603085, 0.0257058040085489,
+    0.023902203305795882, 0.022117062707308868, 0.02035109623004452, 0.018605121275724647, 0.01688008315254317,
+    0.015177088307935327, 0.01349745060173988, 0.01184275785790789, 0.010214971439701471, 0.008616582769398732,
+    0.007050875471373227, 0.005522403299250997, 0.0040379725933630305, 0.0026090727461021627, 0.0012602859304985975,
+  }};
+
+_CCCL_GLOBAL_CONSTANT __ziggurat_table<::cuda::std::uint32_t, float> __ziggurat_normal_table_f32 = {
+  {
+    0x007799ec, 0x00000000, 0x006045f4, 0x006d1aa7, 0x00728fb3, 0x007592af, 0x00777a5c, 0x0078ca38, 0x0079bf6b,
+    0x007a7a34, 0x007b0d2f, 0x007b83d3, 0x007be597, 0x007c3788, 0x007c7d32, 0x007cb926, 0x007ced48, 0x007d1b07,
+    0x007d437e, 0x007d678b, 0x007d87db, 0x007da4fc, 0x007dbf61, 0x007dd767, 0x007ded5c, 0x007e0183, 0x007e1410,
+    0x007e2533, 0x007e3514, 0x007e43d5, 0x007e5192, 0x007e5e67, 0x007e6a68, 0x007e75aa, 0x007e803d, 0x007e8a32,
+    0x007e9395, 0x007e9c72, 0x007ea4d4, 0x007eacc5, 0x007eb44e, 0x007ebb75, 0x007ec242, 0x007ec8bc, 0x007ecee8,
+    0x007ed4cb, 0x007eda6a, 0x007edfca, 0x007ee4ef, 0x007ee9dc, 0x007eee94, 0x007ef31b, 0x007ef773, 0x007efba0,
+    0x007effa3, 0x007f037f, 0x007f0736, 0x007f0ac9, 0x007f0e3c, 0x007f118f, 0x007f14c4, 0x007f17dc, 0x007f1ad9,
+    0x007f1dbc, 0x007f2087, 0x007f233a, 0x007f25d6, 0x007f285d, 0x007f2acf, 0x007f2d2e, 0x007f2f79, 0x007f31b3,
+    0x007f33db, 0x007f35f3, 0x007f37fa, 0x007f39f2, 0x007f3bdc, 0x007f3db7, 0x007f3f84, 0x007f4144, 0x007f42f7,
+    0x007f449e, 0x007f463a, 0x007f47c9, 0x007f494e, 0x007f4ac8, 0x007f4c37, 0x007f4d9d, 0x007f4ef9, 0x007f504b,
+    0x007f5194, 0x007f52d5, 0x007f540d, 0x007f553c, 0x007f5664, 0x007f5783, 0x007f589b, 0x007f59ac, 0x007f5ab5,
+    0x007f5bb7, 0x007f5cb2, 0x007f5da7, 0x007f5e95, 0x007f5f7d, 0x007f605f, 0x007f613a, 0x007f6210, 0x007f62df,
+    0x007f63aa, 0x007f646e, 0x007f652d, 0x007f65e7, 0x007f669c, 0x007f674b, 0x007f67f6, 0x007f689b, 0x007f693c,
+    0x007f69d8, 0x007f6a6f, 0x007f6b02, 0x007f6b90, 0x007f6c1a, 0x007f6ca0, 0x007f6d21, 0x007f6d9e, 0x007f6e16,
+    0x007f6e8b, 0x007f6efc, 0x007f6f68, 0x007f6fd0, 0x007f7035, 0x007f7096, 0x007f70f2, 0x007f714b, 0x007f71a0,
+    0x007f71f1, 0x007f723f, 0x007f7289, 0x007f72cf, 0x007f7311, 0x007f7350, 0x007f738b, 0x007f73c2, 0x007f73f6,
+    0x007f7426, 0x007f7453, 0x007f747b, 0x007f74a1, 0x007f74c2, 0x007f74e0, 0x007f74fa, 0x007f7511, 0x007f7524,
+    0x007f7533, 0x007f753e, 0x007f7546, 0x007f754a, 0x007f754a, 0x007f7546, 0x007f753f, 0x007f7533, 0x007f7524,
+    0x007f7510, 0x007f74f9, 0x007f74dd, 0x007f74be, 0x007f749a, 0x007f7472, 0x007f7445, 0x007f7414, 0x007f73de,
+    0x007f73a4, 0x007f7366, 0x007f7322, 0x007f72da, 0x007f728c, 0x007f723a, 0x007f71e2, 0x007f7185, 0x007f7123,
+    0x007f70ba, 0x007f704d, 0x007f6fd9, 0x007f6f5f, 0x007f6edf, 0x007f6e58, 0x007f6dcb, 0x007f6d36, 0x007f6c9b,
+    0x007f6bf8, 0x007f6b4e, 0x007f6a9c, 0x007f69e2, 0x007f691f, 0x007f6853, 0x007f677e, 0x007f66a0, 0x007f65b8,
+    0x007f64c5, 0x007f63c8, 0x007f62bf, 0x007f61ab, 0x007f608a, 0x007f5f5c, 0x007f5e21, 0x007f5cd7, 0x007f5b7f,
+    0x007f5a16, 0x007f589d, 0x007f5712, 0x007f5575, 0x007f53c4, 0x007f51fe, 0x007f5022, 0x007f4e2e, 0x007f4c21,
+    0x007f49fa, 0x007f47b5, 0x007f4552, 0x007f42cf, 0x007f4027, 0x007f3d5a, 0x007f3a63, 0x007f3740, 0x007f33ed,
+    0x007f3064, 0x007f2ca3, 0x007f28a3, 0x007f245e, 0x007f1fcd, 0x007f1ae9, 0x007f15a8, 0x007f1000, 0x007f09e4,
+    0x007f0346, 0x007efc15, 0x007ef43e, 0x007eeba8, 0x007ee237, 0x007ed7c7, 0x007ecc2f, 0x007ebf37, 0x007eb09d,
+    0x007ea00a, 0x007e8d0d, 0x007e7710, 0x007e5d46, 0x007e3e93, 0x007e1959, 0x007deb2c, 0x007db036, 0x007d6202,
+    0x007cf4b8, 0x007c4fd2, 0x007b362f, 0x0078d2d2,
+  },
+  {
+    4.66198685e-07f, 2.56588333e-08f, 3.41146702e-08f, 4.0023032e-08f, 4.47179467e-08f, 4.8683777e-08f, 5.21562562e-08f,
+    5.52695205e-08f, 5.81078474e-08f, 6.07279915e-08f, 6.31701624e-08f, 6.54639862e-08f, 6.76319871e-08f,
+    6.9691751e-08f, 7.16572544e-08f, 7.35398515e-08f, 7.53488791e-08f, 7.70921389e-08f, 7.87761891e-08f,
+    8.04066431e-08f, 8.19883184e-08f, 8.35253999e-08f, 8.50215329e-08f, 8.64799219e-08f, 8.7903409e-08f,
+    8.92945096e-08f, 9.06554973e-08f, 9.1988376e-08f, 9.32949789e-08f, 9.45769614e-08f, 9.58358157e-08f,
+    9.70729204e-08f, 9.82895116e-08f, 9.94867477e-08f, 1.0066568e-07f, 1.01827283e-07f, 1.0297245e-07f, 1.04102021e-07f,
+    1.0521677e-07f, 1.06317408e-07f, 1.07404617e-07f, 1.08479014e-07f, 1.09541197e-07f, 1.10591714e-07f,
+    1.11631074e-07f, 1.12659777e-07f, 1.13678269e-07f, 1.14686983e-07f, 1.15686333e-07f, 1.16676709e-07f,
+    1.17658466e-07f, 1.18631959e-07f, 1.19597516e-07f, 1.20555455e-07f, 1.21506062e-07f, 1.22449634e-07f,
+    1.23386442e-07f, 1.24316728e-07f, 1.2524076e-07f, 1.26158767e-07f, 1.2707099e-07f, 1.27977614e-07f, 1.28878881e-07f,
+    1.29774975e-07f, 1.30666095e-07f, 1.31552426e-07f, 1.32434138e-07f, 1.33311417e-07f, 1.34184418e-07f,
+    1.35053313e-07f, 1.35918242e-07f, 1.36779363e-07f, 1.37636832e-07f, 1.38490776e-07f, 1.39341338e-07f,
+    1.40188646e-07f, 1.41032828e-07f, 1.41874011e-07f, 1.42712324e-07f, 1.43547879e-07f, 1.44380778e-07f,
+    1.45211146e-07f, 1.46039085e-07f, 1.46864721e-07f, 1.47688141e-07f, 1.48509443e-07f, 1.49328741e-07f,
+    1.50146107e-07f, 1.50961668e-07f, 1.51775509e-07f, 1.52587702e-07f, 1.53398361e-07f, 1.54207555e-07f,
+    1.55015371e-07f, 1.55821922e-07f, 1.56627252e-07f, 1.57431487e-07f, 1.5823467e-07f, 1.59036887e-07f,
+    1.59838237e-07f, 1.60638791e-07f, 1.61438621e-07f, 1.62237811e-07f, 1.63036418e-07f, 1.63834528e-07f,
+    1.64632226e-07f, 1.65429569e-07f, 1.66226641e-07f, 1.67023515e-07f, 1.67820247e-07f, 1.68616921e-07f,
+    1.6941361e-07f, 1.70210384e-07f, 1.71007315e-07f, 1.71804459e-07f, 1.72601901e-07f, 1.73399698e-07f,
+    1.74197936e-07f, 1.74996671e-07f, 1.75795975e-07f, 1.76595933e-07f, 1.77396601e-07f, 1.78198036e-07f,
+    1.79000338e-07f, 1.79803564e-07f, 1.80607771e-07f, 1.81413057e-07f, 1.82219466e-07f, 1.83027097e-07f,
+    1.83836008e-07f, 1.84646254e-07f, 1.85457949e-07f, 1.86271123e-07f, 1.87085888e-07f, 1.87902302e-07f,
+    1.88720435e-07f, 1.89540373e-07f, 1.90362186e-07f, 1.91185975e-07f, 1.92011782e-07f, 1.92839721e-07f,
+    1.93669862e-07f, 1.94502292e-07f, 1.9533708e-07f, 1.96174327e-07f, 1.97014117e-07f, 1.97856522e-07f,
+    1.98701656e-07f, 1.99549589e-07f, 2.00400436e-07f, 2.01254267e-07f, 2.0211121e-07f, 2.02971322e-07f, 2.0383473e-07f,
+    2.04701536e-07f, 2.05571837e-07f, 2.06445733e-07f, 2.07323339e-07f, 2.08204781e-07f, 2.09090146e-07f,
+    2.09979575e-07f, 2.10873182e-07f, 2.11771066e-07f, 2.12673385e-07f, 2.1358025e-07f, 2.14491791e-07f,
+    2.15408164e-07f, 2.16329482e-07f, 2.17255902e-07f, 2.18187566e-07f, 2.1912463e-07f, 2.2006725e-07f, 2.21015583e-07f,
+    2.21969799e-07f, 2.22930069e-07f, 2.23896564e-07f, 2.24869467e-07f, 2.25848979e-07f, 2.26835269e-07f,
+    2.27828565e-07f, 2.28829066e-07f, 2.29836985e-07f, 2.30852535e-07f, 2.31875958e-07f, 2.32907496e-07f,
+    2.33947404e-07f, 2.34995923e-07f, 2.36053339e-07f, 2.3711992e-07f, 2.38195952e-07f, 2.39281746e-07f,
+    2.40377631e-07f, 2.41483917e-07f, 2.42600947e-07f, 2.43729119e-07f, 2.44868744e-07f, 2.4602025e-07f,
+    2.47184062e-07f, 2.48360607e-07f, 2.49550311e-07f, 2.50753658e-07f, 2.5197113e-07f, 2.53203297e-07f,
+    2.54450697e-07f, 2.557139e-07f, 2.56993502e-07f, 2.58290186e-07f, 2.59604633e-07f, 2.60937554e-07f, 2.62289717e-07f,
+    2.63661946e-07f, 2.65055093e-07f, 2.66470124e-07f, 2.67907978e-07f, 2.69369735e-07f, 2.70856503e-07f,
+    2.72369476e-07f, 2.73909961e-07f, 2.75479351e-07f, 2.77079096e-07f, 2.78710871e-07f, 2.80376355e-07f,
+    2.82077451e-07f, 2.83816206e-07f, 2.85594837e-07f, 2.87415787e-07f, 2.89281729e-07f, 2.91195562e-07f,
+    2.93160497e-07f, 2.95180087e-07f, 2.97258254e-07f, 2.99399431e-07f, 3.0160848e-07f, 3.03890886e-07f, 3.062529e-07f,
+    3.08701516e-07f, 3.11244776e-07f, 3.13891945e-07f, 3.16653626e-07f, 3.19542238e-07f, 3.22572419e-07f,
+    3.25761476e-07f, 3.2913016e-07f, 3.32703735e-07f, 3.3651321e-07f, 3.40597467e-07f, 3.45006129e-07f, 3.49803798e-07f,
+    3.55077191e-07f, 3.60946387e-07f, 3.6758496e-07f, 3.75257656e-07f, 3.843993e-07f, 3.95804022e-07f, 4.11186022e-07f,
+    4.35608968e-07f,
+  },
+  {
+    1.0f, 0.977101684f, 0.9598791f, 0.945198953f, 0.932060063f, 0.919991493f, 0.908726454f, 0.898095906f, 0.887984633f,
+    0.878309667f, 0.86900866f, 0.860033631f, 0.851346254f, 0.842915654f, 0.83471632f, 0.826726854f, 0.818929195f,
+    0.811307847f, 0.803849459f, 0.796542346f, 0.78937614f, 0.782341838f, 0.775431275f, 0.7686373f, 0.761953354f,
+    0.755373478f, 0.748892426f, 0.742505312f, 0.736207604f, 0.729995251f, 0.723864555f, 0.717811942f, 0.711834252f,
+    0.705928504f, 0.700091898f, 0.69432193f, 0.688616097f, 0.682972133f, 0.677388012f, 0.671861708f, 0.666391373f,
+    0.660975158f, 0.655611455f, 0.650298715f, 0.645035505f, 0.639820278f, 0.63465178f, 0.629528761f, 0.624450028f,
+    0.619414389f, 0.614420712f, 0.609468043f, 0.604555368f, 0.599681735f, 0.594846249f, 0.590048015f, 0.5852862f,
+    0.580559969f, 0.575868666f, 0.571211517f, 0.566587746f, 0.561996758f, 0.557437897f, 0.552910507f, 0.548413992f,
+    0.543947756f, 0.539511263f, 0.535103917f, 0.5307253f, 0.526374876f, 0.52205205f, 0.517756522f, 0.513487697f,
+    0.509245217f, 0.505028665f, 0.500837564f, 0.496671557f, 0.492530257f, 0.488413274f, 0.484320283f, 0.480250865f,
+    0.476204723f, 0.472181529f, 0.468180954f, 0.464202702f, 0.460246414f, 0.456311852f, 0.452398717f, 0.448506713f,
+    0.44463557f, 0.440785021f, 0.436954856f, 0.433144778f, 0.429354548f, 0.425583929f, 0.421832711f, 0.418100655f,
+    0.414387524f, 0.410693139f, 0.407017291f, 0.403359741f, 0.399720311f, 0.396098822f, 0.392495066f, 0.388908863f,
+    0.385340035f, 0.381788403f, 0.378253818f, 0.3747361f, 0.371235043f, 0.367750555f, 0.364282459f, 0.360830605f,
+    0.357394814f, 0.353974968f, 0.350570947f, 0.347182572f, 0.343809724f, 0.340452254f, 0.337110072f, 0.333783031f,
+    0.330470979f, 0.327173829f, 0.323891491f, 0.320623785f, 0.317370623f, 0.314131945f, 0.310907573f, 0.307697415f,
+    0.304501384f, 0.301319391f, 0.298151314f, 0.294997096f, 0.291856587f, 0.288729727f, 0.285616428f, 0.282516599f,
+    0.279430151f, 0.276356995f, 0.273297042f, 0.270250261f, 0.267216504f, 0.26419577f, 0.261187911f, 0.258192897f,
+    0.255210668f, 0.252241135f, 0.249284208f, 0.246339858f, 0.243408009f, 0.240488604f, 0.237581581f, 0.234686866f,
+    0.231804416f, 0.228934169f, 0.226076066f, 0.223230079f, 0.220396131f, 0.217574179f, 0.214764178f, 0.211966082f,
+    0.209179834f, 0.206405401f, 0.203642756f, 0.200891823f, 0.198152587f, 0.195425004f, 0.192709044f, 0.190004647f,
+    0.187311813f, 0.184630498f, 0.181960657f, 0.179302275f, 0.176655322f, 0.174019769f, 0.1713956f, 0.168782771f,
+    0.166181281f, 0.163591102f, 0.161012217f, 0.158444613f, 0.155888259f, 0.153343156f, 0.150809288f, 0.148286641f,
+    0.145775214f, 0.143274978f, 0.140785947f, 0.138308123f, 0.135841474f, 0.133386031f, 0.130941778f, 0.128508717f,
+    0.126086876f, 0.123676226f, 0.121276803f, 0.118888617f, 0.116511665f, 0.114145979f, 0.111791566f, 0.109448455f,
+    0.107116669f, 0.104796223f, 0.102487162f, 0.1001895f, 0.0979032815f, 0.0956285372f, 0.0933653116f, 0.0911136493f,
+    0.088873595f, 0.0866451934f, 0.0844285116f, 0.0822235942f, 0.0800305158f, 0.077849336f, 0.0756801292f,
+    0.0735229701f, 0.0713779479f, 0.0692451447f, 0.0671246573f, 0.0650165752f, 0.0629210249f, 0.060838107f,
+    0.058767952f, 0.0567106903f, 0.0546664596f, 0.0526354201f, 0.0506177247f, 0.048613552f, 0.0466230959f,
+    0.0446465537f, 0.0426841453f, 0.040736109f, 0.0388027057f, 0.0368842147f, 0.0349809416f, 0.0330932178f,
+    0.0312214177f, 0.02936594f, 0.0275272354f, 0.0257058032f, 0.0239022039f, 0.0221170634f, 0.020351097f, 0.0186051205f,
+    0.0168800838f, 0.0151770879f, 0.0134974504f, 0.0118427575f, 0.0102149714f, 0.00861658249f, 0.00705087557f,
+    0.0055224034f, 0.00403797254f, 0.00260907272f, 0.00126028596f,
+  }};
+
+_CCCL_GLOBAL_CONSTANT __ziggurat_table<::cuda::std::uint64_t, double> __ziggurat_exponential_table_f64 = {
+  {
+    0x001c5214272497c7, 0x0000000000000000, 0x00137d5bd79c317f, 0x00186ef58e3f3c10, 0x001a9bb7320eb0ae,
+    0x001bd127f719447c, 0x001c951d0f88651b, 0x001d1bfe2d5c3973, 0x001d7e5bd56b18b3, 0x001dc934dd172c71,
+    0x001e0409dfac9dc9, 0x001e337b71d47837, 0x001e5a8b177cb7a3, 0x001e7b42096f046c, 0x001e970daf08ae3e,
+    0x001eaef5b14ef09e, 0x001ec3bd07b46557, 0x001ed5f6f08799ce, 0x001ee614ae6e5688, 0x001ef46eca361cd0,
+    0x001f014b76ddd4a4, 0x001f0ce313a796b7, 0x001f176369f1f77a, 0x001f20f20c452571, 0x001f29ae1951a874,
+    0x001f31b18fb95532, 0x001f39125157c106, 0x001f3fe2eb6e694c, 0x001f463332d788fb, 0x001f4c10bf1d3a0f,
+    0x001f51874c5c3322, 0x001f56a109c3ecc0, 0x001f5b66d9099996, 0x001f5fe08210d08c, 0x001f6414dd445772,
+    0x001f6809f6859679, 0x001f6bc52a2b02e7, 0x001f6f4b3d32e4f4, 0x001f72a07190f13a, 0x001f75c8974d09d7,
+    0x001f78c71b045cc0, 0x001f7b9f12413ff5, 0x001f7e5346079f8a, 0x001f80e63be21139, 0x001f835a3dad9162,
+    0x001f85b16056b913, 0x001f87ed89b24262, 0x001f8a10759374fa, 0x001f8c1bba3d39ad, 0x001f8e10cc45d04a,
+    0x001f8ff102013e17, 0x001f91bd968358e1, 0x001f9377ac47afd8, 0x001f95204f8b64db, 0x001f96b878633892,
+    0x001f98410c968892, 0x001f99bae146ba81, 0x001f9b26bc697f00, 0x001f9c85561b717a, 0x001f9dd759cfd803,
+    0x001f9f1d6761a1ce, 0x001fa058140936c0, 0x001fa187eb3a3339, 0x001fa2ad6f6bc4fc, 0x001fa3c91ace0683,
+    0x001fa4db5fee6aa3, 0x001fa5e4aa4d097d, 0x001fa6e55ee46783, 0x001fa7dddca51ec4, 0x001fa8ce7ce6a875,
+    0x001fa9b793ce5fef, 0x001faa9970adb858, 0x001fab745e588232, 0x001fac48a3740585, 0x001fad1682bf9fe9,
+    0x001fadde3b5782c1, 0x001faea008f21d6d, 0x001faf5c2418b07e, 0x001fb012c25b7a13, 0x001fb0c41681dff4,
+    0x001fb17050b6f1fb, 0x001fb2179eb2963a, 0x001fb2ba2bdfa84b, 0x001fb358217f4e18, 0x001fb3f1a6c9be0c,
+    0x001fb486e10cacd7, 0x001fb517f3c793fd, 0x001fb5a500c5fdaa, 0x001fb62e2837fe59, 0x001fb6b388c9010a,
+    0x001fb7353fb50799, 0x001fb7b368dc7da8, 0x001fb82e1ed6ba09, 0x001fb8a57b0347f6, 0x001fb919959a0f74,
+    0x001fb98a85ba7204, 0x001fb9f861796f27, 0x001fba633deee286, 0x001fbacb2f41ec17, 0x001fbb3048b49145,
+    0x001fbb929caea4e2, 0x001fbbf23cc8029e, 0x001fbc4f39d22995, 0x001fbca9a3e140d5, 0x001fbd018a548f9f,
+    0x001fbd56fbde729c, 0x001fbdaa068bd66b, 0x001fbdfab7cb3f41, 0x001fbe491c7364de, 0x001fbe9540c9695f,
+    0x001fbedf3086b128, 0x001fbf26f6de6175, 0x001fbf6c9e828ae3, 0x001fbfb031a904c4, 0x001fbff1ba0ffdb0,
+    0x001fc03141024589, 0x001fc06ecf5b54b3, 0x001fc0aa6d8b1427, 0x001fc0e42399698a, 0x001fc11bf9298a64,
+    0x001fc151f57d1943, 0x001fc1861f770f4b, 0x001fc1b87d9e74b4, 0x001fc1e91620ea43, 0x001fc217eed505de,
+    0x001fc2450d3c83ff, 0x001fc27076864fc2, 0x001fc29a2f90630f, 0x001fc2c23ce98046, 0x001fc2e8a2d2c6b4,
+    0x001fc30d654122ed, 0x001fc33087de9c0f, 0x001fc3520e0b7ec7, 0x001fc371fadf66f8, 0x001fc390512a2887,
+    0x001fc3ad137497fa, 0x001fc3c844013349, 0x001fc3e1e4ccab40, 0x001fc3f9f78e4da8, 0x001fc4107db85061,
+    0x001fc4257877fd68, 0x001fc438e8b5bfc7, 0x001fc44acf15112a, 0x001fc45b2bf447e8, 0x001fc469ff6c4504,
+    0x001fc477495001b2, 0x001fc483092bfbb9, 0x001fc48d3e457ff6, 0x001fc495e799d21b, 0x001fc49d03dd30b1,
+    0x001fc4a29179b433, 0x001fc4a68e8e07fc, 0x001fc4a8f8ebfb8c, 0x001fc4a9ce16ea9f, 0x001fc4a90b41fa34,
+    0x001fc4a6ad4e28a0, 0x001fc4a2b0c82e75, 0x001fc49d11e62de3, 0x001fc495cc852df5, 0x001fc48cdc265ec1,
+    0x001fc4823bec237a, 0x001fc475e696dee6, 0x001fc467d6817e83, 0x001fc458059dc037, 0x001fc4466d702e21,
+    0x001fc433070bcb99, 0x001fc41dcb0d6e0e, 0x001fc406b196bbf7, 0x001fc3edb248cb62, 0x001fc3d2c43e593c,
+    0x001fc3b5de0591b4, 0x001fc396f599614c, 0x001fc376005a4593, 0x001fc352f3069371, 0x001fc32dc1b22819,
+    0x001fc3065fbd7888, 0x001fc2dcbfcbf263, 0x001fc2b0d3b99f9e, 0x001fc2828c8ffcf0, 0x001fc251da79f164,
+    0x001fc21eacb6d39e, 0x001fc1e8f18c6756, 0x001fc1b09637bb3c, 0x001fc17586dccd10, 0x001fc137ae74d6b7,
+    0x001fc0f6f6bb2415, 0x001fc0b348184da4, 0x001fc06c898baff1, 0x001fc022a092f365, 0x001fbfd5710f72b9,
+    0x001fbf84dd29488f, 0x001fbf30c52fc60b, 0x001fbed907770cc6, 0x001fbe7d80327ddb, 0x001fbe1e094ba614,
+    0x001fbdba7a354408, 0x001fbd52a7b9f826, 0x001fbce663c6201b, 0x001fbc757d2c4de5, 0x001fbbffbf63b7aa,
+    0x001fbb84f23fe6a2, 0x001fbb04d9a0d18d, 0x001fba7f351a70ad, 0x001fb9f3bf92b619, 0x001fb9622ed4abfc,
+    0x001fb8ca33174a17, 0x001fb82b76765b54, 0x001fb7859c5b895c, 0x001fb6d840d55594, 0x001fb622f7d96943,
+    0x001fb5654c6f37e1, 0x001fb49ebfbf69d2, 0x001fb3cec803e747, 0x001fb2f4cf539c3f, 0x001fb21032442853,
+    0x001fb1203e5a9604, 0x001fb0243042e1c2, 0x001faf1b31c479a7, 0x001fae045767e105, 0x001facde9dbf2d73,
+    0x001faba8e640060b, 0x001faa61f399ff28, 0x001fa908656f66a2, 0x001fa79ab3508d3d, 0x001fa61726d1f214,
+    0x001fa47bd48bea00, 0x001fa2c693c5c095, 0x001fa0f4f47df315, 0x001f9f04336bbe0b, 0x001f9cf12b79f9bd,
+    0x001f9ab84415abc5, 0x001f98555b782fb9, 0x001f95c3abd03f79, 0x001f92fda9cef1f3, 0x001f8ffcda9ae41d,
+    0x001f8cb99e7385f8, 0x001f892aec479607, 0x001f8545f904db8f, 0x001f80fdc336039b, 0x001f7c427839e926,
+    0x001f7700a3582acc, 0x001f71200f1a241c, 0x001f6a8234b7352b, 0x001f630000a8e267, 0x001f5a66904fe3c4,
+    0x001f50724ece1172, 0x001f44c7665c6fdb, 0x001f36e5a38a59a2, 0x001f26143450340a, 0x001f113e047b0414,
+    0x001ef6aefa57cbe7, 0x001ed38ca188151e, 0x001ea2a61e122db1, 0x001e5961c78b267c, 0x001dddf62bac0bb1,
+    0x001cdb4dd9e4e8c0,
+  },
+  {
+    9.655740063209183e-16, 7.089014243955414e-18, 1.1639412496691224e-17, 1.524391512353216e-17, 1.833284885723744e-17,
+    2.1089651094644866e-17, 2.3611280778431382e-17, 2.595595772310894e-17, 2.8161735541977523e-17,
+    3.0255041303213823e-17, 3.225508254836375e-17, 3.417632340185027e-17, 3.6029969787344525e-17, 3.782490776869649e-17,
+    3.956832198097553e-17, 4.1266117781759464e-17, 4.2923218084425256e-17, 4.4543777432823714e-17,
+    4.613133981483186e-17, 4.768895725264636e-17, 4.921928043727963e-17, 5.072462904503147e-17, 5.220704702792672e-17,
+    5.366834661718192e-17, 5.511014372835095e-17, 5.653388673239667e-17, 5.794088004852767e-17, 5.933230365208943e-17,
+    6.07092293284718e-17, 6.207263431163193e-17, 6.342341280303077e-17, 6.476238575956142e-17, 6.609030925769405e-17,
+    6.740788167872722e-17, 6.871574991183812e-17, 7.00145147340393e-17, 7.130473549660643e-17, 7.258693422414648e-17,
+    7.386159921381792e-17, 7.512918820723728e-17, 7.639013119550826e-17, 7.764483290797848e-17, 7.88936750272979e-17,
+    8.013701816675454e-17, 8.137520364041762e-17, 8.260855505210038e-17, 8.383737972539139e-17, 8.506196999385323e-17,
+    8.628260436784113e-17, 8.749954859216183e-17, 8.871305660690252e-17, 8.992337142215357e-17, 9.113072591597909e-17,
+    9.233534356381788e-17, 9.353743910649129e-17, 9.47372191631295e-17, 9.593488279457997e-17, 9.713062202221521e-17,
+    9.832462230649511e-17, 9.951706298915072e-17, 1.0070811770242949e-16, 1.0189795474846941e-16, 1.030867374515422e-16,
+    1.0427462448561886e-16, 1.0546177017945764e-16, 1.0664832480119147e-16, 1.0783443482419485e-16,
+    1.0902024317583505e-16, 1.1020588947055781e-16, 1.1139151022861975e-16, 1.1257723908165675e-16,
+    1.1376320696616847e-16, 1.1494954230590093e-16, 1.1613637118402183e-16, 1.1732381750590458e-16,
+    1.1851200315326694e-16, 1.1970104813034652e-16, 1.2089107070273855e-16, 1.2208218752947062e-16,
+    1.2327451378884152e-16, 1.2446816329851125e-16, 1.2566324863028985e-16, 1.2685988122003975e-16,
+    1.2805817147307494e-16, 1.2925822886541196e-16, 1.3046016204120288e-16, 1.3166407890665726e-16,
+    1.328700867207381e-16, 1.3407829218289994e-16, 1.3528880151811755e-16, 1.3650172055943978e-16,
+    1.377171548282881e-16, 1.389352096127064e-16, 1.4015599004375715e-16, 1.4137960117024852e-16,
+    1.4260614803196654e-16, 1.4383573573157902e-16, 1.4506846950536877e-16, 1.4630445479294757e-16,
+    1.4754379730609516e-16, 1.487866030968626e-16, 1.500329786250737e-16, 1.5128303082535394e-16,
+    1.5253686717381255e-16, 1.537945957544997e-16, 1.5505632532575771e-16, 1.5632216538658375e-16,
+    1.5759222624311761e-16, 1.5886661907536842e-16, 1.6014545600429167e-16, 1.6142885015932787e-16,
+    1.6271691574651305e-16, 1.640097681172718e-16, 1.653075238380037e-16, 1.666103007605742e-16, 1.6791821809382289e-16,
+    1.6923139647620223e-16, 1.7054995804966298e-16, 1.7187402653490317e-16, 1.7320372730810084e-16,
+    1.745391874792534e-16, 1.7588053597224914e-16, 1.7722790360680065e-16, 1.7858142318237326e-16,
+    1.7994122956424637e-16, 1.8130745977185016e-16, 1.8268025306952523e-16, 1.8405975105985878e-16,
+    1.8544609777975695e-16, 1.8683943979941927e-16, 1.882399263243892e-16, 1.8964770930086167e-16,
+    1.9106294352443765e-16, 1.9248578675252438e-16, 1.9391639982058994e-16, 1.9535494676249091e-16,
+    1.9680159493510374e-16, 1.982565151475019e-16, 1.997198817949342e-16, 2.0119187299787347e-16,
+    2.0267267074641983e-16, 2.0416246105035888e-16, 2.0566143409519179e-16, 2.071697844044737e-16,
+    2.0868771100881597e-16, 2.1021541762192928e-16, 2.117531128241076e-16, 2.133010102535779e-16,
+    2.1485932880616633e-16, 2.1642829284376047e-16, 2.180081324120784e-16, 2.1959908346828707e-16,
+    2.212013881190496e-16, 2.2281529486961805e-16, 2.2444105888463086e-16, 2.2607894226131737e-16,
+    2.277292143158621e-16, 2.2939215188373114e-16, 2.3106803963482133e-16, 2.3275717040435346e-16,
+    2.344598455404958e-16, 2.361763752697774e-16, 2.3790707908142767e-16, 2.3965228613186235e-16,
+    2.4141233567062933e-16, 2.431875774892256e-16, 2.44978372394307e-16, 2.4678509270692887e-16, 2.4860812278958517e-16,
+    2.504478596029557e-16, 2.523047132944217e-16, 2.541791078205812e-16, 2.560714816061771e-16, 2.579822882420531e-16,
+    2.599119972249747e-16, 2.618610947423924e-16, 2.638300845054943e-16, 2.658194886341845e-16, 2.678298485979525e-16,
+    2.698617262169489e-16, 2.7191570472798185e-16, 2.739923899205815e-16, 2.760924113487617e-16, 2.782164236246436e-16,
+    2.8036510780069835e-16, 2.825391728480253e-16, 2.847393572388174e-16, 2.8696643064198177e-16,
+    2.8922119574179956e-16, 2.915044901905293e-16, 2.9381718870700286e-16, 2.9616020533454657e-16,
+    2.9853449587300453e-16, 3.009410605012618e-16, 3.0338094660850034e-16, 3.058552518544861e-16, 3.08365127481531e-16,
+    3.1091178190342663e-16, 3.134964845996663e-16, 3.1612057034671057e-16, 3.187854438219713e-16,
+    3.2149258462067974e-16, 3.2424355273094516e-16, 3.2703999451822404e-16, 3.298836492772283e-16,
+    3.3277635641716714e-16, 3.357200633553244e-16, 3.387168342045505e-16, 3.417688593525637e-16, 3.448784660453424e-16,
+    3.4804813010374423e-16, 3.5128048892229794e-16, 3.545783559224792e-16, 3.5794473666042765e-16,
+    3.6138284682190606e-16, 3.6489613237645425e-16, 3.6848829220956213e-16, 3.7216330360802073e-16,
+    3.7592545104162565e-16, 3.7977935876688744e-16, 3.8373002787892137e-16, 3.8778287856078953e-16,
+    3.919437984311429e-16, 3.962191980786775e-16, 4.0061607510565417e-16, 4.051420882956573e-16, 4.0980564389030625e-16,
+    4.1461599642909046e-16, 4.195833672073399e-16, 4.247190841824385e-16, 4.3003574816674707e-16, 4.355474314693952e-16,
+    4.41269916903607e-16, 4.472209874259932e-16, 4.534207798565834e-16, 4.598922204905932e-16, 4.666615664711476e-16,
+    4.737590853262492e-16, 4.812199172829238e-16, 4.89085182739221e-16, 4.97403423619194e-16, 5.06232507214416e-16,
+    5.156421828878083e-16, 5.257175802022275e-16, 5.365640977112022e-16, 5.483144034258704e-16, 5.61138745467516e-16,
+    5.752606481503332e-16, 5.909817641652103e-16, 6.087231416180908e-16, 6.290979034877557e-16, 6.530492053564041e-16,
+    6.821393079028929e-16, 7.192444966089362e-16, 7.706095350032097e-16, 8.545517038584027e-16,
+  },
+  {
+    1.0, 0.9381436808621747, 0.9004699299257465, 0.8717043323812036, 0.8477855006239896, 0.8269932966430503,
+    0.8084216515230084, 0.7915276369724956, 0.7759568520401156, 0.7614633888498963, 0.7478686219851951,
+    0.7350380924314235, 0.722867659593572, 0.711274760805076, 0.7001926550827882, 0.689566496117078, 0.6793505722647654,
+    0.6695063167319247, 0.6600008410789997, 0.6508058334145711, 0.6418967164272661, 0.6332519942143661,
+    0.624852738703666, 0.6166821809152077, 0.608725382079622, 0.6009689663652322, 0.5934009016917334, 0.586010318477268,
+    0.578787358602845, 0.5717230486648258, 0.5648091929124002, 0.5580382822625874, 0.5514034165406413,
+    0.5448982376724396, 0.5385168720028619, 0.5322538802630433, 0.5261042139836197, 0.5200631773682336,
+    0.5141263938147486, 0.5082897764106429, 0.5025495018413477, 0.49690198724154955, 0.49134386959403253,
+    0.4858719873418849, 0.4804833639304542, 0.4751751930373774, 0.46994482528396, 0.4647897562504262,
+    0.4597076156421377, 0.4546961574746155, 0.449753251162755, 0.4448768734145485, 0.4400651008423539,
+    0.4353161032156366, 0.43062813728845883, 0.42599954114303434, 0.4214287289976166, 0.4169141864330029,
+    0.4124544659971612, 0.4080481831520324, 0.4036940125305303, 0.3993906844752311, 0.39513698183329016,
+    0.3909317369847971, 0.38677382908413765, 0.38266218149600983, 0.3785957594095808, 0.37457356761590216,
+    0.370594648435146, 0.36665807978151416, 0.3627629733548178, 0.3589084729487498, 0.35509375286678746,
+    0.35131801643748334, 0.347580494621637, 0.3438804447045024, 0.34021714906678, 0.3365899140286776, 0.332998068761809,
+    0.3294409642641363, 0.3259179723935562, 0.32242848495608917, 0.31897191284495724, 0.31554768522712895,
+    0.31215524877417955, 0.3087940669345602, 0.30546361924459026, 0.3021634006756935, 0.2988929210155818,
+    0.2956517042812612, 0.2924392881618926, 0.28925522348967775, 0.2860990737370768, 0.28297041453878075,
+    0.2798688332369729, 0.27679392844851736, 0.27374530965280297, 0.27072259679906, 0.2677254199320448,
+    0.2647534188350622, 0.261806242689363, 0.25888354974901623, 0.2559850070304154, 0.25311029001562946,
+    0.2502590823688623, 0.24743107566532763, 0.2446259691318921, 0.24184346939887721, 0.23908329026244918,
+    0.23634515245705964, 0.23362878343743335, 0.2309339171696274, 0.2282602939307167, 0.22560766011668407,
+    0.2229757680581202, 0.2203643758433595, 0.21777324714870053, 0.21520215107537868, 0.21265086199297828,
+    0.21011915938898826, 0.20760682772422204, 0.2051136562938377, 0.20263943909370902, 0.20018397469191127,
+    0.19774706610509887, 0.19532852067956322, 0.19292814997677135, 0.1905457696631954, 0.18818119940425432,
+    0.1858342627621971, 0.18350478709776746, 0.1811926034754963, 0.1788975465724783, 0.17661945459049488,
+    0.1743581691713535, 0.17211353531532006, 0.16988540130252766, 0.1676736186172502, 0.165478041874936,
+    0.16329852875190182, 0.16113493991759203, 0.1589871389693142, 0.15685499236936523, 0.15473836938446808,
+    0.15263714202744286, 0.1505511850010399, 0.1484803756438668, 0.14642459387834494, 0.14438372216063478,
+    0.1423576454324722, 0.14034625107486245, 0.1383494288635802, 0.13636707092642886, 0.13439907170221363,
+    0.13244532790138752, 0.13050573846833077, 0.12858020454522817, 0.12666862943751067, 0.12477091858083096,
+    0.12288697950954514, 0.12101672182667483, 0.11916005717532768, 0.11731689921155557, 0.11548716357863353,
+    0.11367076788274431, 0.1118676316700563, 0.11007767640518538, 0.1083008254510338, 0.10653700405000166,
+    0.10478613930657017, 0.10304816017125772, 0.10132299742595363, 0.09961058367063713, 0.0979108533114922,
+    0.0962237425504328, 0.09454918937605586, 0.09288713355604354, 0.09123751663104016, 0.08960028191003286,
+    0.08797537446727022, 0.08636274114075691, 0.08476233053236812, 0.08317409300963238, 0.08159798070923742,
+    0.0800339475423199, 0.07848194920160642, 0.0769419431704805, 0.07541388873405841, 0.07389774699236475,
+    0.07239348087570874, 0.07090105516237183, 0.06942043649872875, 0.0679515934219366, 0.06649449638533977,
+    0.06504911778675375, 0.06361543199980733, 0.062193415408540995, 0.06078304644547963, 0.059384305633420266,
+    0.05799717563120066, 0.05662164128374288, 0.05525768967669704, 0.05390531019604609, 0.05256449459307169,
+    0.05123523705512628, 0.04991753428270637, 0.0486113855733795, 0.04731679291318155, 0.04603376107617517,
+    0.04476229773294328, 0.04350241356888818, 0.042254122413316234, 0.04101744138041482, 0.039792391023374125,
+    0.03857899550307486, 0.03737728277295936, 0.03618728478193142, 0.03500903769739741, 0.03384258215087433,
+    0.032687963508959535, 0.03154523217289361, 0.030414443910466604, 0.029295660224637393, 0.028188948763978636,
+    0.0270943837809558, 0.026012046645134217, 0.024942026419731783, 0.02388442051155817, 0.02283933540638524,
+    0.02180688750428358, 0.020787204072578117, 0.019780424338009743, 0.01878670074469603, 0.01780620041091136,
+    0.016839106826039948, 0.015885621839973163, 0.014945968011691148, 0.014020391403181938, 0.013109164931254991,
+    0.012212592426255381, 0.011331013597834597, 0.010464810181029979, 0.00961441364250221, 0.008780314985808975,
+    0.00796307743801704, 0.007163353183634984, 0.006381905937319179, 0.005619642207205483, 0.004877655983542392,
+    0.004157295120833795, 0.003460264777836904, 0.002788798793574076, 0.0021459677437189063, 0.0015362997803015724,
+    0.0009672692823271745, 0.00045413435384149677,
+  }};
+
+_CCCL_GLOBAL_CONSTANT __ziggurat_table<::cuda::std::uint32_t, float> __ziggurat_exponential_table_f32 = {
+  {
+    0x00714850, 0x00000000, 0x004df56f, 0x0061bbd6, 0x006a6edc, 0x006f449f, 0x00725474, 0x00746ff8, 0x0075f96f,
+    0x007724d3, 0x00781027, 0x0078cded, 0x00796a2c, 0x0079ed08, 0x007a5c36, 0x007abbd6, 0x007b0ef4, 0x007b57db,
+    0x007b9852, 0x007bd1bb, 0x007c052d, 0x007c338c, 0x007c5d8d, 0x007c83c8, 0x007ca6b8, 0x007cc6c6, 0x007ce449,
+    0x007cff8b, 0x007d18cc, 0x007d3042, 0x007d461d, 0x007d5a84, 0x007d6d9b, 0x007d7f82, 0x007d9053, 0x007da027,
+    0x007daf14, 0x007dbd2c, 0x007dca81, 0x007dd722, 0x007de31c, 0x007dee7c, 0x007df94d, 0x007e0398, 0x007e0d68,
+    0x007e16c5, 0x007e1fb6, 0x007e2841, 0x007e306e, 0x007e3843, 0x007e3fc4, 0x007e46f6, 0x007e4dde, 0x007e5481,
+    0x007e5ae1, 0x007e6104, 0x007e66eb, 0x007e6c9a, 0x007e7215, 0x007e775d, 0x007e7c75, 0x007e8160, 0x007e861f,
+    0x007e8ab5, 0x007e8f24, 0x007e936d, 0x007e9792, 0x007e9b95, 0x007e9f77, 0x007ea339, 0x007ea6de, 0x007eaa65,
+    0x007eadd1, 0x007eb122, 0x007eb45a, 0x007eb778, 0x007eba80, 0x007ebd70, 0x007ec04b, 0x007ec310, 0x007ec5c1,
+    0x007ec85e, 0x007ecae8, 0x007ecd60, 0x007ecfc6, 0x007ed21b, 0x007ed45f, 0x007ed694, 0x007ed8b8, 0x007edace,
+    0x007edcd4, 0x007edecd, 0x007ee0b8, 0x007ee295, 0x007ee466, 0x007ee62a, 0x007ee7e1, 0x007ee98c, 0x007eeb2c,
+    0x007eecc1, 0x007eee4a, 0x007eefc8, 0x007ef13c, 0x007ef2a6, 0x007ef406, 0x007ef55b, 0x007ef6a8, 0x007ef7ea,
+    0x007ef924, 0x007efa55, 0x007efb7c, 0x007efc9b, 0x007efdb2, 0x007efec0, 0x007effc6, 0x007f00c5, 0x007f01bb,
+    0x007f02a9, 0x007f0390, 0x007f046f, 0x007f0547, 0x007f0618, 0x007f06e1, 0x007f07a4, 0x007f085f, 0x007f0914,
+    0x007f09c1, 0x007f0a68, 0x007f0b08, 0x007f0ba2, 0x007f0c35, 0x007f0cc2, 0x007f0d48, 0x007f0dc7, 0x007f0e41,
+    0x007f0eb4, 0x007f0f21, 0x007f0f87, 0x007f0fe7, 0x007f1041, 0x007f1095, 0x007f10e3, 0x007f112b, 0x007f116c,
+    0x007f11a7, 0x007f11dd, 0x007f120c, 0x007f1234, 0x007f1257, 0x007f1274, 0x007f128a, 0x007f129a, 0x007f12a3,
+    0x007f12a7, 0x007f12a4, 0x007f129a, 0x007f128a, 0x007f1274, 0x007f1257, 0x007f1233, 0x007f1208, 0x007f11d7,
+    0x007f119f, 0x007f1160, 0x007f1119, 0x007f10cc, 0x007f1077, 0x007f101a, 0x007f0fb6, 0x007f0f4b, 0x007f0ed7,
+    0x007f0e5b, 0x007f0dd8, 0x007f0d4b, 0x007f0cb7, 0x007f0c19, 0x007f0b72, 0x007f0ac3, 0x007f0a0a, 0x007f0947,
+    0x007f087a, 0x007f07a3, 0x007f06c2, 0x007f05d6, 0x007f04de, 0x007f03db, 0x007f02cd, 0x007f01b2, 0x007f008a,
+    0x007eff55, 0x007efe13, 0x007efcc3, 0x007efb64, 0x007ef9f6, 0x007ef878, 0x007ef6e9, 0x007ef54a, 0x007ef399,
+    0x007ef1d5, 0x007eeffe, 0x007eee13, 0x007eec13, 0x007ee9fc, 0x007ee7ce, 0x007ee588, 0x007ee328, 0x007ee0ad,
+    0x007ede16, 0x007edb61, 0x007ed88b, 0x007ed595, 0x007ed27a, 0x007ecf3b, 0x007ecbd3, 0x007ec840, 0x007ec480,
+    0x007ec090, 0x007ebc6c, 0x007eb811, 0x007eb37a, 0x007eaea3, 0x007ea987, 0x007ea421, 0x007e9e6a, 0x007e985c,
+    0x007e91ef, 0x007e8b1a, 0x007e83d3, 0x007e7c10, 0x007e73c4, 0x007e6ae1, 0x007e6155, 0x007e570e, 0x007e4bf6,
+    0x007e3ff3, 0x007e32e6, 0x007e24ab, 0x007e1517, 0x007e03f7, 0x007df109, 0x007ddc02, 0x007dc480, 0x007daa08,
+    0x007d8c00, 0x007d699a, 0x007d41c9, 0x007d131d, 0x007cdb96, 0x007c9850, 0x007c44f8, 0x007bdabb, 0x007b4e32,
+    0x007a8a98, 0x00796587, 0x007777d8, 0x00736d37,
+  },
+  {
+    1.03677723e-06f, 7.61177077e-09f, 1.24977237e-08f, 1.63680287e-08f, 1.96847463e-08f, 2.26448407e-08f,
+    2.53524188e-08f, 2.78699979e-08f, 3.02384322e-08f, 3.24861027e-08f, 3.46336329e-08f, 3.6696548e-08f,
+    3.86868848e-08f, 4.06141858e-08f, 4.24861639e-08f, 4.43091572e-08f, 4.60884557e-08f, 4.7828518e-08f,
+    4.95331491e-08f, 5.12056282e-08f, 5.28488009e-08f, 5.44651542e-08f, 5.60568907e-08f, 5.76259467e-08f,
+    5.91740665e-08f, 6.07027957e-08f, 6.22135445e-08f, 6.37075743e-08f, 6.51860361e-08f, 6.66499815e-08f,
+    6.81003698e-08f, 6.9538082e-08f, 7.09639281e-08f, 7.23786613e-08f, 7.37829779e-08f, 7.51775104e-08f,
+    7.65628769e-08f, 7.79396245e-08f, 7.93082862e-08f, 8.06693521e-08f, 8.20232771e-08f, 8.33705016e-08f,
+    8.47114379e-08f, 8.60464695e-08f, 8.73759589e-08f, 8.87002614e-08f, 9.00197037e-08f, 9.13345914e-08f,
+    9.26452444e-08f, 9.39519254e-08f, 9.52549186e-08f, 9.65544871e-08f, 9.78508723e-08f, 9.9144323e-08f,
+    1.00435059e-07f, 1.01723316e-07f, 1.03009299e-07f, 1.04293214e-07f, 1.05575261e-07f, 1.0685563e-07f,
+    1.08134515e-07f, 1.09412099e-07f, 1.10688539e-07f, 1.11964027e-07f, 1.13238713e-07f, 1.14512765e-07f,
+    1.15786342e-07f, 1.17059592e-07f, 1.18332672e-07f, 1.1960573e-07f, 1.20878894e-07f, 1.22152315e-07f,
+    1.23426133e-07f, 1.24700477e-07f, 1.2597549e-07f, 1.27251297e-07f, 1.28528015e-07f, 1.29805798e-07f,
+    1.31084747e-07f, 1.32365003e-07f, 1.3364668e-07f, 1.34929891e-07f, 1.36214766e-07f, 1.37501416e-07f,
+    1.38789972e-07f, 1.4008053e-07f, 1.41373235e-07f, 1.42668171e-07f, 1.43965465e-07f, 1.45265247e-07f,
+    1.46567601e-07f, 1.47872669e-07f, 1.49180551e-07f, 1.50491346e-07f, 1.51805196e-07f, 1.53122187e-07f,
+    1.54442446e-07f, 1.55766088e-07f, 1.57093211e-07f, 1.58423944e-07f, 1.597584e-07f, 1.61096679e-07f, 1.62438923e-07f,
+    1.63785217e-07f, 1.65135688e-07f, 1.66490466e-07f, 1.67849649e-07f, 1.69213365e-07f, 1.70581728e-07f,
+    1.71954881e-07f, 1.73332907e-07f, 1.74715964e-07f, 1.76104152e-07f, 1.77497597e-07f, 1.78896443e-07f,
+    1.80300816e-07f, 1.81710831e-07f, 1.83126616e-07f, 1.84548327e-07f, 1.85976091e-07f, 1.87410023e-07f,
+    1.88850294e-07f, 1.90297015e-07f, 1.91750345e-07f, 1.93210425e-07f, 1.94677398e-07f, 1.96151433e-07f,
+    1.97632659e-07f, 1.99121232e-07f, 2.00617322e-07f, 2.02121086e-07f, 2.0363268e-07f, 2.05152276e-07f,
+    2.06680042e-07f, 2.0821615e-07f, 2.09760771e-07f, 2.11314102e-07f, 2.12876316e-07f, 2.14447596e-07f,
+    2.16028127e-07f, 2.17618123e-07f, 2.19217767e-07f, 2.20827289e-07f, 2.22446857e-07f, 2.24076729e-07f,
+    2.25717088e-07f, 2.27368176e-07f, 2.29030221e-07f, 2.30703449e-07f, 2.32388103e-07f, 2.34084453e-07f,
+    2.35792726e-07f, 2.37513177e-07f, 2.39246106e-07f, 2.40991739e-07f, 2.42750417e-07f, 2.44522369e-07f,
+    2.46307934e-07f, 2.48107426e-07f, 2.49921101e-07f, 2.51749356e-07f, 2.53592447e-07f, 2.55450772e-07f,
+    2.57324672e-07f, 2.59214517e-07f, 2.61120675e-07f, 2.63043518e-07f, 2.6498347e-07f, 2.6694093e-07f, 2.68916352e-07f,
+    2.70910135e-07f, 2.72922733e-07f, 2.74954658e-07f, 2.77006365e-07f, 2.79078392e-07f, 2.81171197e-07f,
+    2.83285402e-07f, 2.85421493e-07f, 2.87580121e-07f, 2.89761829e-07f, 2.91967268e-07f, 2.94197093e-07f,
+    2.96451958e-07f, 2.98732601e-07f, 3.01039734e-07f, 3.03374122e-07f, 3.05736563e-07f, 3.08127852e-07f,
+    3.10548899e-07f, 3.13000555e-07f, 3.15483817e-07f, 3.17999593e-07f, 3.20548963e-07f, 3.23133008e-07f,
+    3.25752808e-07f, 3.28409584e-07f, 3.3110453e-07f, 3.33838983e-07f, 3.36614278e-07f, 3.39431864e-07f,
+    3.42293276e-07f, 3.45200021e-07f, 3.48153861e-07f, 3.5115653e-07f, 3.54209874e-07f, 3.57315884e-07f,
+    3.60476662e-07f, 3.63694426e-07f, 3.66971506e-07f, 3.70310431e-07f, 3.73713846e-07f, 3.77184563e-07f,
+    3.80725623e-07f, 3.8434024e-07f, 3.88031879e-07f, 3.91804235e-07f, 3.95661289e-07f, 3.99607302e-07f,
+    4.03646879e-07f, 4.07784995e-07f, 4.12026992e-07f, 4.16378697e-07f, 4.20846447e-07f, 4.25437122e-07f,
+    4.30158224e-07f, 4.35017995e-07f, 4.40025445e-07f, 4.45190523e-07f, 4.50524198e-07f, 4.56038634e-07f,
+    4.61747362e-07f, 4.67665501e-07f, 4.73809962e-07f, 4.80199901e-07f, 4.86856834e-07f, 4.93805487e-07f,
+    5.01074055e-07f, 5.08694939e-07f, 5.16705938e-07f, 5.25151222e-07f, 5.34082858e-07f, 5.43563033e-07f,
+    5.53666553e-07f, 5.64484935e-07f, 5.76131299e-07f, 5.88748094e-07f, 6.02518128e-07f, 6.17681394e-07f,
+    6.34561843e-07f, 6.53611494e-07f, 6.75488707e-07f, 7.01206261e-07f, 7.32441492e-07f, 7.72282874e-07f,
+    8.27435713e-07f, 9.17567888e-07f,
+  },
+  {
+    1.0f, 0.938143671f, 0.900469959f, 0.87170434f, 0.847785473f, 0.826993287f, 0.808421671f, 0.791527629f, 0.775956869f,
+    0.761463404f, 0.747868598f, 0.735038102f, 0.722867668f, 0.711274743f, 0.70019263f, 0.689566493f, 0.679350555f,
+    0.669506311f, 0.660000861f, 0.650805831f, 0.641896725f, 0.633251965f, 0.624852717f, 0.616682172f, 0.608725369f,
+    0.600968957f, 0.593400896f, 0.586010337f, 0.578787386f, 0.571723044f, 0.564809203f, 0.558038294f, 0.551403403f,
+    0.544898212f, 0.538516879f, 0.532253861f, 0.526104212f, 0.520063162f, 0.51412642f, 0.508289754f, 0.502549529f,
+    0.496901989f, 0.491343856f, 0.485872f, 0.480483353f, 0.475175202f, 0.469944835f, 0.464789748f, 0.459707618f,
+    0.454696149f, 0.449753255f, 0.444876879f, 0.440065116f, 0.435316116f, 0.430628151f, 0.425999552f, 0.42142874f,
+    0.416914195f, 0.412454456f, 0.408048183f, 0.403694004f, 0.399390697f, 0.395136982f, 0.390931726f, 0.386773825f,
+    0.382662177f, 0.378595769f, 0.374573559f, 0.370594651f, 0.366658092f, 0.362762988f, 0.358908474f, 0.355093747f,
+    0.351318002f, 0.347580492f, 0.343880445f, 0.340217143f, 0.336589903f, 0.332998067f, 0.329440951f, 0.325917959f,
+    0.322428495f, 0.318971902f, 0.315547675f, 0.312155247f, 0.308794081f, 0.305463612f, 0.302163392f, 0.298892915f,
+    0.295651704f, 0.292439282f, 0.289255232f, 0.286099076f, 0.282970428f, 0.279868841f, 0.276793927f, 0.273745298f,
+    0.270722598f, 0.267725408f, 0.264753431f, 0.26180625f, 0.258883536f, 0.255985022f, 0.25311029f, 0.250259072f,
+    0.24743107f, 0.244625971f, 0.241843462f, 0.23908329f, 0.236345157f, 0.23362878f, 0.23093392f, 0.228260294f,
+    0.225607663f, 0.222975761f, 0.220364377f, 0.217773244f, 0.215202153f, 0.212650865f, 0.210119158f, 0.207606822f,
+    0.205113649f, 0.202639446f, 0.200183973f, 0.197747067f, 0.195328519f, 0.19292815f, 0.190545768f, 0.188181207f,
+    0.185834259f, 0.18350479f, 0.181192607f, 0.178897545f, 0.176619455f, 0.174358174f, 0.172113538f, 0.169885397f,
+    0.167673618f, 0.165478036f, 0.163298532f, 0.161134943f, 0.158987135f, 0.156854987f, 0.154738367f, 0.152637139f,
+    0.150551185f, 0.148480371f, 0.146424592f, 0.144383729f, 0.142357647f, 0.140346244f, 0.138349429f, 0.136367068f,
+    0.134399071f, 0.13244532f, 0.130505741f, 0.128580198f, 0.126668632f, 0.124770917f, 0.122886978f, 0.121016718f,
+    0.119160056f, 0.117316902f, 0.115487166f, 0.113670766f, 0.111867629f, 0.110077679f, 0.108300827f, 0.106537007f,
+    0.104786143f, 0.103048161f, 0.101323001f, 0.099610582f, 0.0979108512f, 0.0962237418f, 0.0945491865f, 0.0928871334f,
+    0.0912375152f, 0.0896002799f, 0.0879753754f, 0.0863627419f, 0.0847623274f, 0.0831740946f, 0.0815979838f,
+    0.0800339505f, 0.0784819499f, 0.0769419447f, 0.0754138902f, 0.0738977492f, 0.0723934844f, 0.0709010586f,
+    0.0694204345f, 0.0679515898f, 0.0664944947f, 0.0650491193f, 0.0636154339f, 0.0621934161f, 0.0607830472f,
+    0.059384305f, 0.0579971746f, 0.0566216409f, 0.0552576892f, 0.053905312f, 0.0525644943f, 0.0512352362f, 0.049917534f,
+    0.0486113839f, 0.0473167934f, 0.0460337624f, 0.0447622985f, 0.0435024127f, 0.0422541238f, 0.0410174429f,
+    0.0397923924f, 0.0385789946f, 0.037377283f, 0.0361872837f, 0.0350090377f, 0.0338425823f, 0.0326879621f,
+    0.031545233f, 0.0304144435f, 0.0292956606f, 0.0281889495f, 0.0270943847f, 0.0260120463f, 0.0249420255f,
+    0.0238844212f, 0.0228393357f, 0.0218068883f, 0.0207872037f, 0.0197804235f, 0.0187867004f, 0.0178062003f,
+    0.0168391075f, 0.0158856213f, 0.0149459681f, 0.0140203917f, 0.0131091652f, 0.0122125922f, 0.0113310134f,
+    0.0104648098f, 0.0096144136f, 0.00878031459f, 0.00796307717f, 0.00716335326f, 0.0063819061f, 0.00561964232f,
+    0.00487765577f, 0.00415729498f, 0.00346026476f, 0.00278879888f, 0.00214596768f, 0.00153629982f, 0.000967269298f,
+    0.000454134366f,
+  }};
+
+_CCCL_END_NAMESPACE_CUDA
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA___RANDOM_ZIGGURAT_TABLES_H
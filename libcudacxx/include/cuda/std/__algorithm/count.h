@@ -20,6 +20,7 @@
 #  pragma system_header
 #endif // no system header
 
+#include <cuda/std/__algorithm/simd_utils.h>
 #include <cuda/std/__iterator/iterator_traits.h>
 
 #include <cuda/std/__cccl/prologue.h>
@@ -31,6 +32,15 @@ template <class _InputIterator, class _Tp>
 [[nodiscard]] _CCCL_API constexpr __iter_diff_t<_InputIterator>
 count(_InputIterator __first, _InputIterator __last, const _Tp& __value_)
 {
+#if _CCCL_HAS_HOST_SIMD()
+  if constexpr (__can_simd_find_v<_InputIterator, _Tp>)
+  {
+    _CCCL_IF_NOT_CONSTEVAL_DEFAULT
+    {
+      NV_IF_TARGET(NV_IS_HOST, (return ::cuda::std::__simd_count(__first, __last, __value_);))
+    }
+  }
+#endif // _CCCL_HAS_HOST_SIMD()
   __iter_diff_t<_InputIterator> __r{0};
   for (; __first != __last; ++__first)
   {
@@ -20,7 +20,11 @@
 #  pragma system_header
 #endif // no system header
 
+#include <cuda/std/__algorithm/simd_utils.h>
+#include <cuda/std/__functional/identity.h>
 #include <cuda/std/__functional/invoke.h>
+#include <cuda/std/__type_traits/is_same.h>
+#include <cuda/std/__type_traits/remove_cv.h>
 
 #include <cuda/std/__cccl/prologue.h>
 
@@ -31,6 +35,15 @@ _CCCL_EXEC_CHECK_DISABLE
 template <class _Iter, class _Sent, class _Tp, class _Proj>
 [[nodiscard]] _CCCL_API constexpr _Iter __find_impl(_Iter __first, _Sent __last, const _Tp& __value, _Proj& __proj)
 {
+#if _CCCL_HAS_HOST_SIMD()
+  if constexpr (is_same_v<_Iter, _Sent> && is_same_v<remove_cv_t<_Proj>, identity> && __can_simd_find_v<_Iter, _Tp>)
+  {
+    _CCCL_IF_NOT_CONSTEVAL_DEFAULT
+    {
+      NV_IF_TARGET(NV_IS_HOST, (return ::cuda::std::__simd_find(__first, __last, __value);))
+    }
+  }
+#endif // _CCCL_HAS_HOST_SIMD()
   for (; __first != __last; ++__first)
   {
     if (::cuda::std::invoke(__proj, *__first) == __value)
@@ -45,6 +58,15 @@ _CCCL_EXEC_CHECK_DISABLE
 template <class _InputIterator, class _Tp>
 [[nodiscard]] _CCCL_API constexpr _InputIterator find(_InputIterator __first, _InputIterator __last, const _Tp& __value_)
 {
+#if _CCCL_HAS_HOST_SIMD()
+  if constexpr (__can_simd_find_v<_InputIterator, _Tp>)
+  {
+    _CCCL_IF_NOT_CONSTEVAL_DEFAULT
+    {
+      NV_IF_TARGET(NV_IS_HOST, (return ::cuda::std::__simd_find(__first, __last, __value_);))
+    }
+  }
+#endif // _CCCL_HAS_HOST_SIMD()
   for (; __first != __last; ++__first)
   {
     if (*__first == __value_)
@@ -21,6 +21,8 @@
 #endif // no system header
 
 #include <cuda/std/__algorithm/comp.h>
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/__algorithm/simd_utils.h>
 #include <cuda/std/__iterator/iterator_traits.h>
 #include <cuda/std/__utility/pair.h>
 
@@ -33,6 +35,16 @@ template <class _InputIterator1, class _InputIterator2, class _BinaryPredicate>
 [[nodiscard]] _CCCL_API constexpr pair<_InputIterator1, _InputIterator2>
 mismatch(_InputIterator1 __first1, _InputIterator1 __last1, _InputIterator2 __first2, _BinaryPredicate __pred)
 {
+#if _CCCL_HAS_HOST_SIMD()
+  if constexpr (__can_simd_mismatch_v<_InputIterator1, _InputIterator2, _BinaryPredicate>)
+  {
+    _CCCL_IF_NOT_CONSTEVAL_DEFAULT
+    {
+      NV_IF_TARGET(NV_IS_HOST,
+                   (return ::cuda::std::__simd_mismatch(__first1, __first2, static_cast<size_t>(__last1 - __first1));))
+    }
+  }
+#endif // _CCCL_HAS_HOST_SIMD()
   for (; __first1 != __last1; ++__first1, (void) ++__first2)
   {
     if (!__pred(*__first1, *__first2))
@@ -59,6 +71,17 @@ template <class _InputIterator1, class _InputIterator2, class _BinaryPredicate>
   _InputIterator2 __last2,
   _BinaryPredicate __pred)
 {
+#if _CCCL_HAS_HOST_SIMD()
+  if constexpr (__can_simd_mismatch_v<_InputIterator1, _InputIterator2, _BinaryPredicate>)
+  {
+    _CCCL_IF_NOT_CONSTEVAL_DEFAULT
+    {
+      NV_IF_TARGET(NV_IS_HOST,
+                   (const auto __n = ::cuda::std::min<size_t>(__last1 - __first1, __last2 - __first2);
+                    return ::cuda::std::__simd_mismatch(__first1, __first2, __n);))
+    }
+  }
+#endif // _CCCL_HAS_HOST_SIMD()
   for (; __first1 != __last1 && __first2 != __last2; ++__first1, (void) ++__first2)
   {
     if (!__pred(*__first1, *__first2))
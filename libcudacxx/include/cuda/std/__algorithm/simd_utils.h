@@ -0,0 +1,672 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___ALGORITHM_SIMD_UTILS_H
+#define _CUDA_STD___ALGORITHM_SIMD_UTILS_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+// Vectorized host implementations of the algorithms that compare the elements of contiguous ranges for equality, like
+// find, count and mismatch. Integers and pointers are equal if and only if their object representations are equal, so
+// ranges of them are compared as arrays of unsigned integers, a vector register at a time. The instruction set is
+// selected at compile time: AVX2 if the compiler targets it, SSE2 otherwise on x86-64, and NEON on Arm64.
+
+#if !_CCCL_COMPILER(NVRTC) && _CCCL_HOST_COMPILATION()
+#  if _CCCL_ARCH(X86_64)
+#    define _CCCL_HAS_HOST_SIMD() 1
+#    include <immintrin.h>
+#  elif _CCCL_ARCH(ARM64) && (defined(__ARM_NEON) || defined(_M_ARM64))
+#    define _CCCL_HAS_HOST_SIMD() 1
+#    include <arm_neon.h>
+#  endif // _CCCL_ARCH(ARM64)
+#endif // !_CCCL_COMPILER(NVRTC) && _CCCL_HOST_COMPILATION()
+
+#if !defined(_CCCL_HAS_HOST_SIMD)
+#  define _CCCL_HAS_HOST_SIMD() 0
+#endif // !_CCCL_HAS_HOST_SIMD
+
+#if _CCCL_HAS_HOST_SIMD()
+
+#  include <cuda/std/__algorithm/comp.h>
+#  include <cuda/std/__algorithm/min.h>
+#  include <cuda/std/__algorithm/unwrap_iter.h>
+#  include <cuda/std/__bit/bit_cast.h>
+#  include <cuda/std/__bit/countr.h>
+#  include <cuda/std/__cstddef/types.h>
+#  include <cuda/std/__iterator/iterator_traits.h>
+#  include <cuda/std/__memory/pointer_traits.h>
+#  include <cuda/std/__type_traits/is_integral.h>
+#  include <cuda/std/__type_traits/is_pointer.h>
+#  include <cuda/std/__type_traits/is_same.h>
+#  include <cuda/std/__type_traits/is_volatile.h>
+#  include <cuda/std/__type_traits/make_nbit_int.h>
+#  include <cuda/std/__type_traits/remove_const.h>
+#  include <cuda/std/__type_traits/remove_cv.h>
+#  include <cuda/std/__type_traits/remove_cvref.h>
+#  include <cuda/std/__type_traits/remove_pointer.h>
+#  include <cuda/std/__utility/declval.h>
+#  include <cuda/std/__utility/pair.h>
+#  include <cuda/std/climits>
+#  include <cuda/std/cstdint>
+#  include <cuda/std/limits>
+
+#  include <cstring>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+// Everything below depends on the instruction set, which is therefore made part of the mangled names. Otherwise the
+// linker would pick a single definition for translation units compiled for different instruction sets, e.g. with and
+// without -mavx2, and run AVX2 code from the ones that were not compiled for it.
+#  if _CCCL_ARCH(X86_64) && defined(__AVX2__)
+#    define _CCCL_HOST_SIMD_NAMESPACE __avx2
+#  elif _CCCL_ARCH(X86_64)
+#    define _CCCL_HOST_SIMD_NAMESPACE __sse2
+#  else // ^^^ x86-64 ^^^ / vvv Arm64 vvv
+#    define _CCCL_HOST_SIMD_NAMESPACE __neon
+#  endif // ^^^ Arm64 ^^^
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+inline namespace _CCCL_HOST_SIMD_NAMESPACE
+{
+
+// __host_simd provides the vector operations of the selected instruction set. The elements of a vector are unsigned
+// integers of the type passed as template argument. Comparisons return a vector whose elements are all ones where the
+// operands are equal and zero elsewhere, and __mask packs such a vector into an integer with __mask_bits_per_byte bits
+// per byte, the lowest ones belonging to the first byte.
+
+#  if _CCCL_ARCH(X86_64) && defined(__AVX2__)
+
+struct __host_simd
+{
+  using __vector = __m256i;
+
+  static constexpr size_t __bytes           = 32;
+  static constexpr int __mask_bits_per_byte = 1;
+
+  [[nodiscard]] _CCCL_HOST_API static __vector __zero() noexcept
+  {
+    return _mm256_setzero_si256();
+  }
+
+  [[nodiscard]] _CCCL_HOST_API static __vector __load(const void* __ptr) noexcept
+  {
+    return _mm256_loadu_si256(static_cast<const __m256i*>(__ptr));
+  }
+
+  _CCCL_HOST_API static void __store(void* __ptr, __vector __v) noexcept
+  {
+    _mm256_storeu_si256(static_cast<__m256i*>(__ptr), __v);
+  }
+
+  template <class _Up>
+  [[nodiscard]] _CCCL_HOST_API static __vector __broadcast(_Up __value) noexcept
+  {
+    if constexpr (sizeof(_Up) == 1)
+    {
+      return _mm256_set1_epi8(static_cast<char>(__value));
+    }
+    else if constexpr (sizeof(_Up) == 2)
+    {
+      return _mm256_set1_epi16(static_cast<short>(__value));
+    }
+    else if constexpr (sizeof(_Up) == 4)
+    {
+      return _mm256_set1_epi32(static_cast<int>(__value));
+    }
+    else
+    {
+      return _mm256_set1_epi64x(static_cast<long long>(__value));
+    }
+  }
+
+  template <class _Up>
+  [[nodiscard]] _CCCL_HOST_API static __vector __equal(__vector __lhs, __vector __rhs) noexcept
+  {
+    if constexpr (sizeof(_Up) == 1)
+    {
+      return _mm256_cmpeq_epi8(__lhs, __rhs);
+    }
+    else if constexpr (sizeof(_Up) == 2)
+    {
+      return _mm256_cmpeq_epi16(__lhs, __rhs);
+    }
+    else if constexpr (sizeof(_Up) == 4)
+    {
+      return _mm256_cmpeq_epi32(__lhs, __rhs);
+    }
+    else
+    {
+      return _mm256_cmpeq_epi64(__lhs, __rhs);
+    }
+  }
+
+  template <class _Up>
+  [[nodiscard]] _CCCL_HOST_API static __vector __sub(__vector __lhs, __vector __rhs) noexcept
+  {
+    if constexpr (sizeof(_Up) == 1)
+    {
+      return _mm256_sub_epi8(__lhs, __rhs);
+    }
+    else if constexpr (sizeof(_Up) == 2)
+    {
+      return _mm256_sub_epi16(__lhs, __rhs);
+    }
+    else if constexpr (sizeof(_Up) == 4)
+    {
+      return _mm256_sub_epi32(__lhs, __rhs);
+    }
+    else
+    {
+      return _mm256_sub_epi64(__lhs, __rhs);
+    }
+  }
+
+  [[nodiscard]] _CCCL_HOST_API static __vector __and(__vector __lhs, __vector __rhs) noexcept
+  {
+    return _mm256_and_si256(__lhs, __rhs);
+  }
+
+  [[nodiscard]] _CCCL_HOST_API static __vector __or(__vector __lhs, __vector __rhs) noexcept
+  {
+    return _mm256_or_si256(__lhs, __rhs);
+  }
+
+  [[nodiscard]] _CCCL_HOST_API static uint64_t __mask(__vector __v) noexcept
+  {
+    return static_cast<uint32_t>(_mm256_movemask_epi8(__v));
+  }
+};
+
+#  elif _CCCL_ARCH(X86_64)
+
+struct __host_simd
+{
+  using __vector = __m128i;
+
+  static constexpr size_t __bytes           = 16;
+  static constexpr int __mask_bits_per_byte = 1;
+
+  [[nodiscard]] _CCCL_HOST_API static __vector __zero() noexcept
+  {
+    return _mm_setzero_si128();
+  }
+
+  [[nodiscard]] _CCCL_HOST_API static __vector __load(const void* __ptr) noexcept
+  {
+    return _mm_loadu_si128(static_cast<const __m128i*>(__ptr));
+  }
+
+  _CCCL_HOST_API static void __store(void* __ptr, __vector __v) noexcept
+  {
+    _mm_storeu_si128(static_cast<__m128i*>(__ptr), __v);
+  }
+
+  template <class _Up>
+  [[nodiscard]] _CCCL_HOST_API static __vector __broadcast(_Up __value) noexcept
+  {
+    if constexpr (sizeof(_Up) == 1)
+    {
+      return _mm_set1_epi8(static_cast<char>(__value));
+    }
+    else if constexpr (sizeof(_Up) == 2)
+    {
+      return _mm_set1_epi16(static_cast<short>(__value));
+    }
+    else if constexpr (sizeof(_Up) == 4)
+    {
+      return _mm_set1_epi32(static_cast<int>(__value));
+    }
+    else
+    {
+      return _mm_set1_epi64x(static_cast<long long>(__value));
+    }
+  }
+
+  template <class _Up>
+  [[nodiscard]] _CCCL_HOST_API static __vector __equal(__vector __lhs, __vector __rhs) noexcept
+  {
+    if constexpr (sizeof(_Up) == 1)
+    {
+      return _mm_cmpeq_epi8(__lhs, __rhs);
+    }
+    else if constexpr (sizeof(_Up) == 2)
+    {
+      return _mm_cmpeq_epi16(__lhs, __rhs);
+    }
+    else if constexpr (sizeof(_Up) == 4)
+    {
+      return _mm_cmpeq_epi32(__lhs, __rhs);
+    }
+    else
+    {
+      // SSE2 has no 64-bit comparison: both halves of an element must be equal
+      const __m128i __halves = _mm_cmpeq_epi32(__lhs, __rhs);
+      return _mm_and_si128(__halves, _mm_shuffle_epi32(__halves, _MM_SHUFFLE(2, 3, 0, 1)));
+    }
+  }
+
+  template <class _Up>
+  [[nodiscard]] _CCCL_HOST_API static __vector __sub(__vector __lhs, __vector __rhs) noexcept
+  {
+    if constexpr (sizeof(_Up) == 1)
+    {
+      return _mm_sub_epi8(__lhs, __rhs);
+    }
+    else if constexpr (sizeof(_Up) == 2)
+    {
+      return _mm_sub_epi16(__lhs, __rhs);
+    }
+    else if constexpr (sizeof(_Up) == 4)
+    {
+      return _mm_sub_epi32(__lhs, __rhs);
+    }
+    else
+    {
+      return _mm_sub_epi64(__lhs, __rhs);
+    }
+  }
+
+  [[nodiscard]] _CCCL_HOST_API static __vector __and(__vector __lhs, __vector __rhs) noexcept
+  {
+    return _mm_and_si128(__lhs, __rhs);
+  }
+
+  [[nodiscard]] _CCCL_HOST_API static __vector __or(__vector __lhs, __vector __rhs) noexcept
+  {
+    return _mm_or_si128(__lhs, __rhs);
+  }
+
+  [[nodiscard]] _CCCL_HOST_API static uint64_t __mask(__vector __v) noexcept
+  {
+    return static_cast<uint32_t>(_mm_movemask_epi8(__v));
+  }
+};
+
+#  else // ^^^ x86-64 ^^^ / vvv Arm64 vvv
+
+struct __host_simd
+{
+  using __vector = uint8x16_t;
+
+  static constexpr size_t __bytes = 16;
+  // NEON has no movemask, narrowing every 16-bit lane to its middle byte leaves four bits per byte
+  static constexpr int __mask_bits_per_byte = 4;
+
+  [[nodiscard]] _CCCL_HOST_API static __vector __zero() noexcept
+  {
+    return vdupq_n_u8(0);
+  }
+
+  [[nodiscard]] _CCCL_HOST_API static __vector __load(const void* __ptr) noexcept
+  {
+    return vld1q_u8(static_cast<const uint8_t*>(__ptr));
+  }
+
+  _CCCL_HOST_API static void __store(void* __ptr, __vector __v) noexcept
+  {
+    vst1q_u8(static_cast<uint8_t*>(__ptr), __v);
+  }
+
+  template <class _Up>
+  [[nodiscard]] _CCCL_HOST_API static __vector __broadcast(_Up __value) noexcept
+  {
+    if constexpr (sizeof(_Up) == 1)
+    {
+      return vdupq_n_u8(__value);
+    }
+    else if constexpr (sizeof(_Up) == 2)
+    {
+      return vreinterpretq_u8_u16(vdupq_n_u16(__value));
+    }
+    else if constexpr (sizeof(_Up) == 4)
+    {
+      return vreinterpretq_u8_u32(vdupq_n_u32(__value));
+    }
+    else
+    {
+      return vreinterpretq_u8_u64(vdupq_n_u64(__value));
+    }
+  }
+
+  template <class _Up>
+  [[nodiscard]] _CCCL_HOST_API static __vector __equal(__vector __lhs, __vector __rhs) noexcept
+  {
+    if constexpr (sizeof(_Up) == 1)
+    {
+      return vceqq_u8(__lhs, __rhs);
+    }
+    else if constexpr (sizeof(_Up) == 2)
+    {
+      return vreinterpretq_u8_u16(vceqq_u16(vreinterpretq_u16_u8(__lhs), vreinterpretq_u16_u8(__rhs)));
+    }
+    else if constexpr (sizeof(_Up) == 4)
+    {
+      return vreinterpretq_u8_u32(vceqq_u32(vreinterpretq_u32_u8(__lhs), vreinterpretq_u32_u8(__rhs)));
+    }
+    else
+    {
+      return vreinterpretq_u8_u64(vceqq_u64(vreinterpretq_u64_u8(__lhs), vreinterpretq_u64_u8(__rhs)));
+    }
+  }
+
+  template <class _Up>
+  [[nodiscard]] _CCCL_HOST_API static __vector __sub(__vector __lhs, __vector __rhs) noexcept
+  {
+    if constexpr (sizeof(_Up) == 1)
+    {
+      return vsubq_u8(__lhs, __rhs);
+    }
+    else if constexpr (sizeof(_Up) == 2)
+    {
+      return vreinterpretq_u8_u16(vsubq_u16(vreinterpretq_u16_u8(__lhs), vreinterpretq_u16_u8(__rhs)));
+    }
+    else if constexpr (sizeof(_Up) == 4)
+    {
+      return vreinterpretq_u8_u32(vsubq_u32(vreinterpretq_u32_u8(__lhs), vreinterpretq_u32_u8(__rhs)));
+    }
+    else
+    {
+      return vreinterpretq_u8_u64(vsubq_u64(vreinterpretq_u64_u8(__lhs), vreinterpretq_u64_u8(__rhs)));
+    }
+  }
+
+  [[nodiscard]] _CCCL_HOST_API static __vector __and(__vector __lhs, __vector __rhs) noexcept
+  {
+    return vandq_u8(__lhs, __rhs);
+  }
+
+  [[nodiscard]] _CCCL_HOST_API static __vector __or(__vector __lhs, __vector __rhs) noexcept
+  {
+    return vorrq_u8(__lhs, __rhs);
+  }
+
+  [[nodiscard]] _CCCL_HOST_API static uint64_t __mask(__vector __v) noexcept
+  {
+    const uint8x8_t __nibbles = vshrn_n_u16(vreinterpretq_u16_u8(__v), 4);
+    return vget_lane_u64(vreinterpret_u64_u8(__nibbles), 0);
+  }
+};
+
+#  endif // ^^^ Arm64 ^^^
+
+//! The number of vectors compared per iteration of the main loops, whose results are combined before they are tested
+inline constexpr size_t __host_simd_unroll = 4;
+
+//! Whether integers or pointers of type `_Tp` can be compared as unsigned integers of the same size
+template <class _Tp>
+inline constexpr bool __is_simd_comparable_v =
+  !is_volatile_v<_Tp> && (is_integral_v<_Tp> || is_pointer_v<_Tp>)
+  && (sizeof(_Tp) == 1 || sizeof(_Tp) == 2 || sizeof(_Tp) == 4 || sizeof(_Tp) == 8);
+
+template <class _Iter>
+using __simd_element_t = remove_const_t<remove_pointer_t<decltype(::cuda::std::__to_address(declval<_Iter>()))>>;
+
+//! Whether `_Iter` is a contiguous iterator over integers or pointers that can be compared as unsigned integers
+template <class _Iter, bool = __has_contiguous_traversal<_Iter>>
+inline constexpr bool __is_simd_comparable_iter_v = false;
+
+template <class _Iter>
+inline constexpr bool __is_simd_comparable_iter_v<_Iter, true> =
+  __is_simd_comparable_v<remove_pointer_t<decltype(::cuda::std::__to_address(declval<_Iter>()))>>;
+
+//! Whether the elements of `_Iter` equal to a `_Tp` can be searched with __simd_find and __simd_count. An integral
+//! value is converted to the element type, while a pointer must have the element type already.
+template <class _Iter, class _Tp, bool = __is_simd_comparable_iter_v<_Iter>>
+inline constexpr bool __can_simd_find_v = false;
+
+template <class _Iter, class _Tp>
+inline constexpr bool __can_simd_find_v<_Iter, _Tp, true> =
+  is_integral_v<__simd_element_t<_Iter>> ? is_integral_v<_Tp> : is_same_v<remove_cv_t<_Tp>, __simd_element_t<_Iter>>;
+
+//! Whether the elements of `_Iter1` and `_Iter2` compared with `_BinaryPredicate` can be compared with
+//! __simd_mismatch and __simd_equal
+template <class _Iter1,
+          class _Iter2,
+          class _BinaryPredicate,
+          bool = __is_simd_comparable_iter_v<_Iter1> && __is_simd_comparable_iter_v<_Iter2>>
+inline constexpr bool __can_simd_mismatch_v = false;
+
+template <class _Iter1, class _Iter2, class _BinaryPredicate>
+inline constexpr bool __can_simd_mismatch_v<_Iter1, _Iter2, _BinaryPredicate, true> =
+  is_same_v<__simd_element_t<_Iter1>, __simd_element_t<_Iter2>>
+  && is_same_v<remove_cvref_t<_BinaryPredicate>, __equal_to>;
+
+//! Returns the index of the first element of [__ptr, __ptr + __n) equal to `__value`, or `__n` if there is none
+template <class _Up>
+[[nodiscard]] _CCCL_HOST_API size_t __simd_find_impl(const _Up* __ptr, size_t __n, _Up __value) noexcept
+{
+  constexpr size_t __lanes      = __host_simd::__bytes / sizeof(_Up);
+  constexpr int __bits_per_elem = __host_simd::__mask_bits_per_byte * sizeof(_Up);
+
+  const auto __needle = __host_simd::__broadcast(__value);
+
+  size_t __i = 0;
+  for (; __n - __i >= __host_simd_unroll * __lanes; __i += __host_simd_unroll * __lanes)
+  {
+    typename __host_simd::__vector __eq[__host_simd_unroll];
+    _CCCL_PRAGMA_UNROLL_FULL()
+    for (size_t __j = 0; __j < __host_simd_unroll; ++__j)
+    {
+      __eq[__j] = __host_simd::__equal<_Up>(__host_simd::__load(__ptr + __i + __j * __lanes), __needle);
+    }
+    const auto __any = __host_simd::__or(__host_simd::__or(__eq[0], __eq[1]), __host_simd::__or(__eq[2], __eq[3]));
+    if (__host_simd::__mask(__any) != 0)
+    {
+      _CCCL_PRAGMA_UNROLL_FULL()
+      for (size_t __j = 0; __j < __host_simd_unroll; ++__j)
+      {
+        const uint64_t __mask = __host_simd::__mask(__eq[__j]);
+        if (__mask != 0)
+        {
+          return __i + __j * __lanes + ::cuda::std::countr_zero(__mask) / __bits_per_elem;
+        }
+      }
+    }
+  }
+  for (; __n - __i >= __lanes; __i += __lanes)
+  {
+    const uint64_t __mask =
+      __host_simd::__mask(__host_simd::__equal<_Up>(__host_simd::__load(__ptr + __i), __needle));
+    if (__mask != 0)
+    {
+      return __i + ::cuda::std::countr_zero(__mask) / __bits_per_elem;
+    }
+  }
+  for (; __i < __n && __ptr[__i] != __value; ++__i)
+  {
+  }
+  return __i;
+}
+
+//! Returns the number of elements of [__ptr, __ptr + __n) equal to `__value`
+template <class _Up>
+[[nodiscard]] _CCCL_HOST_API size_t __simd_count_impl(const _Up* __ptr, size_t __n, _Up __value) noexcept
+{
+  constexpr size_t __lanes = __host_simd::__bytes / sizeof(_Up);
+  // the per-lane counters wrap around after this many vectors
+  constexpr size_t __max_vectors = static_cast<size_t>(numeric_limits<_Up>::max());
+
+  const auto __needle = __host_simd::__broadcast(__value);
+
+  size_t __count = 0;
+  size_t __i     = 0;
+  while (__n - __i >= __lanes)
+  {
+    const size_t __vectors = ::cuda::std::min((__n - __i) / __lanes, __max_vectors);
+
+    // equal elements compare to all ones, that is -1, so subtracting the comparisons increments their counters
+    auto __counters = __host_simd::__zero();
+    for (size_t __k = 0; __k < __vectors; ++__k, __i += __lanes)
+    {
+      __counters =
+        __host_simd::__sub<_Up>(__counters, __host_simd::__equal<_Up>(__host_simd::__load(__ptr + __i), __needle));
+    }
+
+    _Up __lane_counts[__lanes];
+    __host_simd::__store(__lane_counts, __counters);
+    for (size_t __j = 0; __j < __lanes; ++__j)
+    {
+      __count += __lane_counts[__j];
+    }
+  }
+  for (; __i < __n; ++__i)
+  {
+    __count += __ptr[__i] == __value;
+  }
+  return __count;
+}
+
+//! Returns the index of the first element of [__lhs, __lhs + __n) not equal to the element of `__rhs` with the same
+//! index, or `__n` if there is none
+template <class _Up>
+[[nodiscard]] _CCCL_HOST_API size_t __simd_mismatch_impl(const _Up* __lhs, const _Up* __rhs, size_t __n) noexcept
+{
+  constexpr size_t __lanes      = __host_simd::__bytes / sizeof(_Up);
+  constexpr int __bits_per_elem = __host_simd::__mask_bits_per_byte * sizeof(_Up);
+  constexpr int __mask_bits     = __host_simd::__mask_bits_per_byte * __host_simd::__bytes;
+
+  size_t __i = 0;
+  for (; __n - __i >= __host_simd_unroll * __lanes; __i += __host_simd_unroll * __lanes)
+  {
+    typename __host_simd::__vector __eq[__host_simd_unroll];
+    _CCCL_PRAGMA_UNROLL_FULL()
+    for (size_t __j = 0; __j < __host_simd_unroll; ++__j)
+    {
+      __eq[__j] = __host_simd::__equal<_Up>(
+        __host_simd::__load(__lhs + __i + __j * __lanes), __host_simd::__load(__rhs + __i + __j * __lanes));
+    }
+    const auto __all = __host_simd::__and(__host_simd::__and(__eq[0], __eq[1]), __host_simd::__and(__eq[2], __eq[3]));
+    if (::cuda::std::countr_one(__host_simd::__mask(__all)) < __mask_bits)
+    {
+      _CCCL_PRAGMA_UNROLL_FULL()
+      for (size_t __j = 0; __j < __host_simd_unroll; ++__j)
+      {
+        const int __equal_bits = ::cuda::std::countr_one(__host_simd::__mask(__eq[__j]));
+        if (__equal_bits < __mask_bits)
+        {
+          return __i + __j * __lanes + __equal_bits / __bits_per_elem;
+        }
+      }
+    }
+  }
+  for (; __n - __i >= __lanes; __i += __lanes)
+  {
+    const int __equal_bits = ::cuda::std::countr_one(__host_simd::__mask(
+      __host_simd::__equal<_Up>(__host_simd::__load(__lhs + __i), __host_simd::__load(__rhs + __i))));
+    if (__equal_bits < __mask_bits)
+    {
+      return __i + __equal_bits / __bits_per_elem;
+    }
+  }
+  for (; __i < __n && __lhs[__i] == __rhs[__i]; ++__i)
+  {
+  }
+  return __i;
+}
+
+//! Host implementation of find for iterators satisfying __can_simd_find_v
+template <class _Iter, class _Tp>
+[[nodiscard]] _CCCL_HOST_API _Iter __simd_find(_Iter __first, _Iter __last, const _Tp& __value)
+{
+  using _Elem = __simd_element_t<_Iter>;
+  using _Up   = __make_nbit_uint_t<sizeof(_Elem) * CHAR_BIT>;
+
+  if constexpr (is_integral_v<_Elem>)
+  {
+    // a value not representable by the element type compares unequal to all elements
+    if (!(static_cast<_Elem>(__value) == __value))
+    {
+      return __last;
+    }
+  }
+
+  const auto __ptr    = ::cuda::std::__unwrap_iter(__first);
+  const auto __n      = static_cast<size_t>(::cuda::std::__unwrap_iter(__last) - __ptr);
+  const auto __needle = ::cuda::std::bit_cast<_Up>(static_cast<_Elem>(__value));
+
+  size_t __pos;
+  if constexpr (sizeof(_Elem) == 1)
+  {
+    // the C library provides a vectorized search for bytes
+    const auto __found = __n == 0 ? nullptr : static_cast<const _Up*>(::memchr(__ptr, __needle, __n));
+    __pos              = __found ? static_cast<size_t>(__found - reinterpret_cast<const _Up*>(__ptr)) : __n;
+  }
+  else
+  {
+    __pos = ::cuda::std::__simd_find_impl(reinterpret_cast<const _Up*>(__ptr), __n, __needle);
+  }
+  return ::cuda::std::__rewrap_iter(__first, __ptr + __pos);
+}
+
+//! Host implementation of count for iterators satisfying __can_simd_find_v
+template <class _Iter, class _Tp>
+[[nodiscard]] _CCCL_HOST_API __iter_diff_t<_Iter> __simd_count(_Iter __first, _Iter __last, const _Tp& __value)
+{
+  using _Elem = __simd_element_t<_Iter>;
+  using _Up   = __make_nbit_uint_t<sizeof(_Elem) * CHAR_BIT>;
+
+  if constexpr (is_integral_v<_Elem>)
+  {
+    if (!(static_cast<_Elem>(__value) == __value))
+    {
+      return 0;
+    }
+  }
+
+  const auto __ptr = ::cuda::std::__unwrap_iter(__first);
+  const auto __n   = static_cast<size_t>(::cuda::std::__unwrap_iter(__last) - __ptr);
+  return static_cast<__iter_diff_t<_Iter>>(::cuda::std::__simd_count_impl(
+    reinterpret_cast<const _Up*>(__ptr), __n, ::cuda::std::bit_cast<_Up>(static_cast<_Elem>(__value))));
+}
+
+//! Host implementation of mismatch for iterators satisfying __can_simd_mismatch_v, comparing `__n` elements
+template <class _Iter1, class _Iter2>
+[[nodiscard]] _CCCL_HOST_API pair<_Iter1, _Iter2> __simd_mismatch(_Iter1 __first1, _Iter2 __first2, size_t __n)
+{
+  using _Up = __make_nbit_uint_t<sizeof(__simd_element_t<_Iter1>) * CHAR_BIT>;
+
+  const auto __ptr1 = ::cuda::std::__unwrap_iter(__first1);
+  const auto __ptr2 = ::cuda::std::__unwrap_iter(__first2);
+  const size_t __pos =
+    ::cuda::std::__simd_mismatch_impl(reinterpret_cast<const _Up*>(__ptr1), reinterpret_cast<const _Up*>(__ptr2), __n);
+  return pair<_Iter1, _Iter2>{
+    ::cuda::std::__rewrap_iter(__first1, __ptr1 + __pos), ::cuda::std::__rewrap_iter(__first2, __ptr2 + __pos)};
+}
+
+//! Host implementation of equal for iterators satisfying __can_simd_mismatch_v, comparing `__n` elements
+template <class _Iter1, class _Iter2>
+[[nodiscard]] _CCCL_HOST_API bool __simd_equal(_Iter1 __first1, _Iter2 __first2, size_t __n)
+{
+  // only equality matters, so the order memcmp compares in does not
+  return __n == 0
+      || ::memcmp(::cuda::std::__unwrap_iter(__first1),
+                  ::cuda::std::__unwrap_iter(__first2),
+                  __n * sizeof(__simd_element_t<_Iter1>))
+           == 0;
+}
+
+} // namespace _CCCL_HOST_SIMD_NAMESPACE
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_HOST_SIMD()
+
+#endif // _CUDA_STD___ALGORITHM_SIMD_UTILS_H
@@ -23,7 +23,14 @@
 
 #include <cuda/std/__atomic/order.h>
 #include <cuda/std/__atomic/scopes.h>
+#include <cuda/std/__atomic/types.h>
 #include <cuda/std/__atomic/wait/polling.h>
+#include <cuda/std/__chrono/duration.h>
+#include <cuda/std/__thread/threading_support.h>
+#include <cuda/std/__type_traits/is_same.h>
+#include <cuda/std/climits>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstdint>
 #include <cuda/std/cstring>
 
 #include <cuda/std/__cccl/prologue.h>
@@ -32,35 +39,160 @@ _CCCL_BEGIN_NAMESPACE_CUDA_STD
 
 extern "C" _CCCL_DEVICE void __atomic_try_wait_unsupported_before_SM_70__();
 
+template <typename _Tp>
+_CCCL_API inline bool __nonatomic_compare_equal(_Tp const& __lhs, _Tp const& __rhs)
+{
+#if _CCCL_CUDA_COMPILATION()
+  return __lhs == __rhs;
+#else // ^^^ _CCCL_CUDA_COMPILATION() ^^^ / vvv !_CCCL_CUDA_COMPILATION() vvv
+  return ::cuda::std::memcmp(&__lhs, &__rhs, sizeof(_Tp)) == 0;
+#endif // ^^^ !_CCCL_CUDA_COMPILATION() ^^^
+}
+
+#if defined(_LIBCUDACXX_HAS_FUTEX)
+
+// Host waiters block in the kernel. Objects of 32 bits are waited on directly. Every other object shares the futex
+// word of a slot in a table indexed by address, and each notification on an address that maps to the slot bumps that
+// word. Each slot also counts its waiters, so a notification with no waiters never leaves user space.
+struct _CCCL_ALIGNAS(64) __atomic_wait_slot
+{
+  int32_t __waiters;
+  uint32_t __version;
+};
+
+inline constexpr size_t __atomic_wait_table_size = 256;
+
+// Not hidden: every shared object of the process has to see the same table.
+_CCCL_HOST _CCCL_VISIBILITY_DEFAULT inline __atomic_wait_slot* __atomic_wait_table() noexcept
+{
+  static __atomic_wait_slot __table[__atomic_wait_table_size];
+  return __table;
+}
+
+_CCCL_HOST_API inline __atomic_wait_slot* __atomic_wait_slot_for(const volatile void* __addr) noexcept
+{
+  const auto __key = reinterpret_cast<uintptr_t>(__addr) >> 2;
+  return __atomic_wait_table() + (__key ^ (__key >> 8)) % __atomic_wait_table_size;
+}
+
+// The address of the object that is waited on, which atomic_refs to the same object agree on.
+template <typename _Sto, __atomic_storage_is_base<_Sto> = 0>
+_CCCL_HOST_API const volatile void* __atomic_wait_address(_Sto const volatile* __a) noexcept
+{
+  return __a->get();
+}
+
+template <typename _Sto, __atomic_storage_is_small<_Sto> = 0>
+_CCCL_HOST_API const volatile void* __atomic_wait_address(_Sto const volatile* __a) noexcept
+{
+  return __a->__a_value.get();
+}
+
+template <typename _Sto, __atomic_storage_is_locked<_Sto> = 0>
+_CCCL_HOST_API const volatile void* __atomic_wait_address(_Sto const volatile* __a) noexcept
+{
+  return &__a->__a_value;
+}
+
+template <typename _Sto>
+inline constexpr bool __atomic_wait_is_direct =
+  _Sto::__tag == __atomic_tag::__atomic_base_tag && sizeof(__atomic_underlying_t<_Sto>) == sizeof(uint32_t);
+
+template <typename _Tp, typename _Sco>
+_CCCL_HOST_API void __atomic_try_wait_slow_host(
+  _Tp const volatile* __a, __atomic_underlying_remove_cv_t<_Tp> __val, memory_order __order, _Sco)
+{
+  // The device cannot wake up host threads, so waits on objects it may modify only block for a bounded time.
+  const ::cuda::std::chrono::nanoseconds __timeout = is_same_v<_Sco, __thread_scope_system_tag>
+                                                     ? ::cuda::std::chrono::milliseconds(1)
+                                                     : ::cuda::std::chrono::nanoseconds::zero();
+
+  const volatile void* __addr = ::cuda::std::__atomic_wait_address(__a);
+  __atomic_wait_slot* __slot  = ::cuda::std::__atomic_wait_slot_for(__addr);
+
+  __atomic_fetch_add_host(&__slot->__waiters, 1, memory_order_seq_cst);
+
+  if constexpr (__atomic_wait_is_direct<_Tp>)
+  {
+    uint32_t __expected;
+    ::cuda::std::memcpy(&__expected, &__val, sizeof(uint32_t));
+    ::cuda::std::__cccl_futex_wait(__addr, __expected, __timeout);
+  }
+  else
+  {
+    // a notification after this load changes the version, so the kernel refuses to put us to sleep
+    const uint32_t __version = __atomic_load_host(&__slot->__version, memory_order_seq_cst);
+    if (::cuda::std::__nonatomic_compare_equal(__atomic_load_dispatch(__a, __order, _Sco{}), __val))
+    {
+      ::cuda::std::__cccl_futex_wait(&__slot->__version, __version, __timeout);
+    }
+  }
+
+  __atomic_fetch_sub_host(&__slot->__waiters, 1, memory_order_relaxed);
+}
+
+template <typename _Tp>
+_CCCL_HOST_API void __atomic_notify_host(_Tp const volatile* __a, bool __all)
+{
+  const volatile void* __addr = ::cuda::std::__atomic_wait_address(__a);
+  __atomic_wait_slot* __slot  = ::cuda::std::__atomic_wait_slot_for(__addr);
+
+  if constexpr (__atomic_wait_is_direct<_Tp>)
+  {
+    // orders the modification being notified before the check for waiters
+    __atomic_thread_fence_host(memory_order_seq_cst);
+    if (__atomic_load_host(&__slot->__waiters, memory_order_relaxed) != 0)
+    {
+      ::cuda::std::__cccl_futex_wake(__addr, __all ? INT_MAX : 1);
+    }
+  }
+  else
+  {
+    __atomic_fetch_add_host(&__slot->__version, 1u, memory_order_seq_cst);
+    if (__atomic_load_host(&__slot->__waiters, memory_order_seq_cst) != 0)
+    {
+      // the slot may be shared with other objects, so all of its waiters have to recheck their own
+      ::cuda::std::__cccl_futex_wake(&__slot->__version, INT_MAX);
+    }
+  }
+}
+
+#else // ^^^ _LIBCUDACXX_HAS_FUTEX ^^^ / vvv !_LIBCUDACXX_HAS_FUTEX vvv
+
+template <typename _Tp, typename _Sco>
+_CCCL_API inline void __atomic_try_wait_slow_host(
+  _Tp const volatile* __a, __atomic_underlying_remove_cv_t<_Tp> __val, memory_order __order, _Sco)
+{
+  __atomic_try_wait_slow_fallback(__a, __val, __order, _Sco{});
+}
+
+template <typename _Tp>
+_CCCL_API inline void __atomic_notify_host(_Tp const volatile*, bool)
+{}
+
+#endif // ^^^ !_LIBCUDACXX_HAS_FUTEX ^^^
+
 template <typename _Tp, typename _Sco>
 _CCCL_API inline void
 __atomic_try_wait_slow(_Tp const volatile* __a, __atomic_underlying_remove_cv_t<_Tp> __val, memory_order __order, _Sco)
 {
   NV_DISPATCH_TARGET(NV_PROVIDES_SM_70, __atomic_try_wait_slow_fallback(__a, __val, __order, _Sco{});
-                     , NV_IS_HOST, __atomic_try_wait_slow_fallback(__a, __val, __order, _Sco{});
+                     , NV_IS_HOST, __atomic_try_wait_slow_host(__a, __val, __order, _Sco{});
                      , NV_ANY_TARGET, __atomic_try_wait_unsupported_before_SM_70__(););
 }
 
 template <typename _Tp, typename _Sco>
-_CCCL_API inline void __atomic_notify_one(_Tp const volatile*, _Sco)
+_CCCL_API inline void __atomic_notify_one(_Tp const volatile* __a, _Sco)
 {
-  NV_DISPATCH_TARGET(NV_PROVIDES_SM_70, , NV_IS_HOST, , NV_ANY_TARGET, __atomic_try_wait_unsupported_before_SM_70__(););
+  NV_DISPATCH_TARGET(NV_PROVIDES_SM_70, , NV_IS_HOST, __atomic_notify_host(__a, false);
+                     , NV_ANY_TARGET, __atomic_try_wait_unsupported_before_SM_70__(););
 }
 
 template <typename _Tp, typename _Sco>
-_CCCL_API inline void __atomic_notify_all(_Tp const volatile*, _Sco)
+_CCCL_API inline void __atomic_notify_all(_Tp const volatile* __a, _Sco)
 {
-  NV_DISPATCH_TARGET(NV_PROVIDES_SM_70, , NV_IS_HOST, , NV_ANY_TARGET, __atomic_try_wait_unsupported_before_SM_70__(););
-}
-
-template <typename _Tp>
-_CCCL_API inline bool __nonatomic_compare_equal(_Tp const& __lhs, _Tp const& __rhs)
-{
-#if _CCCL_CUDA_COMPILATION()
-  return __lhs == __rhs;
-#else // ^^^ _CCCL_CUDA_COMPILATION() ^^^ / vvv !_CCCL_CUDA_COMPILATION() vvv
-  return ::cuda::std::memcmp(&__lhs, &__rhs, sizeof(_Tp)) == 0;
-#endif // ^^^ !_CCCL_CUDA_COMPILATION() ^^^
+  NV_DISPATCH_TARGET(NV_PROVIDES_SM_70, , NV_IS_HOST, __atomic_notify_host(__a, true);
+                     , NV_ANY_TARGET, __atomic_try_wait_unsupported_before_SM_70__(););
 }
 
 template <typename _Tp, typename _Sco>
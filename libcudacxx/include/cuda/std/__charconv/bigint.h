@@ -0,0 +1,201 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___CHARCONV_BIGINT_H
+#define _CUDA_STD___CHARCONV_BIGINT_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__cstddef/types.h>
+#include <cuda/std/cstdint>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+//! @brief Fixed capacity unsigned big integer for the exact paths of the floating-point conversions
+//! The value is stored in little endian 32 bit limbs, of which only the first @c __size_ are in use, so that zero has
+//! no limbs at all. The capacity is chosen by the callers such that the conversions never exceed it.
+template <size_t _NumLimbs>
+struct __charconv_bigint
+{
+  uint32_t __limbs_[_NumLimbs]{};
+  size_t __size_{};
+
+  _CCCL_HIDE_FROM_ABI constexpr __charconv_bigint() noexcept = default;
+
+  _CCCL_API constexpr explicit __charconv_bigint(uint64_t __value) noexcept
+  {
+    while (__value != 0)
+    {
+      __limbs_[__size_++] = static_cast<uint32_t>(__value);
+      __value >>= 32;
+    }
+  }
+
+  [[nodiscard]] _CCCL_API constexpr bool __is_zero() const noexcept
+  {
+    return __size_ == 0;
+  }
+
+  _CCCL_API constexpr void __trim() noexcept
+  {
+    while (__size_ > 0 && __limbs_[__size_ - 1] == 0)
+    {
+      --__size_;
+    }
+  }
+
+  //! @brief Computes *this * __mul + __add
+  _CCCL_API constexpr void __mul_add(uint32_t __mul, uint32_t __add = 0) noexcept
+  {
+    uint64_t __carry = __add;
+    for (size_t __i = 0; __i < __size_; ++__i)
+    {
+      const uint64_t __product = static_cast<uint64_t>(__limbs_[__i]) * __mul + __carry;
+      __limbs_[__i]            = static_cast<uint32_t>(__product);
+      __carry                  = __product >> 32;
+    }
+    if (__carry != 0)
+    {
+      _CCCL_ASSERT(__size_ < _NumLimbs, "__charconv_bigint overflow");
+      __limbs_[__size_++] = static_cast<uint32_t>(__carry);
+    }
+  }
+
+  _CCCL_API constexpr void __mul_pow5(int __exp) noexcept
+  {
+    // 5^13 is the largest power of 5 that fits into a limb
+    constexpr uint32_t __pow5_13 = 1220703125;
+    for (; __exp >= 13; __exp -= 13)
+    {
+      __mul_add(__pow5_13);
+    }
+    uint32_t __pow5 = 1;
+    for (; __exp > 0; --__exp)
+    {
+      __pow5 *= 5;
+    }
+    __mul_add(__pow5);
+  }
+
+  _CCCL_API constexpr void __shift_left(int __bits) noexcept
+  {
+    if (__size_ == 0 || __bits == 0)
+    {
+      return;
+    }
+    const size_t __limb_shift = static_cast<size_t>(__bits) / 32;
+    const int __bit_shift     = __bits % 32;
+    _CCCL_ASSERT(__size_ + __limb_shift + 1 <= _NumLimbs, "__charconv_bigint overflow");
+
+    __limbs_[__size_ + __limb_shift] = 0;
+    for (size_t __i = __size_; __i-- > 0;)
+    {
+      const uint64_t __shifted = static_cast<uint64_t>(__limbs_[__i]) << __bit_shift;
+      __limbs_[__i + __limb_shift + 1] |= static_cast<uint32_t>(__shifted >> 32);
+      __limbs_[__i + __limb_shift] = static_cast<uint32_t>(__shifted);
+    }
+    for (size_t __i = 0; __i < __limb_shift; ++__i)
+    {
+      __limbs_[__i] = 0;
+    }
+    __size_ += __limb_shift + 1;
+    __trim();
+  }
+
+  //! @brief Divides by @c __div in place and returns the remainder
+  _CCCL_API constexpr uint32_t __divmod(uint32_t __div) noexcept
+  {
+    uint64_t __rem = 0;
+    for (size_t __i = __size_; __i-- > 0;)
+    {
+      const uint64_t __cur = (__rem << 32) | __limbs_[__i];
+      __limbs_[__i]        = static_cast<uint32_t>(__cur / __div);
+      __rem                = __cur % __div;
+    }
+    __trim();
+    return static_cast<uint32_t>(__rem);
+  }
+
+  //! @brief Removes the bits at and above @c __bits and returns them, they must fit into a limb
+  _CCCL_API constexpr uint32_t __split_above(int __bits) noexcept
+  {
+    const size_t __limb = static_cast<size_t>(__bits) / 32;
+    const int __shift   = __bits % 32;
+    if (__limb >= __size_)
+    {
+      return 0;
+    }
+
+    uint64_t __high = __limbs_[__limb];
+    if (__limb + 1 < __size_)
+    {
+      __high |= static_cast<uint64_t>(__limbs_[__limb + 1]) << 32;
+    }
+    _CCCL_ASSERT(__limb + 2 >= __size_, "__charconv_bigint::__split_above: result does not fit into a limb");
+
+    __limbs_[__limb] &= static_cast<uint32_t>((uint64_t{1} << __shift) - 1);
+    __size_ = __limb + 1;
+    __trim();
+    return static_cast<uint32_t>(__high >> __shift);
+  }
+
+  //! @brief Returns whether only the bit @c __bit is set
+  [[nodiscard]] _CCCL_API constexpr bool __is_pow2(int __bit) const noexcept
+  {
+    const size_t __limb = static_cast<size_t>(__bit) / 32;
+    if (__size_ != __limb + 1 || __limbs_[__limb] != (uint32_t{1} << (__bit % 32)))
+    {
+      return false;
+    }
+    for (size_t __i = 0; __i < __limb; ++__i)
+    {
+      if (__limbs_[__i] != 0)
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  //! @brief Returns a negative value, zero or a positive value if @c __lhs is less than, equal to or greater than
+  //! @c __rhs
+  [[nodiscard]] _CCCL_API friend constexpr int
+  __compare(const __charconv_bigint& __lhs, const __charconv_bigint& __rhs) noexcept
+  {
+    if (__lhs.__size_ != __rhs.__size_)
+    {
+      return __lhs.__size_ < __rhs.__size_ ? -1 : 1;
+    }
+    for (size_t __i = __lhs.__size_; __i-- > 0;)
+    {
+      if (__lhs.__limbs_[__i] != __rhs.__limbs_[__i])
+      {
+        return __lhs.__limbs_[__i] < __rhs.__limbs_[__i] ? -1 : 1;
+      }
+    }
+    return 0;
+  }
+};
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA_STD___CHARCONV_BIGINT_H
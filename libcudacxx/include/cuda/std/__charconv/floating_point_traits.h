@@ -0,0 +1,92 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___CHARCONV_FLOATING_POINT_TRAITS_H
+#define _CUDA_STD___CHARCONV_FLOATING_POINT_TRAITS_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__floating_point/format.h>
+#include <cuda/std/__floating_point/properties.h>
+#include <cuda/std/__floating_point/storage.h>
+#include <cuda/std/cstdint>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+//! @brief Properties of the binary formats supported by the floating-point overloads of to_chars and from_chars
+template <class _Tp>
+struct __charconv_fp_traits
+{
+  static constexpr __fp_format __format = __fp_format_of_v<_Tp>;
+
+  static constexpr bool __is_supported =
+    __format == __fp_format::__binary32 || __format == __fp_format::__binary64;
+
+  static constexpr int __mant_bits    = __fp_mant_nbits_v<__format>;
+  static constexpr int __exp_bias     = __fp_exp_bias_v<__format>;
+  static constexpr int __max_exp_bits = (1 << __fp_exp_nbits_v<__format>) - 1;
+
+  //! The binary exponent of the least significant bit of the subnormal values
+  static constexpr int __min_exp2 = 1 - __exp_bias - __mant_bits;
+
+  //! The largest number of significant decimal digits of the exact value of any finite value
+  static constexpr int __max_sig_digits = __format == __fp_format::__binary64 ? 767 : 112;
+
+  //! Nonzero decimal values with an exponent outside of [__min_exp10, __max_exp10] round to zero or overflow, given
+  //! a significand of at most 19 digits
+  static constexpr int __min_exp10 = __format == __fp_format::__binary64 ? -342 : -64;
+  static constexpr int __max_exp10 = __format == __fp_format::__binary64 ? 308 : 38;
+};
+
+//! @brief The decomposition of a floating-point value into its sign and biased exponent and mantissa fields
+struct __charconv_fp_fields
+{
+  bool __negative_;
+  int __exp_;
+  uint64_t __mant_;
+};
+
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr __charconv_fp_fields __charconv_fp_decompose(_Tp __value) noexcept
+{
+  using _Traits       = __charconv_fp_traits<_Tp>;
+  const auto __bits   = static_cast<uint64_t>(::cuda::std::__fp_get_storage(__value));
+  const int __exp_pos = _Traits::__mant_bits;
+  return {((__bits >> (__exp_pos + __fp_exp_nbits_v<_Traits::__format>) ) & 1) != 0,
+          static_cast<int>((__bits >> __exp_pos) & _Traits::__max_exp_bits),
+          __bits & ((uint64_t{1} << __exp_pos) - 1)};
+}
+
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr _Tp __charconv_fp_compose(bool __negative, int __exp, uint64_t __mant) noexcept
+{
+  using _Traits  = __charconv_fp_traits<_Tp>;
+  using _Storage = __fp_storage_of_t<_Tp>;
+  const uint64_t __sign =
+    static_cast<uint64_t>(__negative) << (_Traits::__mant_bits + __fp_exp_nbits_v<_Traits::__format>);
+  return ::cuda::std::__fp_from_storage<_Tp>(
+    static_cast<_Storage>(__sign | (static_cast<uint64_t>(__exp) << _Traits::__mant_bits) | __mant));
+}
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA_STD___CHARCONV_FLOATING_POINT_TRAITS_H
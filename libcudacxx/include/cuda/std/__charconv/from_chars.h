@@ -22,12 +22,15 @@
 
 #include <cuda/__cmath/neg.h>
 #include <cuda/__cmath/uabs.h>
+#include <cuda/std/__bit/countr.h>
+#include <cuda/std/__bit/endian.h>
 #include <cuda/std/__charconv/chars_format.h>
+#include <cuda/std/__charconv/from_chars_floating_point.h>
 #include <cuda/std/__charconv/from_chars_result.h>
 #include <cuda/std/__concepts/concept_macros.h>
 #include <cuda/std/__cstddef/types.h>
+#include <cuda/std/__cstring/memcpy.h>
 #include <cuda/std/__limits/numeric_limits.h>
-#include <cuda/std/__type_traits/always_false.h>
 #include <cuda/std/__type_traits/conditional.h>
 #include <cuda/std/__type_traits/is_floating_point.h>
 #include <cuda/std/__type_traits/is_integer.h>
@@ -46,31 +49,136 @@ struct __from_chars_char_to_value_result
   int __value_;
 };
 
+//! The value of each character as a digit, or 36 if it is not a digit in any base. A lookup avoids the branches on the
+//! character class, which are unpredictable in hexadecimal numbers.
+_CCCL_GLOBAL_CONSTANT uint8_t __from_chars_digit_values[256] = {
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 36, 36, 36, 36, 36, 36,
+  36, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24,
+  25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 36, 36, 36, 36,
+  36, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24,
+  25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+};
+
 [[nodiscard]] _CCCL_API constexpr __from_chars_char_to_value_result
 __from_chars_char_to_value(char __c, int __base) noexcept
 {
-  if (__base <= 10)
+  const int __value = __from_chars_digit_values[static_cast<unsigned char>(__c)];
+  return {__value < __base, __value};
+}
+
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr from_chars_result
+__from_chars_int_generic(const char* __first, const char* __last, _Tp& __value, int __base) noexcept
+{
+  // __value * __base + __digit overflows iff __value > (max - __digit) / __base
+  const _Tp __max_quot = numeric_limits<_Tp>::max() / static_cast<_Tp>(__base);
+  const int __max_rem  = static_cast<int>(numeric_limits<_Tp>::max() % static_cast<_Tp>(__base));
+
+  bool __overflow  = false;
+  const char* __it = __first;
+  for (; __it != __last; ++__it)
   {
-    return {'0' <= __c && __c < '0' + __base, __c - '0'};
+    const auto __digit = ::cuda::std::__from_chars_char_to_value(*__it, __base);
+    if (!__digit.__valid_)
+    {
+      break;
+    }
+    if (!__overflow)
+    {
+      __overflow = __value > __max_quot || (__value == __max_quot && __digit.__value_ > __max_rem);
+      __value    = static_cast<_Tp>(__value * static_cast<_Tp>(__base) + static_cast<_Tp>(__digit.__value_));
+    }
   }
-  else if ('0' <= __c && __c <= '9')
+  return {__it, (__overflow) ? errc::result_out_of_range : ((__it == __first) ? errc::invalid_argument : errc{})};
+}
+
+//! @brief Loads 8 characters into an integer, the first one being the least significant byte
+[[nodiscard]] _CCCL_API constexpr uint64_t __from_chars_load_8(const char* __ptr) noexcept
+{
+  if constexpr (endian::native == endian::little)
   {
-    return {true, __c - '0'};
+    _CCCL_IF_NOT_CONSTEVAL_DEFAULT
+    {
+      uint64_t __chunk{};
+      ::cuda::std::memcpy(&__chunk, __ptr, sizeof(__chunk));
+      return __chunk;
+    }
   }
-  else if ('a' <= __c && __c < 'a' + __base - 10)
+
+  uint64_t __chunk = 0;
+  for (int __i = 0; __i < 8; ++__i)
   {
-    return {true, __c - 'a' + 10};
+    __chunk |= static_cast<uint64_t>(static_cast<unsigned char>(__ptr[__i])) << (8 * __i);
   }
-  else
+  return __chunk;
+}
+
+[[nodiscard]] _CCCL_API constexpr bool __from_chars_is_8_digits(uint64_t __chunk) noexcept
+{
+  // Adding 6 to a byte in ['0', '9'] keeps its high nibble at 3, unlike for any other byte
+  return ((__chunk & 0xf0f0f0f0f0f0f0f0) | (((__chunk + 0x0606060606060606) & 0xf0f0f0f0f0f0f0f0) >> 4))
+      == 0x3333333333333333;
+}
+
+//! @brief Combines 8 decimal digits with three multiplications, merging pairs of digits, then pairs of pairs
+[[nodiscard]] _CCCL_API constexpr uint32_t __from_chars_parse_8_digits(uint64_t __chunk) noexcept
+{
+  constexpr uint64_t __mask = 0x000000ff000000ff;
+  constexpr uint64_t __mul1 = 100 + (uint64_t{1000000} << 32);
+  constexpr uint64_t __mul2 = 1 + (uint64_t{10000} << 32);
+  __chunk -= 0x3030303030303030;
+  __chunk = (__chunk * 10) + (__chunk >> 8);
+  return static_cast<uint32_t>(((__chunk & __mask) * __mul1 + ((__chunk >> 16) & __mask) * __mul2) >> 32);
+}
+
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr from_chars_result
+__from_chars_int_base10(const char* __first, const char* __last, _Tp& __value) noexcept
+{
+  const char* __it = __first;
+  if constexpr (sizeof(_Tp) >= sizeof(uint32_t))
   {
-    return {'A' <= __c && __c < 'A' + __base - 10, __c - 'A' + 10};
+    // Consume 8 digits at a time as long as they cannot overflow
+    constexpr _Tp __max_swar = (numeric_limits<_Tp>::max() - 99999999) / 100000000;
+    while (__last - __it >= 8 && __value <= __max_swar)
+    {
+      const uint64_t __chunk = ::cuda::std::__from_chars_load_8(__it);
+      if (!::cuda::std::__from_chars_is_8_digits(__chunk))
+      {
+        break;
+      }
+      __value = static_cast<_Tp>(__value * 100000000 + ::cuda::std::__from_chars_parse_8_digits(__chunk));
+      __it += 8;
+    }
   }
+
+  const auto __ret = ::cuda::std::__from_chars_int_generic(__it, __last, __value, 10);
+  if (__ret.ec == errc::invalid_argument && __it != __first)
+  {
+    return {__ret.ptr, errc{}};
+  }
+  return __ret;
 }
 
+//! @brief Parses the digits of a power of two base, for which overflow is detected by the bits shifted out
 template <class _Tp>
 [[nodiscard]] _CCCL_API constexpr from_chars_result
-__from_chars_int_generic(const char* __first, const char* __last, _Tp& __value, int __base) noexcept
+__from_chars_int_pow2(const char* __first, const char* __last, _Tp& __value, int __base) noexcept
 {
+  constexpr int __num_bits = numeric_limits<_Tp>::digits;
+  const int __shift        = ::cuda::std::countr_zero(static_cast<unsigned>(__base));
+
   bool __overflow  = false;
   const char* __it = __first;
   for (; __it != __last; ++__it)
@@ -80,19 +188,27 @@ __from_chars_int_generic(const char* __first, const char* __last, _Tp& __value,
     {
       break;
     }
-    if (!__overflow)
-    {
-      const auto __new_value = static_cast<_Tp>(__value * _Tp(__base) + _Tp(__digit.__value_));
-      if (__new_value < __value)
-      {
-        __overflow = true;
-      }
-      __value = __new_value;
-    }
+    __overflow |= (__value >> (__num_bits - __shift)) != 0;
+    __value = static_cast<_Tp>((__value << __shift) | static_cast<_Tp>(__digit.__value_));
   }
   return {__it, (__overflow) ? errc::result_out_of_range : ((__it == __first) ? errc::invalid_argument : errc{})};
 }
 
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr from_chars_result
+__from_chars_int(const char* __first, const char* __last, _Tp& __value, int __base) noexcept
+{
+  if (__base == 10)
+  {
+    return ::cuda::std::__from_chars_int_base10(__first, __last, __value);
+  }
+  if ((__base & (__base - 1)) == 0)
+  {
+    return ::cuda::std::__from_chars_int_pow2(__first, __last, __value, __base);
+  }
+  return ::cuda::std::__from_chars_int_generic(__first, __last, __value, __base);
+}
+
 _CCCL_TEMPLATE(class _Tp)
 _CCCL_REQUIRES(__cccl_is_integer_v<_Tp>)
 [[nodiscard]] _CCCL_API constexpr from_chars_result
@@ -107,7 +223,7 @@ from_chars(const char* __first, const char* __last, _Tp& __value, int __base = 1
   if constexpr (is_signed_v<_Tp>)
   {
     bool __neg = (__first < __last && *__first == '-');
-    __ret      = ::cuda::std::__from_chars_int_generic(__first + __neg, __last, __result, __base);
+    __ret      = ::cuda::std::__from_chars_int(__first + __neg, __last, __result, __base);
     if (__ret.ec == errc{})
     {
       const auto __max = ::cuda::uabs((__neg) ? numeric_limits<_Tp>::min() : numeric_limits<_Tp>::max());
@@ -123,7 +239,7 @@ from_chars(const char* __first, const char* __last, _Tp& __value, int __base = 1
   }
   else
   {
-    __ret = ::cuda::std::__from_chars_int_generic(__first, __last, __result, __base);
+    __ret = ::cuda::std::__from_chars_int(__first, __last, __result, __base);
   }
 
   if (__ret.ec == errc{})
@@ -155,13 +271,7 @@ _CCCL_REQUIRES(is_floating_point_v<_Tp>)
 [[nodiscard]] _CCCL_API constexpr from_chars_result
 from_chars(const char* __first, const char* __last, _Tp& __value, chars_format __fmt = chars_format::general) noexcept
 {
-  static_assert(::cuda::std::__always_false_v<_Tp>,
-                "cuda::std::from_chars for floating point types is not yet implemented");
-  (void) __first;
-  (void) __last;
-  (void) __value;
-  (void) __fmt;
-  return {};
+  return ::cuda::std::__from_chars_fp(__first, __last, __value, __fmt);
 }
 
 _CCCL_END_NAMESPACE_CUDA_STD
@@ -0,0 +1,607 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___CHARCONV_FROM_CHARS_FLOATING_POINT_H
+#define _CUDA_STD___CHARCONV_FROM_CHARS_FLOATING_POINT_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__bit/countl.h>
+#include <cuda/std/__charconv/bigint.h>
+#include <cuda/std/__charconv/chars_format.h>
+#include <cuda/std/__charconv/floating_point_traits.h>
+#include <cuda/std/__charconv/from_chars_result.h>
+#include <cuda/std/__charconv/pow10_table.h>
+#include <cuda/std/__cstddef/types.h>
+#include <cuda/std/cstdint>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+[[nodiscard]] _CCCL_API constexpr bool __from_chars_fp_is_digit(char __c) noexcept
+{
+  return '0' <= __c && __c <= '9';
+}
+
+[[nodiscard]] _CCCL_API constexpr int __from_chars_fp_hex_digit(char __c) noexcept
+{
+  if ('0' <= __c && __c <= '9')
+  {
+    return __c - '0';
+  }
+  if ('a' <= __c && __c <= 'f')
+  {
+    return __c - 'a' + 10;
+  }
+  if ('A' <= __c && __c <= 'F')
+  {
+    return __c - 'A' + 10;
+  }
+  return -1;
+}
+
+[[nodiscard]] _CCCL_API constexpr char __from_chars_fp_to_lower(char __c) noexcept
+{
+  return ('A' <= __c && __c <= 'Z') ? static_cast<char>(__c - 'A' + 'a') : __c;
+}
+
+//! @brief Returns whether [__first, __last) starts with the lower case string @c __str, ignoring case
+[[nodiscard]] _CCCL_API constexpr bool
+__from_chars_fp_starts_with(const char* __first, const char* __last, const char* __str) noexcept
+{
+  for (; *__str != '\0'; ++__str, ++__first)
+  {
+    if (__first == __last || ::cuda::std::__from_chars_fp_to_lower(*__first) != *__str)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+//! @brief Parses an optionally signed decimal exponent, saturating its value
+//! @returns The end of the exponent, or @c __first if there is no exponent
+[[nodiscard]] _CCCL_API constexpr const char*
+__from_chars_fp_parse_exponent(const char* __first, const char* __last, int64_t& __exp) noexcept
+{
+  constexpr int64_t __max_exp = int64_t{1} << 40;
+
+  const char* __ptr    = __first;
+  const bool __negative = __ptr != __last && *__ptr == '-';
+  if (__ptr != __last && (*__ptr == '-' || *__ptr == '+'))
+  {
+    ++__ptr;
+  }
+  if (__ptr == __last || !::cuda::std::__from_chars_fp_is_digit(*__ptr))
+  {
+    return __first;
+  }
+
+  int64_t __value = 0;
+  for (; __ptr != __last && ::cuda::std::__from_chars_fp_is_digit(*__ptr); ++__ptr)
+  {
+    if (__value < __max_exp)
+    {
+      __value = __value * 10 + (*__ptr - '0');
+    }
+  }
+  __exp = __negative ? -__value : __value;
+  return __ptr;
+}
+
+//! @brief The significand and exponent of a decimal number in [__first_, __last_)
+struct __from_chars_fp_decimal
+{
+  //! The first 19 significant digits
+  uint64_t __mant_;
+  //! The decimal exponent of the last digit in @c __mant_
+  int64_t __exp_;
+  //! Whether nonzero digits did not fit into @c __mant_
+  bool __truncated_;
+  //! The digits, including the decimal point, and the explicit exponent
+  const char* __digits_first_;
+  const char* __digits_last_;
+  int64_t __explicit_exp_;
+};
+
+//! @brief The bits of a nonnegative floating-point value without its sign, so that the successor of a value is the
+//! next larger one and infinity directly follows the largest finite value
+struct __from_chars_fp_bits
+{
+  uint64_t __bits_;
+  bool __exact_;
+};
+
+//! @brief Converts a decimal value of at most 19 digits with the algorithm by Daniel Lemire and Michael Eisel
+//! The significand is multiplied by the 128 most significant bits of the power of ten, which determines the correctly
+//! rounded result unless the truncated bits of the product might carry into the significant ones. Those rare cases
+//! are marked as inexact and are resolved by an exact comparison.
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr __from_chars_fp_bits __from_chars_fp_eisel_lemire(uint64_t __w, int64_t __q) noexcept
+{
+  using _Traits                 = __charconv_fp_traits<_Tp>;
+  constexpr int __mant_bits     = _Traits::__mant_bits;
+  constexpr uint64_t __inf_bits = static_cast<uint64_t>(_Traits::__max_exp_bits) << __mant_bits;
+
+  if (__w == 0 || __q < _Traits::__min_exp10)
+  {
+    return {0, true};
+  }
+  if (__q > _Traits::__max_exp10)
+  {
+    return {__inf_bits, true};
+  }
+
+  const int __exp10 = static_cast<int>(__q);
+  const int __lz    = ::cuda::std::countl_zero(__w);
+  __w <<= __lz;
+
+  // Only compute the lower half of the product if the truncation of the power of ten might matter
+  const auto __pow10              = ::cuda::std::__charconv_pow10_128(__exp10);
+  auto __product                  = ::cuda::std::__charconv_mul_64x64(__w, __pow10.__hi_);
+  constexpr uint64_t __prec_mask = ~uint64_t{0} >> (__mant_bits + 3);
+  if ((__product.__hi_ & __prec_mask) == __prec_mask)
+  {
+    const auto __low = ::cuda::std::__charconv_mul_64x64(__w, __pow10.__lo_);
+    __product.__lo_ += __low.__hi_;
+    __product.__hi_ += __product.__lo_ < __low.__hi_;
+  }
+  // The table is rounded down, so the exact product might be slightly larger
+  bool __exact = __product.__lo_ != ~uint64_t{0};
+
+  const int __upper_bit = static_cast<int>(__product.__hi_ >> 63);
+  const int __shift     = __upper_bit + 64 - __mant_bits - 3;
+  uint64_t __mant       = __product.__hi_ >> __shift;
+  int __exp = ::cuda::std::__charconv_floor_log2_pow10(__exp10) + 63 + __upper_bit - __lz + _Traits::__exp_bias;
+
+  if (__exp <= 0)
+  {
+    // Subnormal values, for which exact ties are impossible
+    if (1 - __exp >= 64)
+    {
+      return {0, __exact};
+    }
+    __mant >>= 1 - __exp;
+    __mant += __mant & 1;
+    __mant >>= 1;
+    return {__mant, __exact};
+  }
+
+  // Exact ties are only possible for small exponents, and the table is only exact for nonnegative ones
+  if (__product.__lo_ <= 1 && (__mant & 3) == 1 && (__mant << __shift) == __product.__hi_)
+  {
+    if (__exp10 >= 0 && __exp10 <= (__mant_bits == 52 ? 23 : 10))
+    {
+      __mant &= ~uint64_t{1};
+    }
+    else if (__exp10 < 0 && __exp10 >= -(__mant_bits == 52 ? 4 : 17))
+    {
+      __exact = false;
+    }
+  }
+  __mant += __mant & 1;
+  __mant >>= 1;
+  if (__mant >= (uint64_t{2} << __mant_bits))
+  {
+    __mant = uint64_t{1} << __mant_bits;
+    ++__exp;
+  }
+  __mant &= ~(uint64_t{1} << __mant_bits);
+  if (__exp >= _Traits::__max_exp_bits)
+  {
+    return {__inf_bits, __exact};
+  }
+  return {(static_cast<uint64_t>(__exp) << __mant_bits) | __mant, __exact};
+}
+
+//! @brief Decides the correctly rounded result by comparing the decimal value with the halfway points between the
+//! candidate @c __bits and its neighbors, using big integer arithmetic
+//! Only the first @c __max_sig_digits + 1 significant digits matter, the remaining ones are replaced by a single
+//! nonzero digit if any of them is nonzero.
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr uint64_t
+__from_chars_fp_round_exact(const __from_chars_fp_decimal& __dec, uint64_t __bits) noexcept
+{
+  using _Traits                 = __charconv_fp_traits<_Tp>;
+  constexpr int __mant_bits     = _Traits::__mant_bits;
+  constexpr int __max_digits    = _Traits::__max_sig_digits + 2;
+  constexpr size_t __num_limbs  = _Traits::__format == __fp_format::__binary64 ? 128 : 32;
+  constexpr uint64_t __inf_bits = static_cast<uint64_t>(_Traits::__max_exp_bits) << __mant_bits;
+  using _Bigint                 = __charconv_bigint<__num_limbs>;
+
+  // Collect the significant digits, the last one of which has the decimal exponent __exp
+  _Bigint __digits{};
+  int64_t __exp        = __dec.__explicit_exp_;
+  int __num_digits     = 0;
+  uint32_t __chunk     = 0;
+  uint32_t __chunk_mul = 1;
+  bool __after_point   = false;
+  bool __truncated     = false;
+  for (const char* __it = __dec.__digits_first_; __it != __dec.__digits_last_; ++__it)
+  {
+    if (*__it == '.')
+    {
+      __after_point = true;
+      continue;
+    }
+    if (__num_digits == __max_digits)
+    {
+      __truncated |= *__it != '0';
+      __exp += !__after_point;
+      continue;
+    }
+    __exp -= __after_point;
+    if (__num_digits == 0 && *__it == '0')
+    {
+      continue;
+    }
+    ++__num_digits;
+    __chunk = __chunk * 10 + static_cast<uint32_t>(*__it - '0');
+    __chunk_mul *= 10;
+    if (__chunk_mul == 1000000000)
+    {
+      __digits.__mul_add(__chunk_mul, __chunk);
+      __chunk     = 0;
+      __chunk_mul = 1;
+    }
+  }
+  if (__truncated)
+  {
+    __chunk = __chunk * 10 + 1;
+    __chunk_mul *= 10;
+    --__exp;
+  }
+  __digits.__mul_add(__chunk_mul, __chunk);
+
+  // Compares the decimal value with the halfway point between the values with the bits __b and __b + 1
+  const auto __compare_halfway = [&](uint64_t __b) {
+    const uint64_t __mant_field = __b & ((uint64_t{1} << __mant_bits) - 1);
+    const int __exp_field       = static_cast<int>(__b >> __mant_bits);
+    const uint64_t __m = __exp_field == 0 ? __mant_field : __mant_field | (uint64_t{1} << __mant_bits);
+    const int __e      = __exp_field == 0 ? _Traits::__min_exp2 : __exp_field - _Traits::__exp_bias - __mant_bits;
+
+    // Compare __digits * 10^__exp with (2 * __m + 1) * 2^(__e - 1)
+    _Bigint __lhs = __digits;
+    _Bigint __rhs{2 * __m + 1};
+    int64_t __lhs_pow2 = 0;
+    int64_t __rhs_pow2 = __e - 1;
+    if (__exp >= 0)
+    {
+      __lhs.__mul_pow5(static_cast<int>(__exp));
+      __lhs_pow2 = __exp;
+    }
+    else
+    {
+      __rhs.__mul_pow5(static_cast<int>(-__exp));
+      __rhs_pow2 -= __exp;
+    }
+    if (__lhs_pow2 > __rhs_pow2)
+    {
+      __lhs.__shift_left(static_cast<int>(__lhs_pow2 - __rhs_pow2));
+    }
+    else
+    {
+      __rhs.__shift_left(static_cast<int>(__rhs_pow2 - __lhs_pow2));
+    }
+    return __compare(__lhs, __rhs);
+  };
+
+  // The candidate is at most one unit in the last place away from the correctly rounded result
+  for (int __i = 0; __i < 3; ++__i)
+  {
+    const bool __is_odd = (__bits & 1) != 0;
+    if (__bits < __inf_bits)
+    {
+      const int __cmp = __compare_halfway(__bits);
+      if (__cmp > 0 || (__cmp == 0 && __is_odd))
+      {
+        ++__bits;
+        continue;
+      }
+    }
+    if (__bits > 0)
+    {
+      const int __cmp = __compare_halfway(__bits - 1);
+      if (__cmp < 0 || (__cmp == 0 && __is_odd))
+      {
+        --__bits;
+        continue;
+      }
+    }
+    break;
+  }
+  return __bits;
+}
+
+//! @brief Parses the decimal digits and the exponent of a floating-point number
+//! @returns The end of the parsed number, or @c __first if there are no digits or a required exponent is missing
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr const char* __from_chars_fp_parse_decimal(
+  const char* __first, const char* __last, chars_format __fmt, __from_chars_fp_decimal& __dec) noexcept
+{
+  constexpr int __max_mant_digits = 19;
+
+  const char* __ptr     = __first;
+  uint64_t __mant       = 0;
+  int __num_mant_digits = 0;
+  int64_t __exp         = 0;
+  bool __truncated      = false;
+  bool __has_digits     = false;
+
+  for (; __ptr != __last && ::cuda::std::__from_chars_fp_is_digit(*__ptr); ++__ptr)
+  {
+    __has_digits = true;
+    if (__num_mant_digits < __max_mant_digits)
+    {
+      __mant = __mant * 10 + static_cast<uint64_t>(*__ptr - '0');
+      __num_mant_digits += __mant != 0;
+    }
+    else
+    {
+      __truncated |= *__ptr != '0';
+      ++__exp;
+    }
+  }
+  if (__ptr != __last && *__ptr == '.')
+  {
+    ++__ptr;
+    for (; __ptr != __last && ::cuda::std::__from_chars_fp_is_digit(*__ptr); ++__ptr)
+    {
+      __has_digits = true;
+      if (__num_mant_digits < __max_mant_digits)
+      {
+        __mant = __mant * 10 + static_cast<uint64_t>(*__ptr - '0');
+        __num_mant_digits += __mant != 0;
+        --__exp;
+      }
+      else
+      {
+        __truncated |= *__ptr != '0';
+      }
+    }
+  }
+  if (!__has_digits)
+  {
+    return __first;
+  }
+
+  __dec.__digits_first_ = __first;
+  __dec.__digits_last_  = __ptr;
+  __dec.__explicit_exp_ = 0;
+
+  const bool __allows_exp   = (__fmt & chars_format::scientific) != chars_format{};
+  const bool __requires_exp = (__fmt & chars_format::fixed) == chars_format{};
+  if (__allows_exp && __ptr != __last && (*__ptr == 'e' || *__ptr == 'E'))
+  {
+    const char* __exp_last = ::cuda::std::__from_chars_fp_parse_exponent(__ptr + 1, __last, __dec.__explicit_exp_);
+    if (__exp_last != __ptr + 1)
+    {
+      __ptr = __exp_last;
+    }
+    else if (__requires_exp)
+    {
+      return __first;
+    }
+  }
+  else if (__requires_exp)
+  {
+    return __first;
+  }
+
+  __dec.__mant_      = __mant;
+  __dec.__exp_       = __exp + __dec.__explicit_exp_;
+  __dec.__truncated_ = __truncated;
+  return __ptr;
+}
+
+//! @brief Parses a hexadecimal floating-point number without prefix and rounds it to nearest even
+//! @returns The end of the parsed number, or @c __first if there are no digits
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr const char*
+__from_chars_fp_parse_hex(const char* __first, const char* __last, uint64_t& __bits, bool& __is_zero) noexcept
+{
+  using _Traits                 = __charconv_fp_traits<_Tp>;
+  constexpr int __mant_bits     = _Traits::__mant_bits;
+  constexpr uint64_t __inf_bits = static_cast<uint64_t>(_Traits::__max_exp_bits) << __mant_bits;
+  constexpr int __max_digits    = 16;
+
+  const char* __ptr     = __first;
+  uint64_t __mant       = 0;
+  int __num_mant_digits = 0;
+  int64_t __exp         = 0;
+  bool __sticky         = false;
+  bool __has_digits     = false;
+  bool __after_point    = false;
+  for (; __ptr != __last; ++__ptr)
+  {
+    if (*__ptr == '.' && !__after_point)
+    {
+      __after_point = true;
+      continue;
+    }
+    const int __digit = ::cuda::std::__from_chars_fp_hex_digit(*__ptr);
+    if (__digit < 0)
+    {
+      break;
+    }
+    __has_digits = true;
+    if (__num_mant_digits < __max_digits)
+    {
+      __mant = (__mant << 4) | static_cast<uint64_t>(__digit);
+      __num_mant_digits += __mant != 0;
+      __exp -= 4 * __after_point;
+    }
+    else
+    {
+      __sticky |= __digit != 0;
+      __exp += 4 * !__after_point;
+    }
+  }
+  if (!__has_digits)
+  {
+    return __first;
+  }
+
+  if (__ptr != __last && (*__ptr == 'p' || *__ptr == 'P'))
+  {
+    int64_t __explicit_exp = 0;
+    const char* __exp_last = ::cuda::std::__from_chars_fp_parse_exponent(__ptr + 1, __last, __explicit_exp);
+    if (__exp_last != __ptr + 1)
+    {
+      __ptr = __exp_last;
+      __exp += __explicit_exp;
+    }
+  }
+
+  __is_zero = __mant == 0;
+  if (__is_zero)
+  {
+    __bits = 0;
+    return __ptr;
+  }
+
+  // The value is __mant * 2^__exp, of which only the bits at and above __lsb_exp are representable
+  const int64_t __msb_exp = __exp + 63 - ::cuda::std::countl_zero(__mant);
+  if (__msb_exp > _Traits::__max_exp_bits - 1 - _Traits::__exp_bias)
+  {
+    __bits = __inf_bits;
+    return __ptr;
+  }
+  const int64_t __lsb_exp =
+    __msb_exp - __mant_bits > _Traits::__min_exp2 ? __msb_exp - __mant_bits : int64_t{_Traits::__min_exp2};
+  const int64_t __drop    = __lsb_exp - __exp;
+
+  uint64_t __rounded = 0;
+  if (__drop <= 0)
+  {
+    __rounded = __mant << -__drop;
+  }
+  else if (__drop <= 64)
+  {
+    const uint64_t __kept = __drop == 64 ? 0 : __mant >> __drop;
+    const uint64_t __rest = __drop == 64 ? __mant : __mant & ((uint64_t{1} << __drop) - 1);
+    const uint64_t __half = uint64_t{1} << (__drop - 1);
+    __rounded = __kept + (__rest > __half || (__rest == __half && (__sticky || (__kept & 1) != 0)));
+  }
+
+  // A carry out of the significand correctly moves into the exponent field
+  if (__lsb_exp == _Traits::__min_exp2)
+  {
+    __bits = __rounded;
+  }
+  else
+  {
+    const auto __exp_field = static_cast<uint64_t>(__lsb_exp - _Traits::__min_exp2 + 1);
+    __bits                 = (__exp_field << __mant_bits) + __rounded - (uint64_t{1} << __mant_bits);
+  }
+  __bits = __bits < __inf_bits ? __bits : __inf_bits;
+  return __ptr;
+}
+
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr from_chars_result
+__from_chars_fp(const char* __first, const char* __last, _Tp& __value, chars_format __fmt) noexcept
+{
+  using _Traits = __charconv_fp_traits<_Tp>;
+  static_assert(_Traits::__is_supported, "cuda::std::from_chars is only implemented for float and double");
+  _CCCL_ASSERT(__first <= __last, "input range must be a valid range");
+
+  constexpr int __mant_bits     = _Traits::__mant_bits;
+  constexpr uint64_t __inf_bits = static_cast<uint64_t>(_Traits::__max_exp_bits) << __mant_bits;
+
+  const bool __negative = __first != __last && *__first == '-';
+  const char* __ptr     = __first + __negative;
+
+  if (::cuda::std::__from_chars_fp_starts_with(__ptr, __last, "inf"))
+  {
+    __ptr += ::cuda::std::__from_chars_fp_starts_with(__ptr, __last, "infinity") ? 8 : 3;
+    __value = ::cuda::std::__charconv_fp_compose<_Tp>(__negative, _Traits::__max_exp_bits, 0);
+    return {__ptr, errc{}};
+  }
+  if (::cuda::std::__from_chars_fp_starts_with(__ptr, __last, "nan"))
+  {
+    __ptr += 3;
+    // An optional sequence of letters, digits and underscores in parentheses
+    if (__ptr != __last && *__ptr == '(')
+    {
+      const char* __it = __ptr + 1;
+      for (; __it != __last
+             && (::cuda::std::__from_chars_fp_is_digit(*__it) || *__it == '_'
+                 || ('a' <= ::cuda::std::__from_chars_fp_to_lower(*__it)
+                     && ::cuda::std::__from_chars_fp_to_lower(*__it) <= 'z'));
+           ++__it)
+      {
+      }
+      if (__it != __last && *__it == ')')
+      {
+        __ptr = __it + 1;
+      }
+    }
+    __value = ::cuda::std::__charconv_fp_compose<_Tp>(
+      __negative, _Traits::__max_exp_bits, uint64_t{1} << (__mant_bits - 1));
+    return {__ptr, errc{}};
+  }
+
+  uint64_t __bits = 0;
+  bool __is_zero  = false;
+  if (__fmt == chars_format::hex)
+  {
+    const char* __end = ::cuda::std::__from_chars_fp_parse_hex<_Tp>(__ptr, __last, __bits, __is_zero);
+    if (__end == __ptr)
+    {
+      return {__first, errc::invalid_argument};
+    }
+    __ptr = __end;
+  }
+  else
+  {
+    __from_chars_fp_decimal __dec{};
+    const char* __end = ::cuda::std::__from_chars_fp_parse_decimal<_Tp>(__ptr, __last, __fmt, __dec);
+    if (__end == __ptr)
+    {
+      return {__first, errc::invalid_argument};
+    }
+    __ptr     = __end;
+    __is_zero = __dec.__mant_ == 0;
+
+    auto __result = ::cuda::std::__from_chars_fp_eisel_lemire<_Tp>(__dec.__mant_, __dec.__exp_);
+    if (__dec.__truncated_ && __result.__exact_)
+    {
+      // The exact value lies between the truncated significand and its successor
+      const auto __upper = ::cuda::std::__from_chars_fp_eisel_lemire<_Tp>(__dec.__mant_ + 1, __dec.__exp_);
+      __result.__exact_  = __upper.__exact_ && __upper.__bits_ == __result.__bits_;
+    }
+    __bits = __result.__exact_ ? __result.__bits_
+                               : ::cuda::std::__from_chars_fp_round_exact<_Tp>(__dec, __result.__bits_);
+  }
+
+  if (__bits >= __inf_bits || (__bits == 0 && !__is_zero))
+  {
+    return {__ptr, errc::result_out_of_range};
+  }
+  __value = ::cuda::std::__charconv_fp_compose<_Tp>(__negative, static_cast<int>(__bits >> __mant_bits),
+                                                     __bits & ((uint64_t{1} << __mant_bits) - 1));
+  return {__ptr, errc{}};
+}
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA_STD___CHARCONV_FROM_CHARS_FLOATING_POINT_H
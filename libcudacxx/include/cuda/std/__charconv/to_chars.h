@@ -21,11 +21,14 @@
 #endif // no system header
 
 #include <cuda/__cmath/uabs.h>
+#include <cuda/std/__bit/countr.h>
+#include <cuda/std/__bit/integral.h>
 #include <cuda/std/__charconv/chars_format.h>
+#include <cuda/std/__charconv/to_chars_base10.h>
+#include <cuda/std/__charconv/to_chars_floating_point.h>
 #include <cuda/std/__charconv/to_chars_result.h>
 #include <cuda/std/__concepts/concept_macros.h>
 #include <cuda/std/__cstddef/types.h>
-#include <cuda/std/__type_traits/always_false.h>
 #include <cuda/std/__type_traits/conditional.h>
 #include <cuda/std/__type_traits/is_floating_point.h>
 #include <cuda/std/__type_traits/is_integer.h>
@@ -95,6 +98,70 @@ _CCCL_API constexpr void __to_chars_int_generic(char* __last, _Tp __value, int _
   } while (__value != 0);
 }
 
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr to_chars_result
+__to_chars_int_base10(char* __first, char* __last, _Tp __value) noexcept
+{
+  // Values that do not fit into 64 bits are split into chunks of 16 digits
+  int __n     = 0;
+  auto __high = __value;
+  if constexpr (sizeof(_Tp) > sizeof(uint64_t))
+  {
+    for (; __high > UINT64_MAX; __high /= _Tp{10000000000000000ull})
+    {
+      __n += 16;
+    }
+  }
+  __n += ::cuda::std::__charconv_base10_width(static_cast<uint64_t>(__high));
+
+  if (__n > __last - __first)
+  {
+    return {__last, errc::value_too_large};
+  }
+
+  char* __it = __first + __n;
+  if constexpr (sizeof(_Tp) > sizeof(uint64_t))
+  {
+    for (; __value > UINT64_MAX; __value /= _Tp{10000000000000000ull})
+    {
+      ::cuda::std::__charconv_write_base10_fixed(
+        __it, static_cast<uint64_t>(__value % _Tp{10000000000000000ull}), 16);
+      __it -= 16;
+    }
+  }
+  if constexpr (sizeof(_Tp) > sizeof(uint32_t))
+  {
+    ::cuda::std::__charconv_write_base10(__it, static_cast<uint64_t>(__value));
+  }
+  else
+  {
+    ::cuda::std::__charconv_write_base10(__it, static_cast<uint32_t>(__value));
+  }
+  return {__first + __n, errc{}};
+}
+
+//! @brief Writes the digits of a power of two base with shifts instead of divisions
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr to_chars_result
+__to_chars_int_pow2(char* __first, char* __last, _Tp __value, int __base) noexcept
+{
+  const int __shift = ::cuda::std::countr_zero(static_cast<unsigned>(__base));
+  const int __n     = (__value == 0) ? 1 : (::cuda::std::bit_width(__value) + __shift - 1) / __shift;
+  if (__n > __last - __first)
+  {
+    return {__last, errc::value_too_large};
+  }
+
+  const auto __mask = static_cast<_Tp>(__base - 1);
+  char* __it        = __first + __n;
+  do
+  {
+    *--__it = ::cuda::std::__to_chars_value_to_char(static_cast<int>(__value & __mask), __base);
+    __value >>= __shift;
+  } while (__value != 0);
+  return {__first + __n, errc{}};
+}
+
 _CCCL_TEMPLATE(class _Tp)
 _CCCL_REQUIRES(__cccl_is_integer_v<_Tp>)
 [[nodiscard]] _CCCL_API constexpr to_chars_result
@@ -113,6 +180,15 @@ to_chars(char* __first, char* __last, _Tp __value, int __base = 10) noexcept
   }
   else
   {
+    if (__base == 10)
+    {
+      return ::cuda::std::__to_chars_int_base10(__first, __last, __value);
+    }
+    if ((__base & (__base - 1)) == 0)
+    {
+      return ::cuda::std::__to_chars_int_pow2(__first, __last, __value, __base);
+    }
+
     const ptrdiff_t __cap = __last - __first;
     const int __n         = ::cuda::std::__to_chars_int_width(__value, __base);
 
@@ -148,12 +224,7 @@ _CCCL_TEMPLATE(class _Tp)
 _CCCL_REQUIRES(is_floating_point_v<_Tp>)
 [[nodiscard]] _CCCL_API constexpr to_chars_result to_chars(char* __first, char* __last, _Tp __value) noexcept
 {
-  static_assert(::cuda::std::__always_false_v<_Tp>,
-                "cuda::std::to_chars for floating point types is not yet implemented");
-  (void) __first;
-  (void) __last;
-  (void) __value;
-  return {};
+  return ::cuda::std::__to_chars_fp(__first, __last, __value, chars_format{}, -1);
 }
 
 _CCCL_TEMPLATE(class _Tp)
@@ -161,13 +232,7 @@ _CCCL_REQUIRES(is_floating_point_v<_Tp>)
 [[nodiscard]] _CCCL_API constexpr to_chars_result
 to_chars(char* __first, char* __last, _Tp __value, chars_format __fmt) noexcept
 {
-  static_assert(::cuda::std::__always_false_v<_Tp>,
-                "cuda::std::to_chars for floating point types is not yet implemented");
-  (void) __first;
-  (void) __last;
-  (void) __value;
-  (void) __fmt;
-  return {};
+  return ::cuda::std::__to_chars_fp(__first, __last, __value, __fmt, -1);
 }
 
 _CCCL_TEMPLATE(class _Tp)
@@ -175,14 +240,12 @@ _CCCL_REQUIRES(is_floating_point_v<_Tp>)
 [[nodiscard]] _CCCL_API constexpr to_chars_result
 to_chars(char* __first, char* __last, _Tp __value, chars_format __fmt, int __prec) noexcept
 {
-  static_assert(::cuda::std::__always_false_v<_Tp>,
-                "cuda::std::to_chars for floating point types is not yet implemented");
-  (void) __first;
-  (void) __last;
-  (void) __value;
-  (void) __fmt;
-  (void) __prec;
-  return {};
+  // A negative precision is treated as if it was omitted, as done by printf
+  if (__prec < 0)
+  {
+    __prec = (__fmt == chars_format::hex) ? -1 : 6;
+  }
+  return ::cuda::std::__to_chars_fp(__first, __last, __value, __fmt, __prec);
 }
 
 _CCCL_END_NAMESPACE_CUDA_STD
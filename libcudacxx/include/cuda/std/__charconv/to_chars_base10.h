@@ -0,0 +1,163 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___CHARCONV_TO_CHARS_BASE10_H
+#define _CUDA_STD___CHARCONV_TO_CHARS_BASE10_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/__cmath/mul_hi.h>
+#include <cuda/std/__bit/integral.h>
+#include <cuda/std/cstdint>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+//! The two decimal digits of each value in [0, 100)
+_CCCL_GLOBAL_CONSTANT char __charconv_digit_pairs[] =
+  "00010203040506070809"
+  "10111213141516171819"
+  "20212223242526272829"
+  "30313233343536373839"
+  "40414243444546474849"
+  "50515253545556575859"
+  "60616263646566676869"
+  "70717273747576777879"
+  "80818283848586878889"
+  "90919293949596979899";
+
+_CCCL_GLOBAL_CONSTANT uint64_t __charconv_pow10_u64[] = {
+  1ull,
+  10ull,
+  100ull,
+  1000ull,
+  10000ull,
+  100000ull,
+  1000000ull,
+  10000000ull,
+  100000000ull,
+  1000000000ull,
+  10000000000ull,
+  100000000000ull,
+  1000000000000ull,
+  10000000000000ull,
+  100000000000000ull,
+  1000000000000000ull,
+  10000000000000000ull,
+  100000000000000000ull,
+  1000000000000000000ull,
+  10000000000000000000ull,
+};
+
+//! @brief Returns the number of decimal digits of @c __value
+[[nodiscard]] _CCCL_API constexpr int __charconv_base10_width(uint64_t __value) noexcept
+{
+  // floor(log10(2^bit_width)) is either the number of digits or one less
+  const int __guess = (::cuda::std::bit_width(__value | 1) * 1233) >> 12;
+  return __guess + ((__value | 1) >= __charconv_pow10_u64[__guess]);
+}
+
+//! @brief Computes __value / 100 with a multiplication and a shift, which is exact for all 32 bit values
+[[nodiscard]] _CCCL_API constexpr uint32_t __charconv_div100(uint32_t __value) noexcept
+{
+  return static_cast<uint32_t>((static_cast<uint64_t>(__value) * 1374389535u) >> 37);
+}
+
+//! @brief Computes __value / 10^8 with a multiplication and a shift, which is exact for all 64 bit values
+[[nodiscard]] _CCCL_API constexpr uint64_t __charconv_div1e8(uint64_t __value) noexcept
+{
+  return ::cuda::mul_hi(__value, uint64_t{0xabcc77118461cefd}) >> 26;
+}
+
+_CCCL_API constexpr void __charconv_copy_2_digits(char* __first, uint32_t __value) noexcept
+{
+  __first[0] = __charconv_digit_pairs[2 * __value];
+  __first[1] = __charconv_digit_pairs[2 * __value + 1];
+}
+
+//! @brief Writes exactly @c __num_digits decimal digits of @c __value, padded with leading zeros, such that they end at
+//! @c __last
+_CCCL_API constexpr void __charconv_write_base10_fixed(char* __last, uint32_t __value, int __num_digits) noexcept
+{
+  for (; __num_digits >= 2; __num_digits -= 2)
+  {
+    const uint32_t __quot = ::cuda::std::__charconv_div100(__value);
+    __last -= 2;
+    ::cuda::std::__charconv_copy_2_digits(__last, __value - 100 * __quot);
+    __value = __quot;
+  }
+  if (__num_digits == 1)
+  {
+    *--__last = static_cast<char>('0' + __value);
+  }
+}
+
+_CCCL_API constexpr void __charconv_write_base10_fixed(char* __last, uint64_t __value, int __num_digits) noexcept
+{
+  for (; __num_digits > 8; __num_digits -= 8)
+  {
+    const uint64_t __quot = ::cuda::std::__charconv_div1e8(__value);
+    ::cuda::std::__charconv_write_base10_fixed(__last, static_cast<uint32_t>(__value - 100000000 * __quot), 8);
+    __last -= 8;
+    __value = __quot;
+  }
+  ::cuda::std::__charconv_write_base10_fixed(__last, static_cast<uint32_t>(__value), __num_digits);
+}
+
+//! @brief Writes the decimal digits of @c __value such that they end at @c __last
+//! @returns The first written digit
+_CCCL_API constexpr char* __charconv_write_base10(char* __last, uint32_t __value) noexcept
+{
+  while (__value >= 100)
+  {
+    const uint32_t __quot = ::cuda::std::__charconv_div100(__value);
+    __last -= 2;
+    ::cuda::std::__charconv_copy_2_digits(__last, __value - 100 * __quot);
+    __value = __quot;
+  }
+  if (__value >= 10)
+  {
+    __last -= 2;
+    ::cuda::std::__charconv_copy_2_digits(__last, __value);
+  }
+  else
+  {
+    *--__last = static_cast<char>('0' + __value);
+  }
+  return __last;
+}
+
+_CCCL_API constexpr char* __charconv_write_base10(char* __last, uint64_t __value) noexcept
+{
+  // Split off 8 digits at a time, so that the remaining ones are handled with 32 bit arithmetic
+  while (__value > UINT32_MAX)
+  {
+    const uint64_t __quot = ::cuda::std::__charconv_div1e8(__value);
+    ::cuda::std::__charconv_write_base10_fixed(__last, static_cast<uint32_t>(__value - 100000000 * __quot), 8);
+    __last -= 8;
+    __value = __quot;
+  }
+  return ::cuda::std::__charconv_write_base10(__last, static_cast<uint32_t>(__value));
+}
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA_STD___CHARCONV_TO_CHARS_BASE10_H
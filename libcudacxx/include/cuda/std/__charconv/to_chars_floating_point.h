@@ -0,0 +1,782 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___CHARCONV_TO_CHARS_FLOATING_POINT_H
+#define _CUDA_STD___CHARCONV_TO_CHARS_FLOATING_POINT_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__charconv/bigint.h>
+#include <cuda/std/__charconv/chars_format.h>
+#include <cuda/std/__charconv/floating_point_traits.h>
+#include <cuda/std/__charconv/pow10_table.h>
+#include <cuda/std/__charconv/to_chars_base10.h>
+#include <cuda/std/__charconv/to_chars_result.h>
+#include <cuda/std/__cstddef/types.h>
+#include <cuda/std/__limits/numeric_limits.h>
+#include <cuda/std/cstdint>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+[[nodiscard]] _CCCL_API constexpr to_chars_result __to_chars_fp_value_too_large(char* __last) noexcept
+{
+  return {__last, errc::value_too_large};
+}
+
+[[nodiscard]] _CCCL_API constexpr int __to_chars_fp_num_digits(uint64_t __value) noexcept
+{
+  return ::cuda::std::__charconv_base10_width(__value);
+}
+
+//! @brief Writes the @c __num_digits least significant decimal digits of @c __value, padded with leading zeros
+_CCCL_API constexpr char* __to_chars_fp_write_digits(char* __first, uint64_t __value, int __num_digits) noexcept
+{
+  ::cuda::std::__charconv_write_base10_fixed(__first + __num_digits, __value, __num_digits);
+  return __first + __num_digits;
+}
+
+_CCCL_API constexpr char* __to_chars_fp_fill(char* __first, ptrdiff_t __count, char __c) noexcept
+{
+  for (; __count > 0; --__count)
+  {
+    *__first++ = __c;
+  }
+  return __first;
+}
+
+//! @brief The size of the exponent of the scientific notation, which has at least two digits
+[[nodiscard]] _CCCL_API constexpr ptrdiff_t __to_chars_fp_exponent_size(int __exp) noexcept
+{
+  return (__exp <= -100 || __exp >= 100) ? 5 : 4;
+}
+
+_CCCL_API constexpr char* __to_chars_fp_write_exponent(char* __first, int __exp) noexcept
+{
+  *__first++        = 'e';
+  *__first++        = __exp < 0 ? '-' : '+';
+  const auto __uexp = static_cast<uint64_t>(__exp < 0 ? -__exp : __exp);
+  return ::cuda::std::__to_chars_fp_write_digits(__first, __uexp, __uexp >= 100 ? 3 : 2);
+}
+
+//! @brief Adds one to the last digit of [__first, __last), skipping the decimal point
+//! @returns Whether the carry propagated out of the first digit, in which case all digits have become zero
+_CCCL_API constexpr bool __to_chars_fp_increment(char* __first, char* __last) noexcept
+{
+  while (__last != __first)
+  {
+    --__last;
+    if (*__last == '.')
+    {
+      continue;
+    }
+    if (*__last != '9')
+    {
+      ++*__last;
+      return false;
+    }
+    *__last = '0';
+  }
+  return true;
+}
+
+//! @brief A finite floating-point value as @c __mant_ * 2^__exp_
+struct __to_chars_fp_binary
+{
+  uint64_t __mant_;
+  int __exp_;
+};
+
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr __to_chars_fp_binary __to_chars_fp_to_binary(__charconv_fp_fields __fields) noexcept
+{
+  using _Traits = __charconv_fp_traits<_Tp>;
+  if (__fields.__exp_ == 0)
+  {
+    return {__fields.__mant_, _Traits::__min_exp2};
+  }
+  return {__fields.__mant_ | (uint64_t{1} << _Traits::__mant_bits),
+          __fields.__exp_ - _Traits::__exp_bias - _Traits::__mant_bits};
+}
+
+//! @brief A decimal value as @c __digits_ * 10^__exp_
+struct __to_chars_fp_decimal
+{
+  uint64_t __digits_;
+  int __exp_;
+};
+
+[[nodiscard]] _CCCL_API constexpr __to_chars_fp_decimal
+__to_chars_fp_remove_trailing_zeros(__to_chars_fp_decimal __dec) noexcept
+{
+  while (__dec.__digits_ % 10 == 0)
+  {
+    __dec.__digits_ /= 10;
+    ++__dec.__exp_;
+  }
+  return __dec;
+}
+
+//! @brief Returns the 64 most significant bits of @c __g * __cp, with the least significant bit set if any of the
+//! remaining bits is set, where @c __g is a 128 bit value
+[[nodiscard]] _CCCL_API constexpr uint64_t __to_chars_fp_round_to_odd(__charconv_uint128 __g, uint64_t __cp) noexcept
+{
+  const auto __x      = ::cuda::std::__charconv_mul_64x64(__g.__lo_, __cp);
+  const auto __y      = ::cuda::std::__charconv_mul_64x64(__g.__hi_, __cp);
+  const uint64_t __y0 = __y.__lo_ + __x.__hi_;
+  const uint64_t __y1 = __y.__hi_ + (__y0 < __x.__hi_);
+  return __y1 | (__y0 > 1);
+}
+
+//! @brief Computes the shortest decimal representation that rounds to a finite positive value
+//! This is the Schubfach algorithm by Raffaello Giulietti, which computes the scaled boundaries of the rounding
+//! interval with a single 128 bit approximation of a power of ten, and picks the unique shortest decimal inside of it,
+//! or the closest one of the shortest decimals if there are several.
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr __to_chars_fp_decimal
+__to_chars_fp_shortest_decimal(__charconv_fp_fields __fields) noexcept
+{
+  using _Traits     = __charconv_fp_traits<_Tp>;
+  const auto __bin  = ::cuda::std::__to_chars_fp_to_binary<_Tp>(__fields);
+  const uint64_t __c = __bin.__mant_;
+  const int __q      = __bin.__exp_;
+
+  // Small integers are their own shortest representation
+  if (__fields.__exp_ != 0 && __q <= 0 && __q >= -_Traits::__mant_bits && (__c & ((uint64_t{1} << -__q) - 1)) == 0)
+  {
+    return ::cuda::std::__to_chars_fp_remove_trailing_zeros({__c >> -__q, 0});
+  }
+
+  // The lower boundary is closer if the value is a power of two, unless it is the smallest normal value
+  const bool __is_even        = (__c % 2) == 0;
+  const bool __lower_is_closer = __fields.__mant_ == 0 && __fields.__exp_ > 1;
+
+  const uint64_t __cbl = 4 * __c - 2 + __lower_is_closer;
+  const uint64_t __cb  = 4 * __c;
+  const uint64_t __cbr = 4 * __c + 2;
+
+  // __k is floor(log10(2^q)), or floor(log10(3/4 * 2^q)) if the lower boundary is closer
+  const int __k = (__q * 1262611 - (__lower_is_closer ? 524031 : 0)) >> 22;
+  const int __h = __q + ::cuda::std::__charconv_floor_log2_pow10(-__k) + 1;
+
+  // The table holds 10^-k rounded down, Schubfach requires it rounded up
+  auto __g = ::cuda::std::__charconv_pow10_128(-__k);
+  __g.__hi_ += (++__g.__lo_ == 0);
+
+  const uint64_t __vbl = ::cuda::std::__to_chars_fp_round_to_odd(__g, __cbl << __h);
+  const uint64_t __vb  = ::cuda::std::__to_chars_fp_round_to_odd(__g, __cb << __h);
+  const uint64_t __vbr = ::cuda::std::__to_chars_fp_round_to_odd(__g, __cbr << __h);
+
+  const uint64_t __lower = __vbl + !__is_even;
+  const uint64_t __upper = __vbr - !__is_even;
+
+  // Try the decimals with one digit less first
+  const uint64_t __s = __vb / 4;
+  if (__s >= 10)
+  {
+    const uint64_t __sp     = __s / 10;
+    const bool __up_inside = __lower <= 40 * __sp;
+    const bool __wp_inside = 40 * __sp + 40 <= __upper;
+    if (__up_inside != __wp_inside)
+    {
+      return ::cuda::std::__to_chars_fp_remove_trailing_zeros({__sp + __wp_inside, __k + 1});
+    }
+  }
+
+  const bool __u_inside = __lower <= 4 * __s;
+  const bool __w_inside = 4 * __s + 4 <= __upper;
+  if (__u_inside != __w_inside)
+  {
+    return ::cuda::std::__to_chars_fp_remove_trailing_zeros({__s + __w_inside, __k});
+  }
+
+  // Both candidates are inside of the rounding interval, so pick the closer one and break ties to even
+  const uint64_t __mid    = 4 * __s + 2;
+  const bool __round_up   = __vb > __mid || (__vb == __mid && (__s & 1) != 0);
+  return ::cuda::std::__to_chars_fp_remove_trailing_zeros({__s + __round_up, __k});
+}
+
+//! @brief Generates the exact decimal digits of a finite floating-point value, starting at the most significant
+//! digit of its integer part
+//! The integer part is converted into chunks of nine digits upfront, the digits of the fractional part are generated
+//! by repeated multiplication. All digits after the end of the exact representation are zero.
+template <class _Tp>
+class __to_chars_fp_exact_digits
+{
+  using _Traits = __charconv_fp_traits<_Tp>;
+
+  // The fractional part needs room for its bits and for a multiplication by 10^9
+  static constexpr size_t __num_limbs        = static_cast<size_t>(30 - _Traits::__min_exp2) / 32 + 1;
+  static constexpr int __max_int_chunks      = numeric_limits<_Tp>::max_exponent10 / 9 + 2;
+  static constexpr uint32_t __chunk_base     = 1000000000;
+  static constexpr int __chunk_digits        = 9;
+  static constexpr int __max_small_frac_bits = 60;
+
+  using _Bigint = __charconv_bigint<__num_limbs>;
+
+  uint32_t __int_chunks_[__max_int_chunks]{};
+  int __num_int_chunks_{};
+  int __num_int_digits_{};
+
+  int __frac_bits_{};
+  uint64_t __small_frac_{};
+  _Bigint __frac_{};
+
+  char __chunk_[__chunk_digits]{};
+  int __chunk_pos_{};
+  int __chunk_size_{};
+
+  _CCCL_API constexpr void __load_chunk(uint32_t __chunk, int __num_digits) noexcept
+  {
+    ::cuda::std::__to_chars_fp_write_digits(__chunk_, __chunk, __num_digits);
+    __chunk_pos_  = 0;
+    __chunk_size_ = __num_digits;
+  }
+
+  _CCCL_API constexpr void __next_chunk() noexcept
+  {
+    if (__num_int_chunks_ > 0)
+    {
+      __load_chunk(__int_chunks_[--__num_int_chunks_], __chunk_digits);
+    }
+    else if (__frac_bits_ <= __max_small_frac_bits)
+    {
+      const uint64_t __mask = (uint64_t{1} << __frac_bits_) - 1;
+      for (int __i = 0; __i < __chunk_digits; ++__i)
+      {
+        __small_frac_ *= 10;
+        __chunk_[__i] = static_cast<char>('0' + (__small_frac_ >> __frac_bits_));
+        __small_frac_ &= __mask;
+      }
+      __chunk_pos_  = 0;
+      __chunk_size_ = __chunk_digits;
+    }
+    else
+    {
+      __frac_.__mul_add(__chunk_base);
+      __load_chunk(__frac_.__split_above(__frac_bits_), __chunk_digits);
+    }
+  }
+
+public:
+  //! @param __bin A finite nonzero value
+  _CCCL_API constexpr explicit __to_chars_fp_exact_digits(__to_chars_fp_binary __bin) noexcept
+  {
+    _Bigint __int{};
+    if (__bin.__exp_ >= 0)
+    {
+      __int = _Bigint{__bin.__mant_};
+      __int.__shift_left(__bin.__exp_);
+    }
+    else
+    {
+      __frac_bits_          = -__bin.__exp_;
+      const bool __has_int = __frac_bits_ < 64;
+      __int                = _Bigint{__has_int ? __bin.__mant_ >> __frac_bits_ : 0};
+      const uint64_t __frac = __has_int ? __bin.__mant_ & ((uint64_t{1} << __frac_bits_) - 1) : __bin.__mant_;
+      if (__frac_bits_ <= __max_small_frac_bits)
+      {
+        __small_frac_ = __frac;
+      }
+      else
+      {
+        __frac_ = _Bigint{__frac};
+      }
+    }
+
+    while (!__int.__is_zero())
+    {
+      __int_chunks_[__num_int_chunks_++] = __int.__divmod(__chunk_base);
+    }
+    if (__num_int_chunks_ > 0)
+    {
+      const uint32_t __top = __int_chunks_[--__num_int_chunks_];
+      const int __top_size = ::cuda::std::__to_chars_fp_num_digits(__top);
+      __num_int_digits_    = __num_int_chunks_ * __chunk_digits + __top_size;
+      __load_chunk(__top, __top_size);
+    }
+  }
+
+  //! @brief Returns the number of digits of the integer part, which is zero if the value is less than one
+  [[nodiscard]] _CCCL_API constexpr int __num_int_digits() const noexcept
+  {
+    return __num_int_digits_;
+  }
+
+  [[nodiscard]] _CCCL_API constexpr char __next() noexcept
+  {
+    if (__chunk_pos_ == __chunk_size_)
+    {
+      __next_chunk();
+    }
+    return __chunk_[__chunk_pos_++];
+  }
+
+  //! @brief Returns whether all of the remaining digits are zero
+  [[nodiscard]] _CCCL_API constexpr bool __rest_is_zero() const noexcept
+  {
+    for (int __i = __chunk_pos_; __i < __chunk_size_; ++__i)
+    {
+      if (__chunk_[__i] != '0')
+      {
+        return false;
+      }
+    }
+    for (int __i = 0; __i < __num_int_chunks_; ++__i)
+    {
+      if (__int_chunks_[__i] != 0)
+      {
+        return false;
+      }
+    }
+    return __frac_bits_ <= __max_small_frac_bits ? __small_frac_ == 0 : __frac_.__is_zero();
+  }
+
+  //! @brief Skips the leading zeros of the fractional part of a value less than one
+  //! @returns The number of skipped zeros
+  _CCCL_API constexpr int __skip_leading_zeros() noexcept
+  {
+    _CCCL_ASSERT(__num_int_digits_ == 0, "the value must be less than one");
+    int __num_zeros = 0;
+    while (__next() == '0')
+    {
+      ++__num_zeros;
+    }
+    --__chunk_pos_;
+    return __num_zeros;
+  }
+
+  //! @brief Returns whether the digits generated so far need to be rounded up, given the parity of the last one
+  [[nodiscard]] _CCCL_API constexpr bool __round_up(bool __last_is_odd) noexcept
+  {
+    const char __digit = __next();
+    return __digit > '5' || (__digit == '5' && (__last_is_odd || !__rest_is_zero()));
+  }
+
+  //! @brief Writes the next @c __count digits
+  //! @returns The last written digit, or '0' if no digit has been written
+  _CCCL_API constexpr char __write(char* __first, ptrdiff_t __count) noexcept
+  {
+    char __digit = '0';
+    for (ptrdiff_t __i = 0; __i < __count; ++__i)
+    {
+      // Once the exact representation ends, only zeros are left
+      if (__chunk_pos_ == __chunk_size_ && __rest_is_zero())
+      {
+        ::cuda::std::__to_chars_fp_fill(__first + __i, __count - __i, '0');
+        return '0';
+      }
+      __digit      = __next();
+      __first[__i] = __digit;
+    }
+    return __digit;
+  }
+};
+
+//! @brief Formats a finite value in fixed notation with the given precision as if by printf("%.*f")
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr to_chars_result
+__to_chars_fp_fixed_precision(char* __first, char* __last, __charconv_fp_fields __fields, int __precision) noexcept
+{
+  const bool __is_zero = __fields.__exp_ == 0 && __fields.__mant_ == 0;
+  __to_chars_fp_exact_digits<_Tp> __gen{::cuda::std::__to_chars_fp_to_binary<_Tp>(__fields)};
+
+  const int __num_int_digits = __is_zero ? 0 : __gen.__num_int_digits();
+  const ptrdiff_t __size =
+    (__num_int_digits == 0 ? 1 : __num_int_digits) + (__precision > 0 ? ptrdiff_t{__precision} + 1 : 0);
+  if (__last - __first < __size)
+  {
+    return ::cuda::std::__to_chars_fp_value_too_large(__last);
+  }
+
+  char* __out       = __first;
+  char __last_digit = '0';
+  if (__num_int_digits == 0)
+  {
+    *__out++ = '0';
+  }
+  else
+  {
+    __last_digit = __gen.__write(__out, __num_int_digits);
+    __out += __num_int_digits;
+  }
+
+  if (__precision > 0)
+  {
+    *__out++ = '.';
+    if (__is_zero)
+    {
+      return {::cuda::std::__to_chars_fp_fill(__out, __precision, '0'), errc{}};
+    }
+    __last_digit = __gen.__write(__out, __precision);
+    __out += __precision;
+  }
+
+  if (!__is_zero && __gen.__round_up((__last_digit - '0') % 2 != 0)
+      && ::cuda::std::__to_chars_fp_increment(__first, __out))
+  {
+    // All digits were nines, so the result needs an additional leading one
+    if (__last - __first < __size + 1)
+    {
+      return ::cuda::std::__to_chars_fp_value_too_large(__last);
+    }
+    for (char* __it = __out; __it != __first; --__it)
+    {
+      *__it = *(__it - 1);
+    }
+    *__first = '1';
+    ++__out;
+  }
+  return {__out, errc{}};
+}
+
+//! @brief Computes the first @c __count significant digits of a finite value, rounded to nearest even
+//! @returns The decimal exponent of the first digit
+template <class _Tp>
+_CCCL_API constexpr int
+__to_chars_fp_significant_digits(char* __first, ptrdiff_t __count, __charconv_fp_fields __fields) noexcept
+{
+  if (__fields.__exp_ == 0 && __fields.__mant_ == 0)
+  {
+    ::cuda::std::__to_chars_fp_fill(__first, __count, '0');
+    return 0;
+  }
+
+  __to_chars_fp_exact_digits<_Tp> __gen{::cuda::std::__to_chars_fp_to_binary<_Tp>(__fields)};
+  int __exp = __gen.__num_int_digits() - 1;
+  if (__exp < 0)
+  {
+    __exp = -__gen.__skip_leading_zeros() - 1;
+  }
+
+  const char __last_digit = __gen.__write(__first, __count);
+  if (__gen.__round_up((__last_digit - '0') % 2 != 0)
+      && ::cuda::std::__to_chars_fp_increment(__first, __first + __count))
+  {
+    *__first = '1';
+    ++__exp;
+  }
+  return __exp;
+}
+
+//! @brief Formats a finite value in scientific notation with the given precision as if by printf("%.*e")
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr to_chars_result
+__to_chars_fp_scientific_precision(char* __first, char* __last, __charconv_fp_fields __fields, int __precision) noexcept
+{
+  const ptrdiff_t __num_digits = ptrdiff_t{__precision} + 1;
+  if (__last - __first < __num_digits + 1)
+  {
+    return ::cuda::std::__to_chars_fp_value_too_large(__last);
+  }
+
+  // Leave room for the decimal point after the first digit
+  const int __exp = ::cuda::std::__to_chars_fp_significant_digits<_Tp>(__first + 1, __num_digits, __fields);
+  __first[0]      = __first[1];
+  char* __out     = __first + 1;
+  if (__precision > 0)
+  {
+    *__out = '.';
+    __out += __num_digits;
+  }
+
+  if (__last - __out < ::cuda::std::__to_chars_fp_exponent_size(__exp))
+  {
+    return ::cuda::std::__to_chars_fp_value_too_large(__last);
+  }
+  return {::cuda::std::__to_chars_fp_write_exponent(__out, __exp), errc{}};
+}
+
+//! @brief Writes the digits @c [__digits, __digits + __num_digits) in scientific notation
+[[nodiscard]] _CCCL_API constexpr to_chars_result __to_chars_fp_write_scientific(
+  char* __first, char* __last, const char* __digits, ptrdiff_t __num_digits, int __exp) noexcept
+{
+  const ptrdiff_t __size = __num_digits + (__num_digits > 1) + ::cuda::std::__to_chars_fp_exponent_size(__exp);
+  if (__last - __first < __size)
+  {
+    return ::cuda::std::__to_chars_fp_value_too_large(__last);
+  }
+
+  *__first++ = __digits[0];
+  if (__num_digits > 1)
+  {
+    *__first++ = '.';
+    for (ptrdiff_t __i = 1; __i < __num_digits; ++__i)
+    {
+      *__first++ = __digits[__i];
+    }
+  }
+  return {::cuda::std::__to_chars_fp_write_exponent(__first, __exp), errc{}};
+}
+
+//! @brief Writes the digits @c [__digits, __digits + __num_digits) in fixed notation, where the first digit has the
+//! decimal exponent @c __exp, padding the integer part with zeros
+[[nodiscard]] _CCCL_API constexpr to_chars_result __to_chars_fp_write_fixed(
+  char* __first, char* __last, const char* __digits, ptrdiff_t __num_digits, int __exp) noexcept
+{
+  if (__exp < 0)
+  {
+    if (__last - __first < 1 - ptrdiff_t{__exp} + __num_digits)
+    {
+      return ::cuda::std::__to_chars_fp_value_too_large(__last);
+    }
+    *__first++ = '0';
+    *__first++ = '.';
+    __first    = ::cuda::std::__to_chars_fp_fill(__first, -__exp - 1, '0');
+    for (ptrdiff_t __i = 0; __i < __num_digits; ++__i)
+    {
+      *__first++ = __digits[__i];
+    }
+    return {__first, errc{}};
+  }
+
+  const ptrdiff_t __num_int_digits = ptrdiff_t{__exp} + 1;
+  const ptrdiff_t __num_frac_digits = __num_digits > __num_int_digits ? __num_digits - __num_int_digits : 0;
+  if (__last - __first < __num_int_digits + (__num_frac_digits > 0 ? __num_frac_digits + 1 : 0))
+  {
+    return ::cuda::std::__to_chars_fp_value_too_large(__last);
+  }
+  for (ptrdiff_t __i = 0; __i < __num_int_digits; ++__i)
+  {
+    *__first++ = __i < __num_digits ? __digits[__i] : '0';
+  }
+  if (__num_frac_digits > 0)
+  {
+    *__first++ = '.';
+    for (ptrdiff_t __i = __num_int_digits; __i < __num_digits; ++__i)
+    {
+      *__first++ = __digits[__i];
+    }
+  }
+  return {__first, errc{}};
+}
+
+//! @brief Formats a finite value with the given precision as if by printf("%.*g")
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr to_chars_result
+__to_chars_fp_general_precision(char* __first, char* __last, __charconv_fp_fields __fields, int __precision) noexcept
+{
+  using _Traits = __charconv_fp_traits<_Tp>;
+
+  // Digits beyond the exact representation are zero and would be removed anyway
+  const int __num_sig_digits = __precision == 0 ? 1 : __precision;
+  char __digits[_Traits::__max_sig_digits + 1]{};
+  ptrdiff_t __num_digits =
+    __num_sig_digits < _Traits::__max_sig_digits + 1 ? __num_sig_digits : _Traits::__max_sig_digits + 1;
+
+  const int __exp = ::cuda::std::__to_chars_fp_significant_digits<_Tp>(__digits, __num_digits, __fields);
+  while (__num_digits > 1 && __digits[__num_digits - 1] == '0')
+  {
+    --__num_digits;
+  }
+
+  if (__exp >= -4 && __exp < __num_sig_digits)
+  {
+    return ::cuda::std::__to_chars_fp_write_fixed(__first, __last, __digits, __num_digits, __exp);
+  }
+  return ::cuda::std::__to_chars_fp_write_scientific(__first, __last, __digits, __num_digits, __exp);
+}
+
+//! @brief Formats a finite value as if by printf("%a") without the "0x" prefix
+//! @param __precision The number of hexadecimal digits after the point, or -1 for the shortest exact representation
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr to_chars_result
+__to_chars_fp_hex(char* __first, char* __last, __charconv_fp_fields __fields, int __precision) noexcept
+{
+  using _Traits = __charconv_fp_traits<_Tp>;
+
+  constexpr int __num_nibbles = (_Traits::__mant_bits + 3) / 4;
+  constexpr char __hex_digits[] = "0123456789abcdef";
+
+  uint64_t __lead = __fields.__exp_ != 0;
+  uint64_t __frac = __fields.__mant_ << (__num_nibbles * 4 - _Traits::__mant_bits);
+  int __num_frac_nibbles = __num_nibbles;
+
+  int __exp = 0;
+  if (__fields.__exp_ != 0)
+  {
+    __exp = __fields.__exp_ - _Traits::__exp_bias;
+  }
+  else if (__fields.__mant_ != 0)
+  {
+    __exp = 1 - _Traits::__exp_bias;
+  }
+
+  if (__precision < 0)
+  {
+    for (; __num_frac_nibbles > 0 && (__frac & 0xF) == 0; --__num_frac_nibbles)
+    {
+      __frac >>= 4;
+    }
+  }
+  else if (__precision < __num_nibbles)
+  {
+    // Round to nearest even, which may carry into the leading digit
+    const int __drop_bits  = (__num_nibbles - __precision) * 4;
+    uint64_t __full        = (__lead << (__num_nibbles * 4)) | __frac;
+    const uint64_t __rest  = __full & ((uint64_t{1} << __drop_bits) - 1);
+    const uint64_t __half  = uint64_t{1} << (__drop_bits - 1);
+    __full >>= __drop_bits;
+    __full += __rest > __half || (__rest == __half && (__full & 1) != 0);
+    __lead             = __full >> (__precision * 4);
+    __frac             = __full & ((uint64_t{1} << (__precision * 4)) - 1);
+    __num_frac_nibbles = __precision;
+  }
+
+  const ptrdiff_t __num_zeros = __precision > __num_frac_nibbles ? __precision - __num_frac_nibbles : 0;
+  const auto __uexp           = static_cast<uint64_t>(__exp < 0 ? -__exp : __exp);
+  const int __num_exp_digits  = ::cuda::std::__to_chars_fp_num_digits(__uexp);
+  const ptrdiff_t __num_after_point = __num_frac_nibbles + __num_zeros;
+  if (__last - __first < 1 + (__num_after_point > 0 ? __num_after_point + 1 : 0) + 2 + __num_exp_digits)
+  {
+    return ::cuda::std::__to_chars_fp_value_too_large(__last);
+  }
+
+  *__first++ = __hex_digits[__lead];
+  if (__num_after_point > 0)
+  {
+    *__first++ = '.';
+    for (int __i = __num_frac_nibbles; __i-- > 0;)
+    {
+      *__first++ = __hex_digits[(__frac >> (__i * 4)) & 0xF];
+    }
+    __first = ::cuda::std::__to_chars_fp_fill(__first, __num_zeros, '0');
+  }
+  *__first++ = 'p';
+  *__first++ = __exp < 0 ? '-' : '+';
+  return {::cuda::std::__to_chars_fp_write_digits(__first, __uexp, __num_exp_digits), errc{}};
+}
+
+//! @brief Formats a finite value with the shortest representation that round trips
+//! @param __fmt The requested notation, or chars_format{} to pick the shorter of fixed and scientific notation
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr to_chars_result
+__to_chars_fp_shortest(char* __first, char* __last, __charconv_fp_fields __fields, chars_format __fmt) noexcept
+{
+  if (__fields.__exp_ == 0 && __fields.__mant_ == 0)
+  {
+    constexpr char __zero[] = "0e+00";
+    const ptrdiff_t __size  = __fmt == chars_format::scientific ? 5 : 1;
+    if (__last - __first < __size)
+    {
+      return ::cuda::std::__to_chars_fp_value_too_large(__last);
+    }
+    for (ptrdiff_t __i = 0; __i < __size; ++__i)
+    {
+      *__first++ = __zero[__i];
+    }
+    return {__first, errc{}};
+  }
+
+  const auto __dec        = ::cuda::std::__to_chars_fp_shortest_decimal<_Tp>(__fields);
+  const int __num_digits  = ::cuda::std::__to_chars_fp_num_digits(__dec.__digits_);
+  const int __sci_exp     = __dec.__exp_ + __num_digits - 1;
+
+  bool __use_fixed = __fmt == chars_format::fixed;
+  if (__fmt == chars_format::general)
+  {
+    __use_fixed = __sci_exp >= -4 && __sci_exp < 6;
+  }
+  else if (__fmt == chars_format{})
+  {
+    // Ties are resolved in favor of fixed notation
+    const int __fixed_size = __dec.__exp_ >= 0 ? __num_digits + __dec.__exp_
+                           : __num_digits > -__dec.__exp_ ? __num_digits + 1
+                                                          : 2 - __dec.__exp_;
+    const int __sci_size =
+      __num_digits + (__num_digits > 1) + static_cast<int>(::cuda::std::__to_chars_fp_exponent_size(__sci_exp));
+    __use_fixed = __fixed_size <= __sci_size;
+  }
+
+  char __digits[20]{};
+  ::cuda::std::__to_chars_fp_write_digits(__digits, __dec.__digits_, __num_digits);
+  if (!__use_fixed)
+  {
+    return ::cuda::std::__to_chars_fp_write_scientific(__first, __last, __digits, __num_digits, __sci_exp);
+  }
+
+  // Padding the digits with zeros only gives the closest representation if the value is an integer that is exactly
+  // representable as such, otherwise the exact integer value has the same number of digits
+  if (__dec.__exp_ > 0 && ::cuda::std::__to_chars_fp_to_binary<_Tp>(__fields).__exp_ > 0)
+  {
+    return ::cuda::std::__to_chars_fp_fixed_precision<_Tp>(__first, __last, __fields, 0);
+  }
+  return ::cuda::std::__to_chars_fp_write_fixed(__first, __last, __digits, __num_digits, __sci_exp);
+}
+
+//! @param __precision The precision, or -1 for the shortest representation that round trips
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr to_chars_result
+__to_chars_fp(char* __first, char* __last, _Tp __value, chars_format __fmt, int __precision) noexcept
+{
+  static_assert(__charconv_fp_traits<_Tp>::__is_supported,
+                "cuda::std::to_chars is only implemented for float and double");
+  _CCCL_ASSERT(__first <= __last, "output range must be a valid range");
+  _CCCL_ASSERT(__fmt == chars_format{} || __fmt == chars_format::scientific || __fmt == chars_format::fixed
+                 || __fmt == chars_format::hex || __fmt == chars_format::general,
+               "fmt must be one of the enumerators of chars_format");
+
+  const auto __fields = ::cuda::std::__charconv_fp_decompose(__value);
+  if (__fields.__negative_)
+  {
+    if (__first == __last)
+    {
+      return ::cuda::std::__to_chars_fp_value_too_large(__last);
+    }
+    *__first++ = '-';
+  }
+
+  if (__fields.__exp_ == __charconv_fp_traits<_Tp>::__max_exp_bits)
+  {
+    if (__last - __first < 3)
+    {
+      return ::cuda::std::__to_chars_fp_value_too_large(__last);
+    }
+    const char* __name = __fields.__mant_ == 0 ? "inf" : "nan";
+    for (int __i = 0; __i < 3; ++__i)
+    {
+      *__first++ = __name[__i];
+    }
+    return {__first, errc{}};
+  }
+
+  if (__fmt == chars_format::hex)
+  {
+    return ::cuda::std::__to_chars_fp_hex<_Tp>(__first, __last, __fields, __precision);
+  }
+  if (__precision < 0)
+  {
+    return ::cuda::std::__to_chars_fp_shortest<_Tp>(__first, __last, __fields, __fmt);
+  }
+  if (__fmt == chars_format::fixed)
+  {
+    return ::cuda::std::__to_chars_fp_fixed_precision<_Tp>(__first, __last, __fields, __precision);
+  }
+  if (__fmt == chars_format::scientific)
+  {
+    return ::cuda::std::__to_chars_fp_scientific_precision<_Tp>(__first, __last, __fields, __precision);
+  }
+  return ::cuda::std::__to_chars_fp_general_precision<_Tp>(__first, __last, __fields, __precision);
+}
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA_STD___CHARCONV_TO_CHARS_FLOATING_POINT_H
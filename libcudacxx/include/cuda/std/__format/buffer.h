@@ -20,25 +20,279 @@
 #  pragma system_header
 #endif // no system header
 
+#include <cuda/std/__algorithm/copy_n.h>
+#include <cuda/std/__algorithm/fill_n.h>
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/__algorithm/transform.h>
+#include <cuda/std/__concepts/same_as.h>
+#include <cuda/std/__cstddef/types.h>
 #include <cuda/std/__fwd/format.h>
+#include <cuda/std/__iterator/concepts.h>
+#include <cuda/std/__iterator/incrementable_traits.h>
+#include <cuda/std/__iterator/iterator_traits.h>
+#include <cuda/std/__limits/numeric_limits.h>
+#include <cuda/std/__memory/pointer_traits.h>
+#include <cuda/std/__utility/move.h>
+#include <cuda/std/string_view>
 
 #include <cuda/std/__cccl/prologue.h>
 
 _CCCL_BEGIN_NAMESPACE_CUDA_STD
 
-// todo: implement __fmt_output_buffer
+//! The size of the storage of the buffers that cannot write directly into their destination. It is kept small, so that
+//! the buffers can live on the stack of a device thread.
+inline constexpr size_t __fmt_buffer_size = 256;
 
+//! @brief The output buffer all formatting functions write to.
+//!
+//! The buffer writes into a storage area that is provided by a derived buffer, which is either a small array on the
+//! stack or the destination of the formatting function itself. When the storage area is full the flush function of the
+//! derived buffer is called, which consumes the written characters and provides the next storage area by calling
+//! __reset. The buffer never allocates memory.
+//!
+//! The bulk operations __copy, __transform and __fill are used by the output functions in output_utils.h, so that
+//! strings and padding are not written one character at a time.
 template <class _CharT>
 class __fmt_output_buffer
 {
 public:
   using value_type = _CharT;
+  using __flush_fn = void (*)(__fmt_output_buffer&);
+
+  _CCCL_API explicit __fmt_output_buffer(_CharT* __ptr, size_t __capacity, __flush_fn __flush) noexcept
+      : __ptr_(__ptr)
+      , __capacity_(__capacity)
+      , __size_(0)
+      , __flush_(__flush)
+  {
+    _CCCL_ASSERT(__capacity_ != 0, "the storage of an output buffer must not be empty");
+  }
+
+  __fmt_output_buffer(const __fmt_output_buffer&)            = delete;
+  __fmt_output_buffer& operator=(const __fmt_output_buffer&) = delete;
 
   _CCCL_API void push_back(_CharT __c)
   {
-    _CCCL_ASSERT(false, "unimplemented __fmt_output_buffer push_back method called");
-    (void) __c;
+    __ptr_[__size_++] = __c;
+    if (__size_ == __capacity_)
+    {
+      __flush_(*this);
+    }
+  }
+
+  template <class _InCharT>
+  _CCCL_API void __copy(basic_string_view<_InCharT> __str)
+  {
+    const _InCharT* __first = __str.data();
+    size_t __n              = __str.size();
+    while (__n != 0)
+    {
+      const size_t __chunk = ::cuda::std::min(__n, __capacity_ - __size_);
+      ::cuda::std::copy_n(__first, __chunk, __ptr_ + __size_);
+      __first += __chunk;
+      __n -= __chunk;
+      __commit(__chunk);
+    }
+  }
+
+  template <class _InIt, class _UnaryOp>
+  _CCCL_API void __transform(_InIt __first, _InIt __last, _UnaryOp __operation)
+  {
+    _CCCL_ASSERT(__first <= __last, "not a valid range");
+    size_t __n = static_cast<size_t>(__last - __first);
+    while (__n != 0)
+    {
+      const size_t __chunk = ::cuda::std::min(__n, __capacity_ - __size_);
+      ::cuda::std::transform(__first, __first + __chunk, __ptr_ + __size_, __operation);
+      __first += __chunk;
+      __n -= __chunk;
+      __commit(__chunk);
+    }
+  }
+
+  _CCCL_API void __fill(size_t __n, _CharT __value)
+  {
+    while (__n != 0)
+    {
+      const size_t __chunk = ::cuda::std::min(__n, __capacity_ - __size_);
+      ::cuda::std::fill_n(__ptr_ + __size_, __chunk, __value);
+      __n -= __chunk;
+      __commit(__chunk);
+    }
+  }
+
+  [[nodiscard]] _CCCL_API _CharT* __data() const noexcept
+  {
+    return __ptr_;
+  }
+
+  [[nodiscard]] _CCCL_API size_t __size() const noexcept
+  {
+    return __size_;
+  }
+
+  //! @brief Continues writing into a new storage area, called by the flush functions of the derived buffers
+  _CCCL_API void __reset(_CharT* __ptr, size_t __capacity) noexcept
+  {
+    _CCCL_ASSERT(__capacity != 0, "the storage of an output buffer must not be empty");
+    __ptr_      = __ptr;
+    __capacity_ = __capacity;
+    __size_     = 0;
+  }
+
+private:
+  _CCCL_API void __commit(size_t __n)
+  {
+    __size_ += __n;
+    if (__size_ == __capacity_)
+    {
+      __flush_(*this);
+    }
+  }
+
+  _CharT* __ptr_;
+  size_t __capacity_;
+  size_t __size_;
+  __flush_fn __flush_;
+};
+
+//! Whether the characters can be written straight into the memory an output iterator points to.
+template <class _OutIt, class _CharT>
+inline constexpr bool __fmt_is_direct_output =
+  contiguous_iterator<_OutIt> && same_as<iter_reference_t<_OutIt>, _CharT&>;
+
+//! @brief The buffer of format_to and vformat_to
+//!
+//! Contiguous destinations, such as pointers and span iterators, are written to directly. Other output iterators
+//! receive the characters in chunks from a buffer on the stack.
+template <class _OutIt, class _CharT>
+class __fmt_iterator_buffer : public __fmt_output_buffer<_CharT>
+{
+  static constexpr bool __direct = __fmt_is_direct_output<_OutIt, _CharT>;
+
+public:
+  _CCCL_API explicit __fmt_iterator_buffer(_OutIt __out_it)
+      : __fmt_output_buffer<_CharT>{__storage_, __fmt_buffer_size, &__flush}
+      , __out_it_(::cuda::std::move(__out_it))
+  {
+    if constexpr (__direct)
+    {
+      // The size of the destination is unknown, so it is never flushed
+      this->__reset(::cuda::std::to_address(__out_it_), numeric_limits<size_t>::max());
+    }
   }
+
+  [[nodiscard]] _CCCL_API _OutIt __out_it() &&
+  {
+    if constexpr (__direct)
+    {
+      return __out_it_ + static_cast<iter_difference_t<_OutIt>>(this->__size());
+    }
+    else
+    {
+      __flush(*this);
+      return ::cuda::std::move(__out_it_);
+    }
+  }
+
+private:
+  _CCCL_API static void __flush(__fmt_output_buffer<_CharT>& __buffer)
+  {
+    auto& __self     = static_cast<__fmt_iterator_buffer&>(__buffer);
+    __self.__out_it_ = ::cuda::std::copy_n(__self.__data(), __self.__size(), ::cuda::std::move(__self.__out_it_));
+    __self.__reset(__self.__storage_, __fmt_buffer_size);
+  }
+
+  _OutIt __out_it_;
+  _CharT __storage_[__direct ? 1 : __fmt_buffer_size];
+};
+
+//! @brief The buffer of format_to_n and vformat_to_n
+//!
+//! At most __max_size characters are written to the destination, the remaining ones are only counted. Contiguous
+//! destinations are written to directly until they are full.
+template <class _OutIt, class _CharT>
+class __fmt_format_to_n_buffer : public __fmt_output_buffer<_CharT>
+{
+  static constexpr bool __direct = __fmt_is_direct_output<_OutIt, _CharT>;
+
+public:
+  _CCCL_API explicit __fmt_format_to_n_buffer(_OutIt __out_it, iter_difference_t<_OutIt> __max_size)
+      : __fmt_output_buffer<_CharT>{__storage_, __fmt_buffer_size, &__flush}
+      , __out_it_(::cuda::std::move(__out_it))
+      , __max_size_((__max_size > 0) ? static_cast<size_t>(__max_size) : 0)
+      , __total_(0)
+  {
+    if constexpr (__direct)
+    {
+      if (__max_size_ != 0)
+      {
+        this->__reset(::cuda::std::to_address(__out_it_), __max_size_);
+      }
+    }
+  }
+
+  //! @brief Returns the end of the written output and the total number of characters that were formatted
+  [[nodiscard]] _CCCL_API _OutIt __out_it(iter_difference_t<_OutIt>& __total) &&
+  {
+    __flush(*this);
+    __total = static_cast<iter_difference_t<_OutIt>>(__total_);
+    return ::cuda::std::move(__out_it_);
+  }
+
+private:
+  _CCCL_API static void __flush(__fmt_output_buffer<_CharT>& __buffer)
+  {
+    auto& __self     = static_cast<__fmt_format_to_n_buffer&>(__buffer);
+    const size_t __n = __self.__size();
+    if constexpr (__direct)
+    {
+      if (__self.__data() != __self.__storage_)
+      {
+        // The characters have been written into the destination, the remaining ones go to the storage and are dropped
+        __self.__out_it_ += static_cast<iter_difference_t<_OutIt>>(__n);
+      }
+    }
+    else if (__self.__total_ < __self.__max_size_)
+    {
+      const size_t __count = ::cuda::std::min(__n, __self.__max_size_ - __self.__total_);
+      __self.__out_it_     = ::cuda::std::copy_n(__self.__data(), __count, ::cuda::std::move(__self.__out_it_));
+    }
+    __self.__total_ += __n;
+    __self.__reset(__self.__storage_, __fmt_buffer_size);
+  }
+
+  _OutIt __out_it_;
+  size_t __max_size_;
+  size_t __total_;
+  _CharT __storage_[__fmt_buffer_size];
+};
+
+//! @brief The buffer of formatted_size, which only counts the characters
+template <class _CharT>
+class __fmt_counting_buffer : public __fmt_output_buffer<_CharT>
+{
+public:
+  _CCCL_API __fmt_counting_buffer()
+      : __fmt_output_buffer<_CharT>{__storage_, __fmt_buffer_size, &__flush}
+      , __total_(0)
+  {}
+
+  [[nodiscard]] _CCCL_API size_t __total() const noexcept
+  {
+    return __total_ + this->__size();
+  }
+
+private:
+  _CCCL_API static void __flush(__fmt_output_buffer<_CharT>& __buffer)
+  {
+    auto& __self = static_cast<__fmt_counting_buffer&>(__buffer);
+    __self.__total_ += __self.__size();
+    __self.__reset(__self.__storage_, __fmt_buffer_size);
+  }
+
+  size_t __total_;
+  _CharT __storage_[__fmt_buffer_size];
 };
 
 _CCCL_END_NAMESPACE_CUDA_STD
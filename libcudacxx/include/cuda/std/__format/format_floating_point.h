@@ -0,0 +1,341 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD__FORMAT_FORMAT_FLOATING_POINT_H
+#define _CUDA_STD__FORMAT_FORMAT_FLOATING_POINT_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__algorithm/find.h>
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/__charconv/chars_format.h>
+#include <cuda/std/__charconv/floating_point_traits.h>
+#include <cuda/std/__charconv/to_chars_floating_point.h>
+#include <cuda/std/__cstddef/types.h>
+#include <cuda/std/__format/format_spec_parser.h>
+#include <cuda/std/__format/output_utils.h>
+#include <cuda/std/__utility/move.h>
+#include <cuda/std/__utility/to_underlying.h>
+#include <cuda/std/cstdint>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+//! The number of digits of the integral part of the largest finite value.
+template <class _Tp>
+inline constexpr int __fmt_fp_max_integral_v = __charconv_fp_traits<_Tp>::__max_exp10 + 1;
+
+//! The number of digits of the fractional part of the smallest subnormal value. Fixed notation with a larger precision
+//! only appends zeros.
+template <class _Tp>
+inline constexpr int __fmt_fp_max_fractional_v = -__charconv_fp_traits<_Tp>::__min_exp2;
+
+//! The size of the buffer used by most values, it is enough for any value formatted with a small precision.
+inline constexpr ptrdiff_t __fmt_fp_small_buffer_size = 128;
+
+//! The size of the buffer for any value formatted with any precision, the digits beyond the exact representation of
+//! the value are zeros and are not stored in the buffer.
+//!
+//! The additional space holds the sign, the decimal point, the exponent and the leading zeros of the general notation.
+template <class _Tp>
+inline constexpr ptrdiff_t __fmt_fp_large_buffer_size_v =
+  32 + __fmt_fp_max_integral_v<_Tp> + __fmt_fp_max_fractional_v<_Tp>;
+
+//! Writes [__first, __last) with @c __num_trailing_zeros zeros inserted before @c __exponent, using the padding of
+//! @c __specs.
+template <class _ParserCharT, class _OutIt>
+[[nodiscard]] _CCCL_API _OutIt __fmt_write_using_trailing_zeros(
+  const char* __first,
+  const char* __last,
+  _OutIt __out_it,
+  __fmt_parsed_spec<_ParserCharT> __specs,
+  ptrdiff_t __size,
+  const char* __exponent,
+  size_t __num_trailing_zeros)
+{
+  _CCCL_ASSERT(__first <= __exponent && __exponent <= __last, "Not a valid range");
+
+  __fmt_padding_size_result __padding{0, 0};
+  if (__size < static_cast<ptrdiff_t>(__specs.__width_))
+  {
+    __padding =
+      ::cuda::std::__fmt_padding_size(__size, __specs.__width_, __fmt_spec_alignment{__specs.__std_.__alignment_});
+  }
+
+  __out_it = ::cuda::std::__fmt_fill(::cuda::std::move(__out_it), __padding.__before_, __specs.__fill_);
+  __out_it = ::cuda::std::__fmt_copy(basic_string_view{__first, __exponent}, ::cuda::std::move(__out_it));
+  __out_it = ::cuda::std::__fmt_fill(::cuda::std::move(__out_it), __num_trailing_zeros, _ParserCharT{'0'});
+  __out_it = ::cuda::std::__fmt_copy(basic_string_view{__exponent, __last}, ::cuda::std::move(__out_it));
+  return ::cuda::std::__fmt_fill(::cuda::std::move(__out_it), __padding.__after_, __specs.__fill_);
+}
+
+[[nodiscard]] _CCCL_API constexpr bool __fmt_fp_is_upper_case(__fmt_spec_type __type) noexcept
+{
+  switch (__type)
+  {
+    case __fmt_spec_type::__hexfloat_upper_case:
+    case __fmt_spec_type::__scientific_upper_case:
+    case __fmt_spec_type::__fixed_upper_case:
+    case __fmt_spec_type::__general_upper_case:
+      return true;
+    default:
+      return false;
+  }
+}
+
+//! Returns the number of zeros that the alternate form of the general notation appends after the digits
+//! [__first, __exponent), so that the output has @c __precision significant digits.
+[[nodiscard]] _CCCL_API constexpr ptrdiff_t __fmt_fp_general_trailing_zeros(
+  const char* __first, const char* __point, const char* __exponent, bool __is_scientific, int __precision) noexcept
+{
+  const int __num_sig_digits       = __precision == 0 ? 1 : __precision;
+  const ptrdiff_t __num_fractional = __exponent - __point - 1;
+
+  ptrdiff_t __required{};
+  if (__is_scientific)
+  {
+    // Scientific notation, all digits after the point are significant.
+    __required = __num_sig_digits - 1;
+  }
+  else if (__point - __first > 1 || *__first != '0')
+  {
+    // Fixed notation with a nonzero integral part.
+    __required = __num_sig_digits - (__point - __first);
+  }
+  else
+  {
+    // Fixed notation of a value below one, the zeros after the point are not significant.
+    const char* __it = __point + 1;
+    while (__it != __exponent && *__it == '0')
+    {
+      ++__it;
+    }
+    __required = (__it == __exponent) ? __num_sig_digits - 1 : (__it - __point - 1) + __num_sig_digits;
+  }
+  return __required > __num_fractional ? __required - __num_fractional : 0;
+}
+
+//! Formats a finite or non-finite value into a local buffer of @c _Size characters and writes it to the output.
+//!
+//! @param __fmt                The notation passed to to_chars, chars_format{} for the shortest representation.
+//! @param __precision          The precision passed to to_chars, capped to the digits of the exact value.
+//! @param __num_trailing_zeros The zeros removed from the precision by the capping, they are written separately.
+template <ptrdiff_t _Size, class _Tp, class _CharT, class _FmtCtx>
+[[nodiscard]] _CCCL_API typename _FmtCtx::iterator __fmt_format_fp_impl(
+  _Tp __value,
+  _FmtCtx& __ctx,
+  __fmt_parsed_spec<_CharT> __specs,
+  bool __is_finite,
+  chars_format __fmt,
+  int __precision,
+  ptrdiff_t __num_trailing_zeros)
+{
+  char __buffer[_Size];
+
+  // The first character is reserved for the sign, to_chars only writes the one of negative values.
+  char* __first = __buffer + 1;
+  char* __last{};
+  {
+    const auto __r = ::cuda::std::__to_chars_fp(__first, __buffer + _Size, __value, __fmt, __precision);
+    _CCCL_ASSERT(__r.ec == errc{}, "Internal buffer too small");
+    __last = __r.ptr;
+  }
+
+  if (*__first != '-')
+  {
+    switch (__fmt_spec_sign{__specs.__std_.__sign_})
+    {
+      case __fmt_spec_sign::__default:
+      case __fmt_spec_sign::__minus:
+        break;
+      case __fmt_spec_sign::__plus:
+        *--__first = '+';
+        break;
+      case __fmt_spec_sign::__space:
+        *--__first = ' ';
+        break;
+    }
+  }
+  char* const __digits = (*__first == '-' || *__first == '+' || *__first == ' ') ? __first + 1 : __first;
+  char* __exponent     = __last;
+
+  if (__is_finite)
+  {
+    if (__fmt == chars_format::hex)
+    {
+      __exponent = ::cuda::std::find(__digits, __last, 'p');
+    }
+    else if (__fmt != chars_format::fixed)
+    {
+      __exponent = ::cuda::std::find(__digits, __last, 'e');
+    }
+
+    if (__specs.__std_.__alternate_form_)
+    {
+      char* __point = ::cuda::std::find(__digits, __exponent, '.');
+      if (__point == __exponent)
+      {
+        // The alternate form always has a decimal point, the buffer has room to insert it before the exponent.
+        for (char* __it = __last; __it != __exponent; --__it)
+        {
+          *__it = *(__it - 1);
+        }
+        *__exponent++ = '.';
+        ++__last;
+      }
+
+      if (__fmt == chars_format::general)
+      {
+        // The trailing zeros removed by to_chars are kept by the alternate form of the general notation, which is also
+        // used for a precision without a type.
+        __num_trailing_zeros =
+          ::cuda::std::__fmt_fp_general_trailing_zeros(
+            __digits, __point, __exponent, __exponent != __last, __specs.__precision_);
+      }
+    }
+  }
+
+  if (::cuda::std::__fmt_fp_is_upper_case(__specs.__std_.__type_))
+  {
+    for (char* __it = __digits; __it != __last; ++__it)
+    {
+      if (*__it >= 'a' && *__it <= 'z')
+      {
+        *__it = static_cast<char>(*__it - 'a' + 'A');
+      }
+    }
+  }
+
+  auto __out_it = __ctx.out();
+  if (__fmt_spec_alignment{__specs.__alignment_} == __fmt_spec_alignment::__zero_padding)
+  {
+    if (__is_finite)
+    {
+      // __buffer contains [sign]data, the sign is written before the zeros of the padding.
+      __out_it                  = ::cuda::std::__fmt_copy(__first, __digits, ::cuda::std::move(__out_it));
+      __specs.__fill_.__data[0] = _CharT{'0'};
+      __specs.__width_ -= ::cuda::std::min(static_cast<uint32_t>(__digits - __first), __specs.__width_);
+      __first = __digits;
+    }
+    // Infinity and NaN are never padded with zeros.
+    __specs.__alignment_ = ::cuda::std::to_underlying(__fmt_spec_alignment::__right);
+  }
+
+  if (__num_trailing_zeros == 0)
+  {
+    return ::cuda::std::__fmt_write(__first, __last, ::cuda::std::move(__out_it), __specs);
+  }
+  return ::cuda::std::__fmt_write_using_trailing_zeros(
+    __first,
+    __last,
+    ::cuda::std::move(__out_it),
+    __specs,
+    (__last - __first) + __num_trailing_zeros,
+    __exponent,
+    static_cast<size_t>(__num_trailing_zeros));
+}
+
+template <class _Tp, class _CharT, class _FmtCtx>
+[[nodiscard]] _CCCL_API typename _FmtCtx::iterator
+__fmt_format_fp(_Tp __value, _FmtCtx& __ctx, __fmt_parsed_spec<_CharT> __specs)
+{
+  using _Traits = __charconv_fp_traits<_Tp>;
+
+  if constexpr (!_Traits::__is_supported)
+  {
+    // to_chars only implements binary32 and binary64, other formats are formatted with the precision of double.
+    return ::cuda::std::__fmt_format_fp(static_cast<double>(__value), __ctx, __specs);
+  }
+  else
+  {
+    const auto __fields    = ::cuda::std::__charconv_fp_decompose(__value);
+    const bool __is_finite = __fields.__exp_ != _Traits::__max_exp_bits;
+    chars_format __fmt     = chars_format{};
+    int __precision        = __specs.__precision_;
+    int __max_precision    = _Traits::__max_sig_digits;
+    bool __pad_with_zeros  = true;
+    ptrdiff_t __int_digits = 0;
+
+    switch (__specs.__std_.__type_)
+    {
+      case __fmt_spec_type::__default:
+        if (__precision >= 0)
+        {
+          __fmt            = chars_format::general;
+          __pad_with_zeros = false;
+        }
+        break;
+      case __fmt_spec_type::__hexfloat_lower_case:
+      case __fmt_spec_type::__hexfloat_upper_case:
+        __fmt           = chars_format::hex;
+        __max_precision = (_Traits::__mant_bits + 3) / 4;
+        break;
+      case __fmt_spec_type::__scientific_lower_case:
+      case __fmt_spec_type::__scientific_upper_case:
+        __fmt = chars_format::scientific;
+        break;
+      case __fmt_spec_type::__fixed_lower_case:
+      case __fmt_spec_type::__fixed_upper_case: {
+        __fmt           = chars_format::fixed;
+        __max_precision = __fmt_fp_max_fractional_v<_Tp>;
+        // floor(log10(2) * exponent) + 1 bounds the number of digits of the integral part.
+        const int __exp2 = __fields.__exp_ - _Traits::__exp_bias;
+        __int_digits     = __exp2 >= 0 ? ((__exp2 * 1233) >> 12) + 1 : 1;
+        break;
+      }
+      case __fmt_spec_type::__general_lower_case:
+      case __fmt_spec_type::__general_upper_case:
+        __fmt            = chars_format::general;
+        __pad_with_zeros = false;
+        break;
+      default:
+        _CCCL_UNREACHABLE();
+    }
+
+    if (__fmt != chars_format{} && __fmt != chars_format::hex && __precision < 0)
+    {
+      __precision = 6;
+    }
+
+    // The digits beyond the exact value are zeros, they are not generated by to_chars. The general notation removes
+    // them, unless the alternate form is used, which is handled after the conversion.
+    ptrdiff_t __num_trailing_zeros = 0;
+    if (__precision > __max_precision)
+    {
+      __num_trailing_zeros = __pad_with_zeros ? __precision - __max_precision : 0;
+      __precision          = __max_precision;
+    }
+
+    const ptrdiff_t __size = 32 + __int_digits + (__precision > 0 ? __precision : 0);
+    _CCCL_ASSERT(__size <= __fmt_fp_large_buffer_size_v<_Tp>, "Internal buffer too small");
+    if (__size <= __fmt_fp_small_buffer_size)
+    {
+      return ::cuda::std::__fmt_format_fp_impl<__fmt_fp_small_buffer_size>(
+        __value, __ctx, __specs, __is_finite, __fmt, __precision, __num_trailing_zeros);
+    }
+    return ::cuda::std::__fmt_format_fp_impl<__fmt_fp_large_buffer_size_v<_Tp>>(
+      __value, __ctx, __specs, __is_finite, __fmt, __precision, __num_trailing_zeros);
+  }
+}
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA_STD__FORMAT_FORMAT_FLOATING_POINT_H
@@ -0,0 +1,579 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___FORMAT_FORMAT_FUNCTIONS_H
+#define _CUDA_STD___FORMAT_FORMAT_FUNCTIONS_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__concepts/concept_macros.h>
+#include <cuda/std/__cstddef/types.h>
+#include <cuda/std/__format/buffer.h>
+#include <cuda/std/__format/format_arg.h>
+#include <cuda/std/__format/format_arg_store.h>
+#include <cuda/std/__format/format_args.h>
+#include <cuda/std/__format/format_context.h>
+#include <cuda/std/__format/format_error.h>
+#include <cuda/std/__format/format_parse_context.h>
+#include <cuda/std/__format/formatter.h>
+#include <cuda/std/__format/formatters/bool.h>
+#include <cuda/std/__format/formatters/char.h>
+#include <cuda/std/__format/formatters/fp.h>
+#include <cuda/std/__format/formatters/int.h>
+#include <cuda/std/__format/formatters/ptr.h>
+#include <cuda/std/__format/formatters/str.h>
+#include <cuda/std/__format/output_utils.h>
+#include <cuda/std/__format/parse_arg_id.h>
+#include <cuda/std/__fwd/format.h>
+#include <cuda/std/__iterator/back_insert_iterator.h>
+#include <cuda/std/__iterator/concepts.h>
+#include <cuda/std/__iterator/incrementable_traits.h>
+#include <cuda/std/__memory/pointer_traits.h>
+#include <cuda/std/__type_traits/is_convertible.h>
+#include <cuda/std/__type_traits/is_same.h>
+#include <cuda/std/__type_traits/remove_cvref.h>
+#include <cuda/std/__type_traits/type_identity.h>
+#include <cuda/std/__utility/monostate.h>
+#include <cuda/std/__utility/move.h>
+#include <cuda/std/array>
+#include <cuda/std/string_view>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+template <class _CharT>
+using __fmt_buffer_context _CCCL_NODEBUG_ALIAS =
+  basic_format_context<__back_insert_iterator<__fmt_output_buffer<_CharT>>, _CharT>;
+
+//! @brief Parses the format string of a handle argument with the formatter of its type during the compile-time
+//! validation of a basic_format_string
+template <class _CharT>
+class __fmt_compile_time_handle
+{
+public:
+  _CCCL_API constexpr __fmt_compile_time_handle() noexcept
+      : __parse_{nullptr}
+  {}
+
+  template <class _Tp>
+  _CCCL_API constexpr void __enable() noexcept
+  {
+    __parse_ = &__fmt_compile_time_handle::__parse_with<_Tp>;
+  }
+
+  _CCCL_API constexpr void __parse(basic_format_parse_context<_CharT>& __ctx) const
+  {
+    if (__parse_ == nullptr)
+    {
+      ::cuda::std::__throw_format_error("Not a handle");
+    }
+    __parse_(__ctx);
+  }
+
+private:
+  template <class _Tp>
+  _CCCL_API static constexpr void __parse_with(basic_format_parse_context<_CharT>& __ctx)
+  {
+    formatter<_Tp, _CharT> __f;
+    __ctx.advance_to(__f.parse(__ctx));
+  }
+
+  void (*__parse_)(basic_format_parse_context<_CharT>&);
+};
+
+template <class _CharT, class _Tp>
+[[nodiscard]] _CCCL_API _CCCL_CONSTEVAL __fmt_compile_time_handle<_CharT> __fmt_make_compile_time_handle() noexcept
+{
+  __fmt_compile_time_handle<_CharT> __handle{};
+  if constexpr (::cuda::std::__fmt_determine_arg_t<__fmt_buffer_context<_CharT>, _Tp>() == __fmt_arg_t::__handle)
+  {
+    __handle.template __enable<_Tp>();
+  }
+  return __handle;
+}
+
+//! @brief The format context used for the compile-time validation of a basic_format_string
+//!
+//! Instead of the arguments it only knows their types. Nothing is written during the validation, so all operations of
+//! its iterator are no-ops.
+template <class _CharT>
+class __fmt_compile_time_format_context
+{
+public:
+  using char_type = _CharT;
+
+  struct iterator
+  {
+    _CCCL_API constexpr iterator& operator=(_CharT) noexcept
+    {
+      return *this;
+    }
+    _CCCL_API constexpr iterator& operator*() noexcept
+    {
+      return *this;
+    }
+    _CCCL_API constexpr iterator operator++(int) noexcept
+    {
+      return *this;
+    }
+  };
+
+  _CCCL_API constexpr explicit __fmt_compile_time_format_context(
+    const __fmt_arg_t* __args, const __fmt_compile_time_handle<_CharT>* __handles, size_t __size) noexcept
+      : __args_{__args}
+      , __handles_{__handles}
+      , __size_{__size}
+  {}
+
+  [[nodiscard]] _CCCL_API constexpr __fmt_arg_t arg(size_t __id) const
+  {
+    if (__id >= __size_)
+    {
+      ::cuda::std::__throw_format_error("The argument index value is too large for the number of arguments supplied");
+    }
+    return __args_[__id];
+  }
+
+  [[nodiscard]] _CCCL_API constexpr const __fmt_compile_time_handle<_CharT>& __handle(size_t __id) const
+  {
+    if (__id >= __size_)
+    {
+      ::cuda::std::__throw_format_error("The argument index value is too large for the number of arguments supplied");
+    }
+    return __handles_[__id];
+  }
+
+  [[nodiscard]] _CCCL_API constexpr iterator out() const noexcept
+  {
+    return {};
+  }
+
+  _CCCL_API constexpr void advance_to(iterator) noexcept {}
+
+private:
+  const __fmt_arg_t* __args_;
+  const __fmt_compile_time_handle<_CharT>* __handles_;
+  size_t __size_;
+};
+
+//! @brief Validates that an argument used as a dynamic width or precision has a standard integer type
+//! [format.string.std]/8
+_CCCL_API constexpr void __fmt_compile_time_validate_arg_id_type(__fmt_arg_t __type)
+{
+  switch (__type)
+  {
+    case __fmt_arg_t::__int:
+    case __fmt_arg_t::__long_long:
+    case __fmt_arg_t::__unsigned:
+    case __fmt_arg_t::__unsigned_long_long:
+      return;
+    default:
+      ::cuda::std::__throw_format_error("Replacement argument isn't a standard signed or unsigned integer type");
+  }
+}
+
+template <class _CharT, class _Tp, bool _HasPrecision = false>
+_CCCL_API constexpr void __fmt_compile_time_validate_argument(
+  basic_format_parse_context<_CharT>& __parse_ctx, __fmt_compile_time_format_context<_CharT>& __ctx)
+{
+  formatter<_Tp, _CharT> __formatter;
+  __parse_ctx.advance_to(__formatter.parse(__parse_ctx));
+  if (__formatter.__parser_.__width_as_arg_)
+  {
+    ::cuda::std::__fmt_compile_time_validate_arg_id_type(__ctx.arg(__formatter.__parser_.__width_));
+  }
+  if constexpr (_HasPrecision)
+  {
+    if (__formatter.__parser_.__precision_as_arg_)
+    {
+      ::cuda::std::__fmt_compile_time_validate_arg_id_type(__ctx.arg(__formatter.__parser_.__precision_));
+    }
+  }
+}
+
+template <class _CharT>
+_CCCL_API constexpr void __fmt_compile_time_visit_format_arg(
+  basic_format_parse_context<_CharT>& __parse_ctx, __fmt_compile_time_format_context<_CharT>& __ctx, __fmt_arg_t __type)
+{
+  switch (__type)
+  {
+    case __fmt_arg_t::__boolean:
+      return ::cuda::std::__fmt_compile_time_validate_argument<_CharT, bool>(__parse_ctx, __ctx);
+    case __fmt_arg_t::__char_type:
+      return ::cuda::std::__fmt_compile_time_validate_argument<_CharT, _CharT>(__parse_ctx, __ctx);
+    case __fmt_arg_t::__int:
+      return ::cuda::std::__fmt_compile_time_validate_argument<_CharT, int>(__parse_ctx, __ctx);
+    case __fmt_arg_t::__long_long:
+      return ::cuda::std::__fmt_compile_time_validate_argument<_CharT, long long>(__parse_ctx, __ctx);
+    case __fmt_arg_t::__unsigned:
+      return ::cuda::std::__fmt_compile_time_validate_argument<_CharT, unsigned>(__parse_ctx, __ctx);
+    case __fmt_arg_t::__unsigned_long_long:
+      return ::cuda::std::__fmt_compile_time_validate_argument<_CharT, unsigned long long>(__parse_ctx, __ctx);
+    case __fmt_arg_t::__float:
+      return ::cuda::std::__fmt_compile_time_validate_argument<_CharT, float, true>(__parse_ctx, __ctx);
+    case __fmt_arg_t::__double:
+      return ::cuda::std::__fmt_compile_time_validate_argument<_CharT, double, true>(__parse_ctx, __ctx);
+#if _CCCL_HAS_LONG_DOUBLE()
+    case __fmt_arg_t::__long_double:
+      return ::cuda::std::__fmt_compile_time_validate_argument<_CharT, long double, true>(__parse_ctx, __ctx);
+#endif // _CCCL_HAS_LONG_DOUBLE()
+    case __fmt_arg_t::__const_char_type_ptr:
+      return ::cuda::std::__fmt_compile_time_validate_argument<_CharT, const _CharT*, true>(__parse_ctx, __ctx);
+    case __fmt_arg_t::__string_view:
+      return ::cuda::std::__fmt_compile_time_validate_argument<_CharT, basic_string_view<_CharT>, true>(
+        __parse_ctx, __ctx);
+    case __fmt_arg_t::__ptr:
+      return ::cuda::std::__fmt_compile_time_validate_argument<_CharT, const void*>(__parse_ctx, __ctx);
+    default:
+      ::cuda::std::__throw_format_error("Invalid argument");
+  }
+}
+
+//! @brief Formats a single argument, which is selected by the arg-id of the replacement field
+template <class _ParseCtx, class _Ctx>
+struct __fmt_replacement_field_visitor
+{
+  using _CharT = typename _Ctx::char_type;
+
+  _ParseCtx& __parse_ctx_;
+  _Ctx& __ctx_;
+  bool __parse_;
+
+  template <class _Tp>
+  _CCCL_API void operator()([[maybe_unused]] _Tp __arg)
+  {
+    if constexpr (is_same_v<_Tp, monostate>)
+    {
+      ::cuda::std::__throw_format_error("The argument index value is too large for the number of arguments supplied");
+    }
+    else if constexpr (is_same_v<_Tp, typename basic_format_arg<_Ctx>::handle>)
+    {
+      __arg.format(__parse_ctx_, __ctx_);
+    }
+    else
+    {
+      formatter<_Tp, _CharT> __formatter;
+      if (__parse_)
+      {
+        __parse_ctx_.advance_to(__formatter.parse(__parse_ctx_));
+      }
+      __ctx_.advance_to(__formatter.format(__arg, __ctx_));
+    }
+  }
+};
+
+template <class _It, class _ParseCtx, class _Ctx>
+[[nodiscard]] _CCCL_API constexpr _It
+__fmt_handle_replacement_field(_It __begin, _It __end, _ParseCtx& __parse_ctx, _Ctx& __ctx)
+{
+  using _CharT   = iter_value_t<_It>;
+  const auto __r = ::cuda::std::__fmt_parse_arg_id(__begin, __end, __parse_ctx);
+
+  if (__r.__last == __end)
+  {
+    ::cuda::std::__throw_format_error("The argument index should end with a ':' or a '}'");
+  }
+
+  const bool __parse = *__r.__last == _CharT{':'};
+  switch (*__r.__last)
+  {
+    case _CharT{':'}:
+      // The arg-id has a format-specifier, advance the input to the format-spec.
+      __parse_ctx.advance_to(__r.__last + 1);
+      break;
+    case _CharT{'}'}:
+      // The arg-id has no format-specifier.
+      __parse_ctx.advance_to(__r.__last);
+      break;
+    default:
+      ::cuda::std::__throw_format_error("The argument index should end with a ':' or a '}'");
+  }
+
+  if constexpr (is_same_v<_Ctx, __fmt_compile_time_format_context<_CharT>>)
+  {
+    const __fmt_arg_t __type = __ctx.arg(__r.__value);
+    if (__type == __fmt_arg_t::__none)
+    {
+      ::cuda::std::__throw_format_error("The argument index value is too large for the number of arguments supplied");
+    }
+    else if (__type == __fmt_arg_t::__handle)
+    {
+      __ctx.__handle(__r.__value).__parse(__parse_ctx);
+    }
+    else if (__parse)
+    {
+      ::cuda::std::__fmt_compile_time_visit_format_arg(__parse_ctx, __ctx, __type);
+    }
+  }
+  else
+  {
+    ::cuda::std::visit_format_arg(
+      __fmt_replacement_field_visitor<_ParseCtx, _Ctx>{__parse_ctx, __ctx, __parse}, __ctx.arg(__r.__value));
+  }
+
+  __begin = __parse_ctx.begin();
+  if (__begin == __end || *__begin != _CharT{'}'})
+  {
+    ::cuda::std::__throw_format_error("The replacement field misses a terminating '}'");
+  }
+  return ++__begin;
+}
+
+//! @brief Formats the arguments of @c __ctx according to the format string of @c __parse_ctx
+//!
+//! With a __fmt_compile_time_format_context nothing is written, instead the format string is validated against the
+//! types of the arguments.
+template <class _ParseCtx, class _Ctx>
+_CCCL_API constexpr typename _Ctx::iterator __fmt_vformat_to(_ParseCtx&& __parse_ctx, _Ctx&& __ctx)
+{
+  using _CharT = typename _ParseCtx::char_type;
+  static_assert(is_same_v<typename remove_cvref_t<_Ctx>::char_type, _CharT>);
+
+  auto __begin                                      = __parse_ctx.begin();
+  const auto __end                                  = __parse_ctx.end();
+  typename remove_cvref_t<_Ctx>::iterator __out_it = __ctx.out();
+  while (__begin != __end)
+  {
+    // Copy the literal text up to the next replacement field or escape sequence in one go
+    auto __text_end = __begin;
+    while (__text_end != __end && *__text_end != _CharT{'{'} && *__text_end != _CharT{'}'})
+    {
+      ++__text_end;
+    }
+    if (__text_end != __begin)
+    {
+      if constexpr (!is_same_v<remove_cvref_t<_Ctx>, __fmt_compile_time_format_context<_CharT>>)
+      {
+        __out_it = ::cuda::std::__fmt_copy(
+          basic_string_view<_CharT>{::cuda::std::to_address(__begin), static_cast<size_t>(__text_end - __begin)},
+          ::cuda::std::move(__out_it));
+      }
+      __begin = __text_end;
+      continue;
+    }
+
+    if (*__begin == _CharT{'{'})
+    {
+      ++__begin;
+      if (__begin == __end)
+      {
+        ::cuda::std::__throw_format_error("The format string terminates at a '{'");
+      }
+      if (*__begin != _CharT{'{'})
+      {
+        __ctx.advance_to(::cuda::std::move(__out_it));
+        __begin  = ::cuda::std::__fmt_handle_replacement_field(__begin, __end, __parse_ctx, __ctx);
+        __out_it = __ctx.out();
+        continue;
+      }
+      // The string is an escape sequence.
+    }
+    else
+    {
+      ++__begin;
+      if (__begin == __end || *__begin != _CharT{'}'})
+      {
+        ::cuda::std::__throw_format_error("The format string contains an invalid escape sequence");
+      }
+    }
+
+    // Copy the escaped character to the output verbatim.
+    *__out_it++ = *__begin++;
+  }
+  return __out_it;
+}
+
+//! @brief A format string that is checked against the types of the arguments at compile time
+//!
+//! The check requires consteval, so it is only done from C++20 on. Before that the format string is validated while the
+//! arguments are formatted, as done for vformat_to.
+template <class _CharT, class... _Args>
+struct _CCCL_TYPE_VISIBILITY_DEFAULT basic_format_string
+{
+  _CCCL_TEMPLATE(class _Tp)
+  _CCCL_REQUIRES(is_convertible_v<const _Tp&, basic_string_view<_CharT>>)
+  _CCCL_API _CCCL_CONSTEVAL basic_format_string(const _Tp& __str)
+      : __str_{__str}
+  {
+#if !defined(_CCCL_NO_CONSTEVAL)
+    ::cuda::std::__fmt_vformat_to(basic_format_parse_context<_CharT>{__str_, sizeof...(_Args)},
+                                  _Context{__types_.data(), __handles_.data(), sizeof...(_Args)});
+#endif // !_CCCL_NO_CONSTEVAL
+  }
+
+  [[nodiscard]] _CCCL_API constexpr basic_string_view<_CharT> get() const noexcept
+  {
+    return __str_;
+  }
+
+private:
+  basic_string_view<_CharT> __str_;
+
+#if !defined(_CCCL_NO_CONSTEVAL)
+  using _Context = __fmt_compile_time_format_context<_CharT>;
+
+  static constexpr array<__fmt_arg_t, sizeof...(_Args)> __types_{
+    ::cuda::std::__fmt_determine_arg_t<__fmt_buffer_context<_CharT>, remove_cvref_t<_Args>>()...};
+  static constexpr array<__fmt_compile_time_handle<_CharT>, sizeof...(_Args)> __handles_{
+    ::cuda::std::__fmt_make_compile_time_handle<_CharT, remove_cvref_t<_Args>>()...};
+#endif // !_CCCL_NO_CONSTEVAL
+};
+
+template <class... _Args>
+using format_string = basic_format_string<char, type_identity_t<_Args>...>;
+#if _CCCL_HAS_WCHAR_T()
+template <class... _Args>
+using wformat_string = basic_format_string<wchar_t, type_identity_t<_Args>...>;
+#endif // _CCCL_HAS_WCHAR_T()
+
+template <class _OutIt>
+struct _CCCL_TYPE_VISIBILITY_DEFAULT format_to_n_result
+{
+  _OutIt out;
+  iter_difference_t<_OutIt> size;
+};
+
+template <class _CharT>
+[[nodiscard]] _CCCL_API __fmt_buffer_context<_CharT> __fmt_make_buffer_context(
+  __fmt_output_buffer<_CharT>& __buffer, basic_format_args<__fmt_buffer_context<_CharT>> __args)
+{
+  using _OutIt = __back_insert_iterator<__fmt_output_buffer<_CharT>>;
+  return ::cuda::std::__fmt_make_format_context(_OutIt{__buffer}, __args);
+}
+
+template <class _OutIt, class _CharT>
+[[nodiscard]] _CCCL_API _OutIt __fmt_vformat_to_it(
+  _OutIt __out_it, basic_string_view<_CharT> __fmt, basic_format_args<__fmt_buffer_context<_CharT>> __args)
+{
+  __fmt_iterator_buffer<_OutIt, _CharT> __buffer{::cuda::std::move(__out_it)};
+  ::cuda::std::__fmt_vformat_to(basic_format_parse_context{__fmt, __args.__size()},
+                                ::cuda::std::__fmt_make_buffer_context<_CharT>(__buffer, __args));
+  return ::cuda::std::move(__buffer).__out_it();
+}
+
+template <class _OutIt, class _CharT>
+[[nodiscard]] _CCCL_API format_to_n_result<_OutIt> __fmt_vformat_to_n(
+  _OutIt __out_it,
+  iter_difference_t<_OutIt> __n,
+  basic_string_view<_CharT> __fmt,
+  basic_format_args<__fmt_buffer_context<_CharT>> __args)
+{
+  __fmt_format_to_n_buffer<_OutIt, _CharT> __buffer{::cuda::std::move(__out_it), __n};
+  ::cuda::std::__fmt_vformat_to(basic_format_parse_context{__fmt, __args.__size()},
+                                ::cuda::std::__fmt_make_buffer_context<_CharT>(__buffer, __args));
+  iter_difference_t<_OutIt> __size{};
+  _OutIt __out = ::cuda::std::move(__buffer).__out_it(__size);
+  return {::cuda::std::move(__out), __size};
+}
+
+template <class _CharT>
+[[nodiscard]] _CCCL_API size_t
+__fmt_vformatted_size(basic_string_view<_CharT> __fmt, basic_format_args<__fmt_buffer_context<_CharT>> __args)
+{
+  __fmt_counting_buffer<_CharT> __buffer{};
+  ::cuda::std::__fmt_vformat_to(basic_format_parse_context{__fmt, __args.__size()},
+                                ::cuda::std::__fmt_make_buffer_context<_CharT>(__buffer, __args));
+  return __buffer.__total();
+}
+
+//! @brief Formats the arguments according to a format string that is only known at run time
+//! @throws format_error if the format string is invalid
+_CCCL_TEMPLATE(class _OutIt)
+_CCCL_REQUIRES(output_iterator<_OutIt, const char&>)
+_CCCL_API _OutIt vformat_to(_OutIt __out_it, string_view __fmt, format_args __args)
+{
+  return ::cuda::std::__fmt_vformat_to_it(::cuda::std::move(__out_it), __fmt, __args);
+}
+
+#if _CCCL_HAS_WCHAR_T()
+_CCCL_TEMPLATE(class _OutIt)
+_CCCL_REQUIRES(output_iterator<_OutIt, const wchar_t&>)
+_CCCL_API _OutIt vformat_to(_OutIt __out_it, wstring_view __fmt, wformat_args __args)
+{
+  return ::cuda::std::__fmt_vformat_to_it(::cuda::std::move(__out_it), __fmt, __args);
+}
+#endif // _CCCL_HAS_WCHAR_T()
+
+//! @brief Formats the arguments into @c __out_it without allocating memory
+//!
+//! Pointers and other contiguous iterators are written to directly, other output iterators through a small buffer on
+//! the stack.
+//!
+//! @returns The end of the written output
+_CCCL_TEMPLATE(class _OutIt, class... _Args)
+_CCCL_REQUIRES(output_iterator<_OutIt, const char&>)
+_CCCL_API _OutIt format_to(_OutIt __out_it, format_string<_Args...> __fmt, _Args&&... __args)
+{
+  return ::cuda::std::__fmt_vformat_to_it(
+    ::cuda::std::move(__out_it), __fmt.get(), format_args{::cuda::std::make_format_args(__args...)});
+}
+
+#if _CCCL_HAS_WCHAR_T()
+_CCCL_TEMPLATE(class _OutIt, class... _Args)
+_CCCL_REQUIRES(output_iterator<_OutIt, const wchar_t&>)
+_CCCL_API _OutIt format_to(_OutIt __out_it, wformat_string<_Args...> __fmt, _Args&&... __args)
+{
+  return ::cuda::std::__fmt_vformat_to_it(
+    ::cuda::std::move(__out_it), __fmt.get(), wformat_args{::cuda::std::make_wformat_args(__args...)});
+}
+#endif // _CCCL_HAS_WCHAR_T()
+
+//! @brief Formats the arguments into @c __out_it, writing at most @c __n characters
+//!
+//! @returns The end of the written output and the number of characters the complete output consists of
+_CCCL_TEMPLATE(class _OutIt, class... _Args)
+_CCCL_REQUIRES(output_iterator<_OutIt, const char&>)
+_CCCL_API format_to_n_result<_OutIt>
+format_to_n(_OutIt __out_it, iter_difference_t<_OutIt> __n, format_string<_Args...> __fmt, _Args&&... __args)
+{
+  return ::cuda::std::__fmt_vformat_to_n(
+    ::cuda::std::move(__out_it), __n, __fmt.get(), format_args{::cuda::std::make_format_args(__args...)});
+}
+
+#if _CCCL_HAS_WCHAR_T()
+_CCCL_TEMPLATE(class _OutIt, class... _Args)
+_CCCL_REQUIRES(output_iterator<_OutIt, const wchar_t&>)
+_CCCL_API format_to_n_result<_OutIt>
+format_to_n(_OutIt __out_it, iter_difference_t<_OutIt> __n, wformat_string<_Args...> __fmt, _Args&&... __args)
+{
+  return ::cuda::std::__fmt_vformat_to_n(
+    ::cuda::std::move(__out_it), __n, __fmt.get(), wformat_args{::cuda::std::make_wformat_args(__args...)});
+}
+#endif // _CCCL_HAS_WCHAR_T()
+
+//! @brief Returns the number of characters the formatted arguments consist of
+template <class... _Args>
+[[nodiscard]] _CCCL_API size_t formatted_size(format_string<_Args...> __fmt, _Args&&... __args)
+{
+  return ::cuda::std::__fmt_vformatted_size(__fmt.get(), format_args{::cuda::std::make_format_args(__args...)});
+}
+
+#if _CCCL_HAS_WCHAR_T()
+template <class... _Args>
+[[nodiscard]] _CCCL_API size_t formatted_size(wformat_string<_Args...> __fmt, _Args&&... __args)
+{
+  return ::cuda::std::__fmt_vformatted_size(__fmt.get(), wformat_args{::cuda::std::make_wformat_args(__args...)});
+}
+#endif // _CCCL_HAS_WCHAR_T()
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA_STD___FORMAT_FORMAT_FUNCTIONS_H
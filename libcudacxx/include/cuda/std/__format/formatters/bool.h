@@ -80,7 +80,6 @@ struct __fmt_formatter_bool
     }
   }
 
-private:
   __fmt_spec_parser<_CharT> __parser_; //!< The parser for format specifications.
 };
 
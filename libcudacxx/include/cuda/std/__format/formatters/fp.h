@@ -20,6 +20,7 @@
 #  pragma system_header
 #endif // no system header
 
+#include <cuda/std/__format/format_floating_point.h>
 #include <cuda/std/__format/format_spec_parser.h>
 #include <cuda/std/__format/formatter.h>
 
@@ -59,12 +60,9 @@ struct __fmt_formatter_fp
   template <class _Tp, class _FmtCtx>
   _CCCL_API typename _FmtCtx::iterator format(_Tp __value, _FmtCtx& __ctx) const
   {
-    _CCCL_ASSERT(false, "formatter</*floating-point-type*/>::format() is not implemented");
-    (void) __value;
-    return __ctx.out();
+    return ::cuda::std::__fmt_format_fp(__value, __ctx, __parser_.__get_parsed_std_spec(__ctx));
   }
 
-private:
   __fmt_spec_parser<_CharT> __parser_; //!< The parser for format specifications.
 };
 
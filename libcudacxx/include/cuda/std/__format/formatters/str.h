@@ -122,6 +122,7 @@ private:
     return ::cuda::std::__fmt_write_string(__str2, __ctx.out(), __parser_.__get_parsed_std_spec(__ctx));
   }
 
+public:
   __fmt_spec_parser<_CharT> __parser_ = __make_parser(); //!< The parser for format specifications.
 };
 
@@ -24,8 +24,11 @@
 #include <cuda/std/__algorithm/fill_n.h>
 #include <cuda/std/__algorithm/transform.h>
 #include <cuda/std/__cstddef/types.h>
+#include <cuda/std/__format/buffer.h>
 #include <cuda/std/__format/format_spec_parser.h>
+#include <cuda/std/__iterator/back_insert_iterator.h>
 #include <cuda/std/__iterator/iterator_traits.h>
+#include <cuda/std/__type_traits/is_same.h>
 #include <cuda/std/__utility/move.h>
 #include <cuda/std/string_view>
 
@@ -98,14 +101,25 @@ __fmt_padding_size(size_t __size, size_t __width, __fmt_spec_alignment __align)
 _CCCL_END_NV_DIAG_SUPPRESS()
 #endif // _CCCL_COMPILER(MSVC)
 
+//! Whether the output iterator is the one of the format_context, which allows to write whole strings to its buffer
+template <class _OutIt, class _CharT>
+inline constexpr bool __fmt_is_buffer_iterator = is_same_v<_OutIt, __back_insert_iterator<__fmt_output_buffer<_CharT>>>;
+
 //! Copy wrapper.
 //!
 //! This uses a "mass output function" of __format::__output_buffer when possible.
 template <class _CharT, class _OutCharT = _CharT, class _OutIt>
 [[nodiscard]] _CCCL_API _OutIt __fmt_copy(basic_string_view<_CharT> __str, _OutIt __out_it)
 {
-  // todo: handle __fmt_output_buffer and __fmt_retarget_buffer when they are implemented
-  return ::cuda::std::copy(__str.begin(), __str.end(), ::cuda::std::move(__out_it));
+  if constexpr (__fmt_is_buffer_iterator<_OutIt, _OutCharT>)
+  {
+    __out_it.__get_container()->__copy(__str);
+    return __out_it;
+  }
+  else
+  {
+    return ::cuda::std::copy(__str.begin(), __str.end(), ::cuda::std::move(__out_it));
+  }
 }
 
 template <class _It, class _CharT = iter_value_t<_It>, class _OutCharT = _CharT, class _OutIt>
@@ -126,8 +140,15 @@ template <class _It, class _CharT = iter_value_t<_It>, class _OutCharT = _CharT,
 template <class _It, class _CharT = iter_value_t<_It>, class _OutCharT = _CharT, class _OutIt, class _UnaryOp>
 [[nodiscard]] _CCCL_API _OutIt __fmt_transform(_It __first, _It __last, _OutIt __out_it, _UnaryOp __operation)
 {
-  // todo: handle __fmt_output_buffer and __fmt_retarget_buffer when they are implemented
-  return ::cuda::std::transform(__first, __last, ::cuda::std::move(__out_it), __operation);
+  if constexpr (__fmt_is_buffer_iterator<_OutIt, _OutCharT>)
+  {
+    __out_it.__get_container()->__transform(__first, __last, __operation);
+    return __out_it;
+  }
+  else
+  {
+    return ::cuda::std::transform(__first, __last, ::cuda::std::move(__out_it), __operation);
+  }
 }
 
 //! Fill wrapper.
@@ -136,8 +157,15 @@ template <class _It, class _CharT = iter_value_t<_It>, class _OutCharT = _CharT,
 template <class _CharT, class _OutIt>
 [[nodiscard]] _CCCL_API _OutIt __fmt_fill(_OutIt __out_it, size_t __n, _CharT __value)
 {
-  // todo: handle __fmt_output_buffer and __fmt_retarget_buffer when they are implemented
-  return ::cuda::std::fill_n(::cuda::std::move(__out_it), __n, __value);
+  if constexpr (__fmt_is_buffer_iterator<_OutIt, _CharT>)
+  {
+    __out_it.__get_container()->__fill(__n, __value);
+    return __out_it;
+  }
+  else
+  {
+    return ::cuda::std::fill_n(::cuda::std::move(__out_it), __n, __value);
+  }
 }
 
 template <class _CharT, class _OutIt>
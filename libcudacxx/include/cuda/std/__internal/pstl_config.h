@@ -24,10 +24,24 @@
 #include <cuda/std/__cccl/prologue.h>
 
 #define _CCCL_HAS_BACKEND_CUDA() _CCCL_CUDA_COMPILATION() && !_CCCL_COMPILER(NVRTC)
-#define _CCCL_HAS_BACKEND_OMP()  0
-#define _CCCL_HAS_BACKEND_TBB()  0
 
-#define _CCCL_HAS_PSTL_BACKEND() (_CCCL_HAS_BACKEND_CUDA() || _CCCL_HAS_BACKEND_OMP() || _CCCL_HAS_BACKEND_TBB())
+// The OpenMP backend is available whenever the host compiler runs with OpenMP enabled
+#if defined(_OPENMP) && !_CCCL_COMPILER(NVRTC) && !defined(CCCL_DISABLE_OMP_BACKEND)
+#  define _CCCL_HAS_BACKEND_OMP() 1
+#else // ^^^ OpenMP enabled ^^^ / vvv OpenMP disabled vvv
+#  define _CCCL_HAS_BACKEND_OMP() 0
+#endif // ^^^ OpenMP disabled ^^^
+
+// The TBB backend requires linking against TBB, so users have to opt into it
+#if defined(CCCL_ENABLE_TBB_BACKEND) && !_CCCL_COMPILER(NVRTC)
+#  define _CCCL_HAS_BACKEND_TBB() 1
+#else // ^^^ TBB requested ^^^ / vvv TBB not requested vvv
+#  define _CCCL_HAS_BACKEND_TBB() 0
+#endif // ^^^ TBB not requested ^^^
+
+#define _CCCL_HAS_BACKEND_HOST() (_CCCL_HAS_BACKEND_OMP() || _CCCL_HAS_BACKEND_TBB())
+
+#define _CCCL_HAS_PSTL_BACKEND() (_CCCL_HAS_BACKEND_CUDA() || _CCCL_HAS_BACKEND_HOST())
 
 #include <cuda/std/__cccl/epilogue.h>
 
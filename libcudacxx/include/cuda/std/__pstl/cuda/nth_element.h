@@ -0,0 +1,63 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_CUDA_NTH_ELEMENT_H
+#define _CUDA_STD___PSTL_CUDA_NTH_ELEMENT_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_BACKEND_CUDA()
+
+#  include <cuda/std/__execution/policy.h>
+#  include <cuda/std/__pstl/cuda/sort.h>
+#  include <cuda/std/__pstl/dispatch.h>
+#  include <cuda/std/__utility/move.h>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+//! @brief CUDA backend of cuda::std::nth_element
+//! CUB does not provide a selection algorithm, so the whole range is sorted, which satisfies the postconditions
+template <>
+struct __pstl_dispatch<__pstl_algorithm::__nth_element, __execution_backend::__cuda>
+{
+  template <class _Policy, class _RandomAccessIterator, class _Compare>
+  _CCCL_HOST_API void operator()(
+    [[maybe_unused]] const _Policy& __policy,
+    _RandomAccessIterator __first,
+    _RandomAccessIterator,
+    _RandomAccessIterator __last,
+    _Compare __comp) const
+  {
+    __pstl_cuda_sort<false>{}(
+      __policy, ::cuda::std::move(__first), ::cuda::std::move(__last), ::cuda::std::move(__comp));
+  }
+};
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_BACKEND_CUDA()
+
+#endif // _CUDA_STD___PSTL_CUDA_NTH_ELEMENT_H
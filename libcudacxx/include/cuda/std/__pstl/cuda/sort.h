@@ -0,0 +1,285 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_CUDA_SORT_H
+#define _CUDA_STD___PSTL_CUDA_SORT_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_BACKEND_CUDA()
+
+_CCCL_DIAG_PUSH
+_CCCL_DIAG_SUPPRESS_CLANG("-Wshadow")
+_CCCL_DIAG_SUPPRESS_CLANG("-Wunused-local-typedef")
+_CCCL_DIAG_SUPPRESS_GCC("-Wattributes")
+_CCCL_DIAG_SUPPRESS_NVHPC(attribute_requires_external_linkage)
+
+#  include <cub/device/device_merge_sort.cuh>
+#  include <cub/device/device_radix_sort.cuh>
+
+_CCCL_DIAG_POP
+
+#  include <cuda/__execution/policy.h>
+#  include <cuda/__functional/call_or.h>
+#  include <cuda/__stream/get_stream.h>
+#  include <cuda/__stream/stream_ref.h>
+#  include <cuda/std/__algorithm/sort.h>
+#  include <cuda/std/__algorithm/stable_sort.h>
+#  include <cuda/std/__exception/cuda_error.h>
+#  include <cuda/std/__exception/exception_macros.h>
+#  include <cuda/std/__execution/env.h>
+#  include <cuda/std/__execution/policy.h>
+#  include <cuda/std/__iterator/concepts.h>
+#  include <cuda/std/__iterator/distance.h>
+#  include <cuda/std/__iterator/iterator_traits.h>
+#  include <cuda/std/__memory/pointer_traits.h>
+#  include <cuda/std/__pstl/cuda/temporary_storage.h>
+#  include <cuda/std/__pstl/dispatch.h>
+#  include <cuda/std/__pstl/radix_sort_order.h>
+#  include <cuda/std/__type_traits/always_false.h>
+#  include <cuda/std/__utility/move.h>
+#  include <cuda/std/climits>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+//! @brief CUDA backend of cuda::std::sort and cuda::std::stable_sort
+//! Contiguous ranges of arithmetic values that are ordered by the standard comparison operators are sorted with
+//! cub::DeviceRadixSort, everything else with cub::DeviceMergeSort. The radix sort is stable, so it serves both.
+template <bool _Stable>
+struct __pstl_cuda_sort
+{
+  template <__pstl_radix_sort_order _Order, class _Policy, class _Tp>
+  _CCCL_HOST_API static void __radix_sort(const _Policy& __policy, _Tp* __keys, const size_t __count)
+  {
+    constexpr int __end_bit = static_cast<int>(sizeof(_Tp) * CHAR_BIT);
+
+    // Determine temporary device storage requirements for device_radix_sort
+    size_t __num_bytes = 0;
+    CUB_NS_QUALIFIER::DoubleBuffer<_Tp> __query{__keys, nullptr};
+    if constexpr (_Order == __pstl_radix_sort_order::__ascending)
+    {
+      _CCCL_TRY_CUDA_API(
+        CUB_NS_QUALIFIER::DeviceRadixSort::SortKeys,
+        "__pstl_cuda_sort: determination of device storage for cub::DeviceRadixSort::SortKeys failed",
+        static_cast<void*>(nullptr),
+        __num_bytes,
+        __query,
+        __count,
+        0,
+        __end_bit);
+    }
+    else
+    {
+      _CCCL_TRY_CUDA_API(
+        CUB_NS_QUALIFIER::DeviceRadixSort::SortKeysDescending,
+        "__pstl_cuda_sort: determination of device storage for cub::DeviceRadixSort::SortKeysDescending failed",
+        static_cast<void*>(nullptr),
+        __num_bytes,
+        __query,
+        __count,
+        0,
+        __end_bit);
+    }
+
+    // Allocate memory for the alternate keys
+    auto __stream = ::cuda::__call_or(::cuda::get_stream, ::cuda::stream_ref{cudaStreamPerThread}, __policy);
+
+    {
+      __temporary_storage<_Tp> __storage{__policy, __num_bytes, __count};
+      CUB_NS_QUALIFIER::DoubleBuffer<_Tp> __buffers{__keys, __storage.template __get_raw_ptr<0>()};
+
+      // Run the kernel
+      if constexpr (_Order == __pstl_radix_sort_order::__ascending)
+      {
+        _CCCL_TRY_CUDA_API(
+          CUB_NS_QUALIFIER::DeviceRadixSort::SortKeys,
+          "__pstl_cuda_sort: kernel launch of cub::DeviceRadixSort::SortKeys failed",
+          __storage.__get_temp_storage(),
+          __num_bytes,
+          __buffers,
+          __count,
+          0,
+          __end_bit,
+          __stream.get());
+      }
+      else
+      {
+        _CCCL_TRY_CUDA_API(
+          CUB_NS_QUALIFIER::DeviceRadixSort::SortKeysDescending,
+          "__pstl_cuda_sort: kernel launch of cub::DeviceRadixSort::SortKeysDescending failed",
+          __storage.__get_temp_storage(),
+          __num_bytes,
+          __buffers,
+          __count,
+          0,
+          __end_bit,
+          __stream.get());
+      }
+
+      // The sorted keys might end up in the alternate buffer
+      if (__buffers.Current() != __keys)
+      {
+        _CCCL_TRY_CUDA_API(
+          ::cudaMemcpyAsync,
+          "__pstl_cuda_sort: copy of the sorted keys back into the input range failed",
+          __keys,
+          __buffers.Current(),
+          __count * sizeof(_Tp),
+          ::cudaMemcpyDefault,
+          __stream.get());
+      }
+    }
+  }
+
+  template <class _Policy, class _RandomAccessIterator, class _Compare>
+  _CCCL_HOST_API static void
+  __merge_sort(const _Policy& __policy, _RandomAccessIterator __first, _RandomAccessIterator __last, _Compare __comp)
+  {
+    const auto __count = ::cuda::std::distance(__first, __last);
+
+    // Determine temporary device storage requirements for device_merge_sort
+    size_t __num_bytes = 0;
+    if constexpr (_Stable)
+    {
+      _CCCL_TRY_CUDA_API(
+        CUB_NS_QUALIFIER::DeviceMergeSort::StableSortKeys,
+        "__pstl_cuda_sort: determination of device storage for cub::DeviceMergeSort::StableSortKeys failed",
+        static_cast<void*>(nullptr),
+        __num_bytes,
+        __first,
+        __count,
+        __comp);
+    }
+    else
+    {
+      _CCCL_TRY_CUDA_API(
+        CUB_NS_QUALIFIER::DeviceMergeSort::SortKeys,
+        "__pstl_cuda_sort: determination of device storage for cub::DeviceMergeSort::SortKeys failed",
+        static_cast<void*>(nullptr),
+        __num_bytes,
+        __first,
+        __count,
+        __comp);
+    }
+
+    // Allocate memory for result
+    auto __stream = ::cuda::__call_or(::cuda::get_stream, ::cuda::stream_ref{cudaStreamPerThread}, __policy);
+
+    {
+      __temporary_storage<> __storage{__policy, __num_bytes};
+
+      // Run the kernel
+      if constexpr (_Stable)
+      {
+        _CCCL_TRY_CUDA_API(
+          CUB_NS_QUALIFIER::DeviceMergeSort::StableSortKeys,
+          "__pstl_cuda_sort: kernel launch of cub::DeviceMergeSort::StableSortKeys failed",
+          __storage.__get_temp_storage(),
+          __num_bytes,
+          ::cuda::std::move(__first),
+          __count,
+          ::cuda::std::move(__comp),
+          __stream.get());
+      }
+      else
+      {
+        _CCCL_TRY_CUDA_API(
+          CUB_NS_QUALIFIER::DeviceMergeSort::SortKeys,
+          "__pstl_cuda_sort: kernel launch of cub::DeviceMergeSort::SortKeys failed",
+          __storage.__get_temp_storage(),
+          __num_bytes,
+          ::cuda::std::move(__first),
+          __count,
+          ::cuda::std::move(__comp),
+          __stream.get());
+      }
+    }
+  }
+
+  template <class _Policy, class _RandomAccessIterator, class _Compare>
+  _CCCL_HOST_API static void
+  __par_impl(const _Policy& __policy, _RandomAccessIterator __first, _RandomAccessIterator __last, _Compare __comp)
+  {
+    constexpr auto __order = __pstl_radix_sort_order_v<iter_value_t<_RandomAccessIterator>, _Compare>;
+    if constexpr (__order != __pstl_radix_sort_order::__none && contiguous_iterator<_RandomAccessIterator>)
+    {
+      __radix_sort<__order>(
+        __policy, ::cuda::std::to_address(__first), static_cast<size_t>(::cuda::std::distance(__first, __last)));
+    }
+    else
+    {
+      __merge_sort(__policy, ::cuda::std::move(__first), ::cuda::std::move(__last), ::cuda::std::move(__comp));
+    }
+  }
+
+  template <class _Policy, class _RandomAccessIterator, class _Compare>
+  _CCCL_HOST_API void operator()([[maybe_unused]] const _Policy& __policy,
+                                 _RandomAccessIterator __first,
+                                 _RandomAccessIterator __last,
+                                 _Compare __comp) const
+  {
+    if constexpr (::cuda::std::__has_random_access_traversal<_RandomAccessIterator>)
+    {
+      try
+      {
+        __par_impl(__policy, ::cuda::std::move(__first), ::cuda::std::move(__last), ::cuda::std::move(__comp));
+      }
+      catch (const ::cuda::cuda_error& __err)
+      {
+        if (__err.status() == cudaErrorMemoryAllocation)
+        {
+          _CCCL_THROW(::std::bad_alloc);
+        }
+        else
+        {
+          throw __err;
+        }
+      }
+    }
+    else
+    {
+      static_assert(__always_false_v<_Policy>, "CUDA backend of cuda::std::sort requires random access iterators");
+      if constexpr (_Stable)
+      {
+        ::cuda::std::stable_sort(::cuda::std::move(__first), ::cuda::std::move(__last), ::cuda::std::move(__comp));
+      }
+      else
+      {
+        ::cuda::std::sort(::cuda::std::move(__first), ::cuda::std::move(__last), ::cuda::std::move(__comp));
+      }
+    }
+  }
+};
+
+template <>
+struct __pstl_dispatch<__pstl_algorithm::__sort, __execution_backend::__cuda> : __pstl_cuda_sort<false>
+{};
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_BACKEND_CUDA()
+
+#endif // _CUDA_STD___PSTL_CUDA_SORT_H
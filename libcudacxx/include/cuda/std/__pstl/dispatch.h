@@ -41,10 +41,14 @@ enum class __pstl_algorithm
   __generate_n,
   __inclusive_scan,
   __merge,
+  __nth_element,
+  __partial_sort,
   __partition,
   __partition_copy,
   __reduce,
   __remove_if,
+  __sort,
+  __stable_sort,
   __transform,
   __transform_reduce,
   __unique,
@@ -73,6 +77,16 @@ template <__pstl_algorithm _Algorithm, __execution_backend _Backend>
 inline constexpr bool __pstl_can_dispatch<__pstl_dispatch<_Algorithm, _Backend>> =
   !::cuda::std::is_base_of_v<__pstl_no_dispatch, __pstl_dispatch<_Algorithm, _Backend>>;
 
+//! @brief The host backend that runs the parallel policies which do not request a backend themselves
+//! TBB has to be requested explicitly, so we prefer it over OpenMP, which is enabled by the compiler flags alone
+#if _CCCL_HAS_BACKEND_TBB()
+inline constexpr __execution_backend __pstl_default_host_backend = __execution_backend::__tbb;
+#elif _CCCL_HAS_BACKEND_OMP()
+inline constexpr __execution_backend __pstl_default_host_backend = __execution_backend::__omp;
+#else // ^^^ _CCCL_HAS_BACKEND_OMP() ^^^ / vvv !_CCCL_HAS_BACKEND_HOST() vvv
+inline constexpr __execution_backend __pstl_default_host_backend = __execution_backend::__none;
+#endif // ^^^ !_CCCL_HAS_BACKEND_HOST() ^^^
+
 _CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
 
 //! @brief Top layer dispatcher that returns a concrete dispatch if possible
@@ -87,6 +101,14 @@ template <__pstl_algorithm _Algorithm, class _Policy>
   {
     return __pstl_dispatch<_Algorithm, __backend>{};
   }
+  // Parallel policies without a backend, like cuda::std::execution::par, run on the default host backend
+  else if constexpr (__backend == __execution_backend::__none
+                     && __pstl_default_host_backend != __execution_backend::__none
+                     && (static_cast<uint8_t>(_Policy::__get_policy())
+                         & static_cast<uint8_t>(__execution_policy::__parallel)))
+  {
+    return __pstl_dispatch<_Algorithm, __pstl_default_host_backend>{};
+  }
   else
   {
     // No dispatch found, return invalid to signal serial execution
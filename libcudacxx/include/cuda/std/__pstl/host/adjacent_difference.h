@@ -0,0 +1,123 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_HOST_ADJACENT_DIFFERENCE_H
+#define _CUDA_STD___PSTL_HOST_ADJACENT_DIFFERENCE_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_BACKEND_HOST()
+
+#  include <cuda/std/__concepts/concept_macros.h>
+#  include <cuda/std/__execution/policy.h>
+#  include <cuda/std/__iterator/distance.h>
+#  include <cuda/std/__iterator/iterator_traits.h>
+#  include <cuda/std/__numeric/adjacent_difference.h>
+#  include <cuda/std/__pstl/dispatch.h>
+#  include <cuda/std/__pstl/host/for_each_tile.h>
+#  include <cuda/std/__utility/move.h>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+//! @brief Host backend of cuda::std::adjacent_difference
+//! Every output only depends on two neighboring inputs, so the tiles are independent. The standard requires that the
+//! input and output ranges do not overlap.
+template <__execution_backend _Backend>
+struct __pstl_host_adjacent_difference
+{
+  template <class _InputIterator, class _OutputIterator, class _BinaryOp>
+  [[nodiscard]] _CCCL_HOST_API static _OutputIterator
+  __par_impl(_InputIterator __first, _InputIterator __last, _OutputIterator __result, _BinaryOp __binary_op)
+  {
+    using _InDiff       = iter_difference_t<_InputIterator>;
+    using _OutDiff      = iter_difference_t<_OutputIterator>;
+    const auto __count  = ::cuda::std::distance(__first, __last);
+    const auto __tiling = __pstl_host_backend<_Backend>::__tiling(static_cast<size_t>(__count));
+    __pstl_host_backend<_Backend>::__for_each_tile(__tiling, [&](const size_t __tile) {
+      size_t __pos       = __tiling.__begin(__tile);
+      const size_t __end = __tiling.__end(__tile);
+      if (__pos == 0)
+      {
+        *__result = *__first;
+        ++__pos;
+      }
+
+      for (; __pos != __end; ++__pos)
+      {
+        __result[static_cast<_OutDiff>(__pos)] =
+          __binary_op(__first[static_cast<_InDiff>(__pos)], __first[static_cast<_InDiff>(__pos - 1)]);
+      }
+    });
+
+    return __result + static_cast<_OutDiff>(__count);
+  }
+
+  _CCCL_TEMPLATE(class _Policy, class _InputIterator, class _OutputIterator, class _BinaryOp)
+  _CCCL_REQUIRES(__has_forward_traversal<_InputIterator> _CCCL_AND __has_forward_traversal<_OutputIterator>)
+  [[nodiscard]] _CCCL_HOST_API _OutputIterator operator()(
+    [[maybe_unused]] const _Policy& __policy,
+    _InputIterator __first,
+    _InputIterator __last,
+    _OutputIterator __result,
+    _BinaryOp __binary_op) const
+  {
+    if constexpr (::cuda::std::__has_random_access_traversal<_InputIterator>
+                  && ::cuda::std::__has_random_access_traversal<_OutputIterator>)
+    {
+      return __par_impl(::cuda::std::move(__first),
+                        ::cuda::std::move(__last),
+                        ::cuda::std::move(__result),
+                        ::cuda::std::move(__binary_op));
+    }
+    else
+    {
+      return ::cuda::std::adjacent_difference(::cuda::std::move(__first),
+                                              ::cuda::std::move(__last),
+                                              ::cuda::std::move(__result),
+                                              ::cuda::std::move(__binary_op));
+    }
+  }
+};
+
+#  if _CCCL_HAS_BACKEND_OMP()
+template <>
+struct __pstl_dispatch<__pstl_algorithm::__adjacent_difference, __execution_backend::__omp>
+    : __pstl_host_adjacent_difference<__execution_backend::__omp>
+{};
+#  endif // _CCCL_HAS_BACKEND_OMP()
+
+#  if _CCCL_HAS_BACKEND_TBB()
+template <>
+struct __pstl_dispatch<__pstl_algorithm::__adjacent_difference, __execution_backend::__tbb>
+    : __pstl_host_adjacent_difference<__execution_backend::__tbb>
+{};
+#  endif // _CCCL_HAS_BACKEND_TBB()
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_BACKEND_HOST()
+
+#endif // _CUDA_STD___PSTL_HOST_ADJACENT_DIFFERENCE_H
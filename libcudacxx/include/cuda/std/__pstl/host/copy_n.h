@@ -0,0 +1,120 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_HOST_COPY_N_H
+#define _CUDA_STD___PSTL_HOST_COPY_N_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_BACKEND_HOST()
+
+#  include <cuda/std/__concepts/concept_macros.h>
+#  include <cuda/std/__execution/policy.h>
+#  include <cuda/std/__iterator/iterator_traits.h>
+#  include <cuda/std/__iterator/next.h>
+#  include <cuda/std/__pstl/dispatch.h>
+#  include <cuda/std/__pstl/host/for_each_tile.h>
+#  include <cuda/std/__utility/move.h>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+//! @brief Host backend of cuda::std::copy_n
+//! Elements for which @c __pred does not hold are skipped, leaving the corresponding output untouched.
+template <__execution_backend _Backend>
+struct __pstl_host_copy_n
+{
+  template <class _InputIterator, class _Size, class _OutputIterator, class _UnaryPred>
+  _CCCL_HOST_API static void
+  __serial_impl(_InputIterator __first, _Size __count, _OutputIterator __result, _UnaryPred& __pred)
+  {
+    for (; __count > 0; --__count, (void) ++__first, (void) ++__result)
+    {
+      if (__pred(*__first))
+      {
+        *__result = *__first;
+      }
+    }
+  }
+
+  template <class _InputIterator, class _Size, class _OutputIterator, class _UnaryPred>
+  [[nodiscard]] _CCCL_HOST_API static _OutputIterator
+  __par_impl(_InputIterator __first, _Size __count, _OutputIterator __result, _UnaryPred __pred)
+  {
+    using _InDiff       = iter_difference_t<_InputIterator>;
+    using _OutDiff      = iter_difference_t<_OutputIterator>;
+    const auto __tiling = __pstl_host_backend<_Backend>::__tiling(static_cast<size_t>(__count));
+    __pstl_host_backend<_Backend>::__for_each_tile(__tiling, [&](const size_t __tile) {
+      const size_t __begin = __tiling.__begin(__tile);
+      __serial_impl(__first + static_cast<_InDiff>(__begin),
+                    __tiling.__end(__tile) - __begin,
+                    __result + static_cast<_OutDiff>(__begin),
+                    __pred);
+    });
+
+    return __result + static_cast<_OutDiff>(__count);
+  }
+
+  _CCCL_TEMPLATE(class _Policy, class _InputIterator, class _OutputIterator, class _UnaryPred = __pstl_host_always_true)
+  _CCCL_REQUIRES(__has_forward_traversal<_InputIterator> _CCCL_AND __has_forward_traversal<_OutputIterator>)
+  [[nodiscard]] _CCCL_HOST_API _OutputIterator operator()(
+    [[maybe_unused]] const _Policy& __policy,
+    _InputIterator __first,
+    iter_difference_t<_InputIterator> __count,
+    _OutputIterator __result,
+    _UnaryPred __pred = {}) const
+  {
+    if constexpr (::cuda::std::__has_random_access_traversal<_InputIterator>
+                  && ::cuda::std::__has_random_access_traversal<_OutputIterator>)
+    {
+      return __par_impl(::cuda::std::move(__first), __count, ::cuda::std::move(__result), ::cuda::std::move(__pred));
+    }
+    else
+    {
+      __serial_impl(::cuda::std::move(__first), __count, __result, __pred);
+      return ::cuda::std::next(__result, __count);
+    }
+  }
+};
+
+#  if _CCCL_HAS_BACKEND_OMP()
+template <>
+struct __pstl_dispatch<__pstl_algorithm::__copy_n, __execution_backend::__omp>
+    : __pstl_host_copy_n<__execution_backend::__omp>
+{};
+#  endif // _CCCL_HAS_BACKEND_OMP()
+
+#  if _CCCL_HAS_BACKEND_TBB()
+template <>
+struct __pstl_dispatch<__pstl_algorithm::__copy_n, __execution_backend::__tbb>
+    : __pstl_host_copy_n<__execution_backend::__tbb>
+{};
+#  endif // _CCCL_HAS_BACKEND_TBB()
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_BACKEND_HOST()
+
+#endif // _CUDA_STD___PSTL_HOST_COPY_N_H
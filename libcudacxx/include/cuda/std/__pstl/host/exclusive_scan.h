@@ -0,0 +1,100 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_HOST_EXCLUSIVE_SCAN_H
+#define _CUDA_STD___PSTL_HOST_EXCLUSIVE_SCAN_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_BACKEND_HOST()
+
+#  include <cuda/std/__execution/policy.h>
+#  include <cuda/std/__iterator/distance.h>
+#  include <cuda/std/__iterator/iterator_traits.h>
+#  include <cuda/std/__numeric/exclusive_scan.h>
+#  include <cuda/std/__pstl/dispatch.h>
+#  include <cuda/std/__pstl/host/for_each_tile.h>
+#  include <cuda/std/__pstl/host/scan.h>
+#  include <cuda/std/__utility/move.h>
+#  include <cuda/std/optional>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+//! @brief Host backend of cuda::std::exclusive_scan
+template <__execution_backend _Backend>
+struct __pstl_host_exclusive_scan
+{
+  template <class _Policy, class _InputIterator, class _OutputIterator, class _Tp, class _BinaryOp>
+  [[nodiscard]] _CCCL_HOST_API _OutputIterator operator()(
+    [[maybe_unused]] const _Policy& __policy,
+    _InputIterator __first,
+    _InputIterator __last,
+    _OutputIterator __result,
+    _Tp __init,
+    _BinaryOp __binary_op) const
+  {
+    if constexpr (::cuda::std::__has_random_access_traversal<_InputIterator>
+                  && ::cuda::std::__has_random_access_traversal<_OutputIterator>)
+    {
+      const auto __count = ::cuda::std::distance(__first, __last);
+      return ::cuda::std::execution::__pstl_host_scan<_Backend, true, _Tp>(
+        ::cuda::std::move(__first),
+        static_cast<size_t>(__count),
+        ::cuda::std::move(__result),
+        optional<_Tp>{::cuda::std::move(__init)},
+        ::cuda::std::move(__binary_op));
+    }
+    else
+    {
+      return ::cuda::std::exclusive_scan(
+        ::cuda::std::move(__first),
+        ::cuda::std::move(__last),
+        ::cuda::std::move(__result),
+        ::cuda::std::move(__init),
+        ::cuda::std::move(__binary_op));
+    }
+  }
+};
+
+#  if _CCCL_HAS_BACKEND_OMP()
+template <>
+struct __pstl_dispatch<__pstl_algorithm::__exclusive_scan, __execution_backend::__omp>
+    : __pstl_host_exclusive_scan<__execution_backend::__omp>
+{};
+#  endif // _CCCL_HAS_BACKEND_OMP()
+
+#  if _CCCL_HAS_BACKEND_TBB()
+template <>
+struct __pstl_dispatch<__pstl_algorithm::__exclusive_scan, __execution_backend::__tbb>
+    : __pstl_host_exclusive_scan<__execution_backend::__tbb>
+{};
+#  endif // _CCCL_HAS_BACKEND_TBB()
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_BACKEND_HOST()
+
+#endif // _CUDA_STD___PSTL_HOST_EXCLUSIVE_SCAN_H
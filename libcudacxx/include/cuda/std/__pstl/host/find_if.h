@@ -0,0 +1,121 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_HOST_FIND_IF_H
+#define _CUDA_STD___PSTL_HOST_FIND_IF_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_BACKEND_HOST()
+
+#  include <cuda/std/__algorithm/find_if.h>
+#  include <cuda/std/__execution/policy.h>
+#  include <cuda/std/__iterator/distance.h>
+#  include <cuda/std/__iterator/iterator_traits.h>
+#  include <cuda/std/__pstl/dispatch.h>
+#  include <cuda/std/__pstl/host/for_each_tile.h>
+#  include <cuda/std/__utility/move.h>
+#  include <cuda/std/atomic>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+//! @brief Host backend of cuda::std::find_if
+//! Every tile searches its own range and records the smallest match found so far. Tiles stop searching once a match
+//! before their current position is known, so that later tiles do not scan their whole range needlessly.
+//! @note The front-ends pass zipped ranges whose end does not compare equal to any iterator of the range, so we must
+//!       only ever iterate over the distance between both.
+template <__execution_backend _Backend>
+struct __pstl_host_find_if
+{
+  //! @brief Number of elements between two checks for a match in an earlier tile
+  static constexpr size_t __check_interval = 1024;
+
+  template <class _Iter, class _UnaryOp>
+  [[nodiscard]] _CCCL_HOST_API static _Iter __par_impl(_Iter __first, _Iter __last, _UnaryOp __pred)
+  {
+    using _Diff         = iter_difference_t<_Iter>;
+    const auto __count  = static_cast<size_t>(::cuda::std::distance(__first, __last));
+    const auto __tiling = __pstl_host_backend<_Backend>::__tiling(__count);
+
+    ::cuda::std::atomic<size_t> __found{__count};
+    __pstl_host_backend<_Backend>::__for_each_tile(__tiling, [&](const size_t __tile) {
+      const size_t __end = __tiling.__end(__tile);
+      for (size_t __pos = __tiling.__begin(__tile); __pos != __end; ++__pos)
+      {
+        if (__pos % __check_interval == 0 && __found.load(::cuda::std::memory_order_relaxed) < __pos)
+        {
+          return;
+        }
+
+        if (__pred(__first[static_cast<_Diff>(__pos)]))
+        {
+          size_t __current = __found.load(::cuda::std::memory_order_relaxed);
+          while (__pos < __current
+                 && !__found.compare_exchange_weak(__current, __pos, ::cuda::std::memory_order_relaxed))
+          {
+          }
+          return;
+        }
+      }
+    });
+
+    return __first + static_cast<_Diff>(__found.load(::cuda::std::memory_order_relaxed));
+  }
+
+  template <class _Policy, class _Iter, class _UnaryOp>
+  [[nodiscard]] _CCCL_HOST_API _Iter
+  operator()([[maybe_unused]] const _Policy& __policy, _Iter __first, _Iter __last, _UnaryOp __pred) const
+  {
+    if constexpr (::cuda::std::__has_random_access_traversal<_Iter>)
+    {
+      return __par_impl(::cuda::std::move(__first), ::cuda::std::move(__last), ::cuda::std::move(__pred));
+    }
+    else
+    {
+      return ::cuda::std::find_if(::cuda::std::move(__first), ::cuda::std::move(__last), ::cuda::std::move(__pred));
+    }
+  }
+};
+
+#  if _CCCL_HAS_BACKEND_OMP()
+template <>
+struct __pstl_dispatch<__pstl_algorithm::__find_if, __execution_backend::__omp>
+    : __pstl_host_find_if<__execution_backend::__omp>
+{};
+#  endif // _CCCL_HAS_BACKEND_OMP()
+
+#  if _CCCL_HAS_BACKEND_TBB()
+template <>
+struct __pstl_dispatch<__pstl_algorithm::__find_if, __execution_backend::__tbb>
+    : __pstl_host_find_if<__execution_backend::__tbb>
+{};
+#  endif // _CCCL_HAS_BACKEND_TBB()
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_BACKEND_HOST()
+
+#endif // _CUDA_STD___PSTL_HOST_FIND_IF_H
@@ -0,0 +1,102 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_HOST_FOR_EACH_N_H
+#define _CUDA_STD___PSTL_HOST_FOR_EACH_N_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_BACKEND_HOST()
+
+#  include <cuda/std/__algorithm/for_each_n.h>
+#  include <cuda/std/__execution/policy.h>
+#  include <cuda/std/__iterator/iterator_traits.h>
+#  include <cuda/std/__pstl/dispatch.h>
+#  include <cuda/std/__pstl/host/for_each_tile.h>
+#  include <cuda/std/__utility/convert_to_integral.h>
+#  include <cuda/std/__utility/move.h>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+//! @brief Host backend of cuda::std::for_each_n
+template <__execution_backend _Backend>
+struct __pstl_host_for_each_n
+{
+  template <class _Iter, class _Size, class _Fn>
+  [[nodiscard]] _CCCL_HOST_API static _Iter __par_impl(_Iter __first, _Size __orig_n, _Fn __func)
+  {
+    const auto __count = ::cuda::std::__convert_to_integral(__orig_n);
+
+    using _Diff         = iter_difference_t<_Iter>;
+    const auto __tiling = __pstl_host_backend<_Backend>::__tiling(static_cast<size_t>(__count));
+    __pstl_host_backend<_Backend>::__for_each_tile(__tiling, [&](const size_t __tile) {
+      // Every tile works on its own copy of the function object, just like every thread does in the CUDA backend
+      _Fn __tile_func   = __func;
+      _Iter __begin     = __first + static_cast<_Diff>(__tiling.__begin(__tile));
+      const _Iter __end = __first + static_cast<_Diff>(__tiling.__end(__tile));
+      for (; __begin != __end; ++__begin)
+      {
+        __tile_func(*__begin);
+      }
+    });
+
+    return __first + __count;
+  }
+
+  template <class _Policy, class _Iter, class _Size, class _Fn>
+  [[nodiscard]] _CCCL_HOST_API _Iter
+  operator()([[maybe_unused]] const _Policy& __policy, _Iter __first, _Size __orig_n, _Fn __func) const
+  {
+    if constexpr (::cuda::std::__has_random_access_traversal<_Iter>)
+    {
+      return __par_impl(::cuda::std::move(__first), __orig_n, ::cuda::std::move(__func));
+    }
+    else
+    {
+      return ::cuda::std::for_each_n(::cuda::std::move(__first), __orig_n, ::cuda::std::move(__func));
+    }
+  }
+};
+
+#  if _CCCL_HAS_BACKEND_OMP()
+template <>
+struct __pstl_dispatch<__pstl_algorithm::__for_each_n, __execution_backend::__omp>
+    : __pstl_host_for_each_n<__execution_backend::__omp>
+{};
+#  endif // _CCCL_HAS_BACKEND_OMP()
+
+#  if _CCCL_HAS_BACKEND_TBB()
+template <>
+struct __pstl_dispatch<__pstl_algorithm::__for_each_n, __execution_backend::__tbb>
+    : __pstl_host_for_each_n<__execution_backend::__tbb>
+{};
+#  endif // _CCCL_HAS_BACKEND_TBB()
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_BACKEND_HOST()
+
+#endif // _CUDA_STD___PSTL_HOST_FOR_EACH_N_H
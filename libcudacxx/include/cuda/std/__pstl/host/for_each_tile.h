@@ -0,0 +1,206 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_HOST_FOR_EACH_TILE_H
+#define _CUDA_STD___PSTL_HOST_FOR_EACH_TILE_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_BACKEND_HOST()
+
+#  include <cuda/std/__algorithm/max.h>
+#  include <cuda/std/__algorithm/min.h>
+#  include <cuda/std/__execution/policy.h>
+#  include <cuda/std/__host_stdlib/memory>
+#  include <cuda/std/__type_traits/remove_reference.h>
+#  include <cuda/std/__utility/forward.h>
+#  include <cuda/std/cstddef>
+#  include <cuda/std/optional>
+
+#  if _CCCL_HAS_BACKEND_OMP()
+#    include <omp.h>
+#  endif // _CCCL_HAS_BACKEND_OMP()
+
+#  if _CCCL_HAS_BACKEND_TBB()
+#    include <tbb/blocked_range.h>
+#    include <tbb/parallel_for.h>
+#    include <tbb/task_arena.h>
+#  endif // _CCCL_HAS_BACKEND_TBB()
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+//! @brief Splits @c __count elements into contiguous tiles of nearly equal size
+//! The first @c __count % __num_tiles_ tiles hold one more element than the others
+struct __pstl_host_tiling
+{
+  //! @brief Tiles smaller than this are not worth the synchronization of a parallel region.
+  //! Every tile holds at least two elements, which the algorithms rely on to seed their partial results
+  static constexpr size_t __min_tile_size = size_t{1} << 12;
+
+  size_t __count_;
+  size_t __num_tiles_;
+
+  _CCCL_HOST_API __pstl_host_tiling(const size_t __count, const size_t __max_tiles) noexcept
+      : __count_{__count}
+      , __num_tiles_{::cuda::std::max(size_t{1}, ::cuda::std::min(__max_tiles, __count / __min_tile_size))}
+  {}
+
+  [[nodiscard]] _CCCL_HOST_API size_t __begin(const size_t __tile) const noexcept
+  {
+    const size_t __size = __count_ / __num_tiles_;
+    const size_t __rest = __count_ % __num_tiles_;
+    return __size * __tile + ::cuda::std::min(__tile, __rest);
+  }
+
+  [[nodiscard]] _CCCL_HOST_API size_t __end(const size_t __tile) const noexcept
+  {
+    return __begin(__tile + 1);
+  }
+
+  [[nodiscard]] _CCCL_HOST_API bool __is_serial() const noexcept
+  {
+    return __num_tiles_ == 1;
+  }
+};
+
+//! @brief Storage for one lazily constructed result per tile, which does not require default constructible types
+template <class _Tp>
+class __pstl_host_buffer
+{
+  ::std::unique_ptr<optional<_Tp>[]> __data_;
+
+public:
+  _CCCL_HOST_API explicit __pstl_host_buffer(const size_t __size)
+      : __data_{new optional<_Tp>[__size]}
+  {}
+
+  [[nodiscard]] _CCCL_HOST_API optional<_Tp>& operator[](const size_t __index) noexcept
+  {
+    return __data_[__index];
+  }
+};
+
+//! @brief Computes the exclusive prefix sum of the per tile counts and returns the total
+[[nodiscard]] _CCCL_HOST_API inline size_t
+__pstl_host_exclusive_sum(size_t* __counts, const size_t __num_tiles) noexcept
+{
+  size_t __sum = 0;
+  for (size_t __tile = 0; __tile < __num_tiles; ++__tile)
+  {
+    const size_t __count = __counts[__tile];
+    __counts[__tile]     = __sum;
+    __sum += __count;
+  }
+  return __sum;
+}
+
+//! @brief Predicate that selects every element, used when no predicate has been passed to an algorithm
+struct __pstl_host_always_true
+{
+  template <class... _Args>
+  [[nodiscard]] _CCCL_HOST_API constexpr bool operator()(const _Args&...) const noexcept
+  {
+    return true;
+  }
+};
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+//! @brief The primitives a host backend needs to provide to run the parallel algorithms
+//! Every algorithm is written in terms of independent tiles that are processed in parallel
+template <__execution_backend _Backend>
+struct __pstl_host_backend;
+
+#  if _CCCL_HAS_BACKEND_OMP()
+template <>
+struct __pstl_host_backend<__execution_backend::__omp>
+{
+  [[nodiscard]] _CCCL_HOST_API static __pstl_host_tiling __tiling(const size_t __count) noexcept
+  {
+    return __pstl_host_tiling{__count, static_cast<size_t>(::omp_get_max_threads())};
+  }
+
+  template <class _Fn>
+  _CCCL_HOST_API static void __for_each_tile(const __pstl_host_tiling& __tiling, _Fn&& __fn)
+  {
+    if (__tiling.__is_serial())
+    {
+      __fn(size_t{0});
+      return;
+    }
+
+    const long long __num_tiles = static_cast<long long>(__tiling.__num_tiles_);
+    _CCCL_PRAGMA(omp parallel for schedule(static, 1))
+    for (long long __tile = 0; __tile < __num_tiles; ++__tile)
+    {
+      __fn(static_cast<size_t>(__tile));
+    }
+  }
+};
+#  endif // _CCCL_HAS_BACKEND_OMP()
+
+#  if _CCCL_HAS_BACKEND_TBB()
+template <class _Fn>
+struct __pstl_host_tbb_body
+{
+  _Fn& __fn_;
+
+  _CCCL_HOST_API void operator()(const ::tbb::blocked_range<size_t>& __range) const
+  {
+    for (size_t __tile = __range.begin(); __tile != __range.end(); ++__tile)
+    {
+      __fn_(__tile);
+    }
+  }
+};
+
+template <>
+struct __pstl_host_backend<__execution_backend::__tbb>
+{
+  [[nodiscard]] _CCCL_HOST_API static __pstl_host_tiling __tiling(const size_t __count) noexcept
+  {
+    // TBB balances by stealing, so we oversubscribe the tiles to even out the load
+    return __pstl_host_tiling{__count, 4 * static_cast<size_t>(::tbb::this_task_arena::max_concurrency())};
+  }
+
+  template <class _Fn>
+  _CCCL_HOST_API static void __for_each_tile(const __pstl_host_tiling& __tiling, _Fn&& __fn)
+  {
+    if (__tiling.__is_serial())
+    {
+      __fn(size_t{0});
+      return;
+    }
+
+    ::tbb::parallel_for(::tbb::blocked_range<size_t>{0, __tiling.__num_tiles_, 1},
+                        __pstl_host_tbb_body<::cuda::std::remove_reference_t<_Fn>>{__fn});
+  }
+};
+#  endif // _CCCL_HAS_BACKEND_TBB()
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_BACKEND_HOST()
+
+#endif // _CUDA_STD___PSTL_HOST_FOR_EACH_TILE_H
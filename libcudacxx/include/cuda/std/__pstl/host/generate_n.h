@@ -0,0 +1,103 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_HOST_GENERATE_N_H
+#define _CUDA_STD___PSTL_HOST_GENERATE_N_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_BACKEND_HOST()
+
+#  include <cuda/std/__algorithm/generate_n.h>
+#  include <cuda/std/__concepts/concept_macros.h>
+#  include <cuda/std/__execution/policy.h>
+#  include <cuda/std/__iterator/iterator_traits.h>
+#  include <cuda/std/__pstl/dispatch.h>
+#  include <cuda/std/__pstl/host/for_each_tile.h>
+#  include <cuda/std/__utility/convert_to_integral.h>
+#  include <cuda/std/__utility/move.h>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+//! @brief Host backend of cuda::std::generate_n
+template <__execution_backend _Backend>
+struct __pstl_host_generate_n
+{
+  template <class _OutputIterator, class _Size, class _UnaryOp>
+  [[nodiscard]] _CCCL_HOST_API static _OutputIterator
+  __par_impl(_OutputIterator __result, const _Size __count, _UnaryOp __func)
+  {
+    using _Diff         = iter_difference_t<_OutputIterator>;
+    const auto __tiling = __pstl_host_backend<_Backend>::__tiling(static_cast<size_t>(__count));
+    __pstl_host_backend<_Backend>::__for_each_tile(__tiling, [&](const size_t __tile) {
+      _UnaryOp __tile_func        = __func;
+      _OutputIterator __begin     = __result + static_cast<_Diff>(__tiling.__begin(__tile));
+      const _OutputIterator __end = __result + static_cast<_Diff>(__tiling.__end(__tile));
+      for (; __begin != __end; ++__begin)
+      {
+        *__begin = __tile_func();
+      }
+    });
+
+    return __result + static_cast<_Diff>(__count);
+  }
+
+  _CCCL_TEMPLATE(class _Policy, class _OutputIterator, class _Size, class _UnaryOp)
+  _CCCL_REQUIRES(__has_forward_traversal<_OutputIterator>)
+  [[nodiscard]] _CCCL_HOST_API _OutputIterator
+  operator()([[maybe_unused]] const _Policy& __policy, _OutputIterator __result, _Size __count, _UnaryOp __func) const
+  {
+    if constexpr (::cuda::std::__has_random_access_traversal<_OutputIterator>)
+    {
+      return __par_impl(
+        ::cuda::std::move(__result), ::cuda::std::__convert_to_integral(__count), ::cuda::std::move(__func));
+    }
+    else
+    {
+      return ::cuda::std::generate_n(::cuda::std::move(__result), __count, ::cuda::std::move(__func));
+    }
+  }
+};
+
+#  if _CCCL_HAS_BACKEND_OMP()
+template <>
+struct __pstl_dispatch<__pstl_algorithm::__generate_n, __execution_backend::__omp>
+    : __pstl_host_generate_n<__execution_backend::__omp>
+{};
+#  endif // _CCCL_HAS_BACKEND_OMP()
+
+#  if _CCCL_HAS_BACKEND_TBB()
+template <>
+struct __pstl_dispatch<__pstl_algorithm::__generate_n, __execution_backend::__tbb>
+    : __pstl_host_generate_n<__execution_backend::__tbb>
+{};
+#  endif // _CCCL_HAS_BACKEND_TBB()
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_BACKEND_HOST()
+
+#endif // _CUDA_STD___PSTL_HOST_GENERATE_N_H
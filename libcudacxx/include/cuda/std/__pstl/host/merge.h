@@ -0,0 +1,148 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_HOST_MERGE_H
+#define _CUDA_STD___PSTL_HOST_MERGE_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_BACKEND_HOST()
+
+#  include <cuda/std/__algorithm/merge.h>
+#  include <cuda/std/__algorithm/min.h>
+#  include <cuda/std/__execution/policy.h>
+#  include <cuda/std/__iterator/distance.h>
+#  include <cuda/std/__iterator/iterator_traits.h>
+#  include <cuda/std/__pstl/dispatch.h>
+#  include <cuda/std/__pstl/host/for_each_tile.h>
+#  include <cuda/std/__utility/move.h>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+//! @brief Host backend of cuda::std::merge
+//! The output is split into tiles, and the start of every tile in both input ranges is found with a binary search along
+//! the diagonal of the merge matrix. The tiles are then merged independently. Ties are resolved in favor of the first
+//! range, just like in the serial merge.
+template <__execution_backend _Backend>
+struct __pstl_host_merge
+{
+  //! @brief Returns the number of elements of the first range among the first @c __diagonal elements of the output
+  template <class _InputIterator1, class _InputIterator2, class _Compare>
+  [[nodiscard]] _CCCL_HOST_API static size_t __merge_path(
+    _InputIterator1 __first1,
+    const size_t __count1,
+    _InputIterator2 __first2,
+    const size_t __count2,
+    const size_t __diagonal,
+    _Compare& __comp)
+  {
+    using _Diff1 = iter_difference_t<_InputIterator1>;
+    using _Diff2 = iter_difference_t<_InputIterator2>;
+
+    size_t __lo = __diagonal > __count2 ? __diagonal - __count2 : 0;
+    size_t __hi = ::cuda::std::min(__diagonal, __count1);
+    while (__lo < __hi)
+    {
+      const size_t __mid = __lo + (__hi - __lo) / 2;
+      if (__comp(__first2[static_cast<_Diff2>(__diagonal - __mid - 1)], __first1[static_cast<_Diff1>(__mid)]))
+      {
+        __hi = __mid;
+      }
+      else
+      {
+        __lo = __mid + 1;
+      }
+    }
+    return __lo;
+  }
+
+  template <class _Policy, class _InputIterator1, class _InputIterator2, class _OutputIterator, class _Compare>
+  [[nodiscard]] _CCCL_HOST_API _OutputIterator operator()(
+    [[maybe_unused]] const _Policy& __policy,
+    _InputIterator1 __first1,
+    _InputIterator1 __last1,
+    _InputIterator2 __first2,
+    _InputIterator2 __last2,
+    _OutputIterator __result,
+    _Compare __comp) const
+  {
+    if constexpr (::cuda::std::__has_random_access_traversal<_InputIterator1>
+                  && ::cuda::std::__has_random_access_traversal<_InputIterator2>
+                  && ::cuda::std::__has_random_access_traversal<_OutputIterator>)
+    {
+      using _Diff1        = iter_difference_t<_InputIterator1>;
+      using _Diff2        = iter_difference_t<_InputIterator2>;
+      using _OutDiff      = iter_difference_t<_OutputIterator>;
+      const auto __count1 = static_cast<size_t>(::cuda::std::distance(__first1, __last1));
+      const auto __count2 = static_cast<size_t>(::cuda::std::distance(__first2, __last2));
+      const auto __tiling = __pstl_host_backend<_Backend>::__tiling(__count1 + __count2);
+      if (!__tiling.__is_serial())
+      {
+        __pstl_host_backend<_Backend>::__for_each_tile(__tiling, [&](const size_t __tile) {
+          const size_t __begin  = __tiling.__begin(__tile);
+          const size_t __end    = __tiling.__end(__tile);
+          const size_t __begin1 = __merge_path(__first1, __count1, __first2, __count2, __begin, __comp);
+          const size_t __end1   = __merge_path(__first1, __count1, __first2, __count2, __end, __comp);
+          ::cuda::std::merge(__first1 + static_cast<_Diff1>(__begin1),
+                             __first1 + static_cast<_Diff1>(__end1),
+                             __first2 + static_cast<_Diff2>(__begin - __begin1),
+                             __first2 + static_cast<_Diff2>(__end - __end1),
+                             __result + static_cast<_OutDiff>(__begin),
+                             __comp);
+        });
+        return __result + static_cast<_OutDiff>(__count1 + __count2);
+      }
+    }
+
+    return ::cuda::std::merge(
+      ::cuda::std::move(__first1),
+      ::cuda::std::move(__last1),
+      ::cuda::std::move(__first2),
+      ::cuda::std::move(__last2),
+      ::cuda::std::move(__result),
+      ::cuda::std::move(__comp));
+  }
+};
+
+#  if _CCCL_HAS_BACKEND_OMP()
+template <>
+struct __pstl_dispatch<__pstl_algorithm::__merge, __execution_backend::__omp>
+    : __pstl_host_merge<__execution_backend::__omp>
+{};
+#  endif // _CCCL_HAS_BACKEND_OMP()
+
+#  if _CCCL_HAS_BACKEND_TBB()
+template <>
+struct __pstl_dispatch<__pstl_algorithm::__merge, __execution_backend::__tbb>
+    : __pstl_host_merge<__execution_backend::__tbb>
+{};
+#  endif // _CCCL_HAS_BACKEND_TBB()
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_BACKEND_HOST()
+
+#endif // _CUDA_STD___PSTL_HOST_MERGE_H
@@ -0,0 +1,240 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_HOST_MERGE_SORT_H
+#define _CUDA_STD___PSTL_HOST_MERGE_SORT_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_BACKEND_HOST()
+
+#  include <cuda/std/__algorithm/min.h>
+#  include <cuda/std/__algorithm/sort.h>
+#  include <cuda/std/__algorithm/stable_sort.h>
+#  include <cuda/std/__execution/policy.h>
+#  include <cuda/std/__functional/identity.h>
+#  include <cuda/std/__host_stdlib/memory>
+#  include <cuda/std/__iterator/iterator_traits.h>
+#  include <cuda/std/__pstl/host/for_each_tile.h>
+#  include <cuda/std/__pstl/host/select.h>
+#  include <cuda/std/__utility/forward.h>
+#  include <cuda/std/__utility/move.h>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+//! @brief Parallel merge sort on a host backend
+//! Every tile is sorted serially, then neighboring runs of tiles are merged pairwise until a single run remains. Every
+//! merge round splits its output along the tiles, and a binary search along the diagonal of the merge matrix finds the
+//! part of the two runs each tile merges. Ties are resolved in favor of the first run, so the merge rounds are stable.
+//! @tparam _Stable Whether the tiles need to be sorted stably
+template <__execution_backend _Backend, bool _Stable>
+struct __pstl_host_merge_sort
+{
+  //! @brief Accesses the elements of the input range
+  template <class _RandomAccessIterator>
+  struct __range_ref
+  {
+    _RandomAccessIterator __first_;
+
+    [[nodiscard]] _CCCL_HOST_API decltype(auto) operator[](const size_t __pos) const
+    {
+      return __first_[static_cast<iter_difference_t<_RandomAccessIterator>>(__pos)];
+    }
+
+    template <class _Up>
+    _CCCL_HOST_API void __assign(const size_t __pos, _Up&& __value) const
+    {
+      (*this)[__pos] = ::cuda::std::forward<_Up>(__value);
+    }
+  };
+
+  //! @brief Accesses the elements of the temporary buffer, which are constructed by the first merge round
+  template <class _Tp>
+  struct __buffer_ref
+  {
+    __pstl_host_buffer<_Tp>& __buffer_;
+
+    [[nodiscard]] _CCCL_HOST_API _Tp& operator[](const size_t __pos) const
+    {
+      return *__buffer_[__pos];
+    }
+
+    template <class _Up>
+    _CCCL_HOST_API void __assign(const size_t __pos, _Up&& __value) const
+    {
+      __buffer_[__pos] = ::cuda::std::forward<_Up>(__value);
+    }
+  };
+
+  //! @brief The pair of runs @c [__lo_, __mid_) and @c [__mid_, __hi_) that a tile is merged from
+  struct __runs
+  {
+    size_t __lo_;
+    size_t __mid_;
+    size_t __hi_;
+
+    _CCCL_HOST_API __runs(const __pstl_host_tiling& __tiling, const size_t __width, const size_t __tile) noexcept
+    {
+      const size_t __num_tiles = __tiling.__num_tiles_;
+      const size_t __pair      = __tile - __tile % (2 * __width);
+      __lo_                    = __tiling.__begin(__pair);
+      __mid_                   = __tiling.__begin(::cuda::std::min(__pair + __width, __num_tiles));
+      __hi_                    = __tiling.__begin(::cuda::std::min(__pair + 2 * __width, __num_tiles));
+    }
+  };
+
+  //! @brief Returns the position in the first run up to which it contributes to the first @c __diagonal elements of
+  //! the merge of both runs
+  template <class _Src, class _Compare>
+  [[nodiscard]] _CCCL_HOST_API static size_t
+  __merge_path(const _Src& __src, const __runs& __pair, const size_t __diagonal, _Compare& __comp)
+  {
+    const size_t __lo     = __pair.__lo_;
+    const size_t __mid    = __pair.__mid_;
+    const size_t __count1 = __mid - __lo;
+    const size_t __count2 = __pair.__hi_ - __mid;
+
+    size_t __begin = __diagonal > __count2 ? __diagonal - __count2 : 0;
+    size_t __end   = ::cuda::std::min(__diagonal, __count1);
+    while (__begin < __end)
+    {
+      const size_t __pivot = __begin + (__end - __begin) / 2;
+      if (__comp(__src[__mid + __diagonal - __pivot - 1], __src[__lo + __pivot]))
+      {
+        __end = __pivot;
+      }
+      else
+      {
+        __begin = __pivot + 1;
+      }
+    }
+    return __lo + __begin;
+  }
+
+  //! @brief Writes the elements @c [__begin, __end) of the merge of both runs, which take the elements
+  //! @c [__first1, __last1) from the first run
+  template <class _Src, class _Dst, class _Compare>
+  _CCCL_HOST_API static void __merge_tile(
+    const _Src& __src,
+    const _Dst& __dst,
+    const __runs& __pair,
+    const size_t __begin,
+    const size_t __end,
+    size_t __first1,
+    const size_t __last1,
+    _Compare& __comp)
+  {
+    size_t __first2      = __pair.__mid_ + (__begin - __first1);
+    const size_t __last2 = __pair.__mid_ + (__end - __last1);
+    for (size_t __out = __begin; __out != __end; ++__out)
+    {
+      if (__first2 == __last2 || (__first1 != __last1 && !__comp(__src[__first2], __src[__first1])))
+      {
+        __dst.__assign(__out, ::cuda::std::move(__src[__first1++]));
+      }
+      else
+      {
+        __dst.__assign(__out, ::cuda::std::move(__src[__first2++]));
+      }
+    }
+  }
+
+  //! @brief Runs one merge round over pairs of runs of @c __width tiles
+  template <class _Src, class _Dst, class _Compare>
+  _CCCL_HOST_API static void __merge_round(
+    const _Src& __src,
+    const _Dst& __dst,
+    const __pstl_host_tiling& __tiling,
+    const size_t __width,
+    size_t* __splits,
+    _Compare& __comp)
+  {
+    // Every tile of the output lies within the merge of exactly one pair of runs, because both use the same tiling.
+    // All splits are found before any element is moved, as moving from the source might modify it
+    __pstl_host_backend<_Backend>::__for_each_tile(__tiling, [&](const size_t __tile) {
+      const __runs __pair{__tiling, __width, __tile};
+      __splits[__tile] = __merge_path(__src, __pair, __tiling.__begin(__tile) - __pair.__lo_, __comp);
+    });
+
+    __pstl_host_backend<_Backend>::__for_each_tile(__tiling, [&](const size_t __tile) {
+      const __runs __pair{__tiling, __width, __tile};
+      const size_t __end   = __tiling.__end(__tile);
+      const size_t __last1 = __end == __pair.__hi_ ? __pair.__mid_ : __splits[__tile + 1];
+      __merge_tile(__src, __dst, __pair, __tiling.__begin(__tile), __end, __splits[__tile], __last1, __comp);
+    });
+  }
+
+  template <class _RandomAccessIterator, class _Compare>
+  _CCCL_HOST_API static void
+  __sort(_RandomAccessIterator __first, const __pstl_host_tiling& __tiling, _Compare& __comp)
+  {
+    using _Tp   = iter_value_t<_RandomAccessIterator>;
+    using _Diff = iter_difference_t<_RandomAccessIterator>;
+
+    __pstl_host_backend<_Backend>::__for_each_tile(__tiling, [&](const size_t __tile) {
+      const _RandomAccessIterator __begin = __first + static_cast<_Diff>(__tiling.__begin(__tile));
+      const _RandomAccessIterator __end   = __first + static_cast<_Diff>(__tiling.__end(__tile));
+      if constexpr (_Stable)
+      {
+        ::cuda::std::stable_sort(__begin, __end, __comp);
+      }
+      else
+      {
+        ::cuda::std::sort(__begin, __end, __comp);
+      }
+    });
+
+    const __range_ref<_RandomAccessIterator> __range{__first};
+    __pstl_host_buffer<_Tp> __buffer{__tiling.__count_};
+    const __buffer_ref<_Tp> __temp{__buffer};
+    ::std::unique_ptr<size_t[]> __splits{new size_t[__tiling.__num_tiles_]};
+
+    bool __in_buffer = false;
+    for (size_t __width = 1; __width < __tiling.__num_tiles_; __width *= 2)
+    {
+      if (__in_buffer)
+      {
+        __merge_round(__temp, __range, __tiling, __width, __splits.get(), __comp);
+      }
+      else
+      {
+        __merge_round(__range, __temp, __tiling, __width, __splits.get(), __comp);
+      }
+      __in_buffer = !__in_buffer;
+    }
+
+    if (__in_buffer)
+    {
+      ::cuda::std::execution::__pstl_host_move_back<_Backend>(__first, __tiling.__count_, __buffer, identity{});
+    }
+  }
+};
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_BACKEND_HOST()
+
+#endif // _CUDA_STD___PSTL_HOST_MERGE_SORT_H
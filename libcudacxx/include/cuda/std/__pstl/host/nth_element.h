@@ -0,0 +1,158 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_HOST_NTH_ELEMENT_H
+#define _CUDA_STD___PSTL_HOST_NTH_ELEMENT_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_BACKEND_HOST()
+
+#  include <cuda/std/__algorithm/iter_swap.h>
+#  include <cuda/std/__algorithm/nth_element.h>
+#  include <cuda/std/__execution/policy.h>
+#  include <cuda/std/__iterator/distance.h>
+#  include <cuda/std/__iterator/iterator_traits.h>
+#  include <cuda/std/__pstl/dispatch.h>
+#  include <cuda/std/__pstl/host/for_each_tile.h>
+#  include <cuda/std/__pstl/host/partition.h>
+#  include <cuda/std/__utility/move.h>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+//! @brief Host backend of cuda::std::nth_element
+//! Quickselect with parallel partitioning steps. The median of three elements is moved to the back of the range and
+//! the rest is partitioned into the elements less than it and those that are not. The pivot is placed in between, and
+//! the elements equivalent to it are gathered right behind it, so that runs of equal elements end the search. Once the
+//! remaining range fits into a single tile it is handed to the serial nth_element.
+template <__execution_backend _Backend>
+struct __pstl_host_nth_element
+{
+  template <class _RandomAccessIterator, class _Compare>
+  struct __less_than_pivot
+  {
+    _RandomAccessIterator __pivot_;
+    _Compare& __comp_;
+
+    template <class _Tp>
+    [[nodiscard]] _CCCL_HOST_API bool operator()(const _Tp& __value) const
+    {
+      return static_cast<bool>(__comp_(__value, *__pivot_));
+    }
+  };
+
+  template <class _RandomAccessIterator, class _Compare>
+  struct __equivalent_to_pivot
+  {
+    _RandomAccessIterator __pivot_;
+    _Compare& __comp_;
+
+    //! Only called on elements that are not less than the pivot
+    template <class _Tp>
+    [[nodiscard]] _CCCL_HOST_API bool operator()(const _Tp& __value) const
+    {
+      return !static_cast<bool>(__comp_(*__pivot_, __value));
+    }
+  };
+
+  template <class _Policy, class _RandomAccessIterator, class _Compare>
+  _CCCL_HOST_API void operator()(
+    const _Policy& __policy,
+    _RandomAccessIterator __first,
+    _RandomAccessIterator __nth,
+    _RandomAccessIterator __last,
+    _Compare __comp) const
+  {
+    if constexpr (::cuda::std::__has_random_access_traversal<_RandomAccessIterator>)
+    {
+      using _Diff = iter_difference_t<_RandomAccessIterator>;
+      __pstl_host_partition<_Backend> __partition{};
+      while (!__pstl_host_backend<_Backend>::__tiling(static_cast<size_t>(__last - __first)).__is_serial())
+      {
+        _RandomAccessIterator __mid  = __first + (__last - __first) / 2;
+        _RandomAccessIterator __back = __last - 1;
+        if (__comp(*__mid, *__first))
+        {
+          ::cuda::std::iter_swap(__mid, __first);
+        }
+        if (__comp(*__back, *__mid))
+        {
+          ::cuda::std::iter_swap(__back, __mid);
+          if (__comp(*__mid, *__first))
+          {
+            ::cuda::std::iter_swap(__mid, __first);
+          }
+        }
+        ::cuda::std::iter_swap(__mid, __back);
+
+        const size_t __num_less = __partition(
+          __policy, __first, __back, __less_than_pivot<_RandomAccessIterator, _Compare>{__back, __comp});
+        const _RandomAccessIterator __pivot = __first + static_cast<_Diff>(__num_less);
+        ::cuda::std::iter_swap(__pivot, __back);
+        if (__nth < __pivot)
+        {
+          __last = __pivot;
+          continue;
+        }
+        else if (__nth == __pivot)
+        {
+          return;
+        }
+
+        const size_t __num_equivalent = __partition(
+          __policy, __pivot + 1, __last, __equivalent_to_pivot<_RandomAccessIterator, _Compare>{__pivot, __comp});
+        __first = __pivot + 1 + static_cast<_Diff>(__num_equivalent);
+        if (__nth < __first)
+        {
+          return;
+        }
+      }
+    }
+
+    ::cuda::std::nth_element(
+      ::cuda::std::move(__first), ::cuda::std::move(__nth), ::cuda::std::move(__last), ::cuda::std::move(__comp));
+  }
+};
+
+#  if _CCCL_HAS_BACKEND_OMP()
+template <>
+struct __pstl_dispatch<__pstl_algorithm::__nth_element, __execution_backend::__omp>
+    : __pstl_host_nth_element<__execution_backend::__omp>
+{};
+#  endif // _CCCL_HAS_BACKEND_OMP()
+
+#  if _CCCL_HAS_BACKEND_TBB()
+template <>
+struct __pstl_dispatch<__pstl_algorithm::__nth_element, __execution_backend::__tbb>
+    : __pstl_host_nth_element<__execution_backend::__tbb>
+{};
+#  endif // _CCCL_HAS_BACKEND_TBB()
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_BACKEND_HOST()
+
+#endif // _CUDA_STD___PSTL_HOST_NTH_ELEMENT_H
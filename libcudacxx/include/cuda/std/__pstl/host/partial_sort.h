@@ -0,0 +1,94 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_HOST_PARTIAL_SORT_H
+#define _CUDA_STD___PSTL_HOST_PARTIAL_SORT_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_BACKEND_HOST()
+
+#  include <cuda/std/__algorithm/partial_sort.h>
+#  include <cuda/std/__execution/policy.h>
+#  include <cuda/std/__iterator/iterator_traits.h>
+#  include <cuda/std/__pstl/dispatch.h>
+#  include <cuda/std/__pstl/host/nth_element.h>
+#  include <cuda/std/__pstl/host/sort.h>
+#  include <cuda/std/__utility/move.h>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+//! @brief Host backend of cuda::std::partial_sort
+//! Selects the last element of the sorted prefix, which leaves only smaller or equivalent elements in front of it, and
+//! then sorts the elements in front of it.
+template <__execution_backend _Backend>
+struct __pstl_host_partial_sort
+{
+  template <class _Policy, class _RandomAccessIterator, class _Compare>
+  _CCCL_HOST_API void operator()(
+    const _Policy& __policy,
+    _RandomAccessIterator __first,
+    _RandomAccessIterator __middle,
+    _RandomAccessIterator __last,
+    _Compare __comp) const
+  {
+    if constexpr (::cuda::std::__has_random_access_traversal<_RandomAccessIterator>)
+    {
+      if (__middle != __last)
+      {
+        __pstl_host_nth_element<_Backend>{}(__policy, __first, __middle - 1, __last, __comp);
+        __last = __middle - 1;
+      }
+      __pstl_host_sort<_Backend, false>{}(
+        __policy, ::cuda::std::move(__first), ::cuda::std::move(__last), ::cuda::std::move(__comp));
+    }
+    else
+    {
+      ::cuda::std::partial_sort(
+        ::cuda::std::move(__first), ::cuda::std::move(__middle), ::cuda::std::move(__last), ::cuda::std::move(__comp));
+    }
+  }
+};
+
+#  if _CCCL_HAS_BACKEND_OMP()
+template <>
+struct __pstl_dispatch<__pstl_algorithm::__partial_sort, __execution_backend::__omp>
+    : __pstl_host_partial_sort<__execution_backend::__omp>
+{};
+#  endif // _CCCL_HAS_BACKEND_OMP()
+
+#  if _CCCL_HAS_BACKEND_TBB()
+template <>
+struct __pstl_dispatch<__pstl_algorithm::__partial_sort, __execution_backend::__tbb>
+    : __pstl_host_partial_sort<__execution_backend::__tbb>
+{};
+#  endif // _CCCL_HAS_BACKEND_TBB()
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_BACKEND_HOST()
+
+#endif // _CUDA_STD___PSTL_HOST_PARTIAL_SORT_H
@@ -0,0 +1,114 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_HOST_PARTITION_H
+#define _CUDA_STD___PSTL_HOST_PARTITION_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_BACKEND_HOST()
+
+#  include <cuda/std/__algorithm/partition.h>
+#  include <cuda/std/__execution/policy.h>
+#  include <cuda/std/__iterator/distance.h>
+#  include <cuda/std/__iterator/iterator_traits.h>
+#  include <cuda/std/__pstl/dispatch.h>
+#  include <cuda/std/__pstl/host/for_each_tile.h>
+#  include <cuda/std/__pstl/host/select.h>
+#  include <cuda/std/__utility/move.h>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+//! @brief Host backend of cuda::std::partition
+//! The selected elements are gathered at the front of a temporary buffer and the rejected ones at its back in reverse
+//! order, which does not require knowing the number of selected elements up front. They are then moved back in order.
+template <__execution_backend _Backend>
+struct __pstl_host_partition
+{
+  //! @brief Maps a position of the partitioned range to the buffer holding its element
+  struct __buffer_index
+  {
+    size_t __count_;
+    size_t __num_selected_;
+
+    [[nodiscard]] _CCCL_HOST_API size_t operator()(const size_t __pos) const noexcept
+    {
+      return __pos < __num_selected_ ? __pos : __count_ - 1 - (__pos - __num_selected_);
+    }
+  };
+
+  template <class _Policy, class _InputIterator, class _UnaryPred>
+  [[nodiscard]] _CCCL_HOST_API size_t operator()(
+    [[maybe_unused]] const _Policy& __policy, _InputIterator __first, _InputIterator __last, _UnaryPred __pred) const
+  {
+    if constexpr (::cuda::std::__has_random_access_traversal<_InputIterator>)
+    {
+      using _Diff         = iter_difference_t<_InputIterator>;
+      const auto __count  = static_cast<size_t>(::cuda::std::distance(__first, __last));
+      const auto __tiling = __pstl_host_backend<_Backend>::__tiling(__count);
+      if (!__tiling.__is_serial())
+      {
+        __pstl_host_buffer<iter_value_t<_InputIterator>> __buffer{__count};
+        const size_t __num_selected = ::cuda::std::execution::__pstl_host_select<_Backend>(
+          __tiling,
+          [&](const size_t __pos) {
+            return __pred(__first[static_cast<_Diff>(__pos)]);
+          },
+          [&](const size_t __pos, const bool __selected, const size_t __true_index, const size_t __false_index) {
+            const size_t __index = __selected ? __true_index : __count - 1 - __false_index;
+            __buffer[__index].emplace(::cuda::std::move(__first[static_cast<_Diff>(__pos)]));
+          });
+
+        ::cuda::std::execution::__pstl_host_move_back<_Backend>(
+          __first, __count, __buffer, __buffer_index{__count, __num_selected});
+        return __num_selected;
+      }
+    }
+
+    const auto __mid = ::cuda::std::partition(__first, __last, ::cuda::std::move(__pred));
+    return static_cast<size_t>(::cuda::std::distance(__first, __mid));
+  }
+};
+
+#  if _CCCL_HAS_BACKEND_OMP()
+template <>
+struct __pstl_dispatch<__pstl_algorithm::__partition, __execution_backend::__omp>
+    : __pstl_host_partition<__execution_backend::__omp>
+{};
+#  endif // _CCCL_HAS_BACKEND_OMP()
+
+#  if _CCCL_HAS_BACKEND_TBB()
+template <>
+struct __pstl_dispatch<__pstl_algorithm::__partition, __execution_backend::__tbb>
+    : __pstl_host_partition<__execution_backend::__tbb>
+{};
+#  endif // _CCCL_HAS_BACKEND_TBB()
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_BACKEND_HOST()
+
+#endif // _CUDA_STD___PSTL_HOST_PARTITION_H
@@ -0,0 +1,116 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_HOST_PARTITION_COPY_H
+#define _CUDA_STD___PSTL_HOST_PARTITION_COPY_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_BACKEND_HOST()
+
+#  include <cuda/std/__algorithm/partition_copy.h>
+#  include <cuda/std/__execution/policy.h>
+#  include <cuda/std/__iterator/distance.h>
+#  include <cuda/std/__iterator/iterator_traits.h>
+#  include <cuda/std/__pstl/dispatch.h>
+#  include <cuda/std/__pstl/host/for_each_tile.h>
+#  include <cuda/std/__pstl/host/select.h>
+#  include <cuda/std/__utility/move.h>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+//! @brief Host backend of cuda::std::partition_copy
+template <__execution_backend _Backend>
+struct __pstl_host_partition_copy
+{
+  template <class _Policy, class _InputIterator, class _OutputIterator1, class _OutputIterator2, class _UnaryPred>
+  [[nodiscard]] _CCCL_HOST_API size_t operator()(
+    [[maybe_unused]] const _Policy& __policy,
+    _InputIterator __first,
+    _InputIterator __last,
+    _OutputIterator1 __result_true,
+    _OutputIterator2 __result_false,
+    _UnaryPred __pred) const
+  {
+    if constexpr (::cuda::std::__has_random_access_traversal<_InputIterator>
+                  && ::cuda::std::__has_random_access_traversal<_OutputIterator1>
+                  && ::cuda::std::__has_random_access_traversal<_OutputIterator2>)
+    {
+      using _InDiff       = iter_difference_t<_InputIterator>;
+      using _TrueDiff     = iter_difference_t<_OutputIterator1>;
+      using _FalseDiff    = iter_difference_t<_OutputIterator2>;
+      const auto __count  = static_cast<size_t>(::cuda::std::distance(__first, __last));
+      const auto __tiling = __pstl_host_backend<_Backend>::__tiling(__count);
+      if (!__tiling.__is_serial())
+      {
+        return ::cuda::std::execution::__pstl_host_select<_Backend>(
+          __tiling,
+          [&](const size_t __pos) {
+            return __pred(__first[static_cast<_InDiff>(__pos)]);
+          },
+          [&](const size_t __pos, const bool __selected, const size_t __true_index, const size_t __false_index) {
+            if (__selected)
+            {
+              __result_true[static_cast<_TrueDiff>(__true_index)] = __first[static_cast<_InDiff>(__pos)];
+            }
+            else
+            {
+              __result_false[static_cast<_FalseDiff>(__false_index)] = __first[static_cast<_InDiff>(__pos)];
+            }
+          });
+      }
+    }
+
+    const auto __result_true_first = __result_true;
+    const auto __ret               = ::cuda::std::partition_copy(
+      ::cuda::std::move(__first),
+      ::cuda::std::move(__last),
+      ::cuda::std::move(__result_true),
+      ::cuda::std::move(__result_false),
+      ::cuda::std::move(__pred));
+    return static_cast<size_t>(::cuda::std::distance(__result_true_first, __ret.first));
+  }
+};
+
+#  if _CCCL_HAS_BACKEND_OMP()
+template <>
+struct __pstl_dispatch<__pstl_algorithm::__partition_copy, __execution_backend::__omp>
+    : __pstl_host_partition_copy<__execution_backend::__omp>
+{};
+#  endif // _CCCL_HAS_BACKEND_OMP()
+
+#  if _CCCL_HAS_BACKEND_TBB()
+template <>
+struct __pstl_dispatch<__pstl_algorithm::__partition_copy, __execution_backend::__tbb>
+    : __pstl_host_partition_copy<__execution_backend::__tbb>
+{};
+#  endif // _CCCL_HAS_BACKEND_TBB()
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_BACKEND_HOST()
+
+#endif // _CUDA_STD___PSTL_HOST_PARTITION_COPY_H
@@ -0,0 +1,182 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_HOST_RADIX_SORT_H
+#define _CUDA_STD___PSTL_HOST_RADIX_SORT_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_BACKEND_HOST()
+
+#  include <cuda/std/__bit/bit_cast.h>
+#  include <cuda/std/__execution/policy.h>
+#  include <cuda/std/__host_stdlib/memory>
+#  include <cuda/std/__iterator/iterator_traits.h>
+#  include <cuda/std/__pstl/host/for_each_tile.h>
+#  include <cuda/std/__pstl/radix_sort_order.h>
+#  include <cuda/std/__type_traits/is_floating_point.h>
+#  include <cuda/std/__type_traits/is_signed.h>
+#  include <cuda/std/__type_traits/make_nbit_int.h>
+#  include <cuda/std/__utility/move.h>
+#  include <cuda/std/climits>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+//! @brief Maps a value to an unsigned key whose natural order matches the requested order of the values
+template <class _Tp, __pstl_radix_sort_order _Order>
+struct __pstl_host_radix_key
+{
+  using _Key = __make_nbit_uint_t<sizeof(_Tp) * CHAR_BIT>;
+
+  static constexpr _Key __sign_bit = _Key{1} << (sizeof(_Tp) * CHAR_BIT - 1);
+
+  [[nodiscard]] _CCCL_HOST_API static _Key __get(const _Tp __value) noexcept
+  {
+    _Key __key;
+    if constexpr (is_floating_point_v<_Tp>)
+    {
+      // -0.0 compares equal to +0.0, so both need the same key to keep the sort stable
+      __key = ::cuda::std::bit_cast<_Key>(__value == _Tp{0} ? _Tp{0} : __value);
+      __key = (__key & __sign_bit) ? static_cast<_Key>(~__key) : static_cast<_Key>(__key | __sign_bit);
+    }
+    else if constexpr (is_signed_v<_Tp>)
+    {
+      __key = static_cast<_Key>(::cuda::std::bit_cast<_Key>(__value) ^ __sign_bit);
+    }
+    else
+    {
+      __key = ::cuda::std::bit_cast<_Key>(__value);
+    }
+
+    if constexpr (_Order == __pstl_radix_sort_order::__descending)
+    {
+      __key = static_cast<_Key>(~__key);
+    }
+    return __key;
+  }
+};
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+//! @brief Parallel least significant digit radix sort of arithmetic values on a host backend
+//! Every pass histograms the digits of each tile, scans the histograms in digit major order and then scatters the tiles
+//! in parallel, which keeps the sort stable. Passes in which all keys share the same digit are skipped.
+template <__execution_backend _Backend>
+struct __pstl_host_radix_sort
+{
+  static constexpr int __radix_bits     = 8;
+  static constexpr size_t __num_buckets = size_t{1} << __radix_bits;
+
+  //! @brief Runs one pass over the digit starting at @c __shift and moves the elements from @c __src to @c __dst
+  //! @returns false if the pass has been skipped and the elements are still in @c __src
+  template <__pstl_radix_sort_order _Order, class _Tp, class _Src, class _Dst>
+  [[nodiscard]] _CCCL_HOST_API static bool
+  __pass(_Src __src, _Dst __dst, const __pstl_host_tiling& __tiling, size_t* __offsets, const int __shift)
+  {
+    using _KeyFn   = __pstl_host_radix_key<_Tp, _Order>;
+    using _SrcDiff = iter_difference_t<_Src>;
+    using _DstDiff = iter_difference_t<_Dst>;
+
+    __pstl_host_backend<_Backend>::__for_each_tile(__tiling, [&](const size_t __tile) {
+      size_t* __counts = __offsets + __tile * __num_buckets;
+      for (size_t __bucket = 0; __bucket < __num_buckets; ++__bucket)
+      {
+        __counts[__bucket] = 0;
+      }
+
+      const size_t __end = __tiling.__end(__tile);
+      for (size_t __pos = __tiling.__begin(__tile); __pos != __end; ++__pos)
+      {
+        ++__counts[(_KeyFn::__get(__src[static_cast<_SrcDiff>(__pos)]) >> __shift) & (__num_buckets - 1)];
+      }
+    });
+
+    size_t __offset = 0;
+    for (size_t __bucket = 0; __bucket < __num_buckets; ++__bucket)
+    {
+      const size_t __bucket_begin = __offset;
+      for (size_t __tile = 0; __tile < __tiling.__num_tiles_; ++__tile)
+      {
+        size_t& __count = __offsets[__tile * __num_buckets + __bucket];
+        const size_t __tile_count = __count;
+        __count                   = __offset;
+        __offset += __tile_count;
+      }
+
+      if (__offset - __bucket_begin == __tiling.__count_)
+      {
+        return false;
+      }
+    }
+
+    __pstl_host_backend<_Backend>::__for_each_tile(__tiling, [&](const size_t __tile) {
+      size_t* __tile_offsets = __offsets + __tile * __num_buckets;
+      const size_t __end     = __tiling.__end(__tile);
+      for (size_t __pos = __tiling.__begin(__tile); __pos != __end; ++__pos)
+      {
+        auto&& __value = __src[static_cast<_SrcDiff>(__pos)];
+        size_t& __out  = __tile_offsets[(_KeyFn::__get(__value) >> __shift) & (__num_buckets - 1)];
+        __dst[static_cast<_DstDiff>(__out++)] = ::cuda::std::move(__value);
+      }
+    });
+    return true;
+  }
+
+  template <__pstl_radix_sort_order _Order, class _RandomAccessIterator>
+  _CCCL_HOST_API static void __sort(_RandomAccessIterator __first, const __pstl_host_tiling& __tiling)
+  {
+    using _Tp   = iter_value_t<_RandomAccessIterator>;
+    using _Diff = iter_difference_t<_RandomAccessIterator>;
+
+    ::std::unique_ptr<_Tp[]> __buffer{new _Tp[__tiling.__count_]};
+    ::std::unique_ptr<size_t[]> __offsets{new size_t[__tiling.__num_tiles_ * __num_buckets]};
+
+    bool __in_buffer = false;
+    for (int __shift = 0; __shift < static_cast<int>(sizeof(_Tp) * CHAR_BIT); __shift += __radix_bits)
+    {
+      const bool __moved =
+        __in_buffer
+          ? __pass<_Order, _Tp>(__buffer.get(), __first, __tiling, __offsets.get(), __shift)
+          : __pass<_Order, _Tp>(__first, __buffer.get(), __tiling, __offsets.get(), __shift);
+      __in_buffer = __in_buffer != __moved;
+    }
+
+    if (__in_buffer)
+    {
+      __pstl_host_backend<_Backend>::__for_each_tile(__tiling, [&](const size_t __tile) {
+        const size_t __end = __tiling.__end(__tile);
+        for (size_t __pos = __tiling.__begin(__tile); __pos != __end; ++__pos)
+        {
+          __first[static_cast<_Diff>(__pos)] = __buffer[__pos];
+        }
+      });
+    }
+  }
+};
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_BACKEND_HOST()
+
+#endif // _CUDA_STD___PSTL_HOST_RADIX_SORT_H
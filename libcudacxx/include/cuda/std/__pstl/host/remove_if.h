@@ -0,0 +1,126 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_HOST_REMOVE_IF_H
+#define _CUDA_STD___PSTL_HOST_REMOVE_IF_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_BACKEND_HOST()
+
+#  include <cuda/std/__algorithm/remove_if.h>
+#  include <cuda/std/__execution/policy.h>
+#  include <cuda/std/__functional/identity.h>
+#  include <cuda/std/__functional/not_fn.h>
+#  include <cuda/std/__iterator/iterator_traits.h>
+#  include <cuda/std/__iterator/next.h>
+#  include <cuda/std/__pstl/dispatch.h>
+#  include <cuda/std/__pstl/host/for_each_tile.h>
+#  include <cuda/std/__pstl/host/select.h>
+#  include <cuda/std/__utility/move.h>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+//! @brief Host backend of cuda::std::remove_if
+//! The predicate selects the elements to keep. They are compacted into a temporary buffer and then moved back to the
+//! front of the input range.
+template <__execution_backend _Backend>
+struct __pstl_host_remove_if
+{
+  template <class _InputIterator, class _UnaryPredicate>
+  [[nodiscard]] _CCCL_HOST_API static _InputIterator
+  __serial_impl(_InputIterator __first, iter_difference_t<_InputIterator> __count, _UnaryPredicate __pred)
+  {
+    auto __last = ::cuda::std::next(__first, __count);
+    return ::cuda::std::remove_if(
+      ::cuda::std::move(__first), ::cuda::std::move(__last), ::cuda::std::not_fn(::cuda::std::move(__pred)));
+  }
+
+  template <class _InputIterator, class _UnaryPredicate>
+  [[nodiscard]] _CCCL_HOST_API static _InputIterator
+  __par_impl(_InputIterator __first, iter_difference_t<_InputIterator> __count, _UnaryPredicate __pred)
+  {
+    using _Diff         = iter_difference_t<_InputIterator>;
+    const auto __tiling = __pstl_host_backend<_Backend>::__tiling(static_cast<size_t>(__count));
+    if (__tiling.__is_serial())
+    {
+      return __serial_impl(::cuda::std::move(__first), __count, ::cuda::std::move(__pred));
+    }
+
+    __pstl_host_buffer<iter_value_t<_InputIterator>> __buffer{__tiling.__count_};
+    const size_t __num_selected = ::cuda::std::execution::__pstl_host_select<_Backend>(
+      __tiling,
+      [&](const size_t __pos) {
+        return __pred(__first[static_cast<_Diff>(__pos)]);
+      },
+      [&](const size_t __pos, const bool __selected, const size_t __index, size_t) {
+        if (__selected)
+        {
+          __buffer[__index].emplace(::cuda::std::move(__first[static_cast<_Diff>(__pos)]));
+        }
+      });
+
+    ::cuda::std::execution::__pstl_host_move_back<_Backend>(__first, __num_selected, __buffer, ::cuda::std::identity{});
+    return __first + static_cast<_Diff>(__num_selected);
+  }
+
+  template <class _Policy, class _InputIterator, class _UnaryPredicate>
+  [[nodiscard]] _CCCL_HOST_API _InputIterator operator()(
+    [[maybe_unused]] const _Policy& __policy,
+    _InputIterator __first,
+    iter_difference_t<_InputIterator> __count,
+    _UnaryPredicate __pred) const
+  {
+    if constexpr (::cuda::std::__has_random_access_traversal<_InputIterator>)
+    {
+      return __par_impl(::cuda::std::move(__first), __count, ::cuda::std::move(__pred));
+    }
+    else
+    {
+      return __serial_impl(::cuda::std::move(__first), __count, ::cuda::std::move(__pred));
+    }
+  }
+};
+
+#  if _CCCL_HAS_BACKEND_OMP()
+template <>
+struct __pstl_dispatch<__pstl_algorithm::__remove_if, __execution_backend::__omp>
+    : __pstl_host_remove_if<__execution_backend::__omp>
+{};
+#  endif // _CCCL_HAS_BACKEND_OMP()
+
+#  if _CCCL_HAS_BACKEND_TBB()
+template <>
+struct __pstl_dispatch<__pstl_algorithm::__remove_if, __execution_backend::__tbb>
+    : __pstl_host_remove_if<__execution_backend::__tbb>
+{};
+#  endif // _CCCL_HAS_BACKEND_TBB()
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_BACKEND_HOST()
+
+#endif // _CUDA_STD___PSTL_HOST_REMOVE_IF_H
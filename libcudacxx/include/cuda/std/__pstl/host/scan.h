@@ -0,0 +1,133 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_HOST_SCAN_H
+#define _CUDA_STD___PSTL_HOST_SCAN_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_BACKEND_HOST()
+
+#  include <cuda/std/__execution/policy.h>
+#  include <cuda/std/__iterator/iterator_traits.h>
+#  include <cuda/std/__numeric/exclusive_scan.h>
+#  include <cuda/std/__numeric/inclusive_scan.h>
+#  include <cuda/std/__pstl/host/for_each_tile.h>
+#  include <cuda/std/__utility/move.h>
+#  include <cuda/std/optional>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+//! @brief Scans @c __count elements with a host backend, shared by the inclusive and exclusive scans
+//! The scan runs in three phases: every tile but the last is reduced in parallel, the tile sums are scanned serially
+//! into the prefix of each tile, and finally every tile is scanned in parallel starting from its prefix. The input is
+//! fully read before any output is written, so the scan may run in place.
+//! @tparam _Exclusive Whether the element itself is excluded from its output
+//! @tparam _AccT The accumulator type of the scan
+//! @param __init The initial value of the scan, which must be engaged for exclusive scans
+template <__execution_backend _Backend,
+          bool _Exclusive,
+          class _AccT,
+          class _InputIterator,
+          class _OutputIterator,
+          class _BinaryOp>
+[[nodiscard]] _CCCL_HOST_API _OutputIterator __pstl_host_scan(
+  _InputIterator __first, size_t __count, _OutputIterator __result, optional<_AccT> __init, _BinaryOp __binary_op)
+{
+  using _InDiff  = iter_difference_t<_InputIterator>;
+  using _OutDiff = iter_difference_t<_OutputIterator>;
+
+  const auto __tiling = __pstl_host_backend<_Backend>::__tiling(__count);
+
+  // The prefix of a tile is the sum of all elements of the previous tiles and the initial value
+  __pstl_host_buffer<_AccT> __prefixes{__tiling.__num_tiles_};
+  if (__init.has_value())
+  {
+    __prefixes[0].emplace(::cuda::std::move(*__init));
+  }
+
+  if (!__tiling.__is_serial())
+  {
+    // Reduce every tile but the last one into the prefix of the next tile. Every tile holds at least two elements
+    __pstl_host_buffer<_AccT> __sums{__tiling.__num_tiles_};
+    __pstl_host_backend<_Backend>::__for_each_tile(__tiling, [&](const size_t __tile) {
+      if (__tile + 1 == __tiling.__num_tiles_)
+      {
+        return;
+      }
+
+      _InputIterator __begin     = __first + static_cast<_InDiff>(__tiling.__begin(__tile));
+      const _InputIterator __end = __first + static_cast<_InDiff>(__tiling.__end(__tile));
+      _AccT& __sum               = __sums[__tile].emplace(__binary_op(__begin[0], __begin[1]));
+      for (__begin += 2; __begin != __end; ++__begin)
+      {
+        __sum = __binary_op(::cuda::std::move(__sum), *__begin);
+      }
+    });
+
+    for (size_t __tile = 1; __tile < __tiling.__num_tiles_; ++__tile)
+    {
+      if (__prefixes[__tile - 1].has_value())
+      {
+        __prefixes[__tile].emplace(__binary_op(*__prefixes[__tile - 1], ::cuda::std::move(*__sums[__tile - 1])));
+      }
+      else
+      {
+        __prefixes[__tile].emplace(::cuda::std::move(*__sums[__tile - 1]));
+      }
+    }
+  }
+
+  __pstl_host_backend<_Backend>::__for_each_tile(__tiling, [&](const size_t __tile) {
+    const _InputIterator __begin = __first + static_cast<_InDiff>(__tiling.__begin(__tile));
+    const _InputIterator __end   = __first + static_cast<_InDiff>(__tiling.__end(__tile));
+    const _OutputIterator __out  = __result + static_cast<_OutDiff>(__tiling.__begin(__tile));
+    optional<_AccT>& __prefix    = __prefixes[__tile];
+    if constexpr (_Exclusive)
+    {
+      ::cuda::std::exclusive_scan(__begin, __end, __out, ::cuda::std::move(*__prefix), __binary_op);
+    }
+    else
+    {
+      if (__prefix.has_value())
+      {
+        ::cuda::std::inclusive_scan(__begin, __end, __out, __binary_op, ::cuda::std::move(*__prefix));
+      }
+      else
+      {
+        ::cuda::std::inclusive_scan(__begin, __end, __out, __binary_op);
+      }
+    }
+  });
+
+  return __result + static_cast<_OutDiff>(__count);
+}
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_BACKEND_HOST()
+
+#endif // _CUDA_STD___PSTL_HOST_SCAN_H
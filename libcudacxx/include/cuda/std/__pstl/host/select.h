@@ -0,0 +1,102 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_HOST_SELECT_H
+#define _CUDA_STD___PSTL_HOST_SELECT_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_BACKEND_HOST()
+
+#  include <cuda/std/__execution/policy.h>
+#  include <cuda/std/__host_stdlib/memory>
+#  include <cuda/std/__iterator/iterator_traits.h>
+#  include <cuda/std/__pstl/host/for_each_tile.h>
+#  include <cuda/std/__utility/move.h>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+//! @brief Stable two way selection of the elements of a tiled range, shared by compaction and partitioning
+//! The selection flag of every element is computed exactly once, and the selected elements of every tile are counted.
+//! After the counts have been scanned, every element is passed to @c __emit together with its rank among the selected
+//! or the rejected elements respectively.
+//! @param __flag Returns whether the element at a given position is selected
+//! @param __emit Called with the position of an element, whether it is selected, and its rank among the selected and
+//!        the rejected elements
+//! @returns The number of selected elements
+template <__execution_backend _Backend, class _Flag, class _Emit>
+[[nodiscard]] _CCCL_HOST_API size_t __pstl_host_select(const __pstl_host_tiling& __tiling, _Flag __flag, _Emit __emit)
+{
+  ::std::unique_ptr<bool[]> __flags{new bool[__tiling.__count_]};
+  ::std::unique_ptr<size_t[]> __counts{new size_t[__tiling.__num_tiles_]};
+  __pstl_host_backend<_Backend>::__for_each_tile(__tiling, [&](const size_t __tile) {
+    size_t __num_selected = 0;
+    const size_t __end    = __tiling.__end(__tile);
+    for (size_t __pos = __tiling.__begin(__tile); __pos != __end; ++__pos)
+    {
+      __flags[__pos] = static_cast<bool>(__flag(__pos));
+      __num_selected += __flags[__pos];
+    }
+    __counts[__tile] = __num_selected;
+  });
+
+  const size_t __num_selected =
+    ::cuda::std::execution::__pstl_host_exclusive_sum(__counts.get(), __tiling.__num_tiles_);
+
+  __pstl_host_backend<_Backend>::__for_each_tile(__tiling, [&](const size_t __tile) {
+    size_t __selected  = __counts[__tile];
+    const size_t __end = __tiling.__end(__tile);
+    for (size_t __pos = __tiling.__begin(__tile); __pos != __end; ++__pos)
+    {
+      __emit(__pos, __flags[__pos], __selected, __pos - __selected);
+      __selected += __flags[__pos];
+    }
+  });
+
+  return __num_selected;
+}
+
+//! @brief Moves the first @c __count elements of a temporary buffer back into the input range of an in place algorithm
+template <__execution_backend _Backend, class _Iter, class _Tp, class _Index>
+_CCCL_HOST_API void
+__pstl_host_move_back(_Iter __first, const size_t __count, __pstl_host_buffer<_Tp>& __buffer, _Index __index)
+{
+  using _Diff         = iter_difference_t<_Iter>;
+  const auto __tiling = __pstl_host_backend<_Backend>::__tiling(__count);
+  __pstl_host_backend<_Backend>::__for_each_tile(__tiling, [&](const size_t __tile) {
+    const size_t __end = __tiling.__end(__tile);
+    for (size_t __pos = __tiling.__begin(__tile); __pos != __end; ++__pos)
+    {
+      __first[static_cast<_Diff>(__pos)] = ::cuda::std::move(*__buffer[__index(__pos)]);
+    }
+  });
+}
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_BACKEND_HOST()
+
+#endif // _CUDA_STD___PSTL_HOST_SELECT_H
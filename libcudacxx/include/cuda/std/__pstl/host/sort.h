@@ -0,0 +1,108 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_HOST_SORT_H
+#define _CUDA_STD___PSTL_HOST_SORT_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_BACKEND_HOST()
+
+#  include <cuda/std/__algorithm/sort.h>
+#  include <cuda/std/__algorithm/stable_sort.h>
+#  include <cuda/std/__execution/policy.h>
+#  include <cuda/std/__iterator/distance.h>
+#  include <cuda/std/__iterator/iterator_traits.h>
+#  include <cuda/std/__pstl/dispatch.h>
+#  include <cuda/std/__pstl/host/for_each_tile.h>
+#  include <cuda/std/__pstl/host/merge_sort.h>
+#  include <cuda/std/__pstl/host/radix_sort.h>
+#  include <cuda/std/__pstl/radix_sort_order.h>
+#  include <cuda/std/__utility/move.h>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+//! @brief Host backend of cuda::std::sort and cuda::std::stable_sort
+//! Arithmetic values that are ordered by the standard comparison operators are radix sorted, everything else is merge
+//! sorted. Both are stable, so the only difference is how the tiles of the merge sort are sorted.
+template <__execution_backend _Backend, bool _Stable>
+struct __pstl_host_sort
+{
+  template <class _Policy, class _RandomAccessIterator, class _Compare>
+  _CCCL_HOST_API void operator()([[maybe_unused]] const _Policy& __policy,
+                                 _RandomAccessIterator __first,
+                                 _RandomAccessIterator __last,
+                                 _Compare __comp) const
+  {
+    if constexpr (::cuda::std::__has_random_access_traversal<_RandomAccessIterator>)
+    {
+      const auto __count  = static_cast<size_t>(::cuda::std::distance(__first, __last));
+      const auto __tiling = __pstl_host_backend<_Backend>::__tiling(__count);
+      if (!__tiling.__is_serial())
+      {
+        constexpr auto __order = __pstl_radix_sort_order_v<iter_value_t<_RandomAccessIterator>, _Compare>;
+        if constexpr (__order != __pstl_radix_sort_order::__none)
+        {
+          __pstl_host_radix_sort<_Backend>::template __sort<__order>(::cuda::std::move(__first), __tiling);
+        }
+        else
+        {
+          __pstl_host_merge_sort<_Backend, _Stable>::__sort(::cuda::std::move(__first), __tiling, __comp);
+        }
+        return;
+      }
+    }
+
+    if constexpr (_Stable)
+    {
+      ::cuda::std::stable_sort(::cuda::std::move(__first), ::cuda::std::move(__last), ::cuda::std::move(__comp));
+    }
+    else
+    {
+      ::cuda::std::sort(::cuda::std::move(__first), ::cuda::std::move(__last), ::cuda::std::move(__comp));
+    }
+  }
+};
+
+#  if _CCCL_HAS_BACKEND_OMP()
+template <>
+struct __pstl_dispatch<__pstl_algorithm::__sort, __execution_backend::__omp>
+    : __pstl_host_sort<__execution_backend::__omp, false>
+{};
+#  endif // _CCCL_HAS_BACKEND_OMP()
+
+#  if _CCCL_HAS_BACKEND_TBB()
+template <>
+struct __pstl_dispatch<__pstl_algorithm::__sort, __execution_backend::__tbb>
+    : __pstl_host_sort<__execution_backend::__tbb, false>
+{};
+#  endif // _CCCL_HAS_BACKEND_TBB()
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_BACKEND_HOST()
+
+#endif // _CUDA_STD___PSTL_HOST_SORT_H
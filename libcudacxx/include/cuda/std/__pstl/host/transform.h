@@ -0,0 +1,188 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_HOST_TRANSFORM_H
+#define _CUDA_STD___PSTL_HOST_TRANSFORM_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_BACKEND_HOST()
+
+#  include <cuda/std/__concepts/concept_macros.h>
+#  include <cuda/std/__execution/policy.h>
+#  include <cuda/std/__iterator/distance.h>
+#  include <cuda/std/__iterator/iterator_traits.h>
+#  include <cuda/std/__pstl/dispatch.h>
+#  include <cuda/std/__pstl/host/for_each_tile.h>
+#  include <cuda/std/__type_traits/is_callable.h>
+#  include <cuda/std/__utility/move.h>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+//! @brief Host backend of cuda::std::transform
+//! Elements for which @c __pred does not hold are skipped, leaving the corresponding output untouched.
+template <__execution_backend _Backend>
+struct __pstl_host_transform
+{
+  template <class _InputIterator, class _OutputIterator, class _UnaryOp, class _Predicate>
+  _CCCL_HOST_API static _OutputIterator __serial_impl(
+    _InputIterator __first, _InputIterator __last, _OutputIterator __result, _UnaryOp& __func, _Predicate& __pred)
+  {
+    for (; __first != __last; ++__first, (void) ++__result)
+    {
+      if (__pred(*__first))
+      {
+        *__result = __func(*__first);
+      }
+    }
+    return __result;
+  }
+
+  template <class _InputIterator1, class _InputIterator2, class _OutputIterator, class _BinaryOp, class _Predicate>
+  _CCCL_HOST_API static _OutputIterator __serial_impl(
+    _InputIterator1 __first1,
+    _InputIterator1 __last1,
+    _InputIterator2 __first2,
+    _OutputIterator __result,
+    _BinaryOp& __func,
+    _Predicate& __pred)
+  {
+    for (; __first1 != __last1; ++__first1, (void) ++__first2, (void) ++__result)
+    {
+      if (__pred(*__first1, *__first2))
+      {
+        *__result = __func(*__first1, *__first2);
+      }
+    }
+    return __result;
+  }
+
+  _CCCL_TEMPLATE(class _Policy,
+                 class _InputIterator,
+                 class _OutputIterator,
+                 class _UnaryOp,
+                 class _Predicate = __pstl_host_always_true)
+  _CCCL_REQUIRES(__has_forward_traversal<_InputIterator> _CCCL_AND __has_forward_traversal<_OutputIterator> _CCCL_AND
+                   is_invocable_v<_UnaryOp, iter_reference_t<_InputIterator>>)
+  [[nodiscard]] _CCCL_HOST_API _OutputIterator operator()(
+    [[maybe_unused]] const _Policy& __policy,
+    _InputIterator __first,
+    _InputIterator __last,
+    _OutputIterator __result,
+    _UnaryOp __func,
+    _Predicate __pred = {}) const
+  {
+    if constexpr (::cuda::std::__has_random_access_traversal<_InputIterator>
+                  && ::cuda::std::__has_random_access_traversal<_OutputIterator>)
+    {
+      using _InDiff       = iter_difference_t<_InputIterator>;
+      using _OutDiff      = iter_difference_t<_OutputIterator>;
+      const auto __count  = ::cuda::std::distance(__first, __last);
+      const auto __tiling = __pstl_host_backend<_Backend>::__tiling(static_cast<size_t>(__count));
+      __pstl_host_backend<_Backend>::__for_each_tile(__tiling, [&](const size_t __tile) {
+        __serial_impl(__first + static_cast<_InDiff>(__tiling.__begin(__tile)),
+                      __first + static_cast<_InDiff>(__tiling.__end(__tile)),
+                      __result + static_cast<_OutDiff>(__tiling.__begin(__tile)),
+                      __func,
+                      __pred);
+      });
+      return __result + static_cast<_OutDiff>(__count);
+    }
+    else
+    {
+      return __serial_impl(
+        ::cuda::std::move(__first), ::cuda::std::move(__last), ::cuda::std::move(__result), __func, __pred);
+    }
+  }
+
+  _CCCL_TEMPLATE(class _Policy,
+                 class _InputIterator1,
+                 class _InputIterator2,
+                 class _OutputIterator,
+                 class _BinaryOp,
+                 class _Predicate = __pstl_host_always_true)
+  _CCCL_REQUIRES(__has_forward_traversal<_InputIterator1> _CCCL_AND __has_forward_traversal<_InputIterator2> _CCCL_AND
+                   __has_forward_traversal<_OutputIterator>)
+  [[nodiscard]] _CCCL_HOST_API _OutputIterator operator()(
+    [[maybe_unused]] const _Policy& __policy,
+    _InputIterator1 __first1,
+    _InputIterator1 __last1,
+    _InputIterator2 __first2,
+    _OutputIterator __result,
+    _BinaryOp __func,
+    _Predicate __pred = {}) const
+  {
+    if constexpr (::cuda::std::__has_random_access_traversal<_InputIterator1>
+                  && ::cuda::std::__has_random_access_traversal<_InputIterator2>
+                  && ::cuda::std::__has_random_access_traversal<_OutputIterator>)
+    {
+      using _InDiff1      = iter_difference_t<_InputIterator1>;
+      using _InDiff2      = iter_difference_t<_InputIterator2>;
+      using _OutDiff      = iter_difference_t<_OutputIterator>;
+      const auto __count  = ::cuda::std::distance(__first1, __last1);
+      const auto __tiling = __pstl_host_backend<_Backend>::__tiling(static_cast<size_t>(__count));
+      __pstl_host_backend<_Backend>::__for_each_tile(__tiling, [&](const size_t __tile) {
+        __serial_impl(__first1 + static_cast<_InDiff1>(__tiling.__begin(__tile)),
+                      __first1 + static_cast<_InDiff1>(__tiling.__end(__tile)),
+                      __first2 + static_cast<_InDiff2>(__tiling.__begin(__tile)),
+                      __result + static_cast<_OutDiff>(__tiling.__begin(__tile)),
+                      __func,
+                      __pred);
+      });
+      return __result + static_cast<_OutDiff>(__count);
+    }
+    else
+    {
+      return __serial_impl(
+        ::cuda::std::move(__first1),
+        ::cuda::std::move(__last1),
+        ::cuda::std::move(__first2),
+        ::cuda::std::move(__result),
+        __func,
+        __pred);
+    }
+  }
+};
+
+#  if _CCCL_HAS_BACKEND_OMP()
+template <>
+struct __pstl_dispatch<__pstl_algorithm::__transform, __execution_backend::__omp>
+    : __pstl_host_transform<__execution_backend::__omp>
+{};
+#  endif // _CCCL_HAS_BACKEND_OMP()
+
+#  if _CCCL_HAS_BACKEND_TBB()
+template <>
+struct __pstl_dispatch<__pstl_algorithm::__transform, __execution_backend::__tbb>
+    : __pstl_host_transform<__execution_backend::__tbb>
+{};
+#  endif // _CCCL_HAS_BACKEND_TBB()
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_BACKEND_HOST()
+
+#endif // _CUDA_STD___PSTL_HOST_TRANSFORM_H
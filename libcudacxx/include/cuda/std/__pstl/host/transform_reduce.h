@@ -0,0 +1,144 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_HOST_TRANSFORM_REDUCE_H
+#define _CUDA_STD___PSTL_HOST_TRANSFORM_REDUCE_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_BACKEND_HOST()
+
+#  include <cuda/std/__execution/policy.h>
+#  include <cuda/std/__iterator/iterator_traits.h>
+#  include <cuda/std/__iterator/next.h>
+#  include <cuda/std/__numeric/transform_reduce.h>
+#  include <cuda/std/__pstl/dispatch.h>
+#  include <cuda/std/__pstl/host/for_each_tile.h>
+#  include <cuda/std/__utility/move.h>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+//! @brief Host backend of cuda::std::transform_reduce
+//! Follows the host backend of cuda::std::reduce, applying @c _TransformOp to every element before it is reduced.
+template <__execution_backend _Backend>
+struct __pstl_host_transform_reduce
+{
+  template <class _InputIterator, class _Size, class _Tp, class _ReductionOp, class _TransformOp>
+  [[nodiscard]] _CCCL_HOST_API static _Tp __par_impl(
+    _InputIterator __first, _Size __count, _Tp __init, _ReductionOp __reduction_op, _TransformOp __transform_op)
+  {
+    const auto __tiling = __pstl_host_backend<_Backend>::__tiling(static_cast<size_t>(__count));
+    if (__tiling.__is_serial())
+    {
+      auto __last = ::cuda::std::next(__first, __count);
+      return ::cuda::std::transform_reduce(
+        ::cuda::std::move(__first),
+        ::cuda::std::move(__last),
+        ::cuda::std::move(__init),
+        ::cuda::std::move(__reduction_op),
+        ::cuda::std::move(__transform_op));
+    }
+
+    using _Diff = iter_difference_t<_InputIterator>;
+    __pstl_host_buffer<_Tp> __partials{__tiling.__num_tiles_};
+    __pstl_host_backend<_Backend>::__for_each_tile(__tiling, [&](const size_t __tile) {
+      _InputIterator __begin     = __first + static_cast<_Diff>(__tiling.__begin(__tile));
+      const _InputIterator __end = __first + static_cast<_Diff>(__tiling.__end(__tile));
+      if (__tile == 0)
+      {
+        __partials[__tile].emplace(::cuda::std::move(__init));
+      }
+      else
+      {
+        __partials[__tile].emplace(__reduction_op(__transform_op(__begin[0]), __transform_op(__begin[1])));
+        __begin += 2;
+      }
+
+      _Tp& __sum = *__partials[__tile];
+      for (; __begin != __end; ++__begin)
+      {
+        __sum = __reduction_op(::cuda::std::move(__sum), __transform_op(*__begin));
+      }
+    });
+
+    _Tp __ret = ::cuda::std::move(*__partials[0]);
+    for (size_t __tile = 1; __tile < __tiling.__num_tiles_; ++__tile)
+    {
+      __ret = __reduction_op(::cuda::std::move(__ret), ::cuda::std::move(*__partials[__tile]));
+    }
+    return __ret;
+  }
+
+  template <class _Policy, class _InputIterator, class _Size, class _Tp, class _ReductionOp, class _TransformOp>
+  [[nodiscard]] _CCCL_HOST_API _Tp operator()(
+    [[maybe_unused]] const _Policy& __policy,
+    _InputIterator __first,
+    _Size __count,
+    _Tp __init,
+    _ReductionOp __reduction_op,
+    _TransformOp __transform_op) const
+  {
+    if constexpr (::cuda::std::__has_random_access_traversal<_InputIterator>)
+    {
+      return __par_impl(
+        ::cuda::std::move(__first),
+        __count,
+        ::cuda::std::move(__init),
+        ::cuda::std::move(__reduction_op),
+        ::cuda::std::move(__transform_op));
+    }
+    else
+    {
+      auto __last = ::cuda::std::next(__first, __count);
+      return ::cuda::std::transform_reduce(
+        ::cuda::std::move(__first),
+        ::cuda::std::move(__last),
+        ::cuda::std::move(__init),
+        ::cuda::std::move(__reduction_op),
+        ::cuda::std::move(__transform_op));
+    }
+  }
+};
+
+#  if _CCCL_HAS_BACKEND_OMP()
+template <>
+struct __pstl_dispatch<__pstl_algorithm::__transform_reduce, __execution_backend::__omp>
+    : __pstl_host_transform_reduce<__execution_backend::__omp>
+{};
+#  endif // _CCCL_HAS_BACKEND_OMP()
+
+#  if _CCCL_HAS_BACKEND_TBB()
+template <>
+struct __pstl_dispatch<__pstl_algorithm::__transform_reduce, __execution_backend::__tbb>
+    : __pstl_host_transform_reduce<__execution_backend::__tbb>
+{};
+#  endif // _CCCL_HAS_BACKEND_TBB()
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_BACKEND_HOST()
+
+#endif // _CUDA_STD___PSTL_HOST_TRANSFORM_REDUCE_H
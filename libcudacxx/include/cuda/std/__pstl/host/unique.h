@@ -0,0 +1,149 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_HOST_UNIQUE_H
+#define _CUDA_STD___PSTL_HOST_UNIQUE_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_BACKEND_HOST()
+
+#  include <cuda/std/__algorithm/unique.h>
+#  include <cuda/std/__algorithm/unique_copy.h>
+#  include <cuda/std/__concepts/concept_macros.h>
+#  include <cuda/std/__execution/policy.h>
+#  include <cuda/std/__functional/identity.h>
+#  include <cuda/std/__iterator/distance.h>
+#  include <cuda/std/__iterator/iterator_traits.h>
+#  include <cuda/std/__pstl/dispatch.h>
+#  include <cuda/std/__pstl/host/for_each_tile.h>
+#  include <cuda/std/__pstl/host/select.h>
+#  include <cuda/std/__utility/move.h>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+//! @brief Host backend of cuda::std::unique and cuda::std::unique_copy
+//! An element is kept if it is the first one or if it is not equal to its predecessor. In place, the kept elements are
+//! compacted into a temporary buffer and then moved back to the front of the input range.
+template <__execution_backend _Backend>
+struct __pstl_host_unique
+{
+  _CCCL_TEMPLATE(class _Policy, class _InputIterator, class _BinaryPredicate)
+  _CCCL_REQUIRES(__has_forward_traversal<_InputIterator>)
+  [[nodiscard]] _CCCL_HOST_API _InputIterator operator()(
+    [[maybe_unused]] const _Policy& __policy,
+    _InputIterator __first,
+    _InputIterator __last,
+    _BinaryPredicate __pred) const
+  {
+    if constexpr (::cuda::std::__has_random_access_traversal<_InputIterator>)
+    {
+      using _Diff         = iter_difference_t<_InputIterator>;
+      const auto __count  = static_cast<size_t>(::cuda::std::distance(__first, __last));
+      const auto __tiling = __pstl_host_backend<_Backend>::__tiling(__count);
+      if (!__tiling.__is_serial())
+      {
+        __pstl_host_buffer<iter_value_t<_InputIterator>> __buffer{__count};
+        const size_t __num_selected = ::cuda::std::execution::__pstl_host_select<_Backend>(
+          __tiling,
+          [&](const size_t __pos) {
+            return __pos == 0
+                || !__pred(__first[static_cast<_Diff>(__pos - 1)], __first[static_cast<_Diff>(__pos)]);
+          },
+          [&](const size_t __pos, const bool __selected, const size_t __index, size_t) {
+            if (__selected)
+            {
+              __buffer[__index].emplace(::cuda::std::move(__first[static_cast<_Diff>(__pos)]));
+            }
+          });
+
+        ::cuda::std::execution::__pstl_host_move_back<_Backend>(
+          __first, __num_selected, __buffer, ::cuda::std::identity{});
+        return __first + static_cast<_Diff>(__num_selected);
+      }
+    }
+
+    return ::cuda::std::unique(::cuda::std::move(__first), ::cuda::std::move(__last), ::cuda::std::move(__pred));
+  }
+
+  _CCCL_TEMPLATE(class _Policy, class _InputIterator, class _OutputIterator, class _BinaryPredicate)
+  _CCCL_REQUIRES(__has_forward_traversal<_OutputIterator>)
+  [[nodiscard]] _CCCL_HOST_API _OutputIterator operator()(
+    [[maybe_unused]] const _Policy& __policy,
+    _InputIterator __first,
+    _InputIterator __last,
+    _OutputIterator __result,
+    _BinaryPredicate __pred) const
+  {
+    if constexpr (::cuda::std::__has_random_access_traversal<_InputIterator>
+                  && ::cuda::std::__has_random_access_traversal<_OutputIterator>)
+    {
+      using _InDiff       = iter_difference_t<_InputIterator>;
+      using _OutDiff      = iter_difference_t<_OutputIterator>;
+      const auto __count  = static_cast<size_t>(::cuda::std::distance(__first, __last));
+      const auto __tiling = __pstl_host_backend<_Backend>::__tiling(__count);
+      if (!__tiling.__is_serial())
+      {
+        const size_t __num_selected = ::cuda::std::execution::__pstl_host_select<_Backend>(
+          __tiling,
+          [&](const size_t __pos) {
+            return __pos == 0
+                || !__pred(__first[static_cast<_InDiff>(__pos - 1)], __first[static_cast<_InDiff>(__pos)]);
+          },
+          [&](const size_t __pos, const bool __selected, const size_t __index, size_t) {
+            if (__selected)
+            {
+              __result[static_cast<_OutDiff>(__index)] = __first[static_cast<_InDiff>(__pos)];
+            }
+          });
+        return __result + static_cast<_OutDiff>(__num_selected);
+      }
+    }
+
+    return ::cuda::std::unique_copy(
+      ::cuda::std::move(__first), ::cuda::std::move(__last), ::cuda::std::move(__result), ::cuda::std::move(__pred));
+  }
+};
+
+#  if _CCCL_HAS_BACKEND_OMP()
+template <>
+struct __pstl_dispatch<__pstl_algorithm::__unique, __execution_backend::__omp>
+    : __pstl_host_unique<__execution_backend::__omp>
+{};
+#  endif // _CCCL_HAS_BACKEND_OMP()
+
+#  if _CCCL_HAS_BACKEND_TBB()
+template <>
+struct __pstl_dispatch<__pstl_algorithm::__unique, __execution_backend::__tbb>
+    : __pstl_host_unique<__execution_backend::__tbb>
+{};
+#  endif // _CCCL_HAS_BACKEND_TBB()
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_BACKEND_HOST()
+
+#endif // _CUDA_STD___PSTL_HOST_UNIQUE_H
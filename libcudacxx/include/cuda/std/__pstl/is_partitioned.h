@@ -39,6 +39,9 @@
 #  if _CCCL_HAS_BACKEND_CUDA()
 #    include <cuda/std/__pstl/cuda/find_if.h>
 #  endif // _CCCL_HAS_BACKEND_CUDA()
+#  if _CCCL_HAS_BACKEND_HOST()
+#    include <cuda/std/__pstl/host/find_if.h>
+#  endif // _CCCL_HAS_BACKEND_HOST()
 
 #  include <cuda/std/__cccl/prologue.h>
 
@@ -49,8 +52,9 @@ struct __is_partitioned_fn
 {
   _UnaryPred __pred_;
 
+  _CCCL_EXEC_CHECK_DISABLE
   template <class _Tuple>
-  [[nodiscard]] _CCCL_DEVICE_API constexpr bool operator()(const _Tuple& __tuple) const
+  [[nodiscard]] _CCCL_API constexpr bool operator()(const _Tuple& __tuple) const
   {
     const bool __pred_lhs = __pred_(::cuda::std::get<0>(__tuple));
     const bool __pred_rhs = __pred_(::cuda::std::get<1>(__tuple));
@@ -0,0 +1,71 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_RADIX_SORT_ORDER_H
+#define _CUDA_STD___PSTL_RADIX_SORT_ORDER_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__functional/operations.h>
+#include <cuda/std/__type_traits/is_floating_point.h>
+#include <cuda/std/__type_traits/is_integral.h>
+#include <cuda/std/__type_traits/is_same.h>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+//! @brief The order in which a radix sort can replace a comparison sort
+enum class __pstl_radix_sort_order
+{
+  __none,
+  __ascending,
+  __descending,
+};
+
+//! @brief Whether the bit pattern of @tparam _Tp can be sorted by a radix sort
+//! Radix sorts treat -0.0 and +0.0 as equal, so they are stable with respect to the standard comparison operators
+template <class _Tp>
+inline constexpr bool __pstl_is_radix_sortable =
+  (is_integral_v<_Tp> || is_same_v<_Tp, float> || is_same_v<_Tp, double>) && sizeof(_Tp) <= 8;
+
+//! @brief Detects whether sorting a range of @tparam _Tp with @tparam _Compare is equivalent to a radix sort
+template <class _Tp, class _Compare>
+inline constexpr __pstl_radix_sort_order __pstl_radix_sort_order_v = __pstl_radix_sort_order::__none;
+
+template <class _Tp>
+inline constexpr __pstl_radix_sort_order __pstl_radix_sort_order_v<_Tp, less<_Tp>> =
+  __pstl_is_radix_sortable<_Tp> ? __pstl_radix_sort_order::__ascending : __pstl_radix_sort_order::__none;
+
+template <class _Tp>
+inline constexpr __pstl_radix_sort_order __pstl_radix_sort_order_v<_Tp, less<void>> =
+  __pstl_is_radix_sortable<_Tp> ? __pstl_radix_sort_order::__ascending : __pstl_radix_sort_order::__none;
+
+template <class _Tp>
+inline constexpr __pstl_radix_sort_order __pstl_radix_sort_order_v<_Tp, greater<_Tp>> =
+  __pstl_is_radix_sortable<_Tp> ? __pstl_radix_sort_order::__descending : __pstl_radix_sort_order::__none;
+
+template <class _Tp>
+inline constexpr __pstl_radix_sort_order __pstl_radix_sort_order_v<_Tp, greater<void>> =
+  __pstl_is_radix_sortable<_Tp> ? __pstl_radix_sort_order::__descending : __pstl_radix_sort_order::__none;
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA_STD___PSTL_RADIX_SORT_ORDER_H
@@ -41,6 +41,9 @@
 #  if _CCCL_HAS_BACKEND_CUDA()
 #    include <cuda/std/__pstl/cuda/transform.h>
 #  endif // _CCCL_HAS_BACKEND_CUDA()
+#  if _CCCL_HAS_BACKEND_HOST()
+#    include <cuda/std/__pstl/host/transform.h>
+#  endif // _CCCL_HAS_BACKEND_HOST()
 
 #  include <cuda/std/__cccl/prologue.h>
 
@@ -55,8 +58,9 @@ struct __replace_return_value
       : __new_value_(__new_value)
   {}
 
+  _CCCL_EXEC_CHECK_DISABLE
   template <class _Up>
-  [[nodiscard]] _CCCL_DEVICE_API constexpr _Tp operator()(const _Up&) const
+  [[nodiscard]] _CCCL_API constexpr _Tp operator()(const _Up&) const
     noexcept(is_nothrow_copy_constructible_v<_Tp>)
   {
     return __new_value_;
@@ -40,6 +40,9 @@
 #  if _CCCL_HAS_BACKEND_CUDA()
 #    include <cuda/std/__pstl/cuda/transform.h>
 #  endif // _CCCL_HAS_BACKEND_CUDA()
+#  if _CCCL_HAS_BACKEND_HOST()
+#    include <cuda/std/__pstl/host/transform.h>
+#  endif // _CCCL_HAS_BACKEND_HOST()
 
 #  include <cuda/std/__cccl/prologue.h>
 
@@ -56,8 +59,9 @@ struct __replace_copy_if_select
       , __new_value_(__new_value)
   {}
 
+  _CCCL_EXEC_CHECK_DISABLE
   template <class _Up>
-  [[nodiscard]] _CCCL_DEVICE_API constexpr _Tp operator()(const _Up& __val) const
+  [[nodiscard]] _CCCL_API constexpr _Tp operator()(const _Up& __val) const
     noexcept(is_nothrow_invocable_v<const _UnaryPred&, const _Up&> && is_nothrow_copy_constructible_v<_Tp>)
   {
     return ::cuda::std::invoke(__pred_, __val) ? __new_value_ : static_cast<_Tp>(__val);
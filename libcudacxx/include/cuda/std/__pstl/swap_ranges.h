@@ -49,6 +49,10 @@
 #    include <cuda/std/__pstl/cuda/for_each_n.h>
 #    include <cuda/std/__pstl/cuda/transform.h>
 #  endif // _CCCL_HAS_BACKEND_CUDA()
+#  if _CCCL_HAS_BACKEND_HOST()
+#    include <cuda/std/__pstl/host/for_each_n.h>
+#    include <cuda/std/__pstl/host/transform.h>
+#  endif // _CCCL_HAS_BACKEND_HOST()
 
 #  include <cuda/std/__cccl/prologue.h>
 
@@ -60,8 +64,9 @@ struct __swap_ranges_iter_swap_fn
   _InputIterator1 __first1;
   _InputIterator2 __first2;
 
+  _CCCL_EXEC_CHECK_DISABLE
   template <class _DifferenceType>
-  _CCCL_DEVICE_API _CCCL_FORCEINLINE constexpr void operator()(const _DifferenceType __index) const
+  _CCCL_API _CCCL_FORCEINLINE constexpr void operator()(const _DifferenceType __index) const
   {
     ::cuda::std::iter_swap(__first1 + __index, __first2 + static_cast<iter_difference_t<_InputIterator2>>(__index));
   }
@@ -69,8 +74,9 @@ struct __swap_ranges_iter_swap_fn
 
 struct __swap_ranges_transform_fn
 {
+  _CCCL_EXEC_CHECK_DISABLE
   template <class _Tp, class _Up>
-  [[nodiscard]] _CCCL_DEVICE_API _CCCL_FORCEINLINE constexpr auto operator()(_Tp __lhs, _Up __rhs) const
+  [[nodiscard]] _CCCL_API _CCCL_FORCEINLINE constexpr auto operator()(_Tp __lhs, _Up __rhs) const
   {
     using ::cuda::std::swap;
     swap(__lhs, __rhs);
@@ -0,0 +1,140 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___RANDOM_BULK_GENERATE_H
+#define _CUDA_STD___RANDOM_BULK_GENERATE_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/__bit/integral.h>
+#include <cuda/std/__limits/numeric_limits.h>
+#include <cuda/std/__type_traits/void_t.h>
+#include <cuda/std/__utility/declval.h>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstdint>
+#include <cuda/std/span>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+// Engines that can fill a whole range at once provide generate(span<result_type>)
+template <class, class = void>
+inline constexpr bool __cccl_random_has_bulk_generate = false;
+template <class _URng>
+inline constexpr bool __cccl_random_has_bulk_generate<
+  _URng,
+  void_t<decltype(::cuda::std::declval<_URng&>().generate(span<typename _URng::result_type>{}))>> = true;
+
+// The number of values the distributions produce per call to the bulk generate of the engine
+inline constexpr size_t __cccl_random_bulk_chunk_size = 32;
+
+_CCCL_EXEC_CHECK_DISABLE
+template <class _URng>
+_CCCL_API constexpr void __cccl_random_generate_bits(_URng& __g, typename _URng::result_type* __first, size_t __n)
+{
+  if constexpr (__cccl_random_has_bulk_generate<_URng>)
+  {
+    __g.generate(span<typename _URng::result_type>{__first, __n});
+  }
+  else
+  {
+    for (size_t __i = 0; __i < __n; ++__i)
+    {
+      __first[__i] = __g();
+    }
+  }
+}
+
+// Converts an unsigned integer exactly like static_cast, but without the branch that compilers emit for 64-bit values
+// on targets without an unsigned conversion instruction, which random values mispredict half of the time. Halving only
+// rounds like the full value when the sticky bit lies below the mantissa, so wider types such as x87 long double take
+// the plain conversion.
+template <class _RealType, class _Bits>
+[[nodiscard]] _CCCL_API constexpr _RealType __cccl_random_to_real(_Bits __x) noexcept
+{
+  if constexpr (sizeof(_Bits) == sizeof(uint64_t) && numeric_limits<_RealType>::digits < 63)
+  {
+    // Halving with a sticky bit rounds like the full value, values below 2^63 are converted directly
+    const auto __value = static_cast<uint64_t>(__x);
+    const auto __top   = static_cast<uint64_t>(static_cast<int64_t>(__value) >> 63);
+    const auto __half  = (__value >> 1) | (__value & 1);
+    const auto __conv  = static_cast<_RealType>(static_cast<int64_t>((__half & __top) | (__value & ~__top)));
+    return __conv + __conv * static_cast<_RealType>(__top & 1);
+  }
+  else
+  {
+    return static_cast<_RealType>(__x);
+  }
+}
+
+// Fills [__out, __out + __n) with the values of consecutive calls to generate_canonical<_RealType, digits>. The random
+// bits are drawn in chunks and converted in a separate loop without any calls into the engine.
+_CCCL_EXEC_CHECK_DISABLE
+template <class _RealType, class _URng>
+_CCCL_API constexpr void __cccl_random_generate_canonical_n(_URng& __g, _RealType* __out, size_t __n)
+{
+  using _Bits              = typename _URng::result_type;
+  constexpr size_t __b     = numeric_limits<_RealType>::digits;
+  constexpr size_t __log_r = ::cuda::std::__bit_log2<uint64_t>((_URng::max) () - (_URng::min) () + uint64_t(1));
+  constexpr size_t __k     = __b / __log_r + (__b % __log_r != 0);
+  const _RealType __rp     = static_cast<_RealType>((_URng::max) () - (_URng::min) ()) + _RealType(1);
+
+  _RealType __scale = __rp;
+  for (size_t __j = 1; __j < __k; ++__j)
+  {
+    __scale *= __rp;
+  }
+  // If the range of the engine is a power of two the scale is one as well, and multiplying by its inverse is exact
+  constexpr bool __is_pow2  = ((_URng::max) () - (_URng::min) () & ((_URng::max) () - (_URng::min) () + 1)) == 0;
+  const _RealType __inverse = _RealType(1) / __scale;
+
+  _Bits __bits[__cccl_random_bulk_chunk_size * __k];
+  while (__n > 0)
+  {
+    const size_t __count = ::cuda::std::min(__n, __cccl_random_bulk_chunk_size);
+    ::cuda::std::__cccl_random_generate_bits(__g, __bits, __count * __k);
+    for (size_t __i = 0; __i < __count; ++__i)
+    {
+      const _Bits* __word = __bits + __i * __k;
+      _RealType __base    = __rp;
+      _RealType __sp      = ::cuda::std::__cccl_random_to_real<_RealType>(__word[0] - (_URng::min) ());
+      for (size_t __j = 1; __j < __k; ++__j, __base *= __rp)
+      {
+        __sp += ::cuda::std::__cccl_random_to_real<_RealType>(__word[__j] - (_URng::min) ()) * __base;
+      }
+      if constexpr (__is_pow2)
+      {
+        __out[__i] = __sp * __inverse;
+      }
+      else
+      {
+        __out[__i] = __sp / __scale;
+      }
+    }
+    __out += __count;
+    __n -= __count;
+  }
+}
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA_STD___RANDOM_BULK_GENERATE_H
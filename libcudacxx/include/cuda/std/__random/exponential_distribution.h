@@ -22,6 +22,7 @@
 
 #include <cuda/std/__cmath/logarithms.h>
 #include <cuda/std/__limits/numeric_limits.h>
+#include <cuda/std/__random/bulk_generate.h>
 #include <cuda/std/__random/generate_canonical.h>
 #include <cuda/std/__random/is_valid.h>
 #include <cuda/std/__random/uniform_real_distribution.h>
@@ -103,6 +104,25 @@ public:
          / __p.lambda();
   }
 
+  //! Fills @c __out with the values of consecutive invocations of operator(). The random bits of several values are
+  //! drawn from the engine at once.
+  template <class _URng, size_t _Extent>
+  _CCCL_API void generate(_URng& __g, span<result_type, _Extent> __out)
+  {
+    generate(__g, __out, __p_);
+  }
+  template <class _URng, size_t _Extent>
+  _CCCL_API void generate(_URng& __g, span<result_type, _Extent> __out, const param_type& __p)
+  {
+    static_assert(__cccl_random_is_valid_urng<_URng>, "URng must meet the UniformRandomBitGenerator requirements");
+    ::cuda::std::__cccl_random_generate_canonical_n(__g, __out.data(), __out.size());
+    const result_type __lambda = __p.lambda();
+    for (auto& __x : __out)
+    {
+      __x = -::cuda::std::log(result_type{1} - __x) / __lambda;
+    }
+  }
+
   // property functions
   [[nodiscard]] _CCCL_API constexpr result_type lambda() const noexcept
   {
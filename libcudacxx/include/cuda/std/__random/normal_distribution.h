@@ -25,6 +25,7 @@
 #include <cuda/std/__limits/numeric_limits.h>
 #include <cuda/std/__random/is_valid.h>
 #include <cuda/std/__random/uniform_real_distribution.h>
+#include <cuda/std/span>
 
 #if !_CCCL_COMPILER(NVRTC)
 #  include <ios>
@@ -134,6 +135,21 @@ public:
     return __up * __p.stddev() + __p.mean();
   }
 
+  //! Fills @c __out with the values of consecutive invocations of operator().
+  template <class _URng, size_t _Extent>
+  _CCCL_API constexpr void generate(_URng& __g, span<result_type, _Extent> __out)
+  {
+    generate(__g, __out, __p_);
+  }
+  template <class _URng, size_t _Extent>
+  _CCCL_API constexpr void generate(_URng& __g, span<result_type, _Extent> __out, const param_type& __p)
+  {
+    for (auto& __x : __out)
+    {
+      __x = (*this)(__g, __p);
+    }
+  }
+
   // property functions
   [[nodiscard]] _CCCL_API constexpr result_type mean() const noexcept
   {
@@ -24,11 +24,13 @@
 #include <cuda/__cmath/mul_hi.h>
 #include <cuda/std/__algorithm/min.h>
 #include <cuda/std/__random/is_seed_sequence.h>
+#include <cuda/std/__type_traits/conditional.h>
 #include <cuda/std/__type_traits/make_nbit_int.h>
 #include <cuda/std/__utility/pair.h>
 #include <cuda/std/array>
 #include <cuda/std/cstddef>
 #include <cuda/std/cstdint>
+#include <cuda/std/span>
 
 #if !_CCCL_COMPILER(NVRTC)
 #  include <ios>
@@ -243,6 +245,35 @@ public:
     return __y_[__j_];
   }
 
+  //! This member function fills a range with new random values and updates this philox_engine's state. The values
+  //! are the same ones that consecutive invocations of operator() produce. Full blocks are evaluated for several
+  //! counters at once, with every round applied to all of them, so the compiler can vectorize across the counters.
+  //!
+  //! @param __out The range to fill.
+  template <size_t _Extent>
+  _CCCL_API constexpr void generate(span<result_type, _Extent> __out) noexcept
+  {
+    result_type* __first = __out.data();
+    size_t __n           = __out.size();
+
+    // Use up the values left in the output buffer
+    for (; __n > 0 && __j_ != word_count - 1; --__n)
+    {
+      *__first++ = (*this)();
+    }
+
+    constexpr size_t __block_size = __bulk_lanes * word_count;
+    for (; __n >= __block_size; __n -= __block_size, __first += __block_size)
+    {
+      __philox_bulk(__first);
+    }
+
+    for (; __n > 0; --__n)
+    {
+      *__first++ = (*this)();
+    }
+  }
+
   //! This member function advances this philox_engine's state a given number of times
   //! and discards the results. philox_engine is a counter-based engine, therefore can discard with O(1) complexity.
   //!
@@ -515,6 +546,96 @@ private:
     __y_ = __S;
   }
 
+  // The number of counters evaluated at once by generate
+  static constexpr size_t __bulk_lanes = 8;
+
+  // 32-bit words are evaluated in 32-bit lanes even if result_type is wider, which doubles the SIMD width
+  using __bulk_lane_t = conditional_t<word_size == 32, uint32_t, result_type>;
+
+  [[nodiscard]] static _CCCL_API constexpr auto __mulhilo_bulk(__bulk_lane_t __a, result_type __b) noexcept
+  {
+    if constexpr (word_size == 32)
+    {
+      const uint64_t __product = static_cast<uint64_t>(__a) * static_cast<uint32_t>(__b);
+      return pair{static_cast<uint32_t>(__product >> 32), static_cast<uint32_t>(__product)};
+    }
+    else
+    {
+      return __mulhilo(__a, __b);
+    }
+  }
+
+  // Writes the outputs of the next __bulk_lanes counters to __out, leaving the engine as if __bulk_lanes * word_count
+  // values were drawn through operator(). The state is stored word-major so that every step of a round is the same
+  // operation applied to consecutive elements.
+  _CCCL_API constexpr void __philox_bulk(result_type* __out) noexcept
+  {
+    array<array<__bulk_lane_t, __bulk_lanes>, word_count> __S = {};
+    array<__bulk_lane_t, word_count / 2> __K                  = {};
+
+    _CCCL_PRAGMA_UNROLL_FULL()
+    for (size_t __k = 0; __k < word_count / 2; ++__k)
+    {
+      __K[__k] = static_cast<__bulk_lane_t>(__k_[__k]);
+    }
+
+    for (size_t __l = 0; __l < __bulk_lanes; ++__l)
+    {
+      _CCCL_PRAGMA_UNROLL_FULL()
+      for (size_t __w = 0; __w < word_count; ++__w)
+      {
+        __S[__w][__l] = static_cast<__bulk_lane_t>(__x_[__w]);
+      }
+      __increment_counter();
+    }
+
+    _CCCL_PRAGMA_UNROLL_FULL()
+    for (size_t __j = 0; __j < round_count; ++__j)
+    {
+      for (size_t __l = 0; __l < __bulk_lanes; ++__l)
+      {
+        if constexpr (word_count == 2)
+        {
+          auto [__hi, __lo] = __mulhilo_bulk(__S[0][__l], multipliers[0]);
+          __S[0][__l]       = __hi ^ __K[0] ^ __S[1][__l];
+          __S[1][__l]       = __lo;
+        }
+        else // word_count == 4
+        {
+          const __bulk_lane_t __v1 = __S[1][__l];
+          const __bulk_lane_t __v3 = __S[3][__l];
+          auto [__hi0, __lo0]      = __mulhilo_bulk(__S[2][__l], multipliers[0]);
+          auto [__hi2, __lo2]      = __mulhilo_bulk(__S[0][__l], multipliers[1]);
+          __S[0][__l]              = __hi0 ^ __K[0] ^ __v1;
+          __S[1][__l]              = __lo0;
+          __S[2][__l]              = __hi2 ^ __K[1] ^ __v3;
+          __S[3][__l]              = __lo2;
+        }
+      }
+      __K[0] = static_cast<__bulk_lane_t>((__K[0] + round_consts[0]) & max());
+      if constexpr (word_count == 4)
+      {
+        __K[1] = static_cast<__bulk_lane_t>((__K[1] + round_consts[1]) & max());
+      }
+    }
+
+    for (size_t __l = 0; __l < __bulk_lanes; ++__l)
+    {
+      _CCCL_PRAGMA_UNROLL_FULL()
+      for (size_t __w = 0; __w < word_count; ++__w)
+      {
+        __out[__l * word_count + __w] = __S[__w][__l];
+      }
+    }
+
+    // Leave the output buffer as operator() would, so that the stream state is identical
+    _CCCL_PRAGMA_UNROLL_FULL()
+    for (size_t __w = 0; __w < word_count; ++__w)
+    {
+      __y_[__w] = __S[__w][__bulk_lanes - 1];
+    }
+  }
+
   // The counter X, a big integer stored as word_count w-bit words.
   // The least significant word is __x_[0].
   array<result_type, word_count> __x_ = {};
@@ -28,6 +28,7 @@
 #include <cuda/std/__type_traits/make_unsigned.h>
 #include <cuda/std/cstddef>
 #include <cuda/std/cstdint>
+#include <cuda/std/span>
 
 #include <cuda/std/__cccl/prologue.h>
 
@@ -257,6 +258,21 @@ public:
     return static_cast<result_type>(__u + __p.a());
   }
 
+  //! Fills @c __out with the values of consecutive invocations of operator().
+  template <class _URng, size_t _Extent>
+  _CCCL_API constexpr void generate(_URng& __g, span<result_type, _Extent> __out)
+  {
+    generate(__g, __out, __p_);
+  }
+  template <class _URng, size_t _Extent>
+  _CCCL_API constexpr void generate(_URng& __g, span<result_type, _Extent> __out, const param_type& __p)
+  {
+    for (auto& __x : __out)
+    {
+      __x = (*this)(__g, __p);
+    }
+  }
+
   // property functions
   [[nodiscard]] _CCCL_API constexpr result_type a() const noexcept
   {
@@ -21,6 +21,7 @@
 #endif // no system header
 
 #include <cuda/std/__limits/numeric_limits.h>
+#include <cuda/std/__random/bulk_generate.h>
 #include <cuda/std/__random/generate_canonical.h>
 #include <cuda/std/__random/is_valid.h>
 
@@ -106,6 +107,27 @@ public:
          + __p.a();
   }
 
+  //! Fills @c __out with the values of consecutive invocations of operator(). The random bits of several values are
+  //! drawn from the engine at once.
+  template <class _URng, size_t _Extent>
+  _CCCL_API constexpr void generate(_URng& __g, span<result_type, _Extent> __out) noexcept
+  {
+    generate(__g, __out, __p_);
+  }
+  _CCCL_EXEC_CHECK_DISABLE
+  template <class _URng, size_t _Extent>
+  _CCCL_API constexpr void generate(_URng& __g, span<result_type, _Extent> __out, const param_type& __p) noexcept
+  {
+    static_assert(__cccl_random_is_valid_urng<_URng>, "URng must meet the UniformRandomBitGenerator requirements");
+    ::cuda::std::__cccl_random_generate_canonical_n(__g, __out.data(), __out.size());
+    const result_type __a     = __p.a();
+    const result_type __width = __p.b() - __p.a();
+    for (auto& __x : __out)
+    {
+      __x = __width * __x + __a;
+    }
+  }
+
   // property functions
   [[nodiscard]] _CCCL_API constexpr result_type a() const noexcept
   {
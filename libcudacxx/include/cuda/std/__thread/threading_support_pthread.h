@@ -25,6 +25,7 @@
 #  include <cuda/std/__chrono/duration.h>
 #  include <cuda/std/__utility/cmp.h>
 #  include <cuda/std/climits>
+#  include <cuda/std/cstdint>
 #  include <cuda/std/ctime>
 
 #  include <errno.h>
@@ -122,6 +123,32 @@ __cccl_semaphore_wait_timed(__cccl_semaphore_t* __sem, ::cuda::std::chrono::nano
   return sem_timedwait(__sem, &__ts) == 0;
 }
 
+#  if defined(__linux__)
+// Futex
+#    define _LIBCUDACXX_HAS_FUTEX
+
+// Blocks while the 32-bit word at __addr holds __expected, until woken up or until __timeout has elapsed. A zero
+// timeout waits indefinitely. Spurious returns are possible.
+_CCCL_API inline void
+__cccl_futex_wait(const volatile void* __addr, uint32_t __expected, ::cuda::std::chrono::nanoseconds const& __timeout)
+{
+  if (__timeout == ::cuda::std::chrono::nanoseconds::zero())
+  {
+    ::syscall(SYS_futex, __addr, FUTEX_WAIT_PRIVATE, __expected, nullptr, nullptr, 0);
+  }
+  else
+  {
+    const auto __ts = __cccl_to_timespec(__timeout);
+    ::syscall(SYS_futex, __addr, FUTEX_WAIT_PRIVATE, __expected, &__ts, nullptr, 0);
+  }
+}
+
+_CCCL_API inline void __cccl_futex_wake(const volatile void* __addr, int __count)
+{
+  ::syscall(SYS_futex, __addr, FUTEX_WAKE_PRIVATE, __count, nullptr, nullptr, 0);
+}
+#  endif // __linux__
+
 _CCCL_API inline void __cccl_thread_yield()
 {
   sched_yield();
@@ -0,0 +1,36 @@
+#include <cuda/std/__algorithm/simd_utils.h>
+#include <cuda/std/algorithm>
+#include <cuda/std/cstdint>
+
+#include "mixed_isa.h"
+
+namespace ISA_NAMESPACE
+{
+bool check_algorithms()
+{
+  constexpr std::size_t n = 300;
+  std::uint32_t lhs[n];
+  std::uint32_t rhs[n];
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    lhs[i] = static_cast<std::uint32_t>(i % 10);
+    rhs[i] = lhs[i];
+  }
+  rhs[n - 3] = 42;
+
+  return cuda::std::find(lhs, lhs + n, 7) == lhs + 7 && cuda::std::find(lhs, lhs + n, 10) == lhs + n
+      && cuda::std::count(lhs, lhs + n, 3u) == 30 && cuda::std::equal(lhs, lhs + n - 3, rhs)
+      && !cuda::std::equal(lhs, lhs + n, rhs) && cuda::std::mismatch(lhs, lhs + n, rhs).first == lhs + n - 3;
+}
+
+// The addresses of the out-of-line definitions used by this translation unit
+find_impl_t find_impl()
+{
+  return &cuda::std::__simd_find_impl<std::uint32_t>;
+}
+
+find_t find()
+{
+  return &cuda::std::__simd_find<const std::uint32_t*, int>;
+}
+} // namespace ISA_NAMESPACE
@@ -0,0 +1,26 @@
+#include <cstdio>
+
+#include "mixed_isa.h"
+
+bool check(bool condition, const char* message)
+{
+  if (!condition)
+  {
+    std::fprintf(stderr, "%s\n", message);
+  }
+  return condition;
+}
+
+int main()
+{
+  bool passed = check(baseline::check_algorithms(), "wrong results without AVX2");
+  if (__builtin_cpu_supports("avx2"))
+  {
+    passed &= check(avx2::check_algorithms(), "wrong results with AVX2");
+  }
+
+  // Each instruction set must keep its own definitions, instead of the linker picking one of them for both
+  passed &= check(baseline::find_impl() != avx2::find_impl(), "__simd_find_impl is shared between instruction sets");
+  passed &= check(baseline::find() != avx2::find(), "__simd_find is shared between instruction sets");
+  return passed ? 0 : 1;
+}
@@ -0,0 +1,25 @@
+#ifndef LIBCUDACXX_TEST_HOST_SIMD_MIXED_ISA_H
+#define LIBCUDACXX_TEST_HOST_SIMD_MIXED_ISA_H
+
+#include <cstddef>
+#include <cstdint>
+
+using find_impl_t = std::size_t (*)(const std::uint32_t*, std::size_t, std::uint32_t) noexcept;
+using find_t      = const std::uint32_t* (*) (const std::uint32_t*, const std::uint32_t*, const int&);
+
+// isa_algorithms.cpp is compiled once into each of these namespaces, with the instruction set of the same name
+namespace baseline
+{
+bool check_algorithms();
+find_impl_t find_impl();
+find_t find();
+} // namespace baseline
+
+namespace avx2
+{
+bool check_algorithms();
+find_impl_t find_impl();
+find_t find();
+} // namespace avx2
+
+#endif // LIBCUDACXX_TEST_HOST_SIMD_MIXED_ISA_H
@@ -0,0 +1,191 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// Tests the host backends of the parallel algorithms, which are enabled by compiling with OpenMP or by defining
+// CCCL_ENABLE_TBB_BACKEND
+
+#include <cuda/std/algorithm>
+#include <cuda/std/execution>
+#include <cuda/std/functional>
+#include <cuda/std/numeric>
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#include <testing.cuh>
+
+#include "test_macros.h"
+
+// large enough to be split into multiple tiles
+inline constexpr int size = 100003;
+
+struct is_even
+{
+  __host__ __device__ bool operator()(const int value) const noexcept
+  {
+    return value % 2 == 0;
+  }
+};
+
+struct same_quotient
+{
+  __host__ __device__ bool operator()(const int lhs, const int rhs) const noexcept
+  {
+    return lhs / 4 == rhs / 4;
+  }
+};
+
+struct same_quotient_less
+{
+  __host__ __device__ bool operator()(const int lhs, const int rhs) const noexcept
+  {
+    return lhs / 4 < rhs / 4;
+  }
+};
+
+std::vector<int> make_data()
+{
+  std::vector<int> data(size);
+  for (int i = 0; i < size; ++i)
+  {
+    data[i] = (i * 7919) % 1013;
+  }
+  return data;
+}
+
+template <class Policy>
+void test_host_backend(const Policy& policy)
+{
+  const std::vector<int> data = make_data();
+
+  { // reductions
+    CHECK(cuda::std::reduce(policy, data.begin(), data.end(), 42) == std::accumulate(data.begin(), data.end(), 42));
+    CHECK(cuda::std::transform_reduce(policy, data.begin(), data.end(), 0L, cuda::std::plus<>{}, cuda::std::negate<>{})
+          == -std::accumulate(data.begin(), data.end(), 0L));
+    CHECK(cuda::std::count_if(policy, data.begin(), data.end(), is_even{})
+          == std::count_if(data.begin(), data.end(), is_even{}));
+  }
+
+  { // scans, also in place
+    std::vector<int> expected(size);
+    std::vector<int> result(size);
+    std::inclusive_scan(data.begin(), data.end(), expected.begin());
+    cuda::std::inclusive_scan(policy, data.begin(), data.end(), result.begin());
+    CHECK(result == expected);
+
+    std::exclusive_scan(data.begin(), data.end(), expected.begin(), 3);
+    result = data;
+    cuda::std::exclusive_scan(policy, result.begin(), result.end(), result.begin(), 3);
+    CHECK(result == expected);
+  }
+
+  { // compaction
+    std::vector<int> expected(size);
+    std::vector<int> result(size);
+    const auto expected_end = std::copy_if(data.begin(), data.end(), expected.begin(), is_even{});
+    const auto result_end   = cuda::std::copy_if(policy, data.begin(), data.end(), result.begin(), is_even{});
+    CHECK(result_end - result.begin() == expected_end - expected.begin());
+    CHECK(std::equal(result.begin(), result_end, expected.begin()));
+
+    expected                = data;
+    result                  = data;
+    const auto expected_new = std::unique(expected.begin(), expected.end(), same_quotient{});
+    const auto result_new   = cuda::std::unique(policy, result.begin(), result.end(), same_quotient{});
+    CHECK(result_new - result.begin() == expected_new - expected.begin());
+    CHECK(std::equal(result.begin(), result_new, expected.begin()));
+  }
+
+  { // partition
+    std::vector<int> result = data;
+    const auto mid          = cuda::std::partition(policy, result.begin(), result.end(), is_even{});
+    CHECK(mid - result.begin() == std::count_if(data.begin(), data.end(), is_even{}));
+    CHECK(std::is_partitioned(result.begin(), result.end(), is_even{}));
+    CHECK(std::is_permutation(result.begin(), result.end(), data.begin()));
+  }
+
+  { // merge
+    std::vector<int> lhs = data;
+    std::vector<int> rhs(data.begin(), data.begin() + size / 3);
+    std::sort(lhs.begin(), lhs.end());
+    std::sort(rhs.begin(), rhs.end());
+
+    std::vector<int> expected(lhs.size() + rhs.size());
+    std::vector<int> result(lhs.size() + rhs.size());
+    std::merge(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), expected.begin());
+    cuda::std::merge(policy, lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), result.begin());
+    CHECK(result == expected);
+    CHECK(cuda::std::is_sorted(policy, result.begin(), result.end()));
+  }
+
+  { // sorting, with the radix sort and the merge sort
+    std::vector<int> expected = data;
+    std::vector<int> result   = data;
+    std::sort(expected.begin(), expected.end());
+    cuda::std::sort(policy, result.begin(), result.end());
+    CHECK(result == expected);
+
+    result = data;
+    cuda::std::sort(policy, result.begin(), result.end(), same_quotient_less{});
+    CHECK(std::is_sorted(result.begin(), result.end(), same_quotient_less{}));
+    CHECK(std::is_permutation(result.begin(), result.end(), data.begin()));
+
+    expected = data;
+    result   = data;
+    std::stable_sort(expected.begin(), expected.end(), same_quotient_less{});
+    cuda::std::stable_sort(policy, result.begin(), result.end(), same_quotient_less{});
+    CHECK(result == expected);
+
+    std::sort(expected.begin(), expected.end());
+    result = data;
+    cuda::std::nth_element(policy, result.begin(), result.begin() + size / 3, result.end());
+    CHECK(result[size / 3] == expected[size / 3]);
+    CHECK(std::all_of(result.begin(), result.begin() + size / 3, [&](const int value) {
+      return value <= expected[size / 3];
+    }));
+
+    result = data;
+    cuda::std::partial_sort(policy, result.begin(), result.begin() + size / 3, result.end());
+    CHECK(std::equal(result.begin(), result.begin() + size / 3, expected.begin()));
+  }
+
+  { // find returns the first match
+    std::vector<int> values(size, 1);
+    values[size / 2]     = 2;
+    values[size - 1]     = 2;
+    values[size / 4 * 3] = 3;
+    CHECK(cuda::std::find(policy, values.begin(), values.end(), 2) - values.begin() == size / 2);
+    CHECK(cuda::std::find(policy, values.begin(), values.end(), 4) == values.end());
+  }
+}
+
+C2H_TEST("cuda::std parallel algorithms on the host", "[parallel algorithm]")
+{
+#if _CCCL_HAS_BACKEND_OMP()
+  SECTION("with the OpenMP backend")
+  {
+    test_host_backend(cuda::execution::omp);
+  }
+#endif // _CCCL_HAS_BACKEND_OMP()
+
+#if _CCCL_HAS_BACKEND_TBB()
+  SECTION("with the TBB backend")
+  {
+    test_host_backend(cuda::execution::tbb);
+  }
+#endif // _CCCL_HAS_BACKEND_TBB()
+
+#if _CCCL_HAS_BACKEND_HOST()
+  SECTION("with the default host backend")
+  {
+    test_host_backend(cuda::std::execution::par);
+  }
+#endif // _CCCL_HAS_BACKEND_HOST()
+}
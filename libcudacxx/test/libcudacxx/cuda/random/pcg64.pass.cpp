@@ -10,6 +10,7 @@
 // <random>
 
 #include <cuda/__random/pcg_engine.h>
+#include <cuda/std/span>
 
 #include "random_utilities/test_engine.h"
 
@@ -121,6 +122,34 @@ __host__ __device__ constexpr bool test_against_reference()
   return true;
 }
 
+template <typename Engine>
+__host__ __device__ constexpr bool test_generate()
+{
+  // generate produces the same values and leaves the engine in the same state as consecutive calls to operator()
+  using result_type = typename Engine::result_type;
+  const int offsets[] = {0, 1, 3};
+  const int sizes[]   = {0, 1, 5, 32, 33, 100};
+  for (auto offset : offsets)
+  {
+    for (auto size : sizes)
+    {
+      Engine e1(7);
+      Engine e2(7);
+      e1.discard(offset);
+      e2.discard(offset);
+      result_type values[100] = {};
+      e1.generate(cuda::std::span<result_type>(values, size));
+      for (int i = 0; i < size; ++i)
+      {
+        assert(values[i] == e2());
+      }
+      assert(e1 == e2);
+      assert(e1() == e2());
+    }
+  }
+  return true;
+}
+
 int main(int, char**)
 {
 #if _CCCL_HAS_INT128()
@@ -129,5 +158,7 @@ int main(int, char**)
 
   test_engine<cuda::pcg64, 11135645891219275043ul>();
   test_against_reference();
+  test_generate<cuda::pcg64>();
+  static_assert(test_generate<cuda::pcg64>());
   return 0;
 }
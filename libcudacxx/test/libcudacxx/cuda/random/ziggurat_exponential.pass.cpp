@@ -0,0 +1,89 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+//
+// REQUIRES: long_tests
+
+// <cuda/random>
+
+// template<class RealType = double>
+// class ziggurat_exponential_distribution
+
+#include <cuda/random>
+#include <cuda/std/cassert>
+#include <cuda/std/cmath>
+#include <cuda/std/span>
+
+#include "random_utilities/test_distribution.h"
+#include "test_macros.h"
+
+template <class T>
+struct exponential_cdf
+{
+  using P = typename cuda::ziggurat_exponential_distribution<T>::param_type;
+
+  __host__ __device__ double operator()(double x, const P& p) const
+  {
+    if (x <= 0.0)
+    {
+      return 0.0;
+    }
+
+    // CDF of Exponential distribution: F(x; lambda) = 1 - exp(-lambda * x)
+    return 1.0 - cuda::std::exp(-p.lambda() * x);
+  }
+};
+
+template <class T, class G>
+__host__ __device__ void test_reproducible()
+{
+  using D = cuda::ziggurat_exponential_distribution<T>;
+  G g1(42);
+  G g2(42);
+  D d1(T(2));
+  D d2(T(2));
+  for (int i = 0; i < 10000; ++i)
+  {
+    const T x = d1(g1);
+    assert(x >= T(0));
+    assert(x == d2(g2));
+  }
+  assert(g1 == g2);
+
+  // generate consumes the engine exactly like operator()
+  T values[100] = {};
+  d1.generate(g1, cuda::std::span<T>(values));
+  for (auto value : values)
+  {
+    assert(value == d2(g2));
+  }
+  assert(g1 == g2);
+}
+
+template <class T>
+__host__ __device__ void test()
+{
+  [[maybe_unused]] const bool test_constexpr = false;
+  using D                                    = cuda::ziggurat_exponential_distribution<T>;
+  using P                                    = typename D::param_type;
+  using G                                    = cuda::std::philox4x64;
+  cuda::std::array<P, 5> params              = {P(T(1)), P(T(0.5)), P(T(2)), P(T(0.1)), P(T(10))};
+  test_distribution<D, true, G, test_constexpr>(params, exponential_cdf<T>{});
+
+  test_reproducible<T, cuda::std::philox4x64>();
+  test_reproducible<T, cuda::std::philox4x32>();
+  test_reproducible<T, cuda::std::minstd_rand>();
+}
+
+int main(int, char**)
+{
+  test<double>();
+  test<float>();
+  return 0;
+}
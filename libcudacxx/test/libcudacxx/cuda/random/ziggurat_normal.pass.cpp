@@ -0,0 +1,82 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+//
+// REQUIRES: long_tests
+
+// <cuda/random>
+
+// template<class RealType = double>
+// class ziggurat_normal_distribution
+
+#include <cuda/random>
+#include <cuda/std/cassert>
+#include <cuda/std/cmath>
+#include <cuda/std/span>
+
+#include "random_utilities/test_distribution.h"
+#include "test_macros.h"
+
+template <class T>
+struct normal_cdf
+{
+  using P = typename cuda::ziggurat_normal_distribution<T>::param_type;
+
+  __host__ __device__ double operator()(double x, const P& p) const
+  {
+    return 0.5 * (1 + cuda::std::erf((x - (p.mean())) / (p.stddev() * cuda::std::sqrt(2))));
+  }
+};
+
+template <class T, class G>
+__host__ __device__ void test_reproducible()
+{
+  using D = cuda::ziggurat_normal_distribution<T>;
+  G g1(42);
+  G g2(42);
+  D d1(1, 2);
+  D d2(1, 2);
+  for (int i = 0; i < 10000; ++i)
+  {
+    assert(d1(g1) == d2(g2));
+  }
+  assert(g1 == g2);
+
+  // generate consumes the engine exactly like operator()
+  T values[100] = {};
+  d1.generate(g1, cuda::std::span<T>(values));
+  for (auto value : values)
+  {
+    assert(value == d2(g2));
+  }
+  assert(g1 == g2);
+}
+
+template <class T>
+__host__ __device__ void test()
+{
+  // Can be true if/when cuda::std::exp and cuda::std::log1p are constexpr
+  const bool test_constexpr     = false;
+  using D                       = cuda::ziggurat_normal_distribution<T>;
+  using P                       = typename D::param_type;
+  using G                       = cuda::std::philox4x64;
+  cuda::std::array<P, 5> params = {P(0, 1), P(10, 2), P(-5, 0.5), P(4, 5), P(1000, 100)};
+  test_distribution<D, true, G, test_constexpr>(params, normal_cdf<T>{});
+
+  test_reproducible<T, cuda::std::philox4x64>();
+  test_reproducible<T, cuda::std::philox4x32>();
+  test_reproducible<T, cuda::std::minstd_rand>();
+}
+
+int main(int, char**)
+{
+  test<double>();
+  test<float>();
+  return 0;
+}
@@ -19,6 +19,30 @@
 #include "test_iterators.h"
 #include "test_macros.h"
 
+// long enough for every loop of the vectorized host implementation
+template <class T>
+__host__ __device__ constexpr void test_contiguous()
+{
+  constexpr int size = 300;
+  T arr[size]        = {};
+  for (int i = 0; i < size; ++i)
+  {
+    arr[i] = static_cast<T>(i % 7);
+  }
+
+  for (int v = 0; v < 7; ++v)
+  {
+    assert(cuda::std::count(arr, arr + size, static_cast<T>(v)) == (v < 6 ? 43 : 42));
+  }
+  assert(cuda::std::count(arr + 1, arr + size - 1, T(0)) == 42);
+
+  // a value the element type cannot represent matches no element
+  assert(cuda::std::count(arr, arr + size, 0x100LL) == 0);
+
+  using Iter = contiguous_iterator<const T*>;
+  assert(cuda::std::count(Iter(arr), Iter(arr + size), 3) == 43);
+}
+
 __host__ __device__ constexpr bool test()
 {
   int ia[]          = {0, 1, 2, 2, 0, 1, 2, 3};
@@ -27,6 +51,26 @@ __host__ __device__ constexpr bool test()
   assert(cuda::std::count(cpp17_input_iterator<const int*>(ia), cpp17_input_iterator<const int*>(ia + sa), 7) == 0);
   assert(cuda::std::count(cpp17_input_iterator<const int*>(ia), cpp17_input_iterator<const int*>(ia), 2) == 0);
 
+  test_contiguous<signed char>();
+  test_contiguous<unsigned char>();
+  test_contiguous<short>();
+  test_contiguous<unsigned short>();
+  test_contiguous<int>();
+  test_contiguous<unsigned>();
+  test_contiguous<long long>();
+  test_contiguous<unsigned long long>();
+
+  {
+    bool flags[100] = {};
+    for (int i = 0; i < 100; i += 3)
+    {
+      flags[i] = true;
+    }
+    assert(cuda::std::count(flags, flags + 100, true) == 34);
+    assert(cuda::std::count(flags, flags + 100, 1) == 34);
+    assert(cuda::std::count(flags, flags + 100, 2) == 0);
+  }
+
   return true;
 }
 
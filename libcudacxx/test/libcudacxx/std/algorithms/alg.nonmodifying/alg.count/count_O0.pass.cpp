@@ -0,0 +1,16 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// ADDITIONAL_COMPILE_OPTIONS_HOST: -O0
+
+// Test the vectorized host implementation without optimizations, where some compilers define the intrinsics that take
+// an immediate operand as macros.
+
+#include "count.pass.cpp"
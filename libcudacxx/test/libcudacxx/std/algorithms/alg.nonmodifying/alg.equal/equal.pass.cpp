@@ -124,6 +124,36 @@ private:
   int i_;
 };
 
+// long enough for every loop of the vectorized host implementation
+template <class T>
+__host__ __device__ constexpr void test_contiguous()
+{
+  constexpr int size = 300;
+  T a[size]          = {};
+  T b[size]          = {};
+  for (int i = 0; i < size; ++i)
+  {
+    a[i] = static_cast<T>(i % 100);
+    b[i] = static_cast<T>(i % 100);
+  }
+
+  assert(cuda::std::equal(a, a + size, b));
+  assert(cuda::std::equal(a, a + size, b, b + size));
+  assert(!cuda::std::equal(a, a + size, b, b + size - 1));
+
+  for (int i = 0; i < size; i += 23)
+  {
+    b[i] = static_cast<T>(b[i] + 1);
+    assert(!cuda::std::equal(a, a + size, b));
+    assert(!cuda::std::equal(a, a + size, b, b + size));
+    assert(cuda::std::equal(a, a + i, b));
+    b[i] = a[i];
+  }
+
+  using Iter = contiguous_iterator<const T*>;
+  assert(cuda::std::equal(Iter(a), Iter(a + size), Iter(b)));
+}
+
 __host__ __device__ constexpr bool test()
 {
   types::for_each(types::cpp17_input_iterator_list<int*>(), TestIter2<int, types::cpp17_input_iterator_list<int*>>());
@@ -138,6 +168,15 @@ __host__ __device__ constexpr bool test()
     types::cpp17_input_iterator_list<trivially_equality_comparable*>{},
     TestIter2<trivially_equality_comparable, types::cpp17_input_iterator_list<trivially_equality_comparable*>>{});
 
+  test_contiguous<signed char>();
+  test_contiguous<unsigned char>();
+  test_contiguous<short>();
+  test_contiguous<unsigned short>();
+  test_contiguous<int>();
+  test_contiguous<unsigned>();
+  test_contiguous<long long>();
+  test_contiguous<unsigned long long>();
+
   return true;
 }
 
@@ -32,6 +32,48 @@ struct Comparable
   }
 };
 
+// long enough for every loop of the vectorized host implementation
+template <class T>
+__host__ __device__ constexpr void test_contiguous()
+{
+  constexpr int size = 300;
+  T arr[size]        = {};
+  for (int i = 0; i < size; ++i)
+  {
+    arr[i] = static_cast<T>(i % 100 + 1);
+  }
+
+  for (int i = 0; i < 100; i += 9)
+  {
+    assert(cuda::std::find(arr, arr + size, static_cast<T>(i + 1)) == arr + i);
+    assert(cuda::std::find(arr + i + 1, arr + size, i + 1) == arr + i + 100);
+  }
+  assert(cuda::std::find(arr + 201, arr + size, T(1)) == arr + size);
+
+  { // a value the element type cannot represent matches no element
+    assert(cuda::std::find(arr, arr + size, 0x101LL) == arr + size);
+  }
+
+  {
+    using Iter = contiguous_iterator<const T*>;
+    Iter iter  = cuda::std::find(Iter(arr), Iter(arr + size), T(42));
+    assert(base(iter) == arr + 41);
+  }
+}
+
+__host__ __device__ constexpr void test_contiguous_pointers()
+{
+  int values[2]        = {};
+  const int* ptrs[100] = {};
+  for (int i = 70; i < 100; ++i)
+  {
+    ptrs[i] = values + 1;
+  }
+
+  assert(cuda::std::find(ptrs, ptrs + 100, static_cast<const int*>(values + 1)) == ptrs + 70);
+  assert(cuda::std::find(ptrs, ptrs + 100, static_cast<const int*>(values)) == ptrs + 100);
+}
+
 __host__ __device__ constexpr bool test()
 {
   constexpr int arr[] = {2, 4, 6, 8};
@@ -73,6 +115,16 @@ __host__ __device__ constexpr bool test()
     assert(base(iter) == arr + 4);
   }
 
+  test_contiguous<signed char>();
+  test_contiguous<unsigned char>();
+  test_contiguous<short>();
+  test_contiguous<unsigned short>();
+  test_contiguous<int>();
+  test_contiguous<unsigned>();
+  test_contiguous<long long>();
+  test_contiguous<unsigned long long>();
+  test_contiguous_pointers();
+
   return true;
 }
 
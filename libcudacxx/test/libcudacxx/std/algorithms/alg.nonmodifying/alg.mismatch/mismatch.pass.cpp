@@ -25,6 +25,37 @@
 
 TEST_DIAG_SUPPRESS_MSVC(4018) // signed/unsigned mismatch
 
+// long enough for every loop of the vectorized host implementation
+template <class T>
+__host__ __device__ constexpr void test_contiguous()
+{
+  constexpr int size = 300;
+  T a[size]          = {};
+  T b[size]          = {};
+  for (int i = 0; i < size; ++i)
+  {
+    a[i] = static_cast<T>(i % 100);
+    b[i] = static_cast<T>(i % 100);
+  }
+
+  assert(cuda::std::mismatch(a, a + size, b) == (cuda::std::pair<T*, T*>(a + size, b + size)));
+  assert(cuda::std::mismatch(a, a + size, b, b + size - 1) == (cuda::std::pair<T*, T*>(a + size - 1, b + size - 1)));
+
+  for (int i = 0; i < size; i += 23)
+  {
+    b[i] = static_cast<T>(b[i] + 1);
+    assert(cuda::std::mismatch(a, a + size, b) == (cuda::std::pair<T*, T*>(a + i, b + i)));
+    assert(cuda::std::mismatch(a, a + size, b, b + size) == (cuda::std::pair<T*, T*>(a + i, b + i)));
+    assert(cuda::std::mismatch(a, a + size, b, b + i) == (cuda::std::pair<T*, T*>(a + i, b + i)));
+    b[i] = a[i];
+  }
+
+  using Iter = contiguous_iterator<const T*>;
+  b[150]     = static_cast<T>(b[150] + 1);
+  assert(cuda::std::mismatch(Iter(a), Iter(a + size), Iter(b))
+         == (cuda::std::pair<Iter, Iter>(Iter(a + 150), Iter(b + 150))));
+}
+
 __host__ __device__ constexpr bool test()
 {
   int ia[]                           = {0, 1, 2, 2, 0, 1, 2, 3};
@@ -48,6 +79,15 @@ __host__ __device__ constexpr bool test()
   assert(cuda::std::mismatch(II(ia), II(ia + sa), II(ib), II(ib + 2))
          == (cuda::std::pair<II, II>(II(ia + 2), II(ib + 2))));
 
+  test_contiguous<signed char>();
+  test_contiguous<unsigned char>();
+  test_contiguous<short>();
+  test_contiguous<unsigned short>();
+  test_contiguous<int>();
+  test_contiguous<unsigned>();
+  test_contiguous<long long>();
+  test_contiguous<unsigned long long>();
+
   return true;
 }
 
@@ -0,0 +1,101 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// template<class ExecutionPolicy, class RandomIt>
+// void partial_sort(ExecutionPolicy&& policy, RandomIt first, RandomIt middle, RandomIt last);
+//
+// template<class ExecutionPolicy, class RandomIt, class Compare>
+// void partial_sort(ExecutionPolicy&& policy, RandomIt first, RandomIt middle, RandomIt last, Compare comp);
+
+#include <thrust/device_vector.h>
+
+#include <cuda/iterator>
+#include <cuda/memory_pool>
+#include <cuda/std/algorithm>
+#include <cuda/std/execution>
+#include <cuda/std/functional>
+#include <cuda/stream>
+
+#include <testing.cuh>
+#include <utility.cuh>
+
+inline constexpr int size = 1000;
+
+// A permutation of [0, size)
+struct scramble
+{
+  [[nodiscard]] __host__ __device__ constexpr int operator()(const int index) const noexcept
+  {
+    return (index * 7919) % size;
+  }
+};
+
+void fill_scrambled(thrust::device_vector<int>& input)
+{
+  cuda::std::copy_n(
+    cuda::execution::gpu, cuda::transform_iterator{cuda::counting_iterator{0}, scramble{}}, size, input.begin());
+}
+
+template <class Policy>
+void test_partial_sort(const Policy& policy, thrust::device_vector<int>& input)
+{
+  { // Empty does not access anything
+    cuda::std::partial_sort(
+      policy, static_cast<int*>(nullptr), static_cast<int*>(nullptr), static_cast<int*>(nullptr));
+  }
+
+  constexpr int middle = size / 3;
+  fill_scrambled(input);
+  { // default comparator
+    cuda::std::partial_sort(policy, input.begin(), input.begin() + middle, input.end());
+    CHECK(cuda::std::equal(policy, input.begin(), input.begin() + middle, cuda::counting_iterator{0}));
+  }
+
+  fill_scrambled(input);
+  { // custom comparator
+    cuda::std::partial_sort(policy, input.begin(), input.begin() + middle, input.end(), cuda::std::greater<>{});
+    CHECK(cuda::std::equal(
+      policy, input.begin(), input.begin() + middle, cuda::strided_iterator{cuda::counting_iterator{size - 1}, -1}));
+  }
+}
+
+C2H_TEST("cuda::std::partial_sort", "[parallel algorithm]")
+{
+  thrust::device_vector<int> input(size, thrust::no_init);
+
+  SECTION("with default stream")
+  {
+    const auto policy = cuda::execution::gpu;
+    test_partial_sort(policy, input);
+  }
+
+  SECTION("with provided stream")
+  {
+    cuda::stream stream{cuda::device_ref{0}};
+    const auto policy = cuda::execution::gpu.with(cuda::get_stream, stream);
+    test_partial_sort(policy, input);
+  }
+
+  SECTION("with provided memory_resource")
+  {
+    cuda::device_memory_pool_ref device_resource = cuda::device_default_memory_pool(cuda::device_ref{0});
+    const auto policy = cuda::execution::gpu.with(cuda::mr::get_memory_resource, device_resource);
+    test_partial_sort(policy, input);
+  }
+
+  SECTION("with provided stream and memory_resource")
+  {
+    cuda::stream stream{cuda::device_ref{0}};
+    cuda::device_memory_pool_ref device_resource = cuda::device_default_memory_pool(stream.device());
+    const auto policy =
+      cuda::execution::gpu.with(cuda::mr::get_memory_resource, device_resource).with(cuda::get_stream, stream);
+    test_partial_sort(policy, input);
+  }
+}
@@ -0,0 +1,112 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// template<class ExecutionPolicy, class RandomIt>
+// void stable_sort(ExecutionPolicy&& policy, RandomIt first, RandomIt last);
+//
+// template<class ExecutionPolicy, class RandomIt, class Compare>
+// void stable_sort(ExecutionPolicy&& policy, RandomIt first, RandomIt last, Compare comp);
+
+#include <thrust/device_vector.h>
+#include <thrust/host_vector.h>
+
+#include <cuda/iterator>
+#include <cuda/memory_pool>
+#include <cuda/std/algorithm>
+#include <cuda/std/execution>
+#include <cuda/std/functional>
+#include <cuda/stream>
+
+#include <algorithm>
+
+#include <testing.cuh>
+#include <utility.cuh>
+
+inline constexpr int size = 1000;
+
+// A permutation of [0, size)
+struct scramble
+{
+  [[nodiscard]] __host__ __device__ constexpr int operator()(const int index) const noexcept
+  {
+    return (index * 7919) % size;
+  }
+};
+
+struct less_by_last_digit
+{
+  [[nodiscard]] __host__ __device__ constexpr bool operator()(const int lhs, const int rhs) const noexcept
+  {
+    return lhs % 10 < rhs % 10;
+  }
+};
+
+void fill_scrambled(thrust::device_vector<int>& input)
+{
+  cuda::std::copy_n(
+    cuda::execution::gpu, cuda::transform_iterator{cuda::counting_iterator{0}, scramble{}}, size, input.begin());
+}
+
+template <class Policy>
+void test_stable_sort(const Policy& policy, thrust::device_vector<int>& input)
+{
+  { // Empty does not access anything
+    cuda::std::stable_sort(policy, static_cast<int*>(nullptr), static_cast<int*>(nullptr));
+  }
+
+  fill_scrambled(input);
+  { // radix sort
+    cuda::std::stable_sort(policy, input.begin(), input.end());
+    CHECK(cuda::std::equal(policy, input.begin(), input.end(), cuda::counting_iterator{0}));
+  }
+
+  fill_scrambled(input);
+  { // merge sort keeps equivalent elements in order
+    thrust::host_vector<int> expected = input;
+    std::stable_sort(expected.begin(), expected.end(), less_by_last_digit{});
+
+    cuda::std::stable_sort(policy, input.begin(), input.end(), less_by_last_digit{});
+    CHECK(thrust::host_vector<int>(input) == expected);
+  }
+}
+
+C2H_TEST("cuda::std::stable_sort", "[parallel algorithm]")
+{
+  thrust::device_vector<int> input(size, thrust::no_init);
+
+  SECTION("with default stream")
+  {
+    const auto policy = cuda::execution::gpu;
+    test_stable_sort(policy, input);
+  }
+
+  SECTION("with provided stream")
+  {
+    cuda::stream stream{cuda::device_ref{0}};
+    const auto policy = cuda::execution::gpu.with(cuda::get_stream, stream);
+    test_stable_sort(policy, input);
+  }
+
+  SECTION("with provided memory_resource")
+  {
+    cuda::device_memory_pool_ref device_resource = cuda::device_default_memory_pool(cuda::device_ref{0});
+    const auto policy = cuda::execution::gpu.with(cuda::mr::get_memory_resource, device_resource);
+    test_stable_sort(policy, input);
+  }
+
+  SECTION("with provided stream and memory_resource")
+  {
+    cuda::stream stream{cuda::device_ref{0}};
+    cuda::device_memory_pool_ref device_resource = cuda::device_default_memory_pool(stream.device());
+    const auto policy =
+      cuda::execution::gpu.with(cuda::mr::get_memory_resource, device_resource).with(cuda::get_stream, stream);
+    test_stable_sort(policy, input);
+  }
+}
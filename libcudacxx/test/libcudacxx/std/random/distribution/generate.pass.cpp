@@ -0,0 +1,84 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// <random>
+
+// template<class URng, size_t Extent>
+// void generate(URng& g, span<result_type, Extent> out);
+// template<class URng, size_t Extent>
+// void generate(URng& g, span<result_type, Extent> out, const param_type& p);
+
+#include <cuda/std/cassert>
+#include <cuda/std/random>
+#include <cuda/std/span>
+
+#include "test_macros.h"
+
+// generate produces the same values as consecutive calls to operator() and consumes the same random numbers
+template <class D, class G>
+__host__ __device__ void test_generate_param(const typename D::param_type& p)
+{
+  using result_type = typename D::result_type;
+  constexpr int n   = 100;
+  const int sizes[] = {0, 1, 7, 32, 33, n};
+  for (auto size : sizes)
+  {
+    G g1(42);
+    G g2(42);
+    D d1(p);
+    D d2(p);
+    result_type values[n] = {};
+    d1.generate(g1, cuda::std::span<result_type>(values, size));
+    for (int i = 0; i < size; ++i)
+    {
+      assert(values[i] == d2(g2));
+    }
+    assert(g1 == g2);
+
+    d1.param(typename D::param_type{});
+    d1.generate(g1, cuda::std::span<result_type, n>(values), p);
+    for (int i = 0; i < n; ++i)
+    {
+      assert(values[i] == d2(g2));
+    }
+    assert(g1 == g2);
+  }
+}
+
+template <class D, class G, class... Args>
+__host__ __device__ void test_generate(Args... args)
+{
+  test_generate_param<D, G>(typename D::param_type(args...));
+}
+
+template <class G>
+__host__ __device__ void test()
+{
+  test_generate<cuda::std::uniform_int_distribution<int>, G>(-5, 100);
+  test_generate<cuda::std::uniform_int_distribution<unsigned long long>, G>();
+  test_generate<cuda::std::uniform_real_distribution<float>, G>(-1.0f, 3.0f);
+  test_generate<cuda::std::uniform_real_distribution<double>, G>(-1.0, 3.0);
+  test_generate<cuda::std::normal_distribution<float>, G>(1.0f, 2.0f);
+  test_generate<cuda::std::normal_distribution<double>, G>(1.0, 2.0);
+  test_generate<cuda::std::exponential_distribution<float>, G>(2.0f);
+  test_generate<cuda::std::exponential_distribution<double>, G>(2.0);
+#if _CCCL_HAS_LONG_DOUBLE()
+  test_generate<cuda::std::uniform_real_distribution<long double>, G>(-1.0L, 3.0L);
+  test_generate<cuda::std::exponential_distribution<long double>, G>(2.0L);
+#endif // _CCCL_HAS_LONG_DOUBLE()
+}
+
+int main(int, char**)
+{
+  test<cuda::std::philox4x32>();
+  test<cuda::std::philox4x64>();
+  test<cuda::std::minstd_rand>();
+  return 0;
+}
@@ -9,6 +9,7 @@
 //===----------------------------------------------------------------------===//
 
 #include <cuda/std/random>
+#include <cuda/std/span>
 
 #include "random_utilities/test_engine.h"
 
@@ -78,6 +79,34 @@ __host__ __device__ TEST_CONSTEXPR_CXX20 bool test_against_reference()
   return true;
 }
 
+template <typename Engine>
+__host__ __device__ TEST_CONSTEXPR_CXX20 bool test_generate()
+{
+  // generate produces the same values and leaves the engine in the same state as consecutive calls to operator()
+  using result_type = typename Engine::result_type;
+  const int offsets[] = {0, 1, 3};
+  const int sizes[]   = {0, 1, 5, 32, 33, 100};
+  for (auto offset : offsets)
+  {
+    for (auto size : sizes)
+    {
+      Engine e1(7);
+      Engine e2(7);
+      e1.discard(offset);
+      e2.discard(offset);
+      result_type values[100] = {};
+      e1.generate(cuda::std::span<result_type>(values, size));
+      for (int i = 0; i < size; ++i)
+      {
+        assert(values[i] == e2());
+      }
+      assert(e1 == e2);
+      assert(e1() == e2());
+    }
+  }
+  return true;
+}
+
 __host__ __device__ TEST_CONSTEXPR_CXX20 bool test()
 {
   test_engine<cuda::std::philox4x32, 1955073260u>();
@@ -85,10 +114,14 @@ __host__ __device__ TEST_CONSTEXPR_CXX20 bool test()
   test_set_counter<cuda::std::philox4x32>();
   test_set_counter<cuda::std::philox4x64>();
   test_against_reference();
+  test_generate<cuda::std::philox4x32>();
+  test_generate<cuda::std::philox4x64>();
 #if TEST_STD_VER >= 2020
   static_assert(test_set_counter<cuda::std::philox4x32>());
   static_assert(test_set_counter<cuda::std::philox4x64>());
   static_assert(test_against_reference());
+  static_assert(test_generate<cuda::std::philox4x32>());
+  static_assert(test_generate<cuda::std::philox4x64>());
 #endif
   return true;
 }
@@ -0,0 +1,533 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/std/array>
+#include <cuda/std/charconv>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstring>
+#include <cuda/std/limits>
+#include <cuda/std/type_traits>
+
+#include "test_macros.h"
+
+struct TestItem
+{
+  const char* str;
+  cuda::std::chars_format fmt;
+  cuda::std::ptrdiff_t ptr_offset;
+  cuda::std::errc ec;
+  double val;
+};
+
+// Source code for the generation of the test items
+// #include <charconv>
+// #include <cstdio>
+// #include <cstring>
+
+// constexpr const char* list[] = {
+//   "0", "-0.0", "1", "0.1", "1e23", ... // the strings of the test items
+// };
+
+// int main()
+// {
+//   for (auto fmt : {std::chars_format::scientific, std::chars_format::fixed, std::chars_format::general,
+//                    std::chars_format::hex})
+//   {
+//     for (auto str : list)
+//     {
+//       double value{};
+//       const auto r = std::from_chars(str, str + std::strlen(str), value, fmt);
+//       std::printf("TestItem{\"%s\", %d, %d, %d, %a},\n", str, int(fmt), int(r.ptr - str), int(r.ec), value);
+//     }
+//   }
+// }
+
+constexpr cuda::std::size_t num_test_items = 180;
+
+__host__ __device__ constexpr cuda::std::array<TestItem, num_test_items> get_test_items()
+{
+  return {{
+    TestItem{"0", cuda::std::chars_format::scientific, 0, cuda::std::errc::invalid_argument, 0.0},
+    TestItem{"-0.0", cuda::std::chars_format::scientific, 0, cuda::std::errc::invalid_argument, 0.0},
+    TestItem{"1", cuda::std::chars_format::scientific, 0, cuda::std::errc::invalid_argument, 0.0},
+    TestItem{"0.1", cuda::std::chars_format::scientific, 0, cuda::std::errc::invalid_argument, 0.0},
+    TestItem{"1e23", cuda::std::chars_format::scientific, 4, cuda::std::errc{}, 0x1.52d02c7e14af6p+76},
+    TestItem{"123.456e-2", cuda::std::chars_format::scientific, 10, cuda::std::errc{}, 0x1.3c0c1fc8f3238p+0},
+    TestItem{"2.5E+3", cuda::std::chars_format::scientific, 6, cuda::std::errc{}, 0x1.388p+11},
+    TestItem{"1e", cuda::std::chars_format::scientific, 0, cuda::std::errc::invalid_argument, 0.0},
+    TestItem{"1e+", cuda::std::chars_format::scientific, 0, cuda::std::errc::invalid_argument, 0.0},
+    TestItem{"7e-", cuda::std::chars_format::scientific, 0, cuda::std::errc::invalid_argument, 0.0},
+    TestItem{".5", cuda::std::chars_format::scientific, 0, cuda::std::errc::invalid_argument, 0.0},
+    TestItem{"5.", cuda::std::chars_format::scientific, 0, cuda::std::errc::invalid_argument, 0.0},
+    TestItem{".", cuda::std::chars_format::scientific, 0, cuda::std::errc::invalid_argument, 0.0},
+    TestItem{"-", cuda::std::chars_format::scientific, 0, cuda::std::errc::invalid_argument, 0.0},
+    TestItem{"+1", cuda::std::chars_format::scientific, 0, cuda::std::errc::invalid_argument, 0.0},
+    TestItem{"e5", cuda::std::chars_format::scientific, 0, cuda::std::errc::invalid_argument, 0.0},
+    TestItem{" 1", cuda::std::chars_format::scientific, 0, cuda::std::errc::invalid_argument, 0.0},
+    TestItem{"0x1p3", cuda::std::chars_format::scientific, 0, cuda::std::errc::invalid_argument, 0.0},
+    TestItem{"1p-2", cuda::std::chars_format::scientific, 0, cuda::std::errc::invalid_argument, 0.0},
+    TestItem{"1.8p1", cuda::std::chars_format::scientific, 0, cuda::std::errc::invalid_argument, 0.0},
+    TestItem{"fffp-4", cuda::std::chars_format::scientific, 0, cuda::std::errc::invalid_argument, 0.0},
+    TestItem{"inf",
+             cuda::std::chars_format::scientific,
+             3,
+             cuda::std::errc{},
+             cuda::std::numeric_limits<double>::infinity()},
+    TestItem{"-Infinity",
+             cuda::std::chars_format::scientific,
+             9,
+             cuda::std::errc{},
+             -cuda::std::numeric_limits<double>::infinity()},
+    TestItem{"infinit",
+             cuda::std::chars_format::scientific,
+             3,
+             cuda::std::errc{},
+             cuda::std::numeric_limits<double>::infinity()},
+    TestItem{"nan",
+             cuda::std::chars_format::scientific,
+             3,
+             cuda::std::errc{},
+             cuda::std::numeric_limits<double>::quiet_NaN()},
+    TestItem{"-nan",
+             cuda::std::chars_format::scientific,
+             4,
+             cuda::std::errc{},
+             -cuda::std::numeric_limits<double>::quiet_NaN()},
+    TestItem{"nan(123_abc)",
+             cuda::std::chars_format::scientific,
+             12,
+             cuda::std::errc{},
+             cuda::std::numeric_limits<double>::quiet_NaN()},
+    TestItem{"nan(1",
+             cuda::std::chars_format::scientific,
+             3,
+             cuda::std::errc{},
+             cuda::std::numeric_limits<double>::quiet_NaN()},
+    TestItem{"1e400", cuda::std::chars_format::scientific, 5, cuda::std::errc::result_out_of_range, 0.0},
+    TestItem{"-1e400", cuda::std::chars_format::scientific, 6, cuda::std::errc::result_out_of_range, 0.0},
+    TestItem{"1e-400", cuda::std::chars_format::scientific, 6, cuda::std::errc::result_out_of_range, 0.0},
+    TestItem{"4.9406564584124654e-324",
+             cuda::std::chars_format::scientific,
+             23,
+             cuda::std::errc{},
+             0x0.0000000000001p-1022},
+    TestItem{"2.4703282292062327e-324",
+             cuda::std::chars_format::scientific,
+             23,
+             cuda::std::errc::result_out_of_range,
+             0.0},
+    TestItem{"2.4703282292062328e-324",
+             cuda::std::chars_format::scientific,
+             23,
+             cuda::std::errc{},
+             0x0.0000000000001p-1022},
+    TestItem{"1.7976931348623157e308",
+             cuda::std::chars_format::scientific,
+             22,
+             cuda::std::errc{},
+             0x1.fffffffffffffp+1023},
+    TestItem{"1.7976931348623158e308",
+             cuda::std::chars_format::scientific,
+             22,
+             cuda::std::errc{},
+             0x1.fffffffffffffp+1023},
+    TestItem{"1.7976931348623159e308",
+             cuda::std::chars_format::scientific,
+             22,
+             cuda::std::errc::result_out_of_range,
+             0.0},
+    TestItem{"9007199254740993", cuda::std::chars_format::scientific, 0, cuda::std::errc::invalid_argument, 0.0},
+    TestItem{"9007199254740993.000000000000000000000001",
+             cuda::std::chars_format::scientific,
+             0,
+             cuda::std::errc::invalid_argument,
+             0.0},
+    TestItem{"3.14159265358979323846264338327950288419716939937510582097494459",
+             cuda::std::chars_format::scientific,
+             0,
+             cuda::std::errc::invalid_argument,
+             0.0},
+    TestItem{"0.000000000000000000000000000000000000000001234",
+             cuda::std::chars_format::scientific,
+             0,
+             cuda::std::errc::invalid_argument,
+             0.0},
+    TestItem{"1p-1075", cuda::std::chars_format::scientific, 0, cuda::std::errc::invalid_argument, 0.0},
+    TestItem{"1.00000000000000000000001p-1075",
+             cuda::std::chars_format::scientific,
+             0,
+             cuda::std::errc::invalid_argument,
+             0.0},
+    TestItem{"1.fffffffffffff8p1023", cuda::std::chars_format::scientific, 0, cuda::std::errc::invalid_argument, 0.0},
+    TestItem{"0.0000000000001p-1022", cuda::std::chars_format::scientific, 0, cuda::std::errc::invalid_argument, 0.0},
+    TestItem{"0", cuda::std::chars_format::fixed, 1, cuda::std::errc{}, 0x0p+0},
+    TestItem{"-0.0", cuda::std::chars_format::fixed, 4, cuda::std::errc{}, -0x0p+0},
+    TestItem{"1", cuda::std::chars_format::fixed, 1, cuda::std::errc{}, 0x1p+0},
+    TestItem{"0.1", cuda::std::chars_format::fixed, 3, cuda::std::errc{}, 0x1.999999999999ap-4},
+    TestItem{"1e23", cuda::std::chars_format::fixed, 1, cuda::std::errc{}, 0x1p+0},
+    TestItem{"123.456e-2", cuda::std::chars_format::fixed, 7, cuda::std::errc{}, 0x1.edd2f1a9fbe77p+6},
+    TestItem{"2.5E+3", cuda::std::chars_format::fixed, 3, cuda::std::errc{}, 0x1.4p+1},
+    TestItem{"1e", cuda::std::chars_format::fixed, 1, cuda::std::errc{}, 0x1p+0},
+    TestItem{"1e+", cuda::std::chars_format::fixed, 1, cuda::std::errc{}, 0x1p+0},
+    TestItem{"7e-", cuda::std::chars_format::fixed, 1, cuda::std::errc{}, 0x1.cp+2},
+    TestItem{".5", cuda::std::chars_format::fixed, 2, cuda::std::errc{}, 0x1p-1},
+    TestItem{"5.", cuda::std::chars_format::fixed, 2, cuda::std::errc{}, 0x1.4p+2},
+    TestItem{".", cuda::std::chars_format::fixed, 0, cuda::std::errc::invalid_argument, 0.0},
+    TestItem{"-", cuda::std::chars_format::fixed, 0, cuda::std::errc::invalid_argument, 0.0},
+    TestItem{"+1", cuda::std::chars_format::fixed, 0, cuda::std::errc::invalid_argument, 0.0},
+    TestItem{"e5", cuda::std::chars_format::fixed, 0, cuda::std::errc::invalid_argument, 0.0},
+    TestItem{" 1", cuda::std::chars_format::fixed, 0, cuda::std::errc::invalid_argument, 0.0},
+    TestItem{"0x1p3", cuda::std::chars_format::fixed, 1, cuda::std::errc{}, 0x0p+0},
+    TestItem{"1p-2", cuda::std::chars_format::fixed, 1, cuda::std::errc{}, 0x1p+0},
+    TestItem{"1.8p1", cuda::std::chars_format::fixed, 3, cuda::std::errc{}, 0x1.ccccccccccccdp+0},
+    TestItem{"fffp-4", cuda::std::chars_format::fixed, 0, cuda::std::errc::invalid_argument, 0.0},
+    TestItem{"inf",
+             cuda::std::chars_format::fixed,
+             3,
+             cuda::std::errc{},
+             cuda::std::numeric_limits<double>::infinity()},
+    TestItem{"-Infinity",
+             cuda::std::chars_format::fixed,
+             9,
+             cuda::std::errc{},
+             -cuda::std::numeric_limits<double>::infinity()},
+    TestItem{"infinit",
+             cuda::std::chars_format::fixed,
+             3,
+             cuda::std::errc{},
+             cuda::std::numeric_limits<double>::infinity()},
+    TestItem{"nan",
+             cuda::std::chars_format::fixed,
+             3,
+             cuda::std::errc{},
+             cuda::std::numeric_limits<double>::quiet_NaN()},
+    TestItem{"-nan",
+             cuda::std::chars_format::fixed,
+             4,
+             cuda::std::errc{},
+             -cuda::std::numeric_limits<double>::quiet_NaN()},
+    TestItem{"nan(123_abc)",
+             cuda::std::chars_format::fixed,
+             12,
+             cuda::std::errc{},
+             cuda::std::numeric_limits<double>::quiet_NaN()},
+    TestItem{"nan(1",
+             cuda::std::chars_format::fixed,
+             3,
+             cuda::std::errc{},
+             cuda::std::numeric_limits<double>::quiet_NaN()},
+    TestItem{"1e400", cuda::std::chars_format::fixed, 1, cuda::std::errc{}, 0x1p+0},
+    TestItem{"-1e400", cuda::std::chars_format::fixed, 2, cuda::std::errc{}, -0x1p+0},
+    TestItem{"1e-400", cuda::std::chars_format::fixed, 1, cuda::std::errc{}, 0x1p+0},
+    TestItem{"4.9406564584124654e-324", cuda::std::chars_format::fixed, 18, cuda::std::errc{}, 0x1.3c33b72569c63p+2},
+    TestItem{"2.4703282292062327e-324", cuda::std::chars_format::fixed, 18, cuda::std::errc{}, 0x1.3c33b72569c63p+1},
+    TestItem{"2.4703282292062328e-324", cuda::std::chars_format::fixed, 18, cuda::std::errc{}, 0x1.3c33b72569c64p+1},
+    TestItem{"1.7976931348623157e308", cuda::std::chars_format::fixed, 18, cuda::std::errc{}, 0x1.cc359e067a348p+0},
+    TestItem{"1.7976931348623158e308", cuda::std::chars_format::fixed, 18, cuda::std::errc{}, 0x1.cc359e067a348p+0},
+    TestItem{"1.7976931348623159e308", cuda::std::chars_format::fixed, 18, cuda::std::errc{}, 0x1.cc359e067a349p+0},
+    TestItem{"9007199254740993", cuda::std::chars_format::fixed, 16, cuda::std::errc{}, 0x1p+53},
+    TestItem{"9007199254740993.000000000000000000000001",
+             cuda::std::chars_format::fixed,
+             41,
+             cuda::std::errc{},
+             0x1.0000000000001p+53},
+    TestItem{"3.14159265358979323846264338327950288419716939937510582097494459",
+             cuda::std::chars_format::fixed,
+             64,
+             cuda::std::errc{},
+             0x1.921fb54442d18p+1},
+    TestItem{"0.000000000000000000000000000000000000000001234",
+             cuda::std::chars_format::fixed,
+             47,
+             cuda::std::errc{},
+             0x1.b84e5053d481cp-140},
+    TestItem{"1p-1075", cuda::std::chars_format::fixed, 1, cuda::std::errc{}, 0x1p+0},
+    TestItem{"1.00000000000000000000001p-1075", cuda::std::chars_format::fixed, 25, cuda::std::errc{}, 0x1p+0},
+    TestItem{"1.fffffffffffff8p1023", cuda::std::chars_format::fixed, 2, cuda::std::errc{}, 0x1p+0},
+    TestItem{"0.0000000000001p-1022", cuda::std::chars_format::fixed, 15, cuda::std::errc{}, 0x1.c25c268497682p-44},
+    TestItem{"0", cuda::std::chars_format::general, 1, cuda::std::errc{}, 0x0p+0},
+    TestItem{"-0.0", cuda::std::chars_format::general, 4, cuda::std::errc{}, -0x0p+0},
+    TestItem{"1", cuda::std::chars_format::general, 1, cuda::std::errc{}, 0x1p+0},
+    TestItem{"0.1", cuda::std::chars_format::general, 3, cuda::std::errc{}, 0x1.999999999999ap-4},
+    TestItem{"1e23", cuda::std::chars_format::general, 4, cuda::std::errc{}, 0x1.52d02c7e14af6p+76},
+    TestItem{"123.456e-2", cuda::std::chars_format::general, 10, cuda::std::errc{}, 0x1.3c0c1fc8f3238p+0},
+    TestItem{"2.5E+3", cuda::std::chars_format::general, 6, cuda::std::errc{}, 0x1.388p+11},
+    TestItem{"1e", cuda::std::chars_format::general, 1, cuda::std::errc{}, 0x1p+0},
+    TestItem{"1e+", cuda::std::chars_format::general, 1, cuda::std::errc{}, 0x1p+0},
+    TestItem{"7e-", cuda::std::chars_format::general, 1, cuda::std::errc{}, 0x1.cp+2},
+    TestItem{".5", cuda::std::chars_format::general, 2, cuda::std::errc{}, 0x1p-1},
+    TestItem{"5.", cuda::std::chars_format::general, 2, cuda::std::errc{}, 0x1.4p+2},
+    TestItem{".", cuda::std::chars_format::general, 0, cuda::std::errc::invalid_argument, 0.0},
+    TestItem{"-", cuda::std::chars_format::general, 0, cuda::std::errc::invalid_argument, 0.0},
+    TestItem{"+1", cuda::std::chars_format::general, 0, cuda::std::errc::invalid_argument, 0.0},
+    TestItem{"e5", cuda::std::chars_format::general, 0, cuda::std::errc::invalid_argument, 0.0},
+    TestItem{" 1", cuda::std::chars_format::general, 0, cuda::std::errc::invalid_argument, 0.0},
+    TestItem{"0x1p3", cuda::std::chars_format::general, 1, cuda::std::errc{}, 0x0p+0},
+    TestItem{"1p-2", cuda::std::chars_format::general, 1, cuda::std::errc{}, 0x1p+0},
+    TestItem{"1.8p1", cuda::std::chars_format::general, 3, cuda::std::errc{}, 0x1.ccccccccccccdp+0},
+    TestItem{"fffp-4", cuda::std::chars_format::general, 0, cuda::std::errc::invalid_argument, 0.0},
+    TestItem{"inf",
+             cuda::std::chars_format::general,
+             3,
+             cuda::std::errc{},
+             cuda::std::numeric_limits<double>::infinity()},
+    TestItem{"-Infinity",
+             cuda::std::chars_format::general,
+             9,
+             cuda::std::errc{},
+             -cuda::std::numeric_limits<double>::infinity()},
+    TestItem{"infinit",
+             cuda::std::chars_format::general,
+             3,
+             cuda::std::errc{},
+             cuda::std::numeric_limits<double>::infinity()},
+    TestItem{"nan",
+             cuda::std::chars_format::general,
+             3,
+             cuda::std::errc{},
+             cuda::std::numeric_limits<double>::quiet_NaN()},
+    TestItem{"-nan",
+             cuda::std::chars_format::general,
+             4,
+             cuda::std::errc{},
+             -cuda::std::numeric_limits<double>::quiet_NaN()},
+    TestItem{"nan(123_abc)",
+             cuda::std::chars_format::general,
+             12,
+             cuda::std::errc{},
+             cuda::std::numeric_limits<double>::quiet_NaN()},
+    TestItem{"nan(1",
+             cuda::std::chars_format::general,
+             3,
+             cuda::std::errc{},
+             cuda::std::numeric_limits<double>::quiet_NaN()},
+    TestItem{"1e400", cuda::std::chars_format::general, 5, cuda::std::errc::result_out_of_range, 0.0},
+    TestItem{"-1e400", cuda::std::chars_format::general, 6, cuda::std::errc::result_out_of_range, 0.0},
+    TestItem{"1e-400", cuda::std::chars_format::general, 6, cuda::std::errc::result_out_of_range, 0.0},
+    TestItem{"4.9406564584124654e-324",
+             cuda::std::chars_format::general,
+             23,
+             cuda::std::errc{},
+             0x0.0000000000001p-1022},
+    TestItem{"2.4703282292062327e-324",
+             cuda::std::chars_format::general,
+             23,
+             cuda::std::errc::result_out_of_range,
+             0.0},
+    TestItem{"2.4703282292062328e-324",
+             cuda::std::chars_format::general,
+             23,
+             cuda::std::errc{},
+             0x0.0000000000001p-1022},
+    TestItem{"1.7976931348623157e308",
+             cuda::std::chars_format::general,
+             22,
+             cuda::std::errc{},
+             0x1.fffffffffffffp+1023},
+    TestItem{"1.7976931348623158e308",
+             cuda::std::chars_format::general,
+             22,
+             cuda::std::errc{},
+             0x1.fffffffffffffp+1023},
+    TestItem{"1.7976931348623159e308", cuda::std::chars_format::general, 22, cuda::std::errc::result_out_of_range, 0.0},
+    TestItem{"9007199254740993", cuda::std::chars_format::general, 16, cuda::std::errc{}, 0x1p+53},
+    TestItem{"9007199254740993.000000000000000000000001",
+             cuda::std::chars_format::general,
+             41,
+             cuda::std::errc{},
+             0x1.0000000000001p+53},
+    TestItem{"3.14159265358979323846264338327950288419716939937510582097494459",
+             cuda::std::chars_format::general,
+             64,
+             cuda::std::errc{},
+             0x1.921fb54442d18p+1},
+    TestItem{"0.000000000000000000000000000000000000000001234",
+             cuda::std::chars_format::general,
+             47,
+             cuda::std::errc{},
+             0x1.b84e5053d481cp-140},
+    TestItem{"1p-1075", cuda::std::chars_format::general, 1, cuda::std::errc{}, 0x1p+0},
+    TestItem{"1.00000000000000000000001p-1075", cuda::std::chars_format::general, 25, cuda::std::errc{}, 0x1p+0},
+    TestItem{"1.fffffffffffff8p1023", cuda::std::chars_format::general, 2, cuda::std::errc{}, 0x1p+0},
+    TestItem{"0.0000000000001p-1022", cuda::std::chars_format::general, 15, cuda::std::errc{}, 0x1.c25c268497682p-44},
+    TestItem{"0", cuda::std::chars_format::hex, 1, cuda::std::errc{}, 0x0p+0},
+    TestItem{"-0.0", cuda::std::chars_format::hex, 4, cuda::std::errc{}, -0x0p+0},
+    TestItem{"1", cuda::std::chars_format::hex, 1, cuda::std::errc{}, 0x1p+0},
+    TestItem{"0.1", cuda::std::chars_format::hex, 3, cuda::std::errc{}, 0x1p-4},
+    TestItem{"1e23", cuda::std::chars_format::hex, 4, cuda::std::errc{}, 0x1.e23p+12},
+    TestItem{"123.456e-2", cuda::std::chars_format::hex, 8, cuda::std::errc{}, 0x1.23456ep+8},
+    TestItem{"2.5E+3", cuda::std::chars_format::hex, 4, cuda::std::errc{}, 0x1.2fp+1},
+    TestItem{"1e", cuda::std::chars_format::hex, 2, cuda::std::errc{}, 0x1.ep+4},
+    TestItem{"1e+", cuda::std::chars_format::hex, 2, cuda::std::errc{}, 0x1.ep+4},
+    TestItem{"7e-", cuda::std::chars_format::hex, 2, cuda::std::errc{}, 0x1.f8p+6},
+    TestItem{".5", cuda::std::chars_format::hex, 2, cuda::std::errc{}, 0x1.4p-2},
+    TestItem{"5.", cuda::std::chars_format::hex, 2, cuda::std::errc{}, 0x1.4p+2},
+    TestItem{".", cuda::std::chars_format::hex, 0, cuda::std::errc::invalid_argument, 0.0},
+    TestItem{"-", cuda::std::chars_format::hex, 0, cuda::std::errc::invalid_argument, 0.0},
+    TestItem{"+1", cuda::std::chars_format::hex, 0, cuda::std::errc::invalid_argument, 0.0},
+    TestItem{"e5", cuda::std::chars_format::hex, 2, cuda::std::errc{}, 0x1.cap+7},
+    TestItem{" 1", cuda::std::chars_format::hex, 0, cuda::std::errc::invalid_argument, 0.0},
+    TestItem{"0x1p3", cuda::std::chars_format::hex, 1, cuda::std::errc{}, 0x0p+0},
+    TestItem{"1p-2", cuda::std::chars_format::hex, 4, cuda::std::errc{}, 0x1p-2},
+    TestItem{"1.8p1", cuda::std::chars_format::hex, 5, cuda::std::errc{}, 0x1.8p+1},
+    TestItem{"fffp-4", cuda::std::chars_format::hex, 6, cuda::std::errc{}, 0x1.ffep+7},
+    TestItem{"inf", cuda::std::chars_format::hex, 3, cuda::std::errc{}, cuda::std::numeric_limits<double>::infinity()},
+    TestItem{"-Infinity",
+             cuda::std::chars_format::hex,
+             9,
+             cuda::std::errc{},
+             -cuda::std::numeric_limits<double>::infinity()},
+    TestItem{"infinit",
+             cuda::std::chars_format::hex,
+             3,
+             cuda::std::errc{},
+             cuda::std::numeric_limits<double>::infinity()},
+    TestItem{"nan", cuda::std::chars_format::hex, 3, cuda::std::errc{}, cuda::std::numeric_limits<double>::quiet_NaN()},
+    TestItem{"-nan",
+             cuda::std::chars_format::hex,
+             4,
+             cuda::std::errc{},
+             -cuda::std::numeric_limits<double>::quiet_NaN()},
+    TestItem{"nan(123_abc)",
+             cuda::std::chars_format::hex,
+             12,
+             cuda::std::errc{},
+             cuda::std::numeric_limits<double>::quiet_NaN()},
+    TestItem{"nan(1",
+             cuda::std::chars_format::hex,
+             3,
+             cuda::std::errc{},
+             cuda::std::numeric_limits<double>::quiet_NaN()},
+    TestItem{"1e400", cuda::std::chars_format::hex, 5, cuda::std::errc{}, 0x1.e4p+16},
+    TestItem{"-1e400", cuda::std::chars_format::hex, 6, cuda::std::errc{}, -0x1.e4p+16},
+    TestItem{"1e-400", cuda::std::chars_format::hex, 2, cuda::std::errc{}, 0x1.ep+4},
+    TestItem{"4.9406564584124654e-324", cuda::std::chars_format::hex, 19, cuda::std::errc{}, 0x1.2501959161049p+2},
+    TestItem{"2.4703282292062327e-324", cuda::std::chars_format::hex, 19, cuda::std::errc{}, 0x1.2381941149031p+1},
+    TestItem{"2.4703282292062328e-324", cuda::std::chars_format::hex, 19, cuda::std::errc{}, 0x1.2381941149031p+1},
+    TestItem{"1.7976931348623157e308", cuda::std::chars_format::hex, 22, cuda::std::errc{}, 0x1.7976931348623p+0},
+    TestItem{"1.7976931348623158e308", cuda::std::chars_format::hex, 22, cuda::std::errc{}, 0x1.7976931348623p+0},
+    TestItem{"1.7976931348623159e308", cuda::std::chars_format::hex, 22, cuda::std::errc{}, 0x1.7976931348623p+0},
+    TestItem{"9007199254740993", cuda::std::chars_format::hex, 16, cuda::std::errc{}, 0x1.200e3324a8e81p+63},
+    TestItem{"9007199254740993.000000000000000000000001",
+             cuda::std::chars_format::hex,
+             41,
+             cuda::std::errc{},
+             0x1.200e3324a8e81p+63},
+    TestItem{"3.14159265358979323846264338327950288419716939937510582097494459",
+             cuda::std::chars_format::hex,
+             64,
+             cuda::std::errc{},
+             0x1.8a0ac9329ac4cp+1},
+    TestItem{"0.000000000000000000000000000000000000000001234",
+             cuda::std::chars_format::hex,
+             47,
+             cuda::std::errc{},
+             0x1.234p-168},
+    TestItem{"1p-1075", cuda::std::chars_format::hex, 7, cuda::std::errc::result_out_of_range, 0.0},
+    TestItem{"1.00000000000000000000001p-1075",
+             cuda::std::chars_format::hex,
+             31,
+             cuda::std::errc{},
+             0x0.0000000000001p-1022},
+    TestItem{"1.fffffffffffff8p1023", cuda::std::chars_format::hex, 21, cuda::std::errc::result_out_of_range, 0.0},
+    TestItem{"0.0000000000001p-1022", cuda::std::chars_format::hex, 21, cuda::std::errc{}, 0x0.0000000000001p-1022},
+  }};
+}
+
+__host__ __device__ constexpr bool is_same_value(double lhs, double rhs)
+{
+  return (lhs != lhs) ? (rhs != rhs) : (lhs == rhs);
+}
+
+__host__ __device__ constexpr void test_from_chars(
+  const char* data,
+  cuda::std::size_t size,
+  cuda::std::chars_format fmt,
+  cuda::std::ptrdiff_t exp_ptr_offset,
+  cuda::std::errc exp_errc,
+  double exp_val)
+{
+  constexpr auto init_val = static_cast<double>(-23);
+
+  double value(init_val);
+  const auto result = cuda::std::from_chars(data, data + size, value, fmt);
+
+  // Check if the result matches the expected result
+  assert(result.ptr == data + exp_ptr_offset);
+  assert(result.ec == exp_errc);
+
+  // Check if the value matches the expected value, the value must not be modified on error
+  assert((exp_errc == cuda::std::errc{}) ? is_same_value(value, exp_val) : (value == init_val));
+}
+
+__host__ __device__ constexpr void test_from_chars(const TestItem& item)
+{
+  static_assert(cuda::std::is_same_v<cuda::std::from_chars_result,
+                                     decltype(cuda::std::from_chars(cuda::std::declval<const char*>(),
+                                                                    cuda::std::declval<const char*>(),
+                                                                    cuda::std::declval<double&>()))>);
+  static_assert(noexcept(cuda::std::from_chars(cuda::std::declval<const char*>(),
+                                               cuda::std::declval<const char*>(),
+                                               cuda::std::declval<double&>(),
+                                               cuda::std::chars_format::general)));
+
+  constexpr cuda::std::size_t buff_size = 150;
+  char buff[buff_size]{};
+
+  const auto len = cuda::std::strlen(item.str);
+
+  // 1. Test the original string
+  test_from_chars(item.str, len, item.fmt, item.ptr_offset, item.ec, item.val);
+
+  // 2. Test a string that has invalid characters at the end
+  cuda::std::strncpy(buff, item.str, len);
+  buff[len] = 'x';
+  test_from_chars(buff, len + 1, item.fmt, item.ptr_offset, item.ec, item.val);
+
+  // 3. Test a string that has white characters at the beginning
+  buff[0] = ' ';
+  cuda::std::strncpy(buff + 1, item.str, len);
+  test_from_chars(buff, len + 1, item.fmt, 0, cuda::std::errc::invalid_argument, item.val);
+}
+
+__host__ __device__ constexpr bool test(cuda::std::chars_format fmt)
+{
+  constexpr auto items = get_test_items();
+
+  for (const auto& item : items)
+  {
+    if (item.fmt == fmt)
+    {
+      test_from_chars(item);
+    }
+  }
+
+  return true;
+}
+
+__host__ __device__ constexpr bool test()
+{
+  test(cuda::std::chars_format::scientific);
+  test(cuda::std::chars_format::fixed);
+  test(cuda::std::chars_format::general);
+  test(cuda::std::chars_format::hex);
+
+  return true;
+}
+
+int main(int, char**)
+{
+  test();
+  static_assert(test(cuda::std::chars_format::scientific));
+  static_assert(test(cuda::std::chars_format::fixed));
+  static_assert(test(cuda::std::chars_format::general));
+  static_assert(test(cuda::std::chars_format::hex));
+  return 0;
+}
@@ -0,0 +1,469 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/std/array>
+#include <cuda/std/charconv>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstring>
+#include <cuda/std/limits>
+#include <cuda/std/type_traits>
+
+#include "test_macros.h"
+
+struct TestItem
+{
+  const char* str;
+  cuda::std::chars_format fmt;
+  cuda::std::ptrdiff_t ptr_offset;
+  cuda::std::errc ec;
+  float val;
+};
+
+// Source code for the generation of the test items
+// #include <charconv>
+// #include <cstdio>
+// #include <cstring>
+
+// constexpr const char* list[] = {
+//   "0", "-0.0", "1", "0.1", "1e23", ... // the strings of the test items
+// };
+
+// int main()
+// {
+//   for (auto fmt : {std::chars_format::scientific, std::chars_format::fixed, std::chars_format::general,
+//                    std::chars_format::hex})
+//   {
+//     for (auto str : list)
+//     {
+//       float value{};
+//       const auto r = std::from_chars(str, str + std::strlen(str), value, fmt);
+//       std::printf("TestItem{\"%s\", %d, %d, %d, %a},\n", str, int(fmt), int(r.ptr - str), int(r.ec), value);
+//     }
+//   }
+// }
+
+constexpr cuda::std::size_t num_test_items = 180;
+
+__host__ __device__ constexpr cuda::std::array<TestItem, num_test_items> get_test_items()
+{
+  return {{
+    TestItem{"0", cuda::std::chars_format::scientific, 0, cuda::std::errc::invalid_argument, 0.0f},
+    TestItem{"-0.0", cuda::std::chars_format::scientific, 0, cuda::std::errc::invalid_argument, 0.0f},
+    TestItem{"1", cuda::std::chars_format::scientific, 0, cuda::std::errc::invalid_argument, 0.0f},
+    TestItem{"0.1", cuda::std::chars_format::scientific, 0, cuda::std::errc::invalid_argument, 0.0f},
+    TestItem{"1e23", cuda::std::chars_format::scientific, 4, cuda::std::errc{}, 0x1.52d02cp+76f},
+    TestItem{"123.456e-2", cuda::std::chars_format::scientific, 10, cuda::std::errc{}, 0x1.3c0c2p+0f},
+    TestItem{"2.5E+3", cuda::std::chars_format::scientific, 6, cuda::std::errc{}, 0x1.388p+11f},
+    TestItem{"1e", cuda::std::chars_format::scientific, 0, cuda::std::errc::invalid_argument, 0.0f},
+    TestItem{"1e+", cuda::std::chars_format::scientific, 0, cuda::std::errc::invalid_argument, 0.0f},
+    TestItem{"7e-", cuda::std::chars_format::scientific, 0, cuda::std::errc::invalid_argument, 0.0f},
+    TestItem{".5", cuda::std::chars_format::scientific, 0, cuda::std::errc::invalid_argument, 0.0f},
+    TestItem{"5.", cuda::std::chars_format::scientific, 0, cuda::std::errc::invalid_argument, 0.0f},
+    TestItem{".", cuda::std::chars_format::scientific, 0, cuda::std::errc::invalid_argument, 0.0f},
+    TestItem{"-", cuda::std::chars_format::scientific, 0, cuda::std::errc::invalid_argument, 0.0f},
+    TestItem{"+1", cuda::std::chars_format::scientific, 0, cuda::std::errc::invalid_argument, 0.0f},
+    TestItem{"e5", cuda::std::chars_format::scientific, 0, cuda::std::errc::invalid_argument, 0.0f},
+    TestItem{" 1", cuda::std::chars_format::scientific, 0, cuda::std::errc::invalid_argument, 0.0f},
+    TestItem{"0x1p3", cuda::std::chars_format::scientific, 0, cuda::std::errc::invalid_argument, 0.0f},
+    TestItem{"1p-2", cuda::std::chars_format::scientific, 0, cuda::std::errc::invalid_argument, 0.0f},
+    TestItem{"1.8p1", cuda::std::chars_format::scientific, 0, cuda::std::errc::invalid_argument, 0.0f},
+    TestItem{"fffp-4", cuda::std::chars_format::scientific, 0, cuda::std::errc::invalid_argument, 0.0f},
+    TestItem{"inf",
+             cuda::std::chars_format::scientific,
+             3,
+             cuda::std::errc{},
+             cuda::std::numeric_limits<float>::infinity()},
+    TestItem{"-Infinity",
+             cuda::std::chars_format::scientific,
+             9,
+             cuda::std::errc{},
+             -cuda::std::numeric_limits<float>::infinity()},
+    TestItem{"infinit",
+             cuda::std::chars_format::scientific,
+             3,
+             cuda::std::errc{},
+             cuda::std::numeric_limits<float>::infinity()},
+    TestItem{"nan",
+             cuda::std::chars_format::scientific,
+             3,
+             cuda::std::errc{},
+             cuda::std::numeric_limits<float>::quiet_NaN()},
+    TestItem{"-nan",
+             cuda::std::chars_format::scientific,
+             4,
+             cuda::std::errc{},
+             -cuda::std::numeric_limits<float>::quiet_NaN()},
+    TestItem{"nan(123_abc)",
+             cuda::std::chars_format::scientific,
+             12,
+             cuda::std::errc{},
+             cuda::std::numeric_limits<float>::quiet_NaN()},
+    TestItem{"nan(1",
+             cuda::std::chars_format::scientific,
+             3,
+             cuda::std::errc{},
+             cuda::std::numeric_limits<float>::quiet_NaN()},
+    TestItem{"1e39", cuda::std::chars_format::scientific, 4, cuda::std::errc::result_out_of_range, 0.0f},
+    TestItem{"-1e39", cuda::std::chars_format::scientific, 5, cuda::std::errc::result_out_of_range, 0.0f},
+    TestItem{"1e-46", cuda::std::chars_format::scientific, 5, cuda::std::errc::result_out_of_range, 0.0f},
+    TestItem{"1.4e-45", cuda::std::chars_format::scientific, 7, cuda::std::errc{}, 0x1p-149f},
+    TestItem{"7.006492321624085e-46",
+             cuda::std::chars_format::scientific,
+             21,
+             cuda::std::errc::result_out_of_range,
+             0.0f},
+    TestItem{"7.006492321624086e-46", cuda::std::chars_format::scientific, 21, cuda::std::errc{}, 0x1p-149f},
+    TestItem{"3.4028234e38", cuda::std::chars_format::scientific, 12, cuda::std::errc{}, 0x1.fffffep+127f},
+    TestItem{"3.40282357e38", cuda::std::chars_format::scientific, 13, cuda::std::errc::result_out_of_range, 0.0f},
+    TestItem{"3.40282358e38", cuda::std::chars_format::scientific, 13, cuda::std::errc::result_out_of_range, 0.0f},
+    TestItem{"16777217", cuda::std::chars_format::scientific, 0, cuda::std::errc::invalid_argument, 0.0f},
+    TestItem{"16777217.000000000000000000000001",
+             cuda::std::chars_format::scientific,
+             0,
+             cuda::std::errc::invalid_argument,
+             0.0f},
+    TestItem{"1.000000059604644775390625",
+             cuda::std::chars_format::scientific,
+             0,
+             cuda::std::errc::invalid_argument,
+             0.0f},
+    TestItem{"3.14159265358979323846264338327950288419716939937510582097494459",
+             cuda::std::chars_format::scientific,
+             0,
+             cuda::std::errc::invalid_argument,
+             0.0f},
+    TestItem{"1p-150", cuda::std::chars_format::scientific, 0, cuda::std::errc::invalid_argument, 0.0f},
+    TestItem{"1.00000000000000000000001p-150",
+             cuda::std::chars_format::scientific,
+             0,
+             cuda::std::errc::invalid_argument,
+             0.0f},
+    TestItem{"1.ffffffp127", cuda::std::chars_format::scientific, 0, cuda::std::errc::invalid_argument, 0.0f},
+    TestItem{"0.000001p-126", cuda::std::chars_format::scientific, 0, cuda::std::errc::invalid_argument, 0.0f},
+    TestItem{"0", cuda::std::chars_format::fixed, 1, cuda::std::errc{}, 0x0p+0f},
+    TestItem{"-0.0", cuda::std::chars_format::fixed, 4, cuda::std::errc{}, -0x0p+0f},
+    TestItem{"1", cuda::std::chars_format::fixed, 1, cuda::std::errc{}, 0x1p+0f},
+    TestItem{"0.1", cuda::std::chars_format::fixed, 3, cuda::std::errc{}, 0x1.99999ap-4f},
+    TestItem{"1e23", cuda::std::chars_format::fixed, 1, cuda::std::errc{}, 0x1p+0f},
+    TestItem{"123.456e-2", cuda::std::chars_format::fixed, 7, cuda::std::errc{}, 0x1.edd2f2p+6f},
+    TestItem{"2.5E+3", cuda::std::chars_format::fixed, 3, cuda::std::errc{}, 0x1.4p+1f},
+    TestItem{"1e", cuda::std::chars_format::fixed, 1, cuda::std::errc{}, 0x1p+0f},
+    TestItem{"1e+", cuda::std::chars_format::fixed, 1, cuda::std::errc{}, 0x1p+0f},
+    TestItem{"7e-", cuda::std::chars_format::fixed, 1, cuda::std::errc{}, 0x1.cp+2f},
+    TestItem{".5", cuda::std::chars_format::fixed, 2, cuda::std::errc{}, 0x1p-1f},
+    TestItem{"5.", cuda::std::chars_format::fixed, 2, cuda::std::errc{}, 0x1.4p+2f},
+    TestItem{".", cuda::std::chars_format::fixed, 0, cuda::std::errc::invalid_argument, 0.0f},
+    TestItem{"-", cuda::std::chars_format::fixed, 0, cuda::std::errc::invalid_argument, 0.0f},
+    TestItem{"+1", cuda::std::chars_format::fixed, 0, cuda::std::errc::invalid_argument, 0.0f},
+    TestItem{"e5", cuda::std::chars_format::fixed, 0, cuda::std::errc::invalid_argument, 0.0f},
+    TestItem{" 1", cuda::std::chars_format::fixed, 0, cuda::std::errc::invalid_argument, 0.0f},
+    TestItem{"0x1p3", cuda::std::chars_format::fixed, 1, cuda::std::errc{}, 0x0p+0f},
+    TestItem{"1p-2", cuda::std::chars_format::fixed, 1, cuda::std::errc{}, 0x1p+0f},
+    TestItem{"1.8p1", cuda::std::chars_format::fixed, 3, cuda::std::errc{}, 0x1.ccccccp+0f},
+    TestItem{"fffp-4", cuda::std::chars_format::fixed, 0, cuda::std::errc::invalid_argument, 0.0f},
+    TestItem{"inf", cuda::std::chars_format::fixed, 3, cuda::std::errc{}, cuda::std::numeric_limits<float>::infinity()},
+    TestItem{"-Infinity",
+             cuda::std::chars_format::fixed,
+             9,
+             cuda::std::errc{},
+             -cuda::std::numeric_limits<float>::infinity()},
+    TestItem{"infinit",
+             cuda::std::chars_format::fixed,
+             3,
+             cuda::std::errc{},
+             cuda::std::numeric_limits<float>::infinity()},
+    TestItem{"nan",
+             cuda::std::chars_format::fixed,
+             3,
+             cuda::std::errc{},
+             cuda::std::numeric_limits<float>::quiet_NaN()},
+    TestItem{"-nan",
+             cuda::std::chars_format::fixed,
+             4,
+             cuda::std::errc{},
+             -cuda::std::numeric_limits<float>::quiet_NaN()},
+    TestItem{"nan(123_abc)",
+             cuda::std::chars_format::fixed,
+             12,
+             cuda::std::errc{},
+             cuda::std::numeric_limits<float>::quiet_NaN()},
+    TestItem{"nan(1",
+             cuda::std::chars_format::fixed,
+             3,
+             cuda::std::errc{},
+             cuda::std::numeric_limits<float>::quiet_NaN()},
+    TestItem{"1e39", cuda::std::chars_format::fixed, 1, cuda::std::errc{}, 0x1p+0f},
+    TestItem{"-1e39", cuda::std::chars_format::fixed, 2, cuda::std::errc{}, -0x1p+0f},
+    TestItem{"1e-46", cuda::std::chars_format::fixed, 1, cuda::std::errc{}, 0x1p+0f},
+    TestItem{"1.4e-45", cuda::std::chars_format::fixed, 3, cuda::std::errc{}, 0x1.666666p+0f},
+    TestItem{"7.006492321624085e-46", cuda::std::chars_format::fixed, 17, cuda::std::errc{}, 0x1.c06a5ep+2f},
+    TestItem{"7.006492321624086e-46", cuda::std::chars_format::fixed, 17, cuda::std::errc{}, 0x1.c06a5ep+2f},
+    TestItem{"3.4028234e38", cuda::std::chars_format::fixed, 9, cuda::std::errc{}, 0x1.b38fb8p+1f},
+    TestItem{"3.40282357e38", cuda::std::chars_format::fixed, 10, cuda::std::errc{}, 0x1.b38fbap+1f},
+    TestItem{"3.40282358e38", cuda::std::chars_format::fixed, 10, cuda::std::errc{}, 0x1.b38fbap+1f},
+    TestItem{"16777217", cuda::std::chars_format::fixed, 8, cuda::std::errc{}, 0x1p+24f},
+    TestItem{"16777217.000000000000000000000001",
+             cuda::std::chars_format::fixed,
+             33,
+             cuda::std::errc{},
+             0x1.000002p+24f},
+    TestItem{"1.000000059604644775390625", cuda::std::chars_format::fixed, 26, cuda::std::errc{}, 0x1p+0f},
+    TestItem{"3.14159265358979323846264338327950288419716939937510582097494459",
+             cuda::std::chars_format::fixed,
+             64,
+             cuda::std::errc{},
+             0x1.921fb6p+1f},
+    TestItem{"1p-150", cuda::std::chars_format::fixed, 1, cuda::std::errc{}, 0x1p+0f},
+    TestItem{"1.00000000000000000000001p-150", cuda::std::chars_format::fixed, 25, cuda::std::errc{}, 0x1p+0f},
+    TestItem{"1.ffffffp127", cuda::std::chars_format::fixed, 2, cuda::std::errc{}, 0x1p+0f},
+    TestItem{"0.000001p-126", cuda::std::chars_format::fixed, 8, cuda::std::errc{}, 0x1.0c6f7ap-20f},
+    TestItem{"0", cuda::std::chars_format::general, 1, cuda::std::errc{}, 0x0p+0f},
+    TestItem{"-0.0", cuda::std::chars_format::general, 4, cuda::std::errc{}, -0x0p+0f},
+    TestItem{"1", cuda::std::chars_format::general, 1, cuda::std::errc{}, 0x1p+0f},
+    TestItem{"0.1", cuda::std::chars_format::general, 3, cuda::std::errc{}, 0x1.99999ap-4f},
+    TestItem{"1e23", cuda::std::chars_format::general, 4, cuda::std::errc{}, 0x1.52d02cp+76f},
+    TestItem{"123.456e-2", cuda::std::chars_format::general, 10, cuda::std::errc{}, 0x1.3c0c2p+0f},
+    TestItem{"2.5E+3", cuda::std::chars_format::general, 6, cuda::std::errc{}, 0x1.388p+11f},
+    TestItem{"1e", cuda::std::chars_format::general, 1, cuda::std::errc{}, 0x1p+0f},
+    TestItem{"1e+", cuda::std::chars_format::general, 1, cuda::std::errc{}, 0x1p+0f},
+    TestItem{"7e-", cuda::std::chars_format::general, 1, cuda::std::errc{}, 0x1.cp+2f},
+    TestItem{".5", cuda::std::chars_format::general, 2, cuda::std::errc{}, 0x1p-1f},
+    TestItem{"5.", cuda::std::chars_format::general, 2, cuda::std::errc{}, 0x1.4p+2f},
+    TestItem{".", cuda::std::chars_format::general, 0, cuda::std::errc::invalid_argument, 0.0f},
+    TestItem{"-", cuda::std::chars_format::general, 0, cuda::std::errc::invalid_argument, 0.0f},
+    TestItem{"+1", cuda::std::chars_format::general, 0, cuda::std::errc::invalid_argument, 0.0f},
+    TestItem{"e5", cuda::std::chars_format::general, 0, cuda::std::errc::invalid_argument, 0.0f},
+    TestItem{" 1", cuda::std::chars_format::general, 0, cuda::std::errc::invalid_argument, 0.0f},
+    TestItem{"0x1p3", cuda::std::chars_format::general, 1, cuda::std::errc{}, 0x0p+0f},
+    TestItem{"1p-2", cuda::std::chars_format::general, 1, cuda::std::errc{}, 0x1p+0f},
+    TestItem{"1.8p1", cuda::std::chars_format::general, 3, cuda::std::errc{}, 0x1.ccccccp+0f},
+    TestItem{"fffp-4", cuda::std::chars_format::general, 0, cuda::std::errc::invalid_argument, 0.0f},
+    TestItem{"inf",
+             cuda::std::chars_format::general,
+             3,
+             cuda::std::errc{},
+             cuda::std::numeric_limits<float>::infinity()},
+    TestItem{"-Infinity",
+             cuda::std::chars_format::general,
+             9,
+             cuda::std::errc{},
+             -cuda::std::numeric_limits<float>::infinity()},
+    TestItem{"infinit",
+             cuda::std::chars_format::general,
+             3,
+             cuda::std::errc{},
+             cuda::std::numeric_limits<float>::infinity()},
+    TestItem{"nan",
+             cuda::std::chars_format::general,
+             3,
+             cuda::std::errc{},
+             cuda::std::numeric_limits<float>::quiet_NaN()},
+    TestItem{"-nan",
+             cuda::std::chars_format::general,
+             4,
+             cuda::std::errc{},
+             -cuda::std::numeric_limits<float>::quiet_NaN()},
+    TestItem{"nan(123_abc)",
+             cuda::std::chars_format::general,
+             12,
+             cuda::std::errc{},
+             cuda::std::numeric_limits<float>::quiet_NaN()},
+    TestItem{"nan(1",
+             cuda::std::chars_format::general,
+             3,
+             cuda::std::errc{},
+             cuda::std::numeric_limits<float>::quiet_NaN()},
+    TestItem{"1e39", cuda::std::chars_format::general, 4, cuda::std::errc::result_out_of_range, 0.0f},
+    TestItem{"-1e39", cuda::std::chars_format::general, 5, cuda::std::errc::result_out_of_range, 0.0f},
+    TestItem{"1e-46", cuda::std::chars_format::general, 5, cuda::std::errc::result_out_of_range, 0.0f},
+    TestItem{"1.4e-45", cuda::std::chars_format::general, 7, cuda::std::errc{}, 0x1p-149f},
+    TestItem{"7.006492321624085e-46", cuda::std::chars_format::general, 21, cuda::std::errc::result_out_of_range, 0.0f},
+    TestItem{"7.006492321624086e-46", cuda::std::chars_format::general, 21, cuda::std::errc{}, 0x1p-149f},
+    TestItem{"3.4028234e38", cuda::std::chars_format::general, 12, cuda::std::errc{}, 0x1.fffffep+127f},
+    TestItem{"3.40282357e38", cuda::std::chars_format::general, 13, cuda::std::errc::result_out_of_range, 0.0f},
+    TestItem{"3.40282358e38", cuda::std::chars_format::general, 13, cuda::std::errc::result_out_of_range, 0.0f},
+    TestItem{"16777217", cuda::std::chars_format::general, 8, cuda::std::errc{}, 0x1p+24f},
+    TestItem{"16777217.000000000000000000000001",
+             cuda::std::chars_format::general,
+             33,
+             cuda::std::errc{},
+             0x1.000002p+24f},
+    TestItem{"1.000000059604644775390625", cuda::std::chars_format::general, 26, cuda::std::errc{}, 0x1p+0f},
+    TestItem{"3.14159265358979323846264338327950288419716939937510582097494459",
+             cuda::std::chars_format::general,
+             64,
+             cuda::std::errc{},
+             0x1.921fb6p+1f},
+    TestItem{"1p-150", cuda::std::chars_format::general, 1, cuda::std::errc{}, 0x1p+0f},
+    TestItem{"1.00000000000000000000001p-150", cuda::std::chars_format::general, 25, cuda::std::errc{}, 0x1p+0f},
+    TestItem{"1.ffffffp127", cuda::std::chars_format::general, 2, cuda::std::errc{}, 0x1p+0f},
+    TestItem{"0.000001p-126", cuda::std::chars_format::general, 8, cuda::std::errc{}, 0x1.0c6f7ap-20f},
+    TestItem{"0", cuda::std::chars_format::hex, 1, cuda::std::errc{}, 0x0p+0f},
+    TestItem{"-0.0", cuda::std::chars_format::hex, 4, cuda::std::errc{}, -0x0p+0f},
+    TestItem{"1", cuda::std::chars_format::hex, 1, cuda::std::errc{}, 0x1p+0f},
+    TestItem{"0.1", cuda::std::chars_format::hex, 3, cuda::std::errc{}, 0x1p-4f},
+    TestItem{"1e23", cuda::std::chars_format::hex, 4, cuda::std::errc{}, 0x1.e23p+12f},
+    TestItem{"123.456e-2", cuda::std::chars_format::hex, 8, cuda::std::errc{}, 0x1.23456ep+8f},
+    TestItem{"2.5E+3", cuda::std::chars_format::hex, 4, cuda::std::errc{}, 0x1.2fp+1f},
+    TestItem{"1e", cuda::std::chars_format::hex, 2, cuda::std::errc{}, 0x1.ep+4f},
+    TestItem{"1e+", cuda::std::chars_format::hex, 2, cuda::std::errc{}, 0x1.ep+4f},
+    TestItem{"7e-", cuda::std::chars_format::hex, 2, cuda::std::errc{}, 0x1.f8p+6f},
+    TestItem{".5", cuda::std::chars_format::hex, 2, cuda::std::errc{}, 0x1.4p-2f},
+    TestItem{"5.", cuda::std::chars_format::hex, 2, cuda::std::errc{}, 0x1.4p+2f},
+    TestItem{".", cuda::std::chars_format::hex, 0, cuda::std::errc::invalid_argument, 0.0f},
+    TestItem{"-", cuda::std::chars_format::hex, 0, cuda::std::errc::invalid_argument, 0.0f},
+    TestItem{"+1", cuda::std::chars_format::hex, 0, cuda::std::errc::invalid_argument, 0.0f},
+    TestItem{"e5", cuda::std::chars_format::hex, 2, cuda::std::errc{}, 0x1.cap+7f},
+    TestItem{" 1", cuda::std::chars_format::hex, 0, cuda::std::errc::invalid_argument, 0.0f},
+    TestItem{"0x1p3", cuda::std::chars_format::hex, 1, cuda::std::errc{}, 0x0p+0f},
+    TestItem{"1p-2", cuda::std::chars_format::hex, 4, cuda::std::errc{}, 0x1p-2f},
+    TestItem{"1.8p1", cuda::std::chars_format::hex, 5, cuda::std::errc{}, 0x1.8p+1f},
+    TestItem{"fffp-4", cuda::std::chars_format::hex, 6, cuda::std::errc{}, 0x1.ffep+7f},
+    TestItem{"inf", cuda::std::chars_format::hex, 3, cuda::std::errc{}, cuda::std::numeric_limits<float>::infinity()},
+    TestItem{"-Infinity",
+             cuda::std::chars_format::hex,
+             9,
+             cuda::std::errc{},
+             -cuda::std::numeric_limits<float>::infinity()},
+    TestItem{"infinit",
+             cuda::std::chars_format::hex,
+             3,
+             cuda::std::errc{},
+             cuda::std::numeric_limits<float>::infinity()},
+    TestItem{"nan", cuda::std::chars_format::hex, 3, cuda::std::errc{}, cuda::std::numeric_limits<float>::quiet_NaN()},
+    TestItem{"-nan",
+             cuda::std::chars_format::hex,
+             4,
+             cuda::std::errc{},
+             -cuda::std::numeric_limits<float>::quiet_NaN()},
+    TestItem{"nan(123_abc)",
+             cuda::std::chars_format::hex,
+             12,
+             cuda::std::errc{},
+             cuda::std::numeric_limits<float>::quiet_NaN()},
+    TestItem{"nan(1",
+             cuda::std::chars_format::hex,
+             3,
+             cuda::std::errc{},
+             cuda::std::numeric_limits<float>::quiet_NaN()},
+    TestItem{"1e39", cuda::std::chars_format::hex, 4, cuda::std::errc{}, 0x1.e39p+12f},
+    TestItem{"-1e39", cuda::std::chars_format::hex, 5, cuda::std::errc{}, -0x1.e39p+12f},
+    TestItem{"1e-46", cuda::std::chars_format::hex, 2, cuda::std::errc{}, 0x1.ep+4f},
+    TestItem{"1.4e-45", cuda::std::chars_format::hex, 4, cuda::std::errc{}, 0x1.4ep+0f},
+    TestItem{"7.006492321624085e-46", cuda::std::chars_format::hex, 18, cuda::std::errc{}, 0x1.c01924p+2f},
+    TestItem{"7.006492321624086e-46", cuda::std::chars_format::hex, 18, cuda::std::errc{}, 0x1.c01924p+2f},
+    TestItem{"3.4028234e38", cuda::std::chars_format::hex, 12, cuda::std::errc{}, 0x1.a01412p+1f},
+    TestItem{"3.40282357e38", cuda::std::chars_format::hex, 13, cuda::std::errc{}, 0x1.a01412p+1f},
+    TestItem{"3.40282358e38", cuda::std::chars_format::hex, 13, cuda::std::errc{}, 0x1.a01412p+1f},
+    TestItem{"16777217", cuda::std::chars_format::hex, 8, cuda::std::errc{}, 0x1.677722p+28f},
+    TestItem{"16777217.000000000000000000000001", cuda::std::chars_format::hex, 33, cuda::std::errc{}, 0x1.677722p+28f},
+    TestItem{"1.000000059604644775390625", cuda::std::chars_format::hex, 26, cuda::std::errc{}, 0x1p+0f},
+    TestItem{"3.14159265358979323846264338327950288419716939937510582097494459",
+             cuda::std::chars_format::hex,
+             64,
+             cuda::std::errc{},
+             0x1.8a0acap+1f},
+    TestItem{"1p-150", cuda::std::chars_format::hex, 6, cuda::std::errc::result_out_of_range, 0.0f},
+    TestItem{"1.00000000000000000000001p-150", cuda::std::chars_format::hex, 30, cuda::std::errc{}, 0x1p-149f},
+    TestItem{"1.ffffffp127", cuda::std::chars_format::hex, 12, cuda::std::errc::result_out_of_range, 0.0f},
+    TestItem{"0.000001p-126", cuda::std::chars_format::hex, 13, cuda::std::errc::result_out_of_range, 0.0f},
+  }};
+}
+
+__host__ __device__ constexpr bool is_same_value(float lhs, float rhs)
+{
+  return (lhs != lhs) ? (rhs != rhs) : (lhs == rhs);
+}
+
+__host__ __device__ constexpr void test_from_chars(
+  const char* data,
+  cuda::std::size_t size,
+  cuda::std::chars_format fmt,
+  cuda::std::ptrdiff_t exp_ptr_offset,
+  cuda::std::errc exp_errc,
+  float exp_val)
+{
+  constexpr auto init_val = static_cast<float>(-23);
+
+  float value(init_val);
+  const auto result = cuda::std::from_chars(data, data + size, value, fmt);
+
+  // Check if the result matches the expected result
+  assert(result.ptr == data + exp_ptr_offset);
+  assert(result.ec == exp_errc);
+
+  // Check if the value matches the expected value, the value must not be modified on error
+  assert((exp_errc == cuda::std::errc{}) ? is_same_value(value, exp_val) : (value == init_val));
+}
+
+__host__ __device__ constexpr void test_from_chars(const TestItem& item)
+{
+  static_assert(cuda::std::is_same_v<cuda::std::from_chars_result,
+                                     decltype(cuda::std::from_chars(cuda::std::declval<const char*>(),
+                                                                    cuda::std::declval<const char*>(),
+                                                                    cuda::std::declval<float&>()))>);
+  static_assert(noexcept(cuda::std::from_chars(cuda::std::declval<const char*>(),
+                                               cuda::std::declval<const char*>(),
+                                               cuda::std::declval<float&>(),
+                                               cuda::std::chars_format::general)));
+
+  constexpr cuda::std::size_t buff_size = 150;
+  char buff[buff_size]{};
+
+  const auto len = cuda::std::strlen(item.str);
+
+  // 1. Test the original string
+  test_from_chars(item.str, len, item.fmt, item.ptr_offset, item.ec, item.val);
+
+  // 2. Test a string that has invalid characters at the end
+  cuda::std::strncpy(buff, item.str, len);
+  buff[len] = 'x';
+  test_from_chars(buff, len + 1, item.fmt, item.ptr_offset, item.ec, item.val);
+
+  // 3. Test a string that has white characters at the beginning
+  buff[0] = ' ';
+  cuda::std::strncpy(buff + 1, item.str, len);
+  test_from_chars(buff, len + 1, item.fmt, 0, cuda::std::errc::invalid_argument, item.val);
+}
+
+__host__ __device__ constexpr bool test(cuda::std::chars_format fmt)
+{
+  constexpr auto items = get_test_items();
+
+  for (const auto& item : items)
+  {
+    if (item.fmt == fmt)
+    {
+      test_from_chars(item);
+    }
+  }
+
+  return true;
+}
+
+__host__ __device__ constexpr bool test()
+{
+  test(cuda::std::chars_format::scientific);
+  test(cuda::std::chars_format::fixed);
+  test(cuda::std::chars_format::general);
+  test(cuda::std::chars_format::hex);
+
+  return true;
+}
+
+int main(int, char**)
+{
+  test();
+  static_assert(test(cuda::std::chars_format::scientific));
+  static_assert(test(cuda::std::chars_format::fixed));
+  static_assert(test(cuda::std::chars_format::general));
+  static_assert(test(cuda::std::chars_format::hex));
+  return 0;
+}
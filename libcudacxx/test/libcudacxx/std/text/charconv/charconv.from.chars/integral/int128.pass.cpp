@@ -1322,6 +1322,13 @@ __host__ __device__ constexpr void test_overflow()
     item.str_unsigned = "";
     test_from_chars<T>(item, base, true);
   }
+
+  // 5. Test overflow that wraps around to a value larger than the one before the last digit
+  {
+    item.str_signed   = "378091518801042737181527341590853568290";
+    item.str_unsigned = "378091518801042737181527341590853568290";
+    test_from_chars<T>(item, base, true);
+  }
 }
 
 template <int Base>
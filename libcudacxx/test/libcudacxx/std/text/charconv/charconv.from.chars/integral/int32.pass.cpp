@@ -1222,6 +1222,13 @@ __host__ __device__ constexpr void test_overflow()
     item.str_unsigned = "";
     test_from_chars<T>(item, base, true);
   }
+
+  // 5. Test overflow that wraps around to a value larger than the one before the last digit
+  {
+    item.str_signed   = "4772185890";
+    item.str_unsigned = "4772185890";
+    test_from_chars<T>(item, base, true);
+  }
 }
 
 template <int Base>
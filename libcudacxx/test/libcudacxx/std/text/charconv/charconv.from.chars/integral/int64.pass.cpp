@@ -1281,6 +1281,13 @@ __host__ __device__ constexpr void test_overflow()
     item.str_unsigned = "";
     test_from_chars<T>(item, base, true);
   }
+
+  // 5. Test overflow that wraps around to a value larger than the one before the last digit
+  {
+    item.str_signed   = "20496382304121724020";
+    item.str_unsigned = "20496382304121724020";
+    test_from_chars<T>(item, base, true);
+  }
 }
 
 template <int Base>
@@ -0,0 +1,448 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/std/array>
+#include <cuda/std/charconv>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstring>
+#include <cuda/std/limits>
+#include <cuda/std/type_traits>
+
+#include "test_macros.h"
+
+struct TestItem
+{
+  double val;
+  cuda::std::chars_format fmt;
+  int precision;
+  const char* str;
+};
+
+// Source code for the generation of the test items
+// #include <charconv>
+// #include <cstdio>
+// #include <string>
+
+// constexpr double list[] = {
+//   0.0, 1.0, 0.1, 1.5, 123.456, 1e23, 9.5, 1234567.0, 0.000123,
+//   3.141592653589793, 1e-7, 5e-324, 2.2250738585072014e-308, 1.7976931348623157e308};
+// constexpr int precisions[] = {-1, 0, 4, 17};
+
+// int main()
+// {
+//   for (int fmt = 0; fmt <= 4; ++fmt)
+//   {
+//     for (int precision : precisions)
+//     {
+//       // fmt 0 is the overload without chars_format, precision -1 is the overload without precision
+//       if (fmt == 0 && precision != -1)
+//       {
+//         continue;
+//       }
+//       for (auto v : list)
+//       {
+//         char buff[1000]{};
+//         const auto f = static_cast<std::chars_format>(fmt);
+//         const auto r = (fmt == 0)        ? std::to_chars(buff, buff + 1000, v)
+//                      : (precision < 0) ? std::to_chars(buff, buff + 1000, v, f)
+//                                        : std::to_chars(buff, buff + 1000, v, f, precision);
+//         std::printf("TestItem{%a, %d, %d, \"%s\"},\n", v, fmt, precision, std::string(buff, r.ptr).c_str());
+//       }
+//     }
+//   }
+// }
+
+constexpr cuda::std::size_t num_test_items = 238;
+
+__host__ __device__ constexpr cuda::std::array<TestItem, num_test_items> get_test_items()
+{
+  return {{
+    TestItem{0x0p+0, cuda::std::chars_format{}, -1, "0"},
+    TestItem{0x1p+0, cuda::std::chars_format{}, -1, "1"},
+    TestItem{0x1.999999999999ap-4, cuda::std::chars_format{}, -1, "0.1"},
+    TestItem{0x1.8p+0, cuda::std::chars_format{}, -1, "1.5"},
+    TestItem{0x1.edd2f1a9fbe77p+6, cuda::std::chars_format{}, -1, "123.456"},
+    TestItem{0x1.52d02c7e14af6p+76, cuda::std::chars_format{}, -1, "1e+23"},
+    TestItem{0x1.3p+3, cuda::std::chars_format{}, -1, "9.5"},
+    TestItem{0x1.2d687p+20, cuda::std::chars_format{}, -1, "1234567"},
+    TestItem{0x1.01f31f46ed246p-13, cuda::std::chars_format{}, -1, "0.000123"},
+    TestItem{0x1.921fb54442d18p+1, cuda::std::chars_format{}, -1, "3.141592653589793"},
+    TestItem{0x1.ad7f29abcaf48p-24, cuda::std::chars_format{}, -1, "1e-07"},
+    TestItem{0x0.0000000000001p-1022, cuda::std::chars_format{}, -1, "5e-324"},
+    TestItem{0x1p-1022, cuda::std::chars_format{}, -1, "2.2250738585072014e-308"},
+    TestItem{0x1.fffffffffffffp+1023, cuda::std::chars_format{}, -1, "1.7976931348623157e+308"},
+    TestItem{0x0p+0, cuda::std::chars_format::scientific, -1, "0e+00"},
+    TestItem{0x1p+0, cuda::std::chars_format::scientific, -1, "1e+00"},
+    TestItem{0x1.999999999999ap-4, cuda::std::chars_format::scientific, -1, "1e-01"},
+    TestItem{0x1.8p+0, cuda::std::chars_format::scientific, -1, "1.5e+00"},
+    TestItem{0x1.edd2f1a9fbe77p+6, cuda::std::chars_format::scientific, -1, "1.23456e+02"},
+    TestItem{0x1.52d02c7e14af6p+76, cuda::std::chars_format::scientific, -1, "1e+23"},
+    TestItem{0x1.3p+3, cuda::std::chars_format::scientific, -1, "9.5e+00"},
+    TestItem{0x1.2d687p+20, cuda::std::chars_format::scientific, -1, "1.234567e+06"},
+    TestItem{0x1.01f31f46ed246p-13, cuda::std::chars_format::scientific, -1, "1.23e-04"},
+    TestItem{0x1.921fb54442d18p+1, cuda::std::chars_format::scientific, -1, "3.141592653589793e+00"},
+    TestItem{0x1.ad7f29abcaf48p-24, cuda::std::chars_format::scientific, -1, "1e-07"},
+    TestItem{0x0.0000000000001p-1022, cuda::std::chars_format::scientific, -1, "5e-324"},
+    TestItem{0x1p-1022, cuda::std::chars_format::scientific, -1, "2.2250738585072014e-308"},
+    TestItem{0x1.fffffffffffffp+1023, cuda::std::chars_format::scientific, -1, "1.7976931348623157e+308"},
+    TestItem{0x0p+0, cuda::std::chars_format::scientific, 0, "0e+00"},
+    TestItem{0x1p+0, cuda::std::chars_format::scientific, 0, "1e+00"},
+    TestItem{0x1.999999999999ap-4, cuda::std::chars_format::scientific, 0, "1e-01"},
+    TestItem{0x1.8p+0, cuda::std::chars_format::scientific, 0, "2e+00"},
+    TestItem{0x1.edd2f1a9fbe77p+6, cuda::std::chars_format::scientific, 0, "1e+02"},
+    TestItem{0x1.52d02c7e14af6p+76, cuda::std::chars_format::scientific, 0, "1e+23"},
+    TestItem{0x1.3p+3, cuda::std::chars_format::scientific, 0, "1e+01"},
+    TestItem{0x1.2d687p+20, cuda::std::chars_format::scientific, 0, "1e+06"},
+    TestItem{0x1.01f31f46ed246p-13, cuda::std::chars_format::scientific, 0, "1e-04"},
+    TestItem{0x1.921fb54442d18p+1, cuda::std::chars_format::scientific, 0, "3e+00"},
+    TestItem{0x1.ad7f29abcaf48p-24, cuda::std::chars_format::scientific, 0, "1e-07"},
+    TestItem{0x0.0000000000001p-1022, cuda::std::chars_format::scientific, 0, "5e-324"},
+    TestItem{0x1p-1022, cuda::std::chars_format::scientific, 0, "2e-308"},
+    TestItem{0x1.fffffffffffffp+1023, cuda::std::chars_format::scientific, 0, "2e+308"},
+    TestItem{0x0p+0, cuda::std::chars_format::scientific, 4, "0.0000e+00"},
+    TestItem{0x1p+0, cuda::std::chars_format::scientific, 4, "1.0000e+00"},
+    TestItem{0x1.999999999999ap-4, cuda::std::chars_format::scientific, 4, "1.0000e-01"},
+    TestItem{0x1.8p+0, cuda::std::chars_format::scientific, 4, "1.5000e+00"},
+    TestItem{0x1.edd2f1a9fbe77p+6, cuda::std::chars_format::scientific, 4, "1.2346e+02"},
+    TestItem{0x1.52d02c7e14af6p+76, cuda::std::chars_format::scientific, 4, "1.0000e+23"},
+    TestItem{0x1.3p+3, cuda::std::chars_format::scientific, 4, "9.5000e+00"},
+    TestItem{0x1.2d687p+20, cuda::std::chars_format::scientific, 4, "1.2346e+06"},
+    TestItem{0x1.01f31f46ed246p-13, cuda::std::chars_format::scientific, 4, "1.2300e-04"},
+    TestItem{0x1.921fb54442d18p+1, cuda::std::chars_format::scientific, 4, "3.1416e+00"},
+    TestItem{0x1.ad7f29abcaf48p-24, cuda::std::chars_format::scientific, 4, "1.0000e-07"},
+    TestItem{0x0.0000000000001p-1022, cuda::std::chars_format::scientific, 4, "4.9407e-324"},
+    TestItem{0x1p-1022, cuda::std::chars_format::scientific, 4, "2.2251e-308"},
+    TestItem{0x1.fffffffffffffp+1023, cuda::std::chars_format::scientific, 4, "1.7977e+308"},
+    TestItem{0x0p+0, cuda::std::chars_format::scientific, 17, "0.00000000000000000e+00"},
+    TestItem{0x1p+0, cuda::std::chars_format::scientific, 17, "1.00000000000000000e+00"},
+    TestItem{0x1.999999999999ap-4, cuda::std::chars_format::scientific, 17, "1.00000000000000006e-01"},
+    TestItem{0x1.8p+0, cuda::std::chars_format::scientific, 17, "1.50000000000000000e+00"},
+    TestItem{0x1.edd2f1a9fbe77p+6, cuda::std::chars_format::scientific, 17, "1.23456000000000003e+02"},
+    TestItem{0x1.52d02c7e14af6p+76, cuda::std::chars_format::scientific, 17, "9.99999999999999916e+22"},
+    TestItem{0x1.3p+3, cuda::std::chars_format::scientific, 17, "9.50000000000000000e+00"},
+    TestItem{0x1.2d687p+20, cuda::std::chars_format::scientific, 17, "1.23456700000000000e+06"},
+    TestItem{0x1.01f31f46ed246p-13, cuda::std::chars_format::scientific, 17, "1.23000000000000008e-04"},
+    TestItem{0x1.921fb54442d18p+1, cuda::std::chars_format::scientific, 17, "3.14159265358979312e+00"},
+    TestItem{0x1.ad7f29abcaf48p-24, cuda::std::chars_format::scientific, 17, "9.99999999999999955e-08"},
+    TestItem{0x0.0000000000001p-1022, cuda::std::chars_format::scientific, 17, "4.94065645841246544e-324"},
+    TestItem{0x1p-1022, cuda::std::chars_format::scientific, 17, "2.22507385850720138e-308"},
+    TestItem{0x1.fffffffffffffp+1023, cuda::std::chars_format::scientific, 17, "1.79769313486231571e+308"},
+    TestItem{0x0p+0, cuda::std::chars_format::fixed, -1, "0"},
+    TestItem{0x1p+0, cuda::std::chars_format::fixed, -1, "1"},
+    TestItem{0x1.999999999999ap-4, cuda::std::chars_format::fixed, -1, "0.1"},
+    TestItem{0x1.8p+0, cuda::std::chars_format::fixed, -1, "1.5"},
+    TestItem{0x1.edd2f1a9fbe77p+6, cuda::std::chars_format::fixed, -1, "123.456"},
+    TestItem{0x1.52d02c7e14af6p+76, cuda::std::chars_format::fixed, -1, "99999999999999991611392"},
+    TestItem{0x1.3p+3, cuda::std::chars_format::fixed, -1, "9.5"},
+    TestItem{0x1.2d687p+20, cuda::std::chars_format::fixed, -1, "1234567"},
+    TestItem{0x1.01f31f46ed246p-13, cuda::std::chars_format::fixed, -1, "0.000123"},
+    TestItem{0x1.921fb54442d18p+1, cuda::std::chars_format::fixed, -1, "3.141592653589793"},
+    TestItem{0x1.ad7f29abcaf48p-24, cuda::std::chars_format::fixed, -1, "0.0000001"},
+    TestItem{0x0.0000000000001p-1022,
+             cuda::std::chars_format::fixed,
+             -1,
+             "0.00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+             "0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+             "0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+             "00000000000000000000000005"},
+    TestItem{0x1p-1022,
+             cuda::std::chars_format::fixed,
+             -1,
+             "0.00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+             "0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+             "0000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+             "00000000022250738585072014"},
+    TestItem{0x1.fffffffffffffp+1023,
+             cuda::std::chars_format::fixed,
+             -1,
+             "1797693134862315708145274237317043567980705675258449965989174768031572607800285387605895586327668781"
+             "7154045895351438246423432132688946418276846754670353751698604991057655128207624549009038932894407586"
+             "8508455133942304583236903222948165808559332123348274797826204144723168738177180919299881250404026184"
+             "124858368"},
+    TestItem{0x0p+0, cuda::std::chars_format::fixed, 0, "0"},
+    TestItem{0x1p+0, cuda::std::chars_format::fixed, 0, "1"},
+    TestItem{0x1.999999999999ap-4, cuda::std::chars_format::fixed, 0, "0"},
+    TestItem{0x1.8p+0, cuda::std::chars_format::fixed, 0, "2"},
+    TestItem{0x1.edd2f1a9fbe77p+6, cuda::std::chars_format::fixed, 0, "123"},
+    TestItem{0x1.52d02c7e14af6p+76, cuda::std::chars_format::fixed, 0, "99999999999999991611392"},
+    TestItem{0x1.3p+3, cuda::std::chars_format::fixed, 0, "10"},
+    TestItem{0x1.2d687p+20, cuda::std::chars_format::fixed, 0, "1234567"},
+    TestItem{0x1.01f31f46ed246p-13, cuda::std::chars_format::fixed, 0, "0"},
+    TestItem{0x1.921fb54442d18p+1, cuda::std::chars_format::fixed, 0, "3"},
+    TestItem{0x1.ad7f29abcaf48p-24, cuda::std::chars_format::fixed, 0, "0"},
+    TestItem{0x0.0000000000001p-1022, cuda::std::chars_format::fixed, 0, "0"},
+    TestItem{0x1p-1022, cuda::std::chars_format::fixed, 0, "0"},
+    TestItem{0x1.fffffffffffffp+1023,
+             cuda::std::chars_format::fixed,
+             0,
+             "1797693134862315708145274237317043567980705675258449965989174768031572607800285387605895586327668781"
+             "7154045895351438246423432132688946418276846754670353751698604991057655128207624549009038932894407586"
+             "8508455133942304583236903222948165808559332123348274797826204144723168738177180919299881250404026184"
+             "124858368"},
+    TestItem{0x0p+0, cuda::std::chars_format::fixed, 4, "0.0000"},
+    TestItem{0x1p+0, cuda::std::chars_format::fixed, 4, "1.0000"},
+    TestItem{0x1.999999999999ap-4, cuda::std::chars_format::fixed, 4, "0.1000"},
+    TestItem{0x1.8p+0, cuda::std::chars_format::fixed, 4, "1.5000"},
+    TestItem{0x1.edd2f1a9fbe77p+6, cuda::std::chars_format::fixed, 4, "123.4560"},
+    TestItem{0x1.52d02c7e14af6p+76, cuda::std::chars_format::fixed, 4, "99999999999999991611392.0000"},
+    TestItem{0x1.3p+3, cuda::std::chars_format::fixed, 4, "9.5000"},
+    TestItem{0x1.2d687p+20, cuda::std::chars_format::fixed, 4, "1234567.0000"},
+    TestItem{0x1.01f31f46ed246p-13, cuda::std::chars_format::fixed, 4, "0.0001"},
+    TestItem{0x1.921fb54442d18p+1, cuda::std::chars_format::fixed, 4, "3.1416"},
+    TestItem{0x1.ad7f29abcaf48p-24, cuda::std::chars_format::fixed, 4, "0.0000"},
+    TestItem{0x0.0000000000001p-1022, cuda::std::chars_format::fixed, 4, "0.0000"},
+    TestItem{0x1p-1022, cuda::std::chars_format::fixed, 4, "0.0000"},
+    TestItem{0x1.fffffffffffffp+1023,
+             cuda::std::chars_format::fixed,
+             4,
+             "1797693134862315708145274237317043567980705675258449965989174768031572607800285387605895586327668781"
+             "7154045895351438246423432132688946418276846754670353751698604991057655128207624549009038932894407586"
+             "8508455133942304583236903222948165808559332123348274797826204144723168738177180919299881250404026184"
+             "124858368.0000"},
+    TestItem{0x0p+0, cuda::std::chars_format::fixed, 17, "0.00000000000000000"},
+    TestItem{0x1p+0, cuda::std::chars_format::fixed, 17, "1.00000000000000000"},
+    TestItem{0x1.999999999999ap-4, cuda::std::chars_format::fixed, 17, "0.10000000000000001"},
+    TestItem{0x1.8p+0, cuda::std::chars_format::fixed, 17, "1.50000000000000000"},
+    TestItem{0x1.edd2f1a9fbe77p+6, cuda::std::chars_format::fixed, 17, "123.45600000000000307"},
+    TestItem{0x1.52d02c7e14af6p+76, cuda::std::chars_format::fixed, 17, "99999999999999991611392.00000000000000000"},
+    TestItem{0x1.3p+3, cuda::std::chars_format::fixed, 17, "9.50000000000000000"},
+    TestItem{0x1.2d687p+20, cuda::std::chars_format::fixed, 17, "1234567.00000000000000000"},
+    TestItem{0x1.01f31f46ed246p-13, cuda::std::chars_format::fixed, 17, "0.00012300000000000"},
+    TestItem{0x1.921fb54442d18p+1, cuda::std::chars_format::fixed, 17, "3.14159265358979312"},
+    TestItem{0x1.ad7f29abcaf48p-24, cuda::std::chars_format::fixed, 17, "0.00000010000000000"},
+    TestItem{0x0.0000000000001p-1022, cuda::std::chars_format::fixed, 17, "0.00000000000000000"},
+    TestItem{0x1p-1022, cuda::std::chars_format::fixed, 17, "0.00000000000000000"},
+    TestItem{0x1.fffffffffffffp+1023,
+             cuda::std::chars_format::fixed,
+             17,
+             "1797693134862315708145274237317043567980705675258449965989174768031572607800285387605895586327668781"
+             "7154045895351438246423432132688946418276846754670353751698604991057655128207624549009038932894407586"
+             "8508455133942304583236903222948165808559332123348274797826204144723168738177180919299881250404026184"
+             "124858368.00000000000000000"},
+    TestItem{0x0p+0, cuda::std::chars_format::general, -1, "0"},
+    TestItem{0x1p+0, cuda::std::chars_format::general, -1, "1"},
+    TestItem{0x1.999999999999ap-4, cuda::std::chars_format::general, -1, "0.1"},
+    TestItem{0x1.8p+0, cuda::std::chars_format::general, -1, "1.5"},
+    TestItem{0x1.edd2f1a9fbe77p+6, cuda::std::chars_format::general, -1, "123.456"},
+    TestItem{0x1.52d02c7e14af6p+76, cuda::std::chars_format::general, -1, "1e+23"},
+    TestItem{0x1.3p+3, cuda::std::chars_format::general, -1, "9.5"},
+    TestItem{0x1.2d687p+20, cuda::std::chars_format::general, -1, "1.234567e+06"},
+    TestItem{0x1.01f31f46ed246p-13, cuda::std::chars_format::general, -1, "0.000123"},
+    TestItem{0x1.921fb54442d18p+1, cuda::std::chars_format::general, -1, "3.141592653589793"},
+    TestItem{0x1.ad7f29abcaf48p-24, cuda::std::chars_format::general, -1, "1e-07"},
+    TestItem{0x0.0000000000001p-1022, cuda::std::chars_format::general, -1, "5e-324"},
+    TestItem{0x1p-1022, cuda::std::chars_format::general, -1, "2.2250738585072014e-308"},
+    TestItem{0x1.fffffffffffffp+1023, cuda::std::chars_format::general, -1, "1.7976931348623157e+308"},
+    TestItem{0x0p+0, cuda::std::chars_format::general, 0, "0"},
+    TestItem{0x1p+0, cuda::std::chars_format::general, 0, "1"},
+    TestItem{0x1.999999999999ap-4, cuda::std::chars_format::general, 0, "0.1"},
+    TestItem{0x1.8p+0, cuda::std::chars_format::general, 0, "2"},
+    TestItem{0x1.edd2f1a9fbe77p+6, cuda::std::chars_format::general, 0, "1e+02"},
+    TestItem{0x1.52d02c7e14af6p+76, cuda::std::chars_format::general, 0, "1e+23"},
+    TestItem{0x1.3p+3, cuda::std::chars_format::general, 0, "1e+01"},
+    TestItem{0x1.2d687p+20, cuda::std::chars_format::general, 0, "1e+06"},
+    TestItem{0x1.01f31f46ed246p-13, cuda::std::chars_format::general, 0, "0.0001"},
+    TestItem{0x1.921fb54442d18p+1, cuda::std::chars_format::general, 0, "3"},
+    TestItem{0x1.ad7f29abcaf48p-24, cuda::std::chars_format::general, 0, "1e-07"},
+    TestItem{0x0.0000000000001p-1022, cuda::std::chars_format::general, 0, "5e-324"},
+    TestItem{0x1p-1022, cuda::std::chars_format::general, 0, "2e-308"},
+    TestItem{0x1.fffffffffffffp+1023, cuda::std::chars_format::general, 0, "2e+308"},
+    TestItem{0x0p+0, cuda::std::chars_format::general, 4, "0"},
+    TestItem{0x1p+0, cuda::std::chars_format::general, 4, "1"},
+    TestItem{0x1.999999999999ap-4, cuda::std::chars_format::general, 4, "0.1"},
+    TestItem{0x1.8p+0, cuda::std::chars_format::general, 4, "1.5"},
+    TestItem{0x1.edd2f1a9fbe77p+6, cuda::std::chars_format::general, 4, "123.5"},
+    TestItem{0x1.52d02c7e14af6p+76, cuda::std::chars_format::general, 4, "1e+23"},
+    TestItem{0x1.3p+3, cuda::std::chars_format::general, 4, "9.5"},
+    TestItem{0x1.2d687p+20, cuda::std::chars_format::general, 4, "1.235e+06"},
+    TestItem{0x1.01f31f46ed246p-13, cuda::std::chars_format::general, 4, "0.000123"},
+    TestItem{0x1.921fb54442d18p+1, cuda::std::chars_format::general, 4, "3.142"},
+    TestItem{0x1.ad7f29abcaf48p-24, cuda::std::chars_format::general, 4, "1e-07"},
+    TestItem{0x0.0000000000001p-1022, cuda::std::chars_format::general, 4, "4.941e-324"},
+    TestItem{0x1p-1022, cuda::std::chars_format::general, 4, "2.225e-308"},
+    TestItem{0x1.fffffffffffffp+1023, cuda::std::chars_format::general, 4, "1.798e+308"},
+    TestItem{0x0p+0, cuda::std::chars_format::general, 17, "0"},
+    TestItem{0x1p+0, cuda::std::chars_format::general, 17, "1"},
+    TestItem{0x1.999999999999ap-4, cuda::std::chars_format::general, 17, "0.10000000000000001"},
+    TestItem{0x1.8p+0, cuda::std::chars_format::general, 17, "1.5"},
+    TestItem{0x1.edd2f1a9fbe77p+6, cuda::std::chars_format::general, 17, "123.456"},
+    TestItem{0x1.52d02c7e14af6p+76, cuda::std::chars_format::general, 17, "9.9999999999999992e+22"},
+    TestItem{0x1.3p+3, cuda::std::chars_format::general, 17, "9.5"},
+    TestItem{0x1.2d687p+20, cuda::std::chars_format::general, 17, "1234567"},
+    TestItem{0x1.01f31f46ed246p-13, cuda::std::chars_format::general, 17, "0.00012300000000000001"},
+    TestItem{0x1.921fb54442d18p+1, cuda::std::chars_format::general, 17, "3.1415926535897931"},
+    TestItem{0x1.ad7f29abcaf48p-24, cuda::std::chars_format::general, 17, "9.9999999999999995e-08"},
+    TestItem{0x0.0000000000001p-1022, cuda::std::chars_format::general, 17, "4.9406564584124654e-324"},
+    TestItem{0x1p-1022, cuda::std::chars_format::general, 17, "2.2250738585072014e-308"},
+    TestItem{0x1.fffffffffffffp+1023, cuda::std::chars_format::general, 17, "1.7976931348623157e+308"},
+    TestItem{0x0p+0, cuda::std::chars_format::hex, -1, "0p+0"},
+    TestItem{0x1p+0, cuda::std::chars_format::hex, -1, "1p+0"},
+    TestItem{0x1.999999999999ap-4, cuda::std::chars_format::hex, -1, "1.999999999999ap-4"},
+    TestItem{0x1.8p+0, cuda::std::chars_format::hex, -1, "1.8p+0"},
+    TestItem{0x1.edd2f1a9fbe77p+6, cuda::std::chars_format::hex, -1, "1.edd2f1a9fbe77p+6"},
+    TestItem{0x1.52d02c7e14af6p+76, cuda::std::chars_format::hex, -1, "1.52d02c7e14af6p+76"},
+    TestItem{0x1.3p+3, cuda::std::chars_format::hex, -1, "1.3p+3"},
+    TestItem{0x1.2d687p+20, cuda::std::chars_format::hex, -1, "1.2d687p+20"},
+    TestItem{0x1.01f31f46ed246p-13, cuda::std::chars_format::hex, -1, "1.01f31f46ed246p-13"},
+    TestItem{0x1.921fb54442d18p+1, cuda::std::chars_format::hex, -1, "1.921fb54442d18p+1"},
+    TestItem{0x1.ad7f29abcaf48p-24, cuda::std::chars_format::hex, -1, "1.ad7f29abcaf48p-24"},
+    TestItem{0x0.0000000000001p-1022, cuda::std::chars_format::hex, -1, "0.0000000000001p-1022"},
+    TestItem{0x1p-1022, cuda::std::chars_format::hex, -1, "1p-1022"},
+    TestItem{0x1.fffffffffffffp+1023, cuda::std::chars_format::hex, -1, "1.fffffffffffffp+1023"},
+    TestItem{0x0p+0, cuda::std::chars_format::hex, 0, "0p+0"},
+    TestItem{0x1p+0, cuda::std::chars_format::hex, 0, "1p+0"},
+    TestItem{0x1.999999999999ap-4, cuda::std::chars_format::hex, 0, "2p-4"},
+    TestItem{0x1.8p+0, cuda::std::chars_format::hex, 0, "2p+0"},
+    TestItem{0x1.edd2f1a9fbe77p+6, cuda::std::chars_format::hex, 0, "2p+6"},
+    TestItem{0x1.52d02c7e14af6p+76, cuda::std::chars_format::hex, 0, "1p+76"},
+    TestItem{0x1.3p+3, cuda::std::chars_format::hex, 0, "1p+3"},
+    TestItem{0x1.2d687p+20, cuda::std::chars_format::hex, 0, "1p+20"},
+    TestItem{0x1.01f31f46ed246p-13, cuda::std::chars_format::hex, 0, "1p-13"},
+    TestItem{0x1.921fb54442d18p+1, cuda::std::chars_format::hex, 0, "2p+1"},
+    TestItem{0x1.ad7f29abcaf48p-24, cuda::std::chars_format::hex, 0, "2p-24"},
+    TestItem{0x0.0000000000001p-1022, cuda::std::chars_format::hex, 0, "0p-1022"},
+    TestItem{0x1p-1022, cuda::std::chars_format::hex, 0, "1p-1022"},
+    TestItem{0x1.fffffffffffffp+1023, cuda::std::chars_format::hex, 0, "2p+1023"},
+    TestItem{0x0p+0, cuda::std::chars_format::hex, 4, "0.0000p+0"},
+    TestItem{0x1p+0, cuda::std::chars_format::hex, 4, "1.0000p+0"},
+    TestItem{0x1.999999999999ap-4, cuda::std::chars_format::hex, 4, "1.999ap-4"},
+    TestItem{0x1.8p+0, cuda::std::chars_format::hex, 4, "1.8000p+0"},
+    TestItem{0x1.edd2f1a9fbe77p+6, cuda::std::chars_format::hex, 4, "1.edd3p+6"},
+    TestItem{0x1.52d02c7e14af6p+76, cuda::std::chars_format::hex, 4, "1.52d0p+76"},
+    TestItem{0x1.3p+3, cuda::std::chars_format::hex, 4, "1.3000p+3"},
+    TestItem{0x1.2d687p+20, cuda::std::chars_format::hex, 4, "1.2d68p+20"},
+    TestItem{0x1.01f31f46ed246p-13, cuda::std::chars_format::hex, 4, "1.01f3p-13"},
+    TestItem{0x1.921fb54442d18p+1, cuda::std::chars_format::hex, 4, "1.9220p+1"},
+    TestItem{0x1.ad7f29abcaf48p-24, cuda::std::chars_format::hex, 4, "1.ad7fp-24"},
+    TestItem{0x0.0000000000001p-1022, cuda::std::chars_format::hex, 4, "0.0000p-1022"},
+    TestItem{0x1p-1022, cuda::std::chars_format::hex, 4, "1.0000p-1022"},
+    TestItem{0x1.fffffffffffffp+1023, cuda::std::chars_format::hex, 4, "2.0000p+1023"},
+    TestItem{0x0p+0, cuda::std::chars_format::hex, 17, "0.00000000000000000p+0"},
+    TestItem{0x1p+0, cuda::std::chars_format::hex, 17, "1.00000000000000000p+0"},
+    TestItem{0x1.999999999999ap-4, cuda::std::chars_format::hex, 17, "1.999999999999a0000p-4"},
+    TestItem{0x1.8p+0, cuda::std::chars_format::hex, 17, "1.80000000000000000p+0"},
+    TestItem{0x1.edd2f1a9fbe77p+6, cuda::std::chars_format::hex, 17, "1.edd2f1a9fbe770000p+6"},
+    TestItem{0x1.52d02c7e14af6p+76, cuda::std::chars_format::hex, 17, "1.52d02c7e14af60000p+76"},
+    TestItem{0x1.3p+3, cuda::std::chars_format::hex, 17, "1.30000000000000000p+3"},
+    TestItem{0x1.2d687p+20, cuda::std::chars_format::hex, 17, "1.2d687000000000000p+20"},
+    TestItem{0x1.01f31f46ed246p-13, cuda::std::chars_format::hex, 17, "1.01f31f46ed2460000p-13"},
+    TestItem{0x1.921fb54442d18p+1, cuda::std::chars_format::hex, 17, "1.921fb54442d180000p+1"},
+    TestItem{0x1.ad7f29abcaf48p-24, cuda::std::chars_format::hex, 17, "1.ad7f29abcaf480000p-24"},
+    TestItem{0x0.0000000000001p-1022, cuda::std::chars_format::hex, 17, "0.00000000000010000p-1022"},
+    TestItem{0x1p-1022, cuda::std::chars_format::hex, 17, "1.00000000000000000p-1022"},
+    TestItem{0x1.fffffffffffffp+1023, cuda::std::chars_format::hex, 17, "1.fffffffffffff0000p+1023"},
+  }};
+}
+
+__host__ __device__ constexpr cuda::std::to_chars_result
+call_to_chars(char* first, char* last, double value, const TestItem& item)
+{
+  if (item.fmt == cuda::std::chars_format{})
+  {
+    return cuda::std::to_chars(first, last, value);
+  }
+  if (item.precision < 0)
+  {
+    return cuda::std::to_chars(first, last, value, item.fmt);
+  }
+  return cuda::std::to_chars(first, last, value, item.fmt, item.precision);
+}
+
+__host__ __device__ constexpr void test_to_chars(const TestItem& item)
+{
+  constexpr cuda::std::size_t buff_size = 350;
+
+  static_assert(cuda::std::is_same_v<
+                cuda::std::to_chars_result,
+                decltype(cuda::std::to_chars(cuda::std::declval<char*>(), cuda::std::declval<char*>(), double{}))>);
+  static_assert(noexcept(cuda::std::to_chars(cuda::std::declval<char*>(), cuda::std::declval<char*>(), double{})));
+  static_assert(noexcept(cuda::std::to_chars(
+    cuda::std::declval<char*>(), cuda::std::declval<char*>(), double{}, cuda::std::chars_format::general)));
+  static_assert(noexcept(cuda::std::to_chars(
+    cuda::std::declval<char*>(), cuda::std::declval<char*>(), double{}, cuda::std::chars_format::general, int{})));
+
+  char buff[buff_size + 1]{};
+  char* buff_start = buff + 1;
+
+  const auto ref_len = cuda::std::strlen(item.str);
+
+  // Check valid buffer size
+  {
+    const auto result = call_to_chars(buff_start, buff_start + buff_size, item.val, item);
+    assert(result.ec == cuda::std::errc{});
+    assert(result.ptr == buff_start + ref_len);
+
+    // Compare with reference string
+    assert(cuda::std::strncmp(buff_start, item.str, ref_len) == 0);
+
+    // Check that the operation did not underflow the buffer
+    assert(buff[0] == '\0');
+  }
+
+  // Check the negated value
+  {
+    const auto result = call_to_chars(buff_start, buff_start + buff_size, -item.val, item);
+    assert(result.ec == cuda::std::errc{});
+    assert(result.ptr == buff_start + ref_len + 1);
+    assert(buff_start[0] == '-');
+    assert(cuda::std::strncmp(buff_start + 1, item.str, ref_len) == 0);
+  }
+
+  // Check too small buffer
+  {
+    const auto result = call_to_chars(buff_start, buff_start + ref_len - 1, item.val, item);
+    assert(result.ec == cuda::std::errc::value_too_large);
+    assert(result.ptr == buff_start + ref_len - 1);
+  }
+
+  // Check zero buffer
+  {
+    const auto result = call_to_chars(buff_start, buff_start, item.val, item);
+    assert(result.ec == cuda::std::errc::value_too_large);
+    assert(result.ptr == buff_start);
+  }
+}
+
+__host__ __device__ constexpr bool test(cuda::std::chars_format fmt)
+{
+  constexpr auto items = get_test_items();
+
+  for (const auto& item : items)
+  {
+    if (item.fmt == fmt)
+    {
+      test_to_chars(item);
+    }
+  }
+
+  return true;
+}
+
+__host__ __device__ constexpr bool test()
+{
+  test(cuda::std::chars_format{});
+  test(cuda::std::chars_format::scientific);
+  test(cuda::std::chars_format::fixed);
+  test(cuda::std::chars_format::general);
+  test(cuda::std::chars_format::hex);
+
+  return true;
+}
+
+int main(int, char**)
+{
+  test();
+  static_assert(test(cuda::std::chars_format{}));
+  static_assert(test(cuda::std::chars_format::scientific));
+  static_assert(test(cuda::std::chars_format::fixed));
+  static_assert(test(cuda::std::chars_format::general));
+  static_assert(test(cuda::std::chars_format::hex));
+  return 0;
+}
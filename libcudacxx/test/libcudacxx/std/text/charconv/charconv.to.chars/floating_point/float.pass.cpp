@@ -0,0 +1,415 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/std/array>
+#include <cuda/std/charconv>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstring>
+#include <cuda/std/limits>
+#include <cuda/std/type_traits>
+
+#include "test_macros.h"
+
+struct TestItem
+{
+  float val;
+  cuda::std::chars_format fmt;
+  int precision;
+  const char* str;
+};
+
+// Source code for the generation of the test items
+// #include <charconv>
+// #include <cstdio>
+// #include <string>
+
+// constexpr float list[] = {
+//   0.0f, 1.0f, 0.1f, 1.5f, 123.456f, 1e23f, 9.5f, 1234567.0f, 0.000123f,
+//   3.1415927f, 1e-7f, 1e-45f, 1.17549435e-38f, 3.40282347e38f};
+// constexpr int precisions[] = {-1, 0, 4, 17};
+
+// int main()
+// {
+//   for (int fmt = 0; fmt <= 4; ++fmt)
+//   {
+//     for (int precision : precisions)
+//     {
+//       // fmt 0 is the overload without chars_format, precision -1 is the overload without precision
+//       if (fmt == 0 && precision != -1)
+//       {
+//         continue;
+//       }
+//       for (auto v : list)
+//       {
+//         char buff[1000]{};
+//         const auto f = static_cast<std::chars_format>(fmt);
+//         const auto r = (fmt == 0)        ? std::to_chars(buff, buff + 1000, v)
+//                      : (precision < 0) ? std::to_chars(buff, buff + 1000, v, f)
+//                                        : std::to_chars(buff, buff + 1000, v, f, precision);
+//         std::printf("TestItem{%a, %d, %d, \"%s\"},\n", v, fmt, precision, std::string(buff, r.ptr).c_str());
+//       }
+//     }
+//   }
+// }
+
+constexpr cuda::std::size_t num_test_items = 238;
+
+__host__ __device__ constexpr cuda::std::array<TestItem, num_test_items> get_test_items()
+{
+  return {{
+    TestItem{0x0p+0f, cuda::std::chars_format{}, -1, "0"},
+    TestItem{0x1p+0f, cuda::std::chars_format{}, -1, "1"},
+    TestItem{0x1.99999ap-4f, cuda::std::chars_format{}, -1, "0.1"},
+    TestItem{0x1.8p+0f, cuda::std::chars_format{}, -1, "1.5"},
+    TestItem{0x1.edd2f2p+6f, cuda::std::chars_format{}, -1, "123.456"},
+    TestItem{0x1.52d02cp+76f, cuda::std::chars_format{}, -1, "1e+23"},
+    TestItem{0x1.3p+3f, cuda::std::chars_format{}, -1, "9.5"},
+    TestItem{0x1.2d687p+20f, cuda::std::chars_format{}, -1, "1234567"},
+    TestItem{0x1.01f32p-13f, cuda::std::chars_format{}, -1, "0.000123"},
+    TestItem{0x1.921fb6p+1f, cuda::std::chars_format{}, -1, "3.1415927"},
+    TestItem{0x1.ad7f2ap-24f, cuda::std::chars_format{}, -1, "1e-07"},
+    TestItem{0x1p-149f, cuda::std::chars_format{}, -1, "1e-45"},
+    TestItem{0x1p-126f, cuda::std::chars_format{}, -1, "1.1754944e-38"},
+    TestItem{0x1.fffffep+127f, cuda::std::chars_format{}, -1, "3.4028235e+38"},
+    TestItem{0x0p+0f, cuda::std::chars_format::scientific, -1, "0e+00"},
+    TestItem{0x1p+0f, cuda::std::chars_format::scientific, -1, "1e+00"},
+    TestItem{0x1.99999ap-4f, cuda::std::chars_format::scientific, -1, "1e-01"},
+    TestItem{0x1.8p+0f, cuda::std::chars_format::scientific, -1, "1.5e+00"},
+    TestItem{0x1.edd2f2p+6f, cuda::std::chars_format::scientific, -1, "1.23456e+02"},
+    TestItem{0x1.52d02cp+76f, cuda::std::chars_format::scientific, -1, "1e+23"},
+    TestItem{0x1.3p+3f, cuda::std::chars_format::scientific, -1, "9.5e+00"},
+    TestItem{0x1.2d687p+20f, cuda::std::chars_format::scientific, -1, "1.234567e+06"},
+    TestItem{0x1.01f32p-13f, cuda::std::chars_format::scientific, -1, "1.23e-04"},
+    TestItem{0x1.921fb6p+1f, cuda::std::chars_format::scientific, -1, "3.1415927e+00"},
+    TestItem{0x1.ad7f2ap-24f, cuda::std::chars_format::scientific, -1, "1e-07"},
+    TestItem{0x1p-149f, cuda::std::chars_format::scientific, -1, "1e-45"},
+    TestItem{0x1p-126f, cuda::std::chars_format::scientific, -1, "1.1754944e-38"},
+    TestItem{0x1.fffffep+127f, cuda::std::chars_format::scientific, -1, "3.4028235e+38"},
+    TestItem{0x0p+0f, cuda::std::chars_format::scientific, 0, "0e+00"},
+    TestItem{0x1p+0f, cuda::std::chars_format::scientific, 0, "1e+00"},
+    TestItem{0x1.99999ap-4f, cuda::std::chars_format::scientific, 0, "1e-01"},
+    TestItem{0x1.8p+0f, cuda::std::chars_format::scientific, 0, "2e+00"},
+    TestItem{0x1.edd2f2p+6f, cuda::std::chars_format::scientific, 0, "1e+02"},
+    TestItem{0x1.52d02cp+76f, cuda::std::chars_format::scientific, 0, "1e+23"},
+    TestItem{0x1.3p+3f, cuda::std::chars_format::scientific, 0, "1e+01"},
+    TestItem{0x1.2d687p+20f, cuda::std::chars_format::scientific, 0, "1e+06"},
+    TestItem{0x1.01f32p-13f, cuda::std::chars_format::scientific, 0, "1e-04"},
+    TestItem{0x1.921fb6p+1f, cuda::std::chars_format::scientific, 0, "3e+00"},
+    TestItem{0x1.ad7f2ap-24f, cuda::std::chars_format::scientific, 0, "1e-07"},
+    TestItem{0x1p-149f, cuda::std::chars_format::scientific, 0, "1e-45"},
+    TestItem{0x1p-126f, cuda::std::chars_format::scientific, 0, "1e-38"},
+    TestItem{0x1.fffffep+127f, cuda::std::chars_format::scientific, 0, "3e+38"},
+    TestItem{0x0p+0f, cuda::std::chars_format::scientific, 4, "0.0000e+00"},
+    TestItem{0x1p+0f, cuda::std::chars_format::scientific, 4, "1.0000e+00"},
+    TestItem{0x1.99999ap-4f, cuda::std::chars_format::scientific, 4, "1.0000e-01"},
+    TestItem{0x1.8p+0f, cuda::std::chars_format::scientific, 4, "1.5000e+00"},
+    TestItem{0x1.edd2f2p+6f, cuda::std::chars_format::scientific, 4, "1.2346e+02"},
+    TestItem{0x1.52d02cp+76f, cuda::std::chars_format::scientific, 4, "1.0000e+23"},
+    TestItem{0x1.3p+3f, cuda::std::chars_format::scientific, 4, "9.5000e+00"},
+    TestItem{0x1.2d687p+20f, cuda::std::chars_format::scientific, 4, "1.2346e+06"},
+    TestItem{0x1.01f32p-13f, cuda::std::chars_format::scientific, 4, "1.2300e-04"},
+    TestItem{0x1.921fb6p+1f, cuda::std::chars_format::scientific, 4, "3.1416e+00"},
+    TestItem{0x1.ad7f2ap-24f, cuda::std::chars_format::scientific, 4, "1.0000e-07"},
+    TestItem{0x1p-149f, cuda::std::chars_format::scientific, 4, "1.4013e-45"},
+    TestItem{0x1p-126f, cuda::std::chars_format::scientific, 4, "1.1755e-38"},
+    TestItem{0x1.fffffep+127f, cuda::std::chars_format::scientific, 4, "3.4028e+38"},
+    TestItem{0x0p+0f, cuda::std::chars_format::scientific, 17, "0.00000000000000000e+00"},
+    TestItem{0x1p+0f, cuda::std::chars_format::scientific, 17, "1.00000000000000000e+00"},
+    TestItem{0x1.99999ap-4f, cuda::std::chars_format::scientific, 17, "1.00000001490116119e-01"},
+    TestItem{0x1.8p+0f, cuda::std::chars_format::scientific, 17, "1.50000000000000000e+00"},
+    TestItem{0x1.edd2f2p+6f, cuda::std::chars_format::scientific, 17, "1.23456001281738281e+02"},
+    TestItem{0x1.52d02cp+76f, cuda::std::chars_format::scientific, 17, "9.99999977819630836e+22"},
+    TestItem{0x1.3p+3f, cuda::std::chars_format::scientific, 17, "9.50000000000000000e+00"},
+    TestItem{0x1.2d687p+20f, cuda::std::chars_format::scientific, 17, "1.23456700000000000e+06"},
+    TestItem{0x1.01f32p-13f, cuda::std::chars_format::scientific, 17, "1.23000005260109901e-04"},
+    TestItem{0x1.921fb6p+1f, cuda::std::chars_format::scientific, 17, "3.14159274101257324e+00"},
+    TestItem{0x1.ad7f2ap-24f, cuda::std::chars_format::scientific, 17, "1.00000001168609742e-07"},
+    TestItem{0x1p-149f, cuda::std::chars_format::scientific, 17, "1.40129846432481707e-45"},
+    TestItem{0x1p-126f, cuda::std::chars_format::scientific, 17, "1.17549435082228751e-38"},
+    TestItem{0x1.fffffep+127f, cuda::std::chars_format::scientific, 17, "3.40282346638528860e+38"},
+    TestItem{0x0p+0f, cuda::std::chars_format::fixed, -1, "0"},
+    TestItem{0x1p+0f, cuda::std::chars_format::fixed, -1, "1"},
+    TestItem{0x1.99999ap-4f, cuda::std::chars_format::fixed, -1, "0.1"},
+    TestItem{0x1.8p+0f, cuda::std::chars_format::fixed, -1, "1.5"},
+    TestItem{0x1.edd2f2p+6f, cuda::std::chars_format::fixed, -1, "123.456"},
+    TestItem{0x1.52d02cp+76f, cuda::std::chars_format::fixed, -1, "99999997781963083612160"},
+    TestItem{0x1.3p+3f, cuda::std::chars_format::fixed, -1, "9.5"},
+    TestItem{0x1.2d687p+20f, cuda::std::chars_format::fixed, -1, "1234567"},
+    TestItem{0x1.01f32p-13f, cuda::std::chars_format::fixed, -1, "0.000123"},
+    TestItem{0x1.921fb6p+1f, cuda::std::chars_format::fixed, -1, "3.1415927"},
+    TestItem{0x1.ad7f2ap-24f, cuda::std::chars_format::fixed, -1, "0.0000001"},
+    TestItem{0x1p-149f, cuda::std::chars_format::fixed, -1, "0.000000000000000000000000000000000000000000001"},
+    TestItem{0x1p-126f, cuda::std::chars_format::fixed, -1, "0.000000000000000000000000000000000000011754944"},
+    TestItem{0x1.fffffep+127f, cuda::std::chars_format::fixed, -1, "340282346638528859811704183484516925440"},
+    TestItem{0x0p+0f, cuda::std::chars_format::fixed, 0, "0"},
+    TestItem{0x1p+0f, cuda::std::chars_format::fixed, 0, "1"},
+    TestItem{0x1.99999ap-4f, cuda::std::chars_format::fixed, 0, "0"},
+    TestItem{0x1.8p+0f, cuda::std::chars_format::fixed, 0, "2"},
+    TestItem{0x1.edd2f2p+6f, cuda::std::chars_format::fixed, 0, "123"},
+    TestItem{0x1.52d02cp+76f, cuda::std::chars_format::fixed, 0, "99999997781963083612160"},
+    TestItem{0x1.3p+3f, cuda::std::chars_format::fixed, 0, "10"},
+    TestItem{0x1.2d687p+20f, cuda::std::chars_format::fixed, 0, "1234567"},
+    TestItem{0x1.01f32p-13f, cuda::std::chars_format::fixed, 0, "0"},
+    TestItem{0x1.921fb6p+1f, cuda::std::chars_format::fixed, 0, "3"},
+    TestItem{0x1.ad7f2ap-24f, cuda::std::chars_format::fixed, 0, "0"},
+    TestItem{0x1p-149f, cuda::std::chars_format::fixed, 0, "0"},
+    TestItem{0x1p-126f, cuda::std::chars_format::fixed, 0, "0"},
+    TestItem{0x1.fffffep+127f, cuda::std::chars_format::fixed, 0, "340282346638528859811704183484516925440"},
+    TestItem{0x0p+0f, cuda::std::chars_format::fixed, 4, "0.0000"},
+    TestItem{0x1p+0f, cuda::std::chars_format::fixed, 4, "1.0000"},
+    TestItem{0x1.99999ap-4f, cuda::std::chars_format::fixed, 4, "0.1000"},
+    TestItem{0x1.8p+0f, cuda::std::chars_format::fixed, 4, "1.5000"},
+    TestItem{0x1.edd2f2p+6f, cuda::std::chars_format::fixed, 4, "123.4560"},
+    TestItem{0x1.52d02cp+76f, cuda::std::chars_format::fixed, 4, "99999997781963083612160.0000"},
+    TestItem{0x1.3p+3f, cuda::std::chars_format::fixed, 4, "9.5000"},
+    TestItem{0x1.2d687p+20f, cuda::std::chars_format::fixed, 4, "1234567.0000"},
+    TestItem{0x1.01f32p-13f, cuda::std::chars_format::fixed, 4, "0.0001"},
+    TestItem{0x1.921fb6p+1f, cuda::std::chars_format::fixed, 4, "3.1416"},
+    TestItem{0x1.ad7f2ap-24f, cuda::std::chars_format::fixed, 4, "0.0000"},
+    TestItem{0x1p-149f, cuda::std::chars_format::fixed, 4, "0.0000"},
+    TestItem{0x1p-126f, cuda::std::chars_format::fixed, 4, "0.0000"},
+    TestItem{0x1.fffffep+127f, cuda::std::chars_format::fixed, 4, "340282346638528859811704183484516925440.0000"},
+    TestItem{0x0p+0f, cuda::std::chars_format::fixed, 17, "0.00000000000000000"},
+    TestItem{0x1p+0f, cuda::std::chars_format::fixed, 17, "1.00000000000000000"},
+    TestItem{0x1.99999ap-4f, cuda::std::chars_format::fixed, 17, "0.10000000149011612"},
+    TestItem{0x1.8p+0f, cuda::std::chars_format::fixed, 17, "1.50000000000000000"},
+    TestItem{0x1.edd2f2p+6f, cuda::std::chars_format::fixed, 17, "123.45600128173828125"},
+    TestItem{0x1.52d02cp+76f, cuda::std::chars_format::fixed, 17, "99999997781963083612160.00000000000000000"},
+    TestItem{0x1.3p+3f, cuda::std::chars_format::fixed, 17, "9.50000000000000000"},
+    TestItem{0x1.2d687p+20f, cuda::std::chars_format::fixed, 17, "1234567.00000000000000000"},
+    TestItem{0x1.01f32p-13f, cuda::std::chars_format::fixed, 17, "0.00012300000526011"},
+    TestItem{0x1.921fb6p+1f, cuda::std::chars_format::fixed, 17, "3.14159274101257324"},
+    TestItem{0x1.ad7f2ap-24f, cuda::std::chars_format::fixed, 17, "0.00000010000000117"},
+    TestItem{0x1p-149f, cuda::std::chars_format::fixed, 17, "0.00000000000000000"},
+    TestItem{0x1p-126f, cuda::std::chars_format::fixed, 17, "0.00000000000000000"},
+    TestItem{0x1.fffffep+127f,
+             cuda::std::chars_format::fixed,
+             17,
+             "340282346638528859811704183484516925440.00000000000000000"},
+    TestItem{0x0p+0f, cuda::std::chars_format::general, -1, "0"},
+    TestItem{0x1p+0f, cuda::std::chars_format::general, -1, "1"},
+    TestItem{0x1.99999ap-4f, cuda::std::chars_format::general, -1, "0.1"},
+    TestItem{0x1.8p+0f, cuda::std::chars_format::general, -1, "1.5"},
+    TestItem{0x1.edd2f2p+6f, cuda::std::chars_format::general, -1, "123.456"},
+    TestItem{0x1.52d02cp+76f, cuda::std::chars_format::general, -1, "1e+23"},
+    TestItem{0x1.3p+3f, cuda::std::chars_format::general, -1, "9.5"},
+    TestItem{0x1.2d687p+20f, cuda::std::chars_format::general, -1, "1.234567e+06"},
+    TestItem{0x1.01f32p-13f, cuda::std::chars_format::general, -1, "0.000123"},
+    TestItem{0x1.921fb6p+1f, cuda::std::chars_format::general, -1, "3.1415927"},
+    TestItem{0x1.ad7f2ap-24f, cuda::std::chars_format::general, -1, "1e-07"},
+    TestItem{0x1p-149f, cuda::std::chars_format::general, -1, "1e-45"},
+    TestItem{0x1p-126f, cuda::std::chars_format::general, -1, "1.1754944e-38"},
+    TestItem{0x1.fffffep+127f, cuda::std::chars_format::general, -1, "3.4028235e+38"},
+    TestItem{0x0p+0f, cuda::std::chars_format::general, 0, "0"},
+    TestItem{0x1p+0f, cuda::std::chars_format::general, 0, "1"},
+    TestItem{0x1.99999ap-4f, cuda::std::chars_format::general, 0, "0.1"},
+    TestItem{0x1.8p+0f, cuda::std::chars_format::general, 0, "2"},
+    TestItem{0x1.edd2f2p+6f, cuda::std::chars_format::general, 0, "1e+02"},
+    TestItem{0x1.52d02cp+76f, cuda::std::chars_format::general, 0, "1e+23"},
+    TestItem{0x1.3p+3f, cuda::std::chars_format::general, 0, "1e+01"},
+    TestItem{0x1.2d687p+20f, cuda::std::chars_format::general, 0, "1e+06"},
+    TestItem{0x1.01f32p-13f, cuda::std::chars_format::general, 0, "0.0001"},
+    TestItem{0x1.921fb6p+1f, cuda::std::chars_format::general, 0, "3"},
+    TestItem{0x1.ad7f2ap-24f, cuda::std::chars_format::general, 0, "1e-07"},
+    TestItem{0x1p-149f, cuda::std::chars_format::general, 0, "1e-45"},
+    TestItem{0x1p-126f, cuda::std::chars_format::general, 0, "1e-38"},
+    TestItem{0x1.fffffep+127f, cuda::std::chars_format::general, 0, "3e+38"},
+    TestItem{0x0p+0f, cuda::std::chars_format::general, 4, "0"},
+    TestItem{0x1p+0f, cuda::std::chars_format::general, 4, "1"},
+    TestItem{0x1.99999ap-4f, cuda::std::chars_format::general, 4, "0.1"},
+    TestItem{0x1.8p+0f, cuda::std::chars_format::general, 4, "1.5"},
+    TestItem{0x1.edd2f2p+6f, cuda::std::chars_format::general, 4, "123.5"},
+    TestItem{0x1.52d02cp+76f, cuda::std::chars_format::general, 4, "1e+23"},
+    TestItem{0x1.3p+3f, cuda::std::chars_format::general, 4, "9.5"},
+    TestItem{0x1.2d687p+20f, cuda::std::chars_format::general, 4, "1.235e+06"},
+    TestItem{0x1.01f32p-13f, cuda::std::chars_format::general, 4, "0.000123"},
+    TestItem{0x1.921fb6p+1f, cuda::std::chars_format::general, 4, "3.142"},
+    TestItem{0x1.ad7f2ap-24f, cuda::std::chars_format::general, 4, "1e-07"},
+    TestItem{0x1p-149f, cuda::std::chars_format::general, 4, "1.401e-45"},
+    TestItem{0x1p-126f, cuda::std::chars_format::general, 4, "1.175e-38"},
+    TestItem{0x1.fffffep+127f, cuda::std::chars_format::general, 4, "3.403e+38"},
+    TestItem{0x0p+0f, cuda::std::chars_format::general, 17, "0"},
+    TestItem{0x1p+0f, cuda::std::chars_format::general, 17, "1"},
+    TestItem{0x1.99999ap-4f, cuda::std::chars_format::general, 17, "0.10000000149011612"},
+    TestItem{0x1.8p+0f, cuda::std::chars_format::general, 17, "1.5"},
+    TestItem{0x1.edd2f2p+6f, cuda::std::chars_format::general, 17, "123.45600128173828"},
+    TestItem{0x1.52d02cp+76f, cuda::std::chars_format::general, 17, "9.9999997781963084e+22"},
+    TestItem{0x1.3p+3f, cuda::std::chars_format::general, 17, "9.5"},
+    TestItem{0x1.2d687p+20f, cuda::std::chars_format::general, 17, "1234567"},
+    TestItem{0x1.01f32p-13f, cuda::std::chars_format::general, 17, "0.0001230000052601099"},
+    TestItem{0x1.921fb6p+1f, cuda::std::chars_format::general, 17, "3.1415927410125732"},
+    TestItem{0x1.ad7f2ap-24f, cuda::std::chars_format::general, 17, "1.0000000116860974e-07"},
+    TestItem{0x1p-149f, cuda::std::chars_format::general, 17, "1.4012984643248171e-45"},
+    TestItem{0x1p-126f, cuda::std::chars_format::general, 17, "1.1754943508222875e-38"},
+    TestItem{0x1.fffffep+127f, cuda::std::chars_format::general, 17, "3.4028234663852886e+38"},
+    TestItem{0x0p+0f, cuda::std::chars_format::hex, -1, "0p+0"},
+    TestItem{0x1p+0f, cuda::std::chars_format::hex, -1, "1p+0"},
+    TestItem{0x1.99999ap-4f, cuda::std::chars_format::hex, -1, "1.99999ap-4"},
+    TestItem{0x1.8p+0f, cuda::std::chars_format::hex, -1, "1.8p+0"},
+    TestItem{0x1.edd2f2p+6f, cuda::std::chars_format::hex, -1, "1.edd2f2p+6"},
+    TestItem{0x1.52d02cp+76f, cuda::std::chars_format::hex, -1, "1.52d02cp+76"},
+    TestItem{0x1.3p+3f, cuda::std::chars_format::hex, -1, "1.3p+3"},
+    TestItem{0x1.2d687p+20f, cuda::std::chars_format::hex, -1, "1.2d687p+20"},
+    TestItem{0x1.01f32p-13f, cuda::std::chars_format::hex, -1, "1.01f32p-13"},
+    TestItem{0x1.921fb6p+1f, cuda::std::chars_format::hex, -1, "1.921fb6p+1"},
+    TestItem{0x1.ad7f2ap-24f, cuda::std::chars_format::hex, -1, "1.ad7f2ap-24"},
+    TestItem{0x1p-149f, cuda::std::chars_format::hex, -1, "0.000002p-126"},
+    TestItem{0x1p-126f, cuda::std::chars_format::hex, -1, "1p-126"},
+    TestItem{0x1.fffffep+127f, cuda::std::chars_format::hex, -1, "1.fffffep+127"},
+    TestItem{0x0p+0f, cuda::std::chars_format::hex, 0, "0p+0"},
+    TestItem{0x1p+0f, cuda::std::chars_format::hex, 0, "1p+0"},
+    TestItem{0x1.99999ap-4f, cuda::std::chars_format::hex, 0, "2p-4"},
+    TestItem{0x1.8p+0f, cuda::std::chars_format::hex, 0, "2p+0"},
+    TestItem{0x1.edd2f2p+6f, cuda::std::chars_format::hex, 0, "2p+6"},
+    TestItem{0x1.52d02cp+76f, cuda::std::chars_format::hex, 0, "1p+76"},
+    TestItem{0x1.3p+3f, cuda::std::chars_format::hex, 0, "1p+3"},
+    TestItem{0x1.2d687p+20f, cuda::std::chars_format::hex, 0, "1p+20"},
+    TestItem{0x1.01f32p-13f, cuda::std::chars_format::hex, 0, "1p-13"},
+    TestItem{0x1.921fb6p+1f, cuda::std::chars_format::hex, 0, "2p+1"},
+    TestItem{0x1.ad7f2ap-24f, cuda::std::chars_format::hex, 0, "2p-24"},
+    TestItem{0x1p-149f, cuda::std::chars_format::hex, 0, "0p-126"},
+    TestItem{0x1p-126f, cuda::std::chars_format::hex, 0, "1p-126"},
+    TestItem{0x1.fffffep+127f, cuda::std::chars_format::hex, 0, "2p+127"},
+    TestItem{0x0p+0f, cuda::std::chars_format::hex, 4, "0.0000p+0"},
+    TestItem{0x1p+0f, cuda::std::chars_format::hex, 4, "1.0000p+0"},
+    TestItem{0x1.99999ap-4f, cuda::std::chars_format::hex, 4, "1.999ap-4"},
+    TestItem{0x1.8p+0f, cuda::std::chars_format::hex, 4, "1.8000p+0"},
+    TestItem{0x1.edd2f2p+6f, cuda::std::chars_format::hex, 4, "1.edd3p+6"},
+    TestItem{0x1.52d02cp+76f, cuda::std::chars_format::hex, 4, "1.52d0p+76"},
+    TestItem{0x1.3p+3f, cuda::std::chars_format::hex, 4, "1.3000p+3"},
+    TestItem{0x1.2d687p+20f, cuda::std::chars_format::hex, 4, "1.2d68p+20"},
+    TestItem{0x1.01f32p-13f, cuda::std::chars_format::hex, 4, "1.01f3p-13"},
+    TestItem{0x1.921fb6p+1f, cuda::std::chars_format::hex, 4, "1.9220p+1"},
+    TestItem{0x1.ad7f2ap-24f, cuda::std::chars_format::hex, 4, "1.ad7fp-24"},
+    TestItem{0x1p-149f, cuda::std::chars_format::hex, 4, "0.0000p-126"},
+    TestItem{0x1p-126f, cuda::std::chars_format::hex, 4, "1.0000p-126"},
+    TestItem{0x1.fffffep+127f, cuda::std::chars_format::hex, 4, "2.0000p+127"},
+    TestItem{0x0p+0f, cuda::std::chars_format::hex, 17, "0.00000000000000000p+0"},
+    TestItem{0x1p+0f, cuda::std::chars_format::hex, 17, "1.00000000000000000p+0"},
+    TestItem{0x1.99999ap-4f, cuda::std::chars_format::hex, 17, "1.99999a00000000000p-4"},
+    TestItem{0x1.8p+0f, cuda::std::chars_format::hex, 17, "1.80000000000000000p+0"},
+    TestItem{0x1.edd2f2p+6f, cuda::std::chars_format::hex, 17, "1.edd2f200000000000p+6"},
+    TestItem{0x1.52d02cp+76f, cuda::std::chars_format::hex, 17, "1.52d02c00000000000p+76"},
+    TestItem{0x1.3p+3f, cuda::std::chars_format::hex, 17, "1.30000000000000000p+3"},
+    TestItem{0x1.2d687p+20f, cuda::std::chars_format::hex, 17, "1.2d687000000000000p+20"},
+    TestItem{0x1.01f32p-13f, cuda::std::chars_format::hex, 17, "1.01f32000000000000p-13"},
+    TestItem{0x1.921fb6p+1f, cuda::std::chars_format::hex, 17, "1.921fb600000000000p+1"},
+    TestItem{0x1.ad7f2ap-24f, cuda::std::chars_format::hex, 17, "1.ad7f2a00000000000p-24"},
+    TestItem{0x1p-149f, cuda::std::chars_format::hex, 17, "0.00000200000000000p-126"},
+    TestItem{0x1p-126f, cuda::std::chars_format::hex, 17, "1.00000000000000000p-126"},
+    TestItem{0x1.fffffep+127f, cuda::std::chars_format::hex, 17, "1.fffffe00000000000p+127"},
+  }};
+}
+
+__host__ __device__ constexpr cuda::std::to_chars_result
+call_to_chars(char* first, char* last, float value, const TestItem& item)
+{
+  if (item.fmt == cuda::std::chars_format{})
+  {
+    return cuda::std::to_chars(first, last, value);
+  }
+  if (item.precision < 0)
+  {
+    return cuda::std::to_chars(first, last, value, item.fmt);
+  }
+  return cuda::std::to_chars(first, last, value, item.fmt, item.precision);
+}
+
+__host__ __device__ constexpr void test_to_chars(const TestItem& item)
+{
+  constexpr cuda::std::size_t buff_size = 350;
+
+  static_assert(cuda::std::is_same_v<
+                cuda::std::to_chars_result,
+                decltype(cuda::std::to_chars(cuda::std::declval<char*>(), cuda::std::declval<char*>(), float{}))>);
+  static_assert(noexcept(cuda::std::to_chars(cuda::std::declval<char*>(), cuda::std::declval<char*>(), float{})));
+  static_assert(noexcept(cuda::std::to_chars(
+    cuda::std::declval<char*>(), cuda::std::declval<char*>(), float{}, cuda::std::chars_format::general)));
+  static_assert(noexcept(cuda::std::to_chars(
+    cuda::std::declval<char*>(), cuda::std::declval<char*>(), float{}, cuda::std::chars_format::general, int{})));
+
+  char buff[buff_size + 1]{};
+  char* buff_start = buff + 1;
+
+  const auto ref_len = cuda::std::strlen(item.str);
+
+  // Check valid buffer size
+  {
+    const auto result = call_to_chars(buff_start, buff_start + buff_size, item.val, item);
+    assert(result.ec == cuda::std::errc{});
+    assert(result.ptr == buff_start + ref_len);
+
+    // Compare with reference string
+    assert(cuda::std::strncmp(buff_start, item.str, ref_len) == 0);
+
+    // Check that the operation did not underflow the buffer
+    assert(buff[0] == '\0');
+  }
+
+  // Check the negated value
+  {
+    const auto result = call_to_chars(buff_start, buff_start + buff_size, -item.val, item);
+    assert(result.ec == cuda::std::errc{});
+    assert(result.ptr == buff_start + ref_len + 1);
+    assert(buff_start[0] == '-');
+    assert(cuda::std::strncmp(buff_start + 1, item.str, ref_len) == 0);
+  }
+
+  // Check too small buffer
+  {
+    const auto result = call_to_chars(buff_start, buff_start + ref_len - 1, item.val, item);
+    assert(result.ec == cuda::std::errc::value_too_large);
+    assert(result.ptr == buff_start + ref_len - 1);
+  }
+
+  // Check zero buffer
+  {
+    const auto result = call_to_chars(buff_start, buff_start, item.val, item);
+    assert(result.ec == cuda::std::errc::value_too_large);
+    assert(result.ptr == buff_start);
+  }
+}
+
+__host__ __device__ constexpr bool test(cuda::std::chars_format fmt)
+{
+  constexpr auto items = get_test_items();
+
+  for (const auto& item : items)
+  {
+    if (item.fmt == fmt)
+    {
+      test_to_chars(item);
+    }
+  }
+
+  return true;
+}
+
+__host__ __device__ constexpr bool test()
+{
+  test(cuda::std::chars_format{});
+  test(cuda::std::chars_format::scientific);
+  test(cuda::std::chars_format::fixed);
+  test(cuda::std::chars_format::general);
+  test(cuda::std::chars_format::hex);
+
+  return true;
+}
+
+int main(int, char**)
+{
+  test();
+  static_assert(test(cuda::std::chars_format{}));
+  static_assert(test(cuda::std::chars_format::scientific));
+  static_assert(test(cuda::std::chars_format::fixed));
+  static_assert(test(cuda::std::chars_format::general));
+  static_assert(test(cuda::std::chars_format::hex));
+  return 0;
+}
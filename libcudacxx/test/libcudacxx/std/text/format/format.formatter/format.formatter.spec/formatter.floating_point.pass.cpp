@@ -0,0 +1,315 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// <cuda/std/format>
+
+// [format.formatter.spec]:
+// Each header that declares the template `formatter` provides the following
+// enabled specializations:
+// For each `charT`, for each cv-unqualified arithmetic type `ArithmeticT`
+// other than char, wchar_t, char8_t, char16_t, or char32_t, a specialization
+//    template<> struct formatter<ArithmeticT, charT>
+//
+// This file tests with `ArithmeticT = floating-point`, for each valid `charT`.
+// Where `floating-point` is one of:
+// - float
+// - double
+// - long double
+
+#include <cuda/std/__format_>
+#include <cuda/std/cassert>
+#include <cuda/std/concepts>
+#include <cuda/std/inplace_vector>
+#include <cuda/std/iterator>
+#include <cuda/std/limits>
+#include <cuda/std/memory>
+#include <cuda/std/type_traits>
+
+#include "literal.h"
+
+constexpr cuda::std::size_t max_output_size = 1200;
+
+template <class CharT, class T, class Check>
+__host__ __device__ void
+test_fp_formatter(cuda::std::basic_string_view<CharT> fmt, T value, cuda::std::size_t offset, Check check)
+{
+  using Container     = cuda::std::inplace_vector<CharT, max_output_size>;
+  using OutIt         = cuda::std::__back_insert_iterator<Container>;
+  using ParseContext  = cuda::std::basic_format_parse_context<CharT>;
+  using FormatContext = cuda::std::basic_format_context<OutIt, CharT>;
+
+  Container container{};
+
+  auto store   = cuda::std::make_format_args<FormatContext>(value);
+  auto args    = cuda::std::basic_format_args{store};
+  auto context = cuda::std::__fmt_make_format_context(OutIt{container}, args);
+
+  cuda::std::formatter<T, CharT> formatter{};
+  static_assert(cuda::std::semiregular<decltype(formatter)>);
+
+  ParseContext parse_ctx{fmt};
+  auto it = formatter.parse(parse_ctx);
+  static_assert(cuda::std::is_same_v<decltype(it), typename cuda::std::basic_string_view<CharT>::const_iterator>);
+
+  // std::to_address works around LWG3989 and MSVC STL's iterator debugging mechanism.
+  assert(cuda::std::to_address(it) == cuda::std::to_address(fmt.end()) - offset);
+
+  formatter.format(value, context);
+  check(cuda::std::basic_string_view{container.data(), container.size()});
+}
+
+template <class CharT, class T, class Check>
+__host__ __device__ void
+test_termination_condition_check(cuda::std::basic_string_view<CharT> fmt, T value, Check check)
+{
+  // The format-spec is valid if completely consumed or terminates at a '}'.
+  // The valid inputs all end with a '}'. The test is executed twice:
+  // - first with the terminating '}',
+  // - second consuming the entire input.
+  assert(fmt.back() == TEST_CHARLIT(CharT, '}'));
+
+  test_fp_formatter(fmt, value, 1, check);
+  fmt.remove_suffix(1);
+  test_fp_formatter(fmt, value, 0, check);
+}
+
+template <class CharT, class T>
+__host__ __device__ void test_termination_condition(
+  cuda::std::basic_string_view<CharT> fmt, T value, cuda::std::basic_string_view<CharT> expected)
+{
+  test_termination_condition_check(fmt, value, [expected](cuda::std::basic_string_view<CharT> result) {
+    assert(result == expected);
+  });
+}
+
+//! Checks that the output is @c prefix, followed by @c num_zeros zeros, followed by @c suffix
+template <class CharT>
+struct check_zeros
+{
+  cuda::std::basic_string_view<CharT> prefix;
+  cuda::std::size_t num_zeros;
+  cuda::std::basic_string_view<CharT> suffix;
+
+  __host__ __device__ void operator()(cuda::std::basic_string_view<CharT> result) const
+  {
+    assert(result.size() == prefix.size() + num_zeros + suffix.size());
+    assert(result.substr(0, prefix.size()) == prefix);
+    for (cuda::std::size_t i = 0; i != num_zeros; ++i)
+    {
+      assert(result[prefix.size() + i] == TEST_CHARLIT(CharT, '0'));
+    }
+    assert(result.substr(prefix.size() + num_zeros) == suffix);
+  }
+};
+
+template <class CharT, class T>
+__host__ __device__ void test_default()
+{
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, "}"), T(0), TEST_STRLIT(CharT, "0"));
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, "}"), T(-0.0), TEST_STRLIT(CharT, "-0"));
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, "}"), T(1.5), TEST_STRLIT(CharT, "1.5"));
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, "}"), T(-0.25), TEST_STRLIT(CharT, "-0.25"));
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, "}"), T(0.1), TEST_STRLIT(CharT, "0.1"));
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, "}"), T(1024), TEST_STRLIT(CharT, "1024"));
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, "}"), T(1e10), TEST_STRLIT(CharT, "1e+10"));
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, "}"), T(1.5e-7), TEST_STRLIT(CharT, "1.5e-07"));
+  test_termination_condition<CharT, T>(
+    TEST_STRLIT(CharT, "}"), cuda::std::numeric_limits<T>::infinity(), TEST_STRLIT(CharT, "inf"));
+  test_termination_condition<CharT, T>(
+    TEST_STRLIT(CharT, "}"), -cuda::std::numeric_limits<T>::infinity(), TEST_STRLIT(CharT, "-inf"));
+  test_termination_condition<CharT, T>(
+    TEST_STRLIT(CharT, "}"), cuda::std::numeric_limits<T>::quiet_NaN(), TEST_STRLIT(CharT, "nan"));
+
+  // A precision without a type selects the general notation.
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, ".3}"), T(1.2345), TEST_STRLIT(CharT, "1.23"));
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, ".3}"), T(1234.5), TEST_STRLIT(CharT, "1.23e+03"));
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, ".0}"), T(2.5), TEST_STRLIT(CharT, "2"));
+
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, "#}"), T(1), TEST_STRLIT(CharT, "1."));
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, "#}"), T(1e10), TEST_STRLIT(CharT, "1.e+10"));
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, "#.3}"), T(1), TEST_STRLIT(CharT, "1.00"));
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, "#.3}"), T(0.5), TEST_STRLIT(CharT, "0.500"));
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, "#.3}"), T(1e10), TEST_STRLIT(CharT, "1.00e+10"));
+}
+
+template <class CharT, class T>
+__host__ __device__ void test_fixed()
+{
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, "f}"), T(1), TEST_STRLIT(CharT, "1.000000"));
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, ".3f}"), T(3.14159), TEST_STRLIT(CharT, "3.142"));
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, ".0f}"), T(0.5), TEST_STRLIT(CharT, "0"));
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, ".0f}"), T(1.5), TEST_STRLIT(CharT, "2"));
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, ".2f}"), T(-1234.5), TEST_STRLIT(CharT, "-1234.50"));
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, "#.0f}"), T(3), TEST_STRLIT(CharT, "3."));
+  test_termination_condition<CharT, T>(
+    TEST_STRLIT(CharT, "f}"), cuda::std::numeric_limits<T>::infinity(), TEST_STRLIT(CharT, "inf"));
+  test_termination_condition<CharT, T>(
+    TEST_STRLIT(CharT, "F}"), cuda::std::numeric_limits<T>::infinity(), TEST_STRLIT(CharT, "INF"));
+  test_termination_condition<CharT, T>(
+    TEST_STRLIT(CharT, "F}"), -cuda::std::numeric_limits<T>::quiet_NaN(), TEST_STRLIT(CharT, "-NAN"));
+
+  // The digits beyond the exact value are zeros.
+  test_termination_condition_check<CharT, T>(
+    TEST_STRLIT(CharT, ".1100f}"), T(1), check_zeros<CharT>{TEST_STRLIT(CharT, "1."), 1100, TEST_STRLIT(CharT, "")});
+  test_termination_condition_check<CharT, T>(
+    TEST_STRLIT(CharT, ".160f}"),
+    cuda::std::numeric_limits<T>::denorm_min(),
+    [](cuda::std::basic_string_view<CharT> result) {
+      assert(result.size() == 162);
+      assert(result.substr(0, 3) == TEST_STRLIT(CharT, "0.0"));
+    });
+  test_termination_condition_check<CharT, T>(
+    TEST_STRLIT(CharT, ".0f}"), cuda::std::numeric_limits<T>::max(), [](cuda::std::basic_string_view<CharT> result) {
+      assert(result.size() == static_cast<cuda::std::size_t>(cuda::std::numeric_limits<T>::max_exponent10 + 1));
+    });
+}
+
+template <class CharT, class T>
+__host__ __device__ void test_scientific()
+{
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, "e}"), T(1234.5), TEST_STRLIT(CharT, "1.234500e+03"));
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, "E}"), T(1234.5), TEST_STRLIT(CharT, "1.234500E+03"));
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, ".2e}"), T(-0.00125), TEST_STRLIT(CharT, "-1.25e-03"));
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, ".0e}"), T(0), TEST_STRLIT(CharT, "0e+00"));
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, "#.0e}"), T(5), TEST_STRLIT(CharT, "5.e+00"));
+  test_termination_condition<CharT, T>(
+    TEST_STRLIT(CharT, "E}"), cuda::std::numeric_limits<T>::quiet_NaN(), TEST_STRLIT(CharT, "NAN"));
+
+  test_termination_condition_check<CharT, T>(
+    TEST_STRLIT(CharT, ".900e}"),
+    T(1),
+    check_zeros<CharT>{TEST_STRLIT(CharT, "1."), 900, TEST_STRLIT(CharT, "e+00")});
+}
+
+template <class CharT, class T>
+__host__ __device__ void test_general()
+{
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, "g}"), T(1234.5), TEST_STRLIT(CharT, "1234.5"));
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, "g}"), T(1e-5), TEST_STRLIT(CharT, "1e-05"));
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, "G}"), T(1e-5), TEST_STRLIT(CharT, "1E-05"));
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, "g}"), T(1e6), TEST_STRLIT(CharT, "1e+06"));
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, ".3g}"), T(1234.5), TEST_STRLIT(CharT, "1.23e+03"));
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, ".3g}"), T(0.0001), TEST_STRLIT(CharT, "0.0001"));
+  test_termination_condition<CharT, T>(
+    TEST_STRLIT(CharT, "G}"), -cuda::std::numeric_limits<T>::infinity(), TEST_STRLIT(CharT, "-INF"));
+
+  // The alternate form keeps the trailing zeros.
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, "#g}"), T(1), TEST_STRLIT(CharT, "1.00000"));
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, "#g}"), T(0), TEST_STRLIT(CharT, "0.00000"));
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, "#.3g}"), T(0.0625), TEST_STRLIT(CharT, "0.0625"));
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, "#.3g}"), T(0.125), TEST_STRLIT(CharT, "0.125"));
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, "#.4g}"), T(0.5), TEST_STRLIT(CharT, "0.5000"));
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, "#.3g}"), T(120), TEST_STRLIT(CharT, "120."));
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, "#.2g}"), T(1e10), TEST_STRLIT(CharT, "1.0e+10"));
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, "#.0g}"), T(2), TEST_STRLIT(CharT, "2."));
+  test_termination_condition_check<CharT, T>(
+    TEST_STRLIT(CharT, "#.900g}"),
+    T(1),
+    check_zeros<CharT>{TEST_STRLIT(CharT, "1."), 899, TEST_STRLIT(CharT, "")});
+}
+
+template <class CharT, class T>
+__host__ __device__ void test_hex()
+{
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, "a}"), T(1), TEST_STRLIT(CharT, "1p+0"));
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, "a}"), T(0.5), TEST_STRLIT(CharT, "1p-1"));
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, "a}"), T(-10), TEST_STRLIT(CharT, "-1.4p+3"));
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, "A}"), T(255), TEST_STRLIT(CharT, "1.FEP+7"));
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, "a}"), T(0), TEST_STRLIT(CharT, "0p+0"));
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, ".2a}"), T(1), TEST_STRLIT(CharT, "1.00p+0"));
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, ".0a}"), T(1.5), TEST_STRLIT(CharT, "2p+0"));
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, "#a}"), T(1), TEST_STRLIT(CharT, "1.p+0"));
+  test_termination_condition<CharT, T>(
+    TEST_STRLIT(CharT, "A}"), cuda::std::numeric_limits<T>::infinity(), TEST_STRLIT(CharT, "INF"));
+
+  test_termination_condition_check<CharT, T>(
+    TEST_STRLIT(CharT, ".20a}"), T(1), check_zeros<CharT>{TEST_STRLIT(CharT, "1."), 20, TEST_STRLIT(CharT, "p+0")});
+}
+
+template <class CharT, class T>
+__host__ __device__ void test_sign_and_padding()
+{
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, "+}"), T(1.5), TEST_STRLIT(CharT, "+1.5"));
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, "-}"), T(1.5), TEST_STRLIT(CharT, "1.5"));
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, " }"), T(1.5), TEST_STRLIT(CharT, " 1.5"));
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, " }"), T(-1.5), TEST_STRLIT(CharT, "-1.5"));
+  test_termination_condition<CharT, T>(
+    TEST_STRLIT(CharT, "+}"), cuda::std::numeric_limits<T>::quiet_NaN(), TEST_STRLIT(CharT, "+nan"));
+
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, "8}"), T(1.5), TEST_STRLIT(CharT, "     1.5"));
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, "<8}"), T(1.5), TEST_STRLIT(CharT, "1.5     "));
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, "*^9}"), T(1.5), TEST_STRLIT(CharT, "***1.5***"));
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, "08}"), T(-1.5), TEST_STRLIT(CharT, "-00001.5"));
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, "+08.2f}"), T(3.14159), TEST_STRLIT(CharT, "+0003.14"));
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, "010a}"), T(1), TEST_STRLIT(CharT, "0000001p+0"));
+  test_termination_condition<CharT, T>(TEST_STRLIT(CharT, "2}"), T(1234.5), TEST_STRLIT(CharT, "1234.5"));
+
+  // Infinity and NaN are not padded with zeros.
+  test_termination_condition<CharT, T>(
+    TEST_STRLIT(CharT, "08}"), -cuda::std::numeric_limits<T>::infinity(), TEST_STRLIT(CharT, "    -inf"));
+
+  test_termination_condition_check<CharT, T>(
+    TEST_STRLIT(CharT, "_>12.900e}"),
+    T(1),
+    check_zeros<CharT>{TEST_STRLIT(CharT, "1."), 900, TEST_STRLIT(CharT, "e+00")});
+  test_termination_condition_check<CharT, T>(
+    TEST_STRLIT(CharT, "_>910.900e}"),
+    T(1),
+    check_zeros<CharT>{TEST_STRLIT(CharT, "____1."), 900, TEST_STRLIT(CharT, "e+00")});
+}
+
+template <class CharT, class T>
+__host__ __device__ void test_type()
+{
+  test_default<CharT, T>();
+  test_fixed<CharT, T>();
+  test_scientific<CharT, T>();
+  test_general<CharT, T>();
+  test_hex<CharT, T>();
+  test_sign_and_padding<CharT, T>();
+}
+
+template <class CharT>
+__host__ __device__ void test_type()
+{
+  test_type<CharT, float>();
+  test_type<CharT, double>();
+#if _CCCL_HAS_LONG_DOUBLE()
+  test_termination_condition<CharT, long double>(TEST_STRLIT(CharT, "}"), 1.5L, TEST_STRLIT(CharT, "1.5"));
+  test_termination_condition<CharT, long double>(TEST_STRLIT(CharT, ".3f}"), -3.14159L, TEST_STRLIT(CharT, "-3.142"));
+  test_termination_condition<CharT, long double>(TEST_STRLIT(CharT, "e}"), 1234.5L, TEST_STRLIT(CharT, "1.234500e+03"));
+#endif // _CCCL_HAS_LONG_DOUBLE()
+
+  // Values that are specific to the type.
+  test_termination_condition<CharT, float>(TEST_STRLIT(CharT, ".10f}"), 0.1f, TEST_STRLIT(CharT, "0.1000000015"));
+  test_termination_condition<CharT, float>(TEST_STRLIT(CharT, "}"), 3.4028235e38f, TEST_STRLIT(CharT, "3.4028235e+38"));
+  test_termination_condition<CharT, double>(
+    TEST_STRLIT(CharT, ".20f}"), 0.1, TEST_STRLIT(CharT, "0.10000000000000000555"));
+  test_termination_condition<CharT, double>(
+    TEST_STRLIT(CharT, "}"), 1.7976931348623157e308, TEST_STRLIT(CharT, "1.7976931348623157e+308"));
+  test_termination_condition<CharT, double>(TEST_STRLIT(CharT, "a}"), 0.1, TEST_STRLIT(CharT, "1.999999999999ap-4"));
+  test_termination_condition<CharT, double>(TEST_STRLIT(CharT, "}"), 5e-324, TEST_STRLIT(CharT, "5e-324"));
+}
+
+__host__ __device__ bool test()
+{
+  test_type<char>();
+#if _CCCL_HAS_WCHAR_T()
+  test_type<wchar_t>();
+#endif // _CCCL_HAS_WCHAR_T()
+
+  return true;
+}
+
+int main(int, char**)
+{
+  test();
+  return 0;
+}
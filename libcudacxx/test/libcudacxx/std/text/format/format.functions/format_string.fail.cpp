@@ -0,0 +1,31 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: c++17
+
+// template<class charT, class... Args>
+//   struct basic_format_string;
+
+// The format string is checked against the types of the arguments at compile time.
+
+#include <cuda/std/__format_>
+
+__host__ __device__ void test()
+{
+  char buffer[16];
+  // A string can not be formatted as an integer.
+  (void) cuda::std::format_to(buffer, "{:d}", "abc");
+}
+
+int main(int, char**)
+{
+  test();
+  return 0;
+}
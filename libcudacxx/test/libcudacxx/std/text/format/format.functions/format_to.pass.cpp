@@ -0,0 +1,174 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// <cuda/std/format>
+
+// template<class Out, class... Args>
+//   Out format_to(Out out, format_string<Args...> fmt, Args&&... args);
+// template<class Out, class... Args>
+//   Out format_to(Out out, wformat_string<Args...> fmt, Args&&... args);
+
+#include <cuda/std/__format_>
+#include <cuda/std/cassert>
+#include <cuda/std/inplace_vector>
+#include <cuda/std/iterator>
+#include <cuda/std/span>
+#include <cuda/std/string_view>
+#include <cuda/std/type_traits>
+
+#include "literal.h"
+
+struct point
+{
+  int x;
+  int y;
+};
+
+template <class CharT>
+struct cuda::std::formatter<point, CharT> : cuda::std::formatter<int, CharT>
+{
+  template <class FormatContext>
+  __host__ __device__ typename FormatContext::iterator format(point value, FormatContext& ctx) const
+  {
+    ctx.advance_to(cuda::std::formatter<int, CharT>::format(value.x, ctx));
+    auto it = ctx.out();
+    *it++   = TEST_CHARLIT(CharT, ',');
+    ctx.advance_to(it);
+    return cuda::std::formatter<int, CharT>::format(value.y, ctx);
+  }
+};
+
+template <class CharT, class... Args>
+using test_format_string = cuda::std::type_identity_t<cuda::std::basic_format_string<CharT, const Args&...>>;
+
+template <class CharT, class... Args>
+__host__ __device__ void
+test_pointer(cuda::std::basic_string_view<CharT> expected, test_format_string<CharT, Args...> fmt, const Args&... args)
+{
+  CharT buffer[512]{};
+  CharT* it = cuda::std::format_to(buffer, fmt, args...);
+  static_assert(cuda::std::is_same_v<decltype(cuda::std::format_to(buffer, fmt, args...)), CharT*>);
+  assert(it == buffer + expected.size());
+  assert((cuda::std::basic_string_view<CharT>{buffer, expected.size()} == expected));
+}
+
+template <class CharT, class... Args>
+__host__ __device__ void
+test_span(cuda::std::basic_string_view<CharT> expected, test_format_string<CharT, Args...> fmt, const Args&... args)
+{
+  CharT buffer[512]{};
+  cuda::std::span<CharT> span{buffer};
+  auto it = cuda::std::format_to(span.begin(), fmt, args...);
+  assert(it == span.begin() + expected.size());
+  assert((cuda::std::basic_string_view<CharT>{buffer, expected.size()} == expected));
+}
+
+template <class CharT, class... Args>
+__host__ __device__ void
+test_back_inserter(cuda::std::basic_string_view<CharT> expected,
+                   test_format_string<CharT, Args...> fmt,
+                   const Args&... args)
+{
+  using Container = cuda::std::inplace_vector<CharT, 512>;
+  using OutIt     = cuda::std::__back_insert_iterator<Container>;
+
+  Container container{};
+  cuda::std::format_to(OutIt{container}, fmt, args...);
+  assert((cuda::std::basic_string_view<CharT>{container.data(), container.size()} == expected));
+}
+
+template <class CharT, class... Args>
+__host__ __device__ void
+test(cuda::std::basic_string_view<CharT> expected, test_format_string<CharT, Args...> fmt, const Args&... args)
+{
+  test_pointer<CharT>(expected, fmt, args...);
+  test_span<CharT>(expected, fmt, args...);
+  test_back_inserter<CharT>(expected, fmt, args...);
+}
+
+// The output is larger than the buffer on the stack, which is flushed several times
+template <class CharT>
+__host__ __device__ void test_large_output()
+{
+  using Container = cuda::std::inplace_vector<CharT, 1024>;
+  using OutIt     = cuda::std::__back_insert_iterator<Container>;
+
+  Container container{};
+  cuda::std::format_to(OutIt{container}, TEST_STRLIT(CharT, "{:_>1000}{}"), TEST_CHARLIT(CharT, 'x'), 42);
+  assert(container.size() == 1002);
+  for (cuda::std::size_t i = 0; i < 999; ++i)
+  {
+    assert(container[i] == TEST_CHARLIT(CharT, '_'));
+  }
+  assert(container[999] == TEST_CHARLIT(CharT, 'x'));
+  assert(container[1000] == TEST_CHARLIT(CharT, '4'));
+  assert(container[1001] == TEST_CHARLIT(CharT, '2'));
+}
+
+template <class CharT>
+__host__ __device__ void test_type()
+{
+  using SV = cuda::std::basic_string_view<CharT>;
+
+  test<CharT>(SV{TEST_STRLIT(CharT, "")}, TEST_STRLIT(CharT, ""));
+  test<CharT>(SV{TEST_STRLIT(CharT, "hello")}, TEST_STRLIT(CharT, "hello"));
+  test<CharT>(SV{TEST_STRLIT(CharT, "{}")}, TEST_STRLIT(CharT, "{{}}"));
+  test<CharT>(SV{TEST_STRLIT(CharT, "{42}")}, TEST_STRLIT(CharT, "{{{}}}"), 42);
+
+  // automatic and manual argument indexing
+  test<CharT>(SV{TEST_STRLIT(CharT, "1 2 3")}, TEST_STRLIT(CharT, "{} {} {}"), 1, 2u, 3ll);
+  test<CharT>(SV{TEST_STRLIT(CharT, "3 1 3")}, TEST_STRLIT(CharT, "{2} {0} {2}"), 1, 2, 3);
+
+  // the supported argument types
+  test<CharT>(SV{TEST_STRLIT(CharT, "true a -7 18446744073709551615")},
+              TEST_STRLIT(CharT, "{} {} {} {}"),
+              true,
+              TEST_CHARLIT(CharT, 'a'),
+              -7,
+              ~0ull);
+  test<CharT>(SV{TEST_STRLIT(CharT, "abc def")},
+              TEST_STRLIT(CharT, "{} {}"),
+              TEST_STRLIT(CharT, "abc"),
+              SV{TEST_STRLIT(CharT, "def")});
+  test<CharT>(SV{TEST_STRLIT(CharT, "0x0")}, TEST_STRLIT(CharT, "{}"), nullptr);
+
+  // format specifications
+  test<CharT>(SV{TEST_STRLIT(CharT, "0x00ff|   -12|+5|ab***|__1011__")},
+              TEST_STRLIT(CharT, "{:#06x}|{:>6}|{:+}|{:*<5}|{:_^8b}"),
+              255,
+              -12,
+              5,
+              TEST_STRLIT(CharT, "ab"),
+              11);
+  test<CharT>(SV{TEST_STRLIT(CharT, "ABC")}, TEST_STRLIT(CharT, "{:X}"), 2748);
+  test<CharT>(
+    SV{TEST_STRLIT(CharT, "1       |abc")}, TEST_STRLIT(CharT, "{:<{}}|{:.{}}"), 1, 8, TEST_STRLIT(CharT, "abcdef"), 3);
+
+  // formatter specialization of a user defined type
+  test<CharT>(SV{TEST_STRLIT(CharT, "[  1, -2]")}, TEST_STRLIT(CharT, "[{:>3}]"), point{1, -2});
+
+  test_large_output<CharT>();
+}
+
+__host__ __device__ bool test()
+{
+  test_type<char>();
+#if _CCCL_HAS_WCHAR_T()
+  test_type<wchar_t>();
+#endif // _CCCL_HAS_WCHAR_T()
+
+  return true;
+}
+
+int main(int, char**)
+{
+  test();
+  return 0;
+}
@@ -0,0 +1,130 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// <cuda/std/format>
+
+// template<class Out, class... Args>
+//   format_to_n_result<Out> format_to_n(Out out, iter_difference_t<Out> n,
+//                                       format_string<Args...> fmt, Args&&... args);
+// template<class Out, class... Args>
+//   format_to_n_result<Out> format_to_n(Out out, iter_difference_t<Out> n,
+//                                       wformat_string<Args...> fmt, Args&&... args);
+
+#include <cuda/std/__format_>
+#include <cuda/std/algorithm>
+#include <cuda/std/cassert>
+#include <cuda/std/inplace_vector>
+#include <cuda/std/iterator>
+#include <cuda/std/span>
+#include <cuda/std/string_view>
+#include <cuda/std/type_traits>
+
+#include "literal.h"
+
+template <class CharT, class... Args>
+using test_format_string = cuda::std::type_identity_t<cuda::std::basic_format_string<CharT, const Args&...>>;
+
+template <class CharT, class... Args>
+__host__ __device__ void test(cuda::std::basic_string_view<CharT> expected,
+                              cuda::std::ptrdiff_t n,
+                              test_format_string<CharT, Args...> fmt,
+                              const Args&... args)
+{
+  const auto written = cuda::std::min(static_cast<cuda::std::size_t>(cuda::std::max(n, cuda::std::ptrdiff_t{0})),
+                                      expected.size());
+  const auto total   = static_cast<cuda::std::ptrdiff_t>(expected.size());
+
+  // pointer
+  {
+    CharT buffer[512]{};
+    auto result = cuda::std::format_to_n(buffer, n, fmt, args...);
+    static_assert(cuda::std::is_same_v<decltype(result), cuda::std::format_to_n_result<CharT*>>);
+    assert(result.out == buffer + written);
+    assert(result.size == total);
+    assert((cuda::std::basic_string_view<CharT>{buffer, written} == expected.substr(0, written)));
+    assert(buffer[written] == CharT{});
+  }
+  // contiguous iterator
+  {
+    CharT buffer[512]{};
+    cuda::std::span<CharT> span{buffer};
+    auto result = cuda::std::format_to_n(span.begin(), n, fmt, args...);
+    assert(result.out == span.begin() + written);
+    assert(result.size == total);
+    assert((cuda::std::basic_string_view<CharT>{buffer, written} == expected.substr(0, written)));
+  }
+  // output iterator
+  {
+    using Container = cuda::std::inplace_vector<CharT, 1024>;
+    using OutIt     = cuda::std::__back_insert_iterator<Container>;
+
+    Container container{};
+    auto result = cuda::std::format_to_n(OutIt{container}, n, fmt, args...);
+    assert(result.size == total);
+    assert((cuda::std::basic_string_view<CharT>{container.data(), container.size()} == expected.substr(0, written)));
+  }
+}
+
+template <class CharT>
+__host__ __device__ void test_type()
+{
+  using SV = cuda::std::basic_string_view<CharT>;
+
+  test<CharT>(SV{TEST_STRLIT(CharT, "")}, 0, TEST_STRLIT(CharT, ""));
+  test<CharT>(SV{TEST_STRLIT(CharT, "")}, 10, TEST_STRLIT(CharT, ""));
+
+  const SV expected{TEST_STRLIT(CharT, "value=    42 {ab}")};
+  const cuda::std::ptrdiff_t sizes[] = {-1, 0, 1, 5, 12, 16, 17, 18, 100};
+  for (auto n : sizes)
+  {
+    test<CharT>(expected, n, TEST_STRLIT(CharT, "value={:>6} {{{}}}"), 42, TEST_STRLIT(CharT, "ab"));
+  }
+
+  // The output is larger than the buffer on the stack
+  const SV digits{TEST_STRLIT(CharT, "0123456789")};
+  const cuda::std::ptrdiff_t large_sizes[] = {0, 255, 256, 257, 300, 500};
+  for (auto n : large_sizes)
+  {
+    test<CharT>(digits.substr(0, 1), n, TEST_STRLIT(CharT, "{}"), 0);
+
+    CharT buffer[512]{};
+    auto result = cuda::std::format_to_n(buffer, n, TEST_STRLIT(CharT, "{:*>400}"), digits);
+    assert(result.out == buffer + cuda::std::min(n, cuda::std::ptrdiff_t{400}));
+    assert(result.size == 400);
+    for (cuda::std::ptrdiff_t i = 0; i < cuda::std::min(n, cuda::std::ptrdiff_t{390}); ++i)
+    {
+      assert(buffer[i] == TEST_CHARLIT(CharT, '*'));
+    }
+
+    using Container = cuda::std::inplace_vector<CharT, 512>;
+    using OutIt     = cuda::std::__back_insert_iterator<Container>;
+    Container container{};
+    auto result2 = cuda::std::format_to_n(OutIt{container}, n, TEST_STRLIT(CharT, "{:*>400}"), digits);
+    assert(result2.size == 400);
+    assert(container.size() == static_cast<cuda::std::size_t>(cuda::std::min(n, cuda::std::ptrdiff_t{400})));
+    assert((SV{buffer, container.size()} == SV{container.data(), container.size()}));
+  }
+}
+
+__host__ __device__ bool test()
+{
+  test_type<char>();
+#if _CCCL_HAS_WCHAR_T()
+  test_type<wchar_t>();
+#endif // _CCCL_HAS_WCHAR_T()
+
+  return true;
+}
+
+int main(int, char**)
+{
+  test();
+  return 0;
+}
@@ -0,0 +1,58 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// <cuda/std/format>
+
+// template<class... Args>
+//   size_t formatted_size(format_string<Args...> fmt, Args&&... args);
+// template<class... Args>
+//   size_t formatted_size(wformat_string<Args...> fmt, Args&&... args);
+
+#include <cuda/std/__format_>
+#include <cuda/std/cassert>
+#include <cuda/std/cstddef>
+#include <cuda/std/type_traits>
+
+#include "literal.h"
+
+template <class CharT>
+__host__ __device__ void test_type()
+{
+  static_assert(
+    cuda::std::is_same_v<decltype(cuda::std::formatted_size(TEST_STRLIT(CharT, "{}"), 1)), cuda::std::size_t>);
+
+  assert(cuda::std::formatted_size(TEST_STRLIT(CharT, "")) == 0);
+  assert(cuda::std::formatted_size(TEST_STRLIT(CharT, "hello")) == 5);
+  assert(cuda::std::formatted_size(TEST_STRLIT(CharT, "{{}}")) == 2);
+  assert(cuda::std::formatted_size(TEST_STRLIT(CharT, "{}"), -1234) == 5);
+  assert(cuda::std::formatted_size(TEST_STRLIT(CharT, "{:#b}"), 5u) == 5);
+  assert(cuda::std::formatted_size(TEST_STRLIT(CharT, "{} {}"), true, TEST_STRLIT(CharT, "abc")) == 8);
+  assert(cuda::std::formatted_size(TEST_STRLIT(CharT, "{:{}}|{:.{}}"), 1, 10, TEST_STRLIT(CharT, "abcdef"), 2) == 13);
+
+  // The output is larger than the buffer on the stack
+  assert(cuda::std::formatted_size(TEST_STRLIT(CharT, "{:>1000}"), TEST_CHARLIT(CharT, 'x')) == 1000);
+  assert(cuda::std::formatted_size(TEST_STRLIT(CharT, "{:>256}{:>256}"), 1, 2) == 512);
+}
+
+__host__ __device__ bool test()
+{
+  test_type<char>();
+#if _CCCL_HAS_WCHAR_T()
+  test_type<wchar_t>();
+#endif // _CCCL_HAS_WCHAR_T()
+
+  return true;
+}
+
+int main(int, char**)
+{
+  test();
+  return 0;
+}
@@ -0,0 +1,103 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// <cuda/std/format>
+
+// template<class Out>
+//   Out vformat_to(Out out, string_view fmt, format_args args);
+// template<class Out>
+//   Out vformat_to(Out out, wstring_view fmt, wformat_args args);
+
+#include <cuda/std/__format_>
+#include <cuda/std/cassert>
+#include <cuda/std/inplace_vector>
+#include <cuda/std/iterator>
+#include <cuda/std/string_view>
+
+#include "literal.h"
+#include "test_macros.h"
+
+template <class CharT, class Args>
+__host__ __device__ void
+test(cuda::std::basic_string_view<CharT> expected, cuda::std::basic_string_view<CharT> fmt, const Args& store)
+{
+  {
+    CharT buffer[512]{};
+    CharT* it = cuda::std::vformat_to(buffer, fmt, store);
+    assert(it == buffer + expected.size());
+    assert((cuda::std::basic_string_view<CharT>{buffer, expected.size()} == expected));
+  }
+  {
+    using Container = cuda::std::inplace_vector<CharT, 512>;
+    using OutIt     = cuda::std::__back_insert_iterator<Container>;
+
+    Container container{};
+    cuda::std::vformat_to(OutIt{container}, fmt, store);
+    assert((cuda::std::basic_string_view<CharT>{container.data(), container.size()} == expected));
+  }
+}
+
+__host__ __device__ bool test()
+{
+  using SV = cuda::std::string_view;
+
+  int i           = 42;
+  unsigned u      = 7;
+  const char* str = "abc";
+  test<char>(SV{"42 7 abc"}, SV{"{} {} {}"}, cuda::std::make_format_args(i, u, str));
+  test<char>(SV{"abc 42 0x2a"}, SV{"{2} {0} {0:#x}"}, cuda::std::make_format_args(i, u, str));
+  test<char>(SV{"     42|abc"}, SV{"{:>{}}|{:.{}}"}, cuda::std::make_format_args(i, u, str, u));
+
+#if _CCCL_HAS_WCHAR_T()
+  using WSV           = cuda::std::wstring_view;
+  const wchar_t* wstr = L"abc";
+  test<wchar_t>(WSV{L"42 7 abc"}, WSV{L"{} {} {}"}, cuda::std::make_wformat_args(i, u, wstr));
+#endif // _CCCL_HAS_WCHAR_T()
+
+  return true;
+}
+
+#if TEST_HAS_EXCEPTIONS()
+void test_exception(cuda::std::string_view fmt)
+{
+  char buffer[64]{};
+  int i = 42;
+  try
+  {
+    (void) cuda::std::vformat_to(buffer, fmt, cuda::std::make_format_args(i));
+    assert(false);
+  }
+  catch (const cuda::std::format_error&)
+  {}
+  catch (...)
+  {
+    assert(false);
+  }
+}
+
+void test_exceptions()
+{
+  // The format string is only known at run time, so it is validated while formatting
+  test_exception("{");
+  test_exception("}");
+  test_exception("{1}");
+  test_exception("{:s}");
+  test_exception("{}{0}");
+}
+#endif // TEST_HAS_EXCEPTIONS()
+
+int main(int, char**)
+{
+  test();
+#if TEST_HAS_EXCEPTIONS()
+  NV_IF_TARGET(NV_IS_HOST, (test_exceptions();))
+#endif // TEST_HAS_EXCEPTIONS()
+  return 0;
+}
@@ -16,7 +16,11 @@
 #  include <cuda/memory_resource>
 #  include <cuda/std/execution>
 #  include <cuda/stream>
-#endif // THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_CUDA
+#elif THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP
+#  include <omp.h>
+#elif THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_TBB
+#  include <tbb/task_arena.h>
+#endif // THRUST_DEVICE_SYSTEM
 
 #include <map>
 #include <stdexcept>
@@ -711,4 +715,35 @@ auto policy(caching_allocator_t&, nvbench::launch&)
   return thrust::device;
 }
 #endif
+
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_CUDA
+// Benchmarks of the CUDA system are timed with GPU timers
+constexpr auto system_exec_tag(nvbench::state&)
+{
+  return nvbench::exec_tag::gpu;
+}
+#else
+// Number of threads the host device system runs algorithms on
+int host_system_threads()
+{
+#  if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP
+  return omp_get_max_threads();
+#  elif THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_TBB
+  return tbb::this_task_arena::max_concurrency();
+#  else
+  return 1;
+#  endif
+}
+
+// Benchmarks of the host systems (CPP, OMP, TBB) are timed with CPU timers. The number of threads is reported next to
+// the throughput. It is controlled by OMP_NUM_THREADS for OMP and by the process affinity mask for TBB.
+auto system_exec_tag(nvbench::state& state)
+{
+  auto& summary = state.add_summary("cccl/host/threads");
+  summary.set_string("name", "Threads");
+  summary.set_string("description", "Number of host threads used by the device system");
+  summary.set_int64("value", host_system_threads());
+  return nvbench::exec_tag::no_gpu;
+}
+#endif // THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_CUDA
 } // namespace
@@ -30,7 +30,7 @@ static void basic(nvbench::state& state, nvbench::type_list<T>)
   caching_allocator_t alloc{};
 
   state.exec(
-    nvbench::exec_tag::gpu | nvbench::exec_tag::no_batch | nvbench::exec_tag::sync, [&](nvbench::launch& launch) {
+    system_exec_tag(state) | nvbench::exec_tag::no_batch | nvbench::exec_tag::sync, [&](nvbench::launch& launch) {
       do_not_optimize(thrust::any_of(policy(alloc, launch), dinput.begin(), dinput.end(), cuda::equal_to_value{val}));
     });
 }
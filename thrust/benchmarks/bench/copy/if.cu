@@ -28,7 +28,7 @@ static void basic(nvbench::state& state, nvbench::type_list<T>)
   state.add_global_memory_writes<T>(selected_elements);
 
   caching_allocator_t alloc;
-  state.exec(nvbench::exec_tag::gpu | nvbench::exec_tag::no_batch | nvbench::exec_tag::sync,
+  state.exec(system_exec_tag(state) | nvbench::exec_tag::no_batch | nvbench::exec_tag::sync,
              [&](nvbench::launch& launch) {
                thrust::copy_if(policy(alloc, launch), input.cbegin(), input.cend(), output.begin(), select_op);
              });
@@ -31,7 +31,7 @@ static void basic(nvbench::state& state, nvbench::type_list<T>)
 
   caching_allocator_t alloc{};
 
-  state.exec(nvbench::exec_tag::gpu | nvbench::exec_tag::sync, [&](nvbench::launch& launch) {
+  state.exec(system_exec_tag(state) | nvbench::exec_tag::sync, [&](nvbench::launch& launch) {
     do_not_optimize(thrust::count_if(policy(alloc, launch), in.begin(), in.end(), equal_to_42{}));
   });
 }
@@ -34,7 +34,7 @@ static void basic(nvbench::state& state, nvbench::type_list<KeyT, ValueT>)
 
   caching_allocator_t alloc;
   state.exec(
-    nvbench::exec_tag::gpu | nvbench::exec_tag::no_batch | nvbench::exec_tag::sync, [&](nvbench::launch& launch) {
+    system_exec_tag(state) | nvbench::exec_tag::no_batch | nvbench::exec_tag::sync, [&](nvbench::launch& launch) {
       thrust::reduce_by_key(
         policy(alloc, launch), in_keys.begin(), in_keys.end(), in_vals.begin(), out_keys.begin(), out_vals.begin());
     });
@@ -18,7 +18,7 @@ static void basic(nvbench::state& state, nvbench::type_list<T>)
   state.add_global_memory_writes<T>(2 * elements);
 
   caching_allocator_t alloc; // swap_ranges shouldn't allocate, but let's be consistent
-  state.exec(nvbench::exec_tag::gpu | nvbench::exec_tag::no_batch | nvbench::exec_tag::sync,
+  state.exec(system_exec_tag(state) | nvbench::exec_tag::no_batch | nvbench::exec_tag::sync,
              [&](nvbench::launch& launch) {
                thrust::swap_ranges(policy(alloc, launch), a.begin(), a.end(), b.begin());
              });
@@ -52,7 +52,7 @@ static void fib(nvbench::state& state, nvbench::type_list<T>)
 
   fib_t<T, nvbench::uint32_t> op{};
   caching_allocator_t alloc; // transform shouldn't allocate, but let's be consistent
-  state.exec(nvbench::exec_tag::gpu | nvbench::exec_tag::no_batch | nvbench::exec_tag::sync,
+  state.exec(system_exec_tag(state) | nvbench::exec_tag::no_batch | nvbench::exec_tag::sync,
              [&](nvbench::launch& launch) {
                thrust::transform(policy(alloc, launch), input.cbegin(), input.cend(), output.begin(), op);
              });
@@ -27,7 +27,7 @@ static void negate_if_stencil(nvbench::state& state, nvbench::type_list<T>)
 
   caching_allocator_t alloc; // transform_if shouldn't allocate, but let's be consistent
   state.exec(
-    nvbench::exec_tag::gpu | nvbench::exec_tag::no_batch | nvbench::exec_tag::sync, [&](nvbench::launch& launch) {
+    system_exec_tag(state) | nvbench::exec_tag::no_batch | nvbench::exec_tag::sync, [&](nvbench::launch& launch) {
       thrust::transform_if(
         policy(alloc, launch), input.begin(), input.end(), stencil.begin(), output.begin(), transform_op, select_op);
     });
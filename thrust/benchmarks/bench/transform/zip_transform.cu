@@ -43,7 +43,7 @@ static void nstream_zip_transform(nvbench::state& state, nvbench::type_list<T>)
   cuda::zip_transform_iterator begin{lambda, a.begin(), b.begin(), c.begin()};
   cuda::zip_transform_iterator end{lambda, a.end(), b.end(), c.end()};
   caching_allocator_t alloc; // transform shouldn't allocate, but let's be consistent
-  state.exec(nvbench::exec_tag::gpu | nvbench::exec_tag::no_batch | nvbench::exec_tag::sync,
+  state.exec(system_exec_tag(state) | nvbench::exec_tag::no_batch | nvbench::exec_tag::sync,
              [&](nvbench::launch& launch) {
                thrust::copy(policy(alloc, launch), begin, end, a.begin());
              });
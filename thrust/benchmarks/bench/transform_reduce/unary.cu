@@ -32,7 +32,7 @@ static void unary(nvbench::state& state, nvbench::type_list<T>)
 
   caching_allocator_t alloc{};
 
-  state.exec(nvbench::exec_tag::gpu | nvbench::exec_tag::sync, [&](nvbench::launch& launch) {
+  state.exec(system_exec_tag(state) | nvbench::exec_tag::sync, [&](nvbench::launch& launch) {
     do_not_optimize(
       thrust::transform_reduce(policy(alloc, launch), in.begin(), in.end(), plus_one<T>{}, 42, cuda::std::plus<T>{}));
   });
@@ -406,3 +406,89 @@ struct TestVectorBinarySearchDiscardIterator
 };
 VariableUnitTest<TestVectorBinarySearchDiscardIterator, SignedIntegralTypes>
   TestVectorBinarySearchDiscardIteratorInstance;
+
+// queries whose results are computed on the host and compared to the ones of the device system
+template <typename HaystackVector, typename QueryVector, typename Compare>
+void check_vector_searches(const HaystackVector& h_vec, const QueryVector& h_input, Compare comp)
+{
+  using Haystack = typename HaystackVector::value_type;
+  using Query    = typename QueryVector::value_type;
+
+  thrust::device_vector<Haystack> d_vec = h_vec;
+  thrust::device_vector<Query> d_input  = h_input;
+
+  thrust::host_vector<int> h_output(h_input.size());
+  thrust::device_vector<int> d_output(h_input.size());
+
+  thrust::lower_bound(h_vec.begin(), h_vec.end(), h_input.begin(), h_input.end(), h_output.begin(), comp);
+  thrust::lower_bound(d_vec.begin(), d_vec.end(), d_input.begin(), d_input.end(), d_output.begin(), comp);
+  ASSERT_EQUAL(h_output, d_output);
+
+  thrust::upper_bound(h_vec.begin(), h_vec.end(), h_input.begin(), h_input.end(), h_output.begin(), comp);
+  thrust::upper_bound(d_vec.begin(), d_vec.end(), d_input.begin(), d_input.end(), d_output.begin(), comp);
+  ASSERT_EQUAL(h_output, d_output);
+
+  thrust::binary_search(h_vec.begin(), h_vec.end(), h_input.begin(), h_input.end(), h_output.begin(), comp);
+  thrust::binary_search(d_vec.begin(), d_vec.end(), d_input.begin(), d_input.end(), d_output.begin(), comp);
+  ASSERT_EQUAL(h_output, d_output);
+}
+
+// enough queries for several tiles of the host backends, the first half of them sorted and the second one not
+thrust::host_vector<int> make_many_queries()
+{
+  const int num_queries = 20000;
+  thrust::host_vector<int> queries(num_queries);
+  for (int i = 0; i < num_queries / 2; ++i)
+  {
+    queries[i] = i / 8 - 10;
+  }
+  for (int i = num_queries / 2; i < num_queries; ++i)
+  {
+    queries[i] = (i * 7919) % 1300 - 10;
+  }
+  return queries;
+}
+
+void TestVectorSearchManyQueries()
+{
+  thrust::host_vector<int> h_vec(3000);
+  for (int i = 0; i < 3000; ++i)
+  {
+    h_vec[i] = i / 3;
+  }
+
+  check_vector_searches(h_vec, make_many_queries(), thrust::less<int>());
+}
+DECLARE_UNITTEST(TestVectorSearchManyQueries);
+
+struct search_key
+{
+  int key;
+  int value;
+};
+
+// only orders keys against ints, so the queries cannot be compared with each other
+struct compare_key_to_int
+{
+  _CCCL_HOST_DEVICE bool operator()(const search_key& lhs, int rhs) const
+  {
+    return lhs.key < rhs;
+  }
+
+  _CCCL_HOST_DEVICE bool operator()(int lhs, const search_key& rhs) const
+  {
+    return lhs < rhs.key;
+  }
+};
+
+void TestVectorSearchHeterogeneousComparator()
+{
+  thrust::host_vector<search_key> h_vec(3000);
+  for (int i = 0; i < 3000; ++i)
+  {
+    h_vec[i] = search_key{i / 3, i};
+  }
+
+  check_vector_searches(h_vec, make_many_queries(), compare_key_to_int());
+}
+DECLARE_UNITTEST(TestVectorSearchHeterogeneousComparator);
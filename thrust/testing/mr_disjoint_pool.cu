@@ -292,6 +292,119 @@ void TestDisjointSynchronizedPoolCachingOversized()
 }
 DECLARE_UNITTEST(TestDisjointSynchronizedPoolCachingOversized);
 
+template <template <typename, typename> class PoolTemplate>
+void TestDisjointPoolCachingOversizedLimit()
+{
+  dummy_resource upstream;
+  thrust::mr::new_delete_resource bookkeeper;
+
+  using Pool = PoolTemplate<dummy_resource, thrust::mr::new_delete_resource>;
+
+  thrust::mr::pool_options opts = Pool::get_default_options();
+  opts.cache_oversized          = true;
+  opts.largest_block_size       = 512;
+  opts.max_cached_bytes         = 4096;
+
+  Pool pool(&upstream, &bookkeeper, opts);
+
+  upstream.id_to_allocate = 1;
+  alloc_id a1             = pool.do_allocate(1024, 32);
+  upstream.id_to_allocate = 2;
+  alloc_id a2             = pool.do_allocate(2048, 32);
+  upstream.id_to_allocate = 3;
+  alloc_id a3             = pool.do_allocate(1536, 32);
+
+  pool.do_deallocate(a1, 1024, 32);
+  pool.do_deallocate(a2, 2048, 32);
+
+  // make sure that the biggest cached block is returned to upstream to make
+  // room for a block that would exceed the limit
+  upstream.id_to_deallocate = 2;
+  pool.do_deallocate(a3, 1536, 32);
+  ASSERT_EQUAL(upstream.id_to_deallocate, 0u);
+
+  alloc_id a4 = pool.do_allocate(1024, 32);
+  ASSERT_EQUAL(a4.id, 1u);
+  alloc_id a5 = pool.do_allocate(1536, 32);
+  ASSERT_EQUAL(a5.id, 3u);
+
+  // make sure that a block bigger than the limit is never cached
+  upstream.id_to_allocate   = 4;
+  alloc_id a6               = pool.do_allocate(8192, 32);
+  upstream.id_to_deallocate = 4;
+  pool.do_deallocate(a6, 8192, 32);
+  ASSERT_EQUAL(upstream.id_to_deallocate, 0u);
+}
+
+void TestDisjointUnsynchronizedPoolCachingOversizedLimit()
+{
+  TestDisjointPoolCachingOversizedLimit<thrust::mr::disjoint_unsynchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestDisjointUnsynchronizedPoolCachingOversizedLimit);
+
+void TestDisjointSynchronizedPoolCachingOversizedLimit()
+{
+  TestDisjointPoolCachingOversizedLimit<thrust::mr::disjoint_synchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestDisjointSynchronizedPoolCachingOversizedLimit);
+
+template <template <typename, typename> class PoolTemplate>
+void TestDisjointPoolStatistics()
+{
+  dummy_resource upstream;
+  thrust::mr::new_delete_resource bookkeeper;
+
+  using Pool = PoolTemplate<dummy_resource, thrust::mr::new_delete_resource>;
+
+  thrust::mr::pool_options opts = Pool::get_default_options();
+  opts.largest_block_size       = 1024;
+  opts.collect_statistics       = true;
+
+  Pool pool(&upstream, &bookkeeper, opts);
+
+  upstream.id_to_allocate = 1;
+  alloc_id a1             = pool.do_allocate(16, 16);
+  alloc_id a2             = pool.do_allocate(16, 16);
+  upstream.id_to_allocate = 2;
+  alloc_id a3             = pool.do_allocate(2048, 32);
+  pool.do_deallocate(a3, 2048, 32);
+  alloc_id a4 = pool.do_allocate(2048, 32);
+
+  thrust::mr::pool_statistics stats = pool.statistics();
+  ASSERT_EQUAL(stats.upstream_allocations, 2u);
+  ASSERT_EQUAL(stats.bytes_held, upstream.used_bytes);
+  ASSERT_EQUAL(stats.bytes_in_use, 2048u + 2 * 16u);
+  ASSERT_EQUAL(stats.oversized_hits, 1u);
+  ASSERT_EQUAL(stats.oversized_misses, 1u);
+  ASSERT_EQUAL(stats.buckets[0].block_size, opts.smallest_block_size);
+  ASSERT_EQUAL(stats.buckets[0].misses, 1u);
+  ASSERT_EQUAL(stats.buckets[0].hits, 1u);
+
+  pool.do_deallocate(a1, 16, 16);
+  pool.do_deallocate(a2, 16, 16);
+  pool.do_deallocate(a4, 2048, 32);
+
+  pool.release();
+
+  stats = pool.statistics();
+  ASSERT_EQUAL(stats.bytes_in_use, 0u);
+  ASSERT_EQUAL(stats.peak_bytes_in_use, 2048u + 2 * 16u);
+  ASSERT_EQUAL(stats.upstream_deallocations, 2u);
+  ASSERT_EQUAL(stats.bytes_held, 0u);
+}
+
+void TestDisjointUnsynchronizedPoolStatistics()
+{
+  TestDisjointPoolStatistics<thrust::mr::disjoint_unsynchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestDisjointUnsynchronizedPoolStatistics);
+
+void TestDisjointSynchronizedPoolStatistics()
+{
+  TestDisjointPoolStatistics<thrust::mr::disjoint_synchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestDisjointSynchronizedPoolStatistics);
+
 template <template <typename, typename> class PoolTemplate>
 void TestDisjointGlobalPool()
 {
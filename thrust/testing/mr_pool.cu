@@ -3,9 +3,15 @@
 #include <thrust/mr/new.h>
 #include <thrust/mr/pool.h>
 #include <thrust/mr/sync_pool.h>
+#include <thrust/mr/thread_cached_pool.h>
 
 #include <unittest/unittest.h>
 
+#include <atomic>
+#include <cstring>
+#include <thread>
+#include <vector>
+
 template <typename T>
 struct reference
 {
@@ -244,6 +250,12 @@ void TestSynchronizedPool()
 }
 DECLARE_UNITTEST(TestSynchronizedPool);
 
+void TestThreadCachedPool()
+{
+  TestPool<thrust::mr::thread_cached_pool_resource>();
+}
+DECLARE_UNITTEST(TestThreadCachedPool);
+
 template <template <typename> class PoolTemplate>
 void TestPoolCachingOversized()
 {
@@ -353,6 +365,184 @@ void TestSynchronizedPoolCachingOversized()
 }
 DECLARE_UNITTEST(TestSynchronizedPoolCachingOversized);
 
+void TestThreadCachedPoolCachingOversized()
+{
+  TestPoolCachingOversized<thrust::mr::thread_cached_pool_resource>();
+}
+DECLARE_UNITTEST(TestThreadCachedPoolCachingOversized);
+
+template <template <typename> class PoolTemplate>
+void TestPoolCachingOversizedLimit()
+{
+  tracked_resource upstream;
+
+  upstream.id_to_allocate = -1u;
+
+  using Pool = PoolTemplate<tracked_resource>;
+
+  thrust::mr::pool_options opts = Pool::get_default_options();
+  opts.cache_oversized          = true;
+  opts.largest_block_size       = 512;
+  opts.max_cached_bytes         = 4096;
+
+  Pool pool(&upstream, opts);
+
+  upstream.id_to_allocate  = 1;
+  tracked_pointer<void> a1 = pool.do_allocate(1024, 32);
+  upstream.id_to_allocate  = 2;
+  tracked_pointer<void> a2 = pool.do_allocate(2048, 32);
+  upstream.id_to_allocate  = 3;
+  tracked_pointer<void> a3 = pool.do_allocate(1536, 32);
+
+  pool.do_deallocate(a1, 1024, 32);
+  pool.do_deallocate(a2, 2048, 32);
+
+  // make sure that the biggest cached block is returned to upstream to make
+  // room for a block that would exceed the limit
+  upstream.id_to_deallocate = 2;
+  pool.do_deallocate(a3, 1536, 32);
+  ASSERT_EQUAL(upstream.id_to_deallocate, 0u);
+
+  tracked_pointer<void> a4 = pool.do_allocate(1024, 32);
+  ASSERT_EQUAL(a4.id, 1u);
+  tracked_pointer<void> a5 = pool.do_allocate(1536, 32);
+  ASSERT_EQUAL(a5.id, 3u);
+
+  // make sure that a block bigger than the limit is never cached
+  upstream.id_to_allocate   = 4;
+  tracked_pointer<void> a6  = pool.do_allocate(8192, 32);
+  upstream.id_to_deallocate = 4;
+  pool.do_deallocate(a6, 8192, 32);
+  ASSERT_EQUAL(upstream.id_to_deallocate, 0u);
+
+  pool.do_deallocate(a4, 1024, 32);
+  pool.do_deallocate(a5, 1536, 32);
+
+  upstream.id_to_allocate = 0;
+}
+
+void TestUnsynchronizedPoolCachingOversizedLimit()
+{
+  TestPoolCachingOversizedLimit<thrust::mr::unsynchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestUnsynchronizedPoolCachingOversizedLimit);
+
+void TestSynchronizedPoolCachingOversizedLimit()
+{
+  TestPoolCachingOversizedLimit<thrust::mr::synchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestSynchronizedPoolCachingOversizedLimit);
+
+void TestThreadCachedPoolCachingOversizedLimit()
+{
+  TestPoolCachingOversizedLimit<thrust::mr::thread_cached_pool_resource>();
+}
+DECLARE_UNITTEST(TestThreadCachedPoolCachingOversizedLimit);
+
+template <template <typename> class PoolTemplate>
+void TestPoolStatistics()
+{
+  using Pool = PoolTemplate<thrust::mr::new_delete_resource>;
+
+  thrust::mr::new_delete_resource upstream;
+
+  {
+    // statistics are opt-in
+    Pool pool(&upstream);
+
+    void* p = pool.do_allocate(16);
+    pool.do_deallocate(p, 16);
+
+    thrust::mr::pool_statistics stats = pool.statistics();
+    ASSERT_EQUAL(stats.upstream_allocations, 0u);
+    ASSERT_EQUAL(stats.buckets.empty(), true);
+  }
+
+  thrust::mr::pool_options opts = Pool::get_default_options();
+  opts.largest_block_size       = 1024;
+  opts.collect_statistics       = true;
+
+  Pool pool(&upstream, opts);
+
+  void* a1 = pool.do_allocate(16);
+  void* a2 = pool.do_allocate(16);
+  void* a3 = pool.do_allocate(2048);
+  pool.do_deallocate(a3, 2048);
+  void* a4 = pool.do_allocate(2048);
+
+  thrust::mr::pool_statistics stats = pool.statistics();
+  ASSERT_EQUAL(stats.upstream_allocations, 2u);
+  ASSERT_EQUAL(stats.upstream_deallocations, 0u);
+  ASSERT_EQUAL(stats.bytes_in_use, 2048u + 2 * 16u);
+  ASSERT_EQUAL(stats.peak_bytes_in_use, 2048u + 2 * 16u);
+  ASSERT_GEQUAL(stats.bytes_held, stats.bytes_in_use);
+  ASSERT_EQUAL(stats.oversized_hits, 1u);
+  ASSERT_EQUAL(stats.oversized_misses, 1u);
+  ASSERT_EQUAL(stats.buckets.size(), ::cuda::ceil_ilog2(1024u) - ::cuda::ceil_ilog2(opts.smallest_block_size) + 1);
+  ASSERT_EQUAL(stats.buckets[0].block_size, opts.smallest_block_size);
+  ASSERT_EQUAL(stats.buckets[0].misses, 1u);
+  ASSERT_EQUAL(stats.buckets[0].hits, 1u);
+
+  pool.do_deallocate(a1, 16);
+  pool.do_deallocate(a2, 16);
+  pool.do_deallocate(a4, 2048);
+
+  // the peaks remain until reset
+  stats = pool.statistics();
+  ASSERT_EQUAL(stats.bytes_in_use, 0u);
+  ASSERT_EQUAL(stats.peak_bytes_in_use, 2048u + 2 * 16u);
+
+  pool.reset_statistics();
+
+  stats = pool.statistics();
+  ASSERT_EQUAL(stats.upstream_allocations, 0u);
+  ASSERT_EQUAL(stats.oversized_hits, 0u);
+  ASSERT_EQUAL(stats.buckets[0].misses, 0u);
+  ASSERT_EQUAL(stats.peak_bytes_in_use, 0u);
+  ASSERT_EQUAL(stats.peak_bytes_held, stats.bytes_held);
+
+  pool.release();
+
+  stats = pool.statistics();
+  ASSERT_EQUAL(stats.upstream_deallocations, 2u);
+  ASSERT_EQUAL(stats.bytes_held, 0u);
+}
+
+void TestUnsynchronizedPoolStatistics()
+{
+  TestPoolStatistics<thrust::mr::unsynchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestUnsynchronizedPoolStatistics);
+
+void TestSynchronizedPoolStatistics()
+{
+  TestPoolStatistics<thrust::mr::synchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestSynchronizedPoolStatistics);
+
+void TestThreadCachedPoolStatistics()
+{
+  using Pool = thrust::mr::thread_cached_pool_resource<thrust::mr::new_delete_resource>;
+
+  thrust::mr::new_delete_resource upstream;
+
+  thrust::mr::pool_options opts = Pool::get_default_options();
+  opts.collect_statistics       = true;
+
+  Pool pool(&upstream, opts);
+
+  void* p = pool.do_allocate(16);
+
+  // a whole batch of blocks has moved to the cache of this thread, and counts as in use
+  thrust::mr::pool_statistics stats = pool.statistics();
+  ASSERT_EQUAL(stats.upstream_allocations, 1u);
+  ASSERT_EQUAL(stats.buckets[0].misses, 1u);
+  ASSERT_EQUAL(stats.bytes_in_use, (stats.buckets[0].hits + 1) * opts.smallest_block_size);
+
+  pool.do_deallocate(p, 16);
+}
+DECLARE_UNITTEST(TestThreadCachedPoolStatistics);
+
 template <template <typename> class PoolTemplate>
 void TestGlobalPool()
 {
@@ -372,3 +562,169 @@ void TestSynchronizedGlobalPool()
   TestGlobalPool<thrust::mr::synchronized_pool_resource>();
 }
 DECLARE_UNITTEST(TestSynchronizedGlobalPool);
+
+void TestThreadCachedGlobalPool()
+{
+  TestGlobalPool<thrust::mr::thread_cached_pool_resource>();
+}
+DECLARE_UNITTEST(TestThreadCachedGlobalPool);
+
+class counting_resource final : public thrust::mr::memory_resource<>
+{
+public:
+  virtual void* do_allocate(std::size_t n, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+  {
+    allocated_bytes += n;
+    return upstream.do_allocate(n, alignment);
+  }
+
+  virtual void do_deallocate(void* p, std::size_t n, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+  {
+    allocated_bytes -= n;
+    upstream.do_deallocate(p, n, alignment);
+  }
+
+  std::atomic<std::size_t> allocated_bytes{0};
+
+private:
+  thrust::mr::new_delete_resource upstream;
+};
+
+void TestThreadCachedPoolCrossThread()
+{
+  counting_resource upstream;
+
+  {
+    using Pool = thrust::mr::thread_cached_pool_resource<counting_resource>;
+
+    Pool pool(&upstream);
+
+    constexpr int num_threads = 4;
+    constexpr int num_blocks  = 1000;
+
+    // every thread allocates blocks of various sizes, and the next thread
+    // deallocates them, so that blocks keep moving between thread caches
+    std::vector<std::vector<void*>> blocks(num_threads, std::vector<void*>(num_blocks));
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < num_threads; ++t)
+    {
+      threads.emplace_back([&pool, &blocks, t] {
+        for (int i = 0; i < num_blocks; ++i)
+        {
+          const std::size_t size = 8 + (i * 37) % 4096;
+
+          blocks[t][i] = pool.do_allocate(size);
+          std::memset(blocks[t][i], t, size);
+        }
+      });
+    }
+    for (auto& thread : threads)
+    {
+      thread.join();
+    }
+    threads.clear();
+
+    // a failing assertion throws, which must not happen on the worker threads
+    std::vector<int> corrupted_blocks(num_threads, 0);
+    for (int t = 0; t < num_threads; ++t)
+    {
+      threads.emplace_back([&pool, &blocks, &corrupted_blocks, t] {
+        const int owner = (t + 1) % num_threads;
+
+        for (int i = 0; i < num_blocks; ++i)
+        {
+          const std::size_t size = 8 + (i * 37) % 4096;
+
+          if (static_cast<unsigned char*>(blocks[owner][i])[size - 1] != owner)
+          {
+            ++corrupted_blocks[t];
+          }
+          pool.do_deallocate(blocks[owner][i], size);
+        }
+      });
+    }
+    for (auto& thread : threads)
+    {
+      thread.join();
+    }
+    for (int t = 0; t < num_threads; ++t)
+    {
+      ASSERT_EQUAL(corrupted_blocks[t], 0);
+    }
+
+    // the blocks freed by the exited threads are available again
+    void* p = pool.do_allocate(64);
+    pool.do_deallocate(p, 64);
+  }
+
+  // the destruction returns everything, including the blocks cached by the exited threads and by this one
+
+  ASSERT_EQUAL(upstream.allocated_bytes.load(), 0u);
+}
+DECLARE_UNITTEST(TestThreadCachedPoolCrossThread);
+
+// overwrites memory before returning it upstream, so that reading pool metadata from a freed chunk gives wrong values
+class poisoning_resource final : public thrust::mr::memory_resource<>
+{
+public:
+  virtual void* do_allocate(std::size_t n, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+  {
+    allocated_bytes += n;
+    return upstream.do_allocate(n, alignment);
+  }
+
+  virtual void do_deallocate(void* p, std::size_t n, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+  {
+    std::memset(p, 0xff, n);
+    allocated_bytes -= n;
+    upstream.do_deallocate(p, n, alignment);
+  }
+
+  std::size_t allocated_bytes = 0;
+
+private:
+  thrust::mr::new_delete_resource upstream;
+};
+
+template <template <typename> class PoolTemplate>
+void TestPoolReleaseStatistics()
+{
+  using Pool = PoolTemplate<poisoning_resource>;
+
+  poisoning_resource upstream;
+
+  thrust::mr::pool_options opts = Pool::get_default_options();
+  opts.largest_block_size       = 1024;
+  opts.collect_statistics       = true;
+
+  Pool pool(&upstream, opts);
+  const std::size_t pool_bytes = upstream.allocated_bytes;
+
+  void* small = pool.do_allocate(16);
+  void* large = pool.do_allocate(2048);
+  pool.do_deallocate(small, 16);
+  pool.do_deallocate(large, 2048);
+
+  thrust::mr::pool_statistics stats = pool.statistics();
+  ASSERT_EQUAL(stats.bytes_held, upstream.allocated_bytes - pool_bytes);
+
+  pool.release();
+
+  stats = pool.statistics();
+  ASSERT_EQUAL(upstream.allocated_bytes, pool_bytes);
+  ASSERT_EQUAL(stats.upstream_deallocations, 2u);
+  ASSERT_EQUAL(stats.bytes_held, 0u);
+}
+
+void TestUnsynchronizedPoolReleaseStatistics()
+{
+  TestPoolReleaseStatistics<thrust::mr::unsynchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestUnsynchronizedPoolReleaseStatistics);
+
+void TestSynchronizedPoolReleaseStatistics()
+{
+  TestPoolReleaseStatistics<thrust::mr::synchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestSynchronizedPoolReleaseStatistics);
@@ -0,0 +1,84 @@
+#include <thrust/detail/config.h>
+
+#include <thrust/mr/new.h>
+#include <thrust/mr/pool.h>
+#include <thrust/mr/tracing_resource.h>
+
+#include <unittest/unittest.h>
+
+void TestTracingResource()
+{
+  thrust::mr::new_delete_resource upstream;
+  thrust::mr::tracing_resource<thrust::mr::new_delete_resource> tracing(&upstream);
+
+  void* a1 = tracing.do_allocate(1);
+  void* a2 = tracing.do_allocate(100, 64);
+  void* a3 = tracing.do_allocate(128);
+
+  thrust::mr::tracing_statistics stats = tracing.statistics();
+  ASSERT_EQUAL(stats.allocations, 3u);
+  ASSERT_EQUAL(stats.deallocations, 0u);
+  ASSERT_EQUAL(stats.bytes_in_use, 229u);
+  ASSERT_EQUAL(stats.blocks_in_use, 3u);
+
+  // 1 byte goes to the first entry, and both 100 and 128 bytes to the entry of 128
+  ASSERT_EQUAL(stats.size_histogram.size(), 8u);
+  ASSERT_EQUAL(stats.size_histogram[0], 1u);
+  ASSERT_EQUAL(stats.size_histogram[7], 2u);
+
+  ASSERT_EQUAL(stats.alignment_histogram.size(), 7u);
+  ASSERT_EQUAL(stats.alignment_histogram[6], 1u);
+
+  tracing.do_deallocate(a3, 128);
+  tracing.do_deallocate(a2, 100, 64);
+
+  stats = tracing.statistics();
+  ASSERT_EQUAL(stats.deallocations, 2u);
+  ASSERT_EQUAL(stats.bytes_in_use, 1u);
+  ASSERT_EQUAL(stats.peak_bytes_in_use, 229u);
+  ASSERT_EQUAL(stats.blocks_in_use, 1u);
+  ASSERT_EQUAL(stats.peak_blocks_in_use, 3u);
+
+  tracing.reset_statistics();
+
+  stats = tracing.statistics();
+  ASSERT_EQUAL(stats.allocations, 0u);
+  ASSERT_EQUAL(stats.peak_bytes_in_use, 1u);
+  ASSERT_EQUAL(stats.size_histogram.empty(), true);
+
+  tracing.do_deallocate(a1, 1);
+}
+DECLARE_UNITTEST(TestTracingResource);
+
+void TestTracingResourceUpstreamOfPool()
+{
+  using tracing_type = thrust::mr::tracing_resource<thrust::mr::new_delete_resource>;
+
+  tracing_type tracing;
+
+  {
+    thrust::mr::pool_options opts = thrust::mr::unsynchronized_pool_resource<tracing_type>::get_default_options();
+    opts.cache_oversized          = false;
+    opts.largest_block_size       = 1024;
+
+    thrust::mr::unsynchronized_pool_resource<tracing_type> pool(&tracing, opts);
+
+    // the pooled blocks share one chunk, the oversized one goes straight to upstream
+    void* a1 = pool.do_allocate(16);
+    void* a2 = pool.do_allocate(16);
+    void* a3 = pool.do_allocate(4096);
+
+    pool.do_deallocate(a3, 4096);
+    pool.do_deallocate(a2, 16);
+    pool.do_deallocate(a1, 16);
+
+    // the chunk stays with the pool, next to the bookkeeping of the pool itself
+    ASSERT_EQUAL(tracing.statistics().blocks_in_use, 2u);
+  }
+
+  thrust::mr::tracing_statistics stats = tracing.statistics();
+  ASSERT_EQUAL(stats.blocks_in_use, 0u);
+  ASSERT_EQUAL(stats.bytes_in_use, 0u);
+  ASSERT_EQUAL(stats.peak_blocks_in_use, 3u);
+}
+DECLARE_UNITTEST(TestTracingResourceUpstreamOfPool);
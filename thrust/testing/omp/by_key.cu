@@ -0,0 +1,254 @@
+#include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
+#include <thrust/host_vector.h>
+#include <thrust/iterator/transform_output_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/scan.h>
+#include <thrust/system/omp/execution_policy.h>
+
+#include <unittest/unittest.h>
+
+// Several threads split the inputs into several tiles, so that segments cross tile boundaries
+
+// the composition of affine maps x -> a * x + b, which is associative but not commutative
+struct affine
+{
+  unsigned int a;
+  unsigned int b;
+
+  _CCCL_HOST_DEVICE bool operator==(const affine& other) const
+  {
+    return a == other.a && b == other.b;
+  }
+
+  _CCCL_HOST_DEVICE bool operator!=(const affine& other) const
+  {
+    return !(*this == other);
+  }
+};
+
+inline std::ostream& operator<<(std::ostream& os, const affine& f)
+{
+  return os << "(" << f.a << ", " << f.b << ")";
+}
+
+struct compose_affine
+{
+  _CCCL_HOST_DEVICE affine operator()(const affine& f, const affine& g) const
+  {
+    return affine{f.a * g.a, f.b * g.a + g.b};
+  }
+};
+
+struct affine_offset
+{
+  _CCCL_HOST_DEVICE unsigned int operator()(const affine& f) const
+  {
+    return f.b;
+  }
+};
+
+// segments of 1 to 40 elements, with one segment longer than a tile in the middle
+thrust::host_vector<int> make_by_key_keys(size_t n)
+{
+  thrust::host_vector<int> keys(n);
+  int key       = 0;
+  size_t length = 0;
+  for (size_t i = 0; i < n; ++i)
+  {
+    if (length == 0)
+    {
+      ++key;
+      length = (i > n / 2 && i < n / 2 + 10000) ? 10000 : 1 + (i * 7919) % 40;
+    }
+    keys[i] = key;
+    --length;
+  }
+  return keys;
+}
+
+thrust::host_vector<affine> make_by_key_values(size_t n)
+{
+  thrust::host_vector<affine> values(n);
+  for (size_t i = 0; i < n; ++i)
+  {
+    values[i] = affine{static_cast<unsigned int>(i % 7 + 1), static_cast<unsigned int>(i % 13)};
+  }
+  return values;
+}
+
+inline constexpr size_t by_key_test_size = 100000;
+
+void TestOmpReduceByKeyManyTiles()
+{
+  const thrust::host_vector<int> h_keys      = make_by_key_keys(by_key_test_size);
+  const thrust::host_vector<affine> h_values = make_by_key_values(by_key_test_size);
+
+  thrust::host_vector<int> h_keys_output(by_key_test_size);
+  thrust::host_vector<affine> h_values_output(by_key_test_size);
+  const auto h_end = thrust::reduce_by_key(
+    thrust::seq,
+    h_keys.begin(),
+    h_keys.end(),
+    h_values.begin(),
+    h_keys_output.begin(),
+    h_values_output.begin(),
+    ::cuda::std::equal_to<int>(),
+    compose_affine());
+  const size_t num_segments = h_end.first - h_keys_output.begin();
+  h_keys_output.resize(num_segments);
+  h_values_output.resize(num_segments);
+
+  for (unsigned int threads : {1u, 3u, 8u})
+  {
+    const thrust::device_vector<int> d_keys      = h_keys;
+    const thrust::device_vector<affine> d_values = h_values;
+
+    thrust::device_vector<int> d_keys_output(by_key_test_size);
+    thrust::device_vector<affine> d_values_output(by_key_test_size);
+    const auto d_end = thrust::reduce_by_key(
+      thrust::omp::par.with(thrust::omp::threads(threads)),
+      d_keys.begin(),
+      d_keys.end(),
+      d_values.begin(),
+      d_keys_output.begin(),
+      d_values_output.begin(),
+      ::cuda::std::equal_to<int>(),
+      compose_affine());
+    ASSERT_EQUAL(static_cast<size_t>(d_end.first - d_keys_output.begin()), num_segments);
+    ASSERT_EQUAL(static_cast<size_t>(d_end.second - d_values_output.begin()), num_segments);
+    d_keys_output.resize(num_segments);
+    d_values_output.resize(num_segments);
+    ASSERT_EQUAL(h_keys_output, d_keys_output);
+    ASSERT_EQUAL(h_values_output, d_values_output);
+
+    // an output iterator which cannot be read from
+    thrust::device_vector<unsigned int> d_offsets(num_segments);
+    thrust::reduce_by_key(
+      thrust::omp::par.with(thrust::omp::threads(threads)),
+      d_keys.begin(),
+      d_keys.end(),
+      d_values.begin(),
+      d_keys_output.begin(),
+      thrust::make_transform_output_iterator(d_offsets.begin(), affine_offset()),
+      ::cuda::std::equal_to<int>(),
+      compose_affine());
+    for (size_t i = 0; i < num_segments; ++i)
+    {
+      ASSERT_EQUAL(static_cast<unsigned int>(d_offsets[i]), h_values_output[i].b);
+    }
+  }
+}
+DECLARE_UNITTEST(TestOmpReduceByKeyManyTiles);
+
+void TestOmpScanByKeyManyTiles()
+{
+  const thrust::host_vector<int> h_keys      = make_by_key_keys(by_key_test_size);
+  const thrust::host_vector<affine> h_values = make_by_key_values(by_key_test_size);
+  const affine init{2, 5};
+
+  thrust::host_vector<affine> h_inclusive(by_key_test_size);
+  thrust::inclusive_scan_by_key(
+    thrust::seq,
+    h_keys.begin(),
+    h_keys.end(),
+    h_values.begin(),
+    h_inclusive.begin(),
+    ::cuda::std::equal_to<int>(),
+    compose_affine());
+
+  thrust::host_vector<affine> h_exclusive(by_key_test_size);
+  thrust::exclusive_scan_by_key(
+    thrust::seq,
+    h_keys.begin(),
+    h_keys.end(),
+    h_values.begin(),
+    h_exclusive.begin(),
+    init,
+    ::cuda::std::equal_to<int>(),
+    compose_affine());
+
+  for (unsigned int threads : {1u, 3u, 8u})
+  {
+    const auto policy                       = thrust::omp::par.with(thrust::omp::threads(threads));
+    const thrust::device_vector<int> d_keys = h_keys;
+
+    thrust::device_vector<affine> d_values = h_values;
+    thrust::device_vector<affine> d_result(by_key_test_size);
+    thrust::inclusive_scan_by_key(
+      policy,
+      d_keys.begin(),
+      d_keys.end(),
+      d_values.begin(),
+      d_result.begin(),
+      ::cuda::std::equal_to<int>(),
+      compose_affine());
+    ASSERT_EQUAL(h_inclusive, d_result);
+
+    thrust::exclusive_scan_by_key(
+      policy,
+      d_keys.begin(),
+      d_keys.end(),
+      d_values.begin(),
+      d_result.begin(),
+      init,
+      ::cuda::std::equal_to<int>(),
+      compose_affine());
+    ASSERT_EQUAL(h_exclusive, d_result);
+
+    // in place
+    thrust::inclusive_scan_by_key(
+      policy,
+      d_keys.begin(),
+      d_keys.end(),
+      d_values.begin(),
+      d_values.begin(),
+      ::cuda::std::equal_to<int>(),
+      compose_affine());
+    ASSERT_EQUAL(h_inclusive, d_values);
+
+    d_values = h_values;
+    thrust::exclusive_scan_by_key(
+      policy,
+      d_keys.begin(),
+      d_keys.end(),
+      d_values.begin(),
+      d_values.begin(),
+      init,
+      ::cuda::std::equal_to<int>(),
+      compose_affine());
+    ASSERT_EQUAL(h_exclusive, d_values);
+  }
+}
+DECLARE_UNITTEST(TestOmpScanByKeyManyTiles);
+
+void TestOmpScanByKeyManyTilesInPlaceKeys()
+{
+  const thrust::host_vector<int> h_keys = make_by_key_keys(by_key_test_size);
+  thrust::host_vector<int> h_values(by_key_test_size);
+  for (size_t i = 0; i < by_key_test_size; ++i)
+  {
+    h_values[i] = static_cast<int>(i % 10);
+  }
+
+  thrust::host_vector<int> h_inclusive(by_key_test_size);
+  thrust::inclusive_scan_by_key(thrust::seq, h_keys.begin(), h_keys.end(), h_values.begin(), h_inclusive.begin());
+  thrust::host_vector<int> h_exclusive(by_key_test_size);
+  thrust::exclusive_scan_by_key(thrust::seq, h_keys.begin(), h_keys.end(), h_values.begin(), h_exclusive.begin());
+
+  for (unsigned int threads : {1u, 3u, 8u})
+  {
+    const auto policy                         = thrust::omp::par.with(thrust::omp::threads(threads));
+    const thrust::device_vector<int> d_values = h_values;
+
+    // the keys of the next tile must not be overwritten before they are compared
+    thrust::device_vector<int> d_keys = h_keys;
+    thrust::inclusive_scan_by_key(policy, d_keys.begin(), d_keys.end(), d_values.begin(), d_keys.begin());
+    ASSERT_EQUAL(h_inclusive, d_keys);
+
+    d_keys = h_keys;
+    thrust::exclusive_scan_by_key(policy, d_keys.begin(), d_keys.end(), d_values.begin(), d_keys.begin());
+    ASSERT_EQUAL(h_exclusive, d_keys);
+  }
+}
+DECLARE_UNITTEST(TestOmpScanByKeyManyTilesInPlaceKeys);
@@ -0,0 +1,184 @@
+#include <thrust/copy.h>
+#include <thrust/for_each.h>
+#include <thrust/merge.h>
+#include <thrust/reduce.h>
+#include <thrust/scan.h>
+#include <thrust/set_operations.h>
+#include <thrust/sort.h>
+#include <thrust/system/omp/execution_policy.h>
+#include <thrust/unique.h>
+
+#include <atomic>
+
+#include <omp.h>
+#include <unittest/unittest.h>
+
+void TestOmpParWithConfig()
+{
+  using thrust::system::omp::detail::execution_config;
+
+  const execution_config default_config = thrust::omp::par.config();
+  ASSERT_EQUAL(default_config.num_threads, 0u);
+  ASSERT_EQUAL(default_config.grain_size, 0u);
+  ASSERT_EQUAL(default_config.schedule_kind == thrust::omp::schedule::automatic, true);
+
+  const auto policy =
+    thrust::omp::par.with(thrust::omp::threads(3), thrust::omp::grain(64), thrust::omp::schedule::dynamic);
+  ASSERT_EQUAL(policy.config().num_threads, 3u);
+  ASSERT_EQUAL(policy.config().grain_size, 64u);
+  ASSERT_EQUAL(policy.config().schedule_kind == thrust::omp::schedule::dynamic, true);
+
+  // the knobs can be changed one at a time, later ones win
+  const auto changed = policy.with(thrust::omp::schedule::guided, thrust::omp::threads(2), thrust::omp::threads(5));
+  ASSERT_EQUAL(changed.config().num_threads, 5u);
+  ASSERT_EQUAL(changed.config().grain_size, 64u);
+  ASSERT_EQUAL(changed.config().schedule_kind == thrust::omp::schedule::guided, true);
+
+  // the tag has nothing to configure
+  ASSERT_EQUAL(thrust::omp::tag{}.config().num_threads, 0u);
+}
+DECLARE_UNITTEST(TestOmpParWithConfig);
+
+void TestOmpParWithAllocator()
+{
+  std::allocator<char> alloc;
+
+  const auto policy = thrust::omp::par(alloc).with(thrust::omp::threads(2));
+  ASSERT_EQUAL(policy.config().num_threads, 2u);
+
+  thrust::host_vector<int> h_data = unittest::random_integers<int>(10000);
+  thrust::device_vector<int> d_data = h_data;
+
+  thrust::sort(h_data.begin(), h_data.end());
+  thrust::sort(policy, d_data.begin(), d_data.end());
+
+  ASSERT_EQUAL(h_data, d_data);
+}
+DECLARE_UNITTEST(TestOmpParWithAllocator);
+
+struct record_team_size
+{
+  std::atomic<int>* max_team_size;
+
+  void operator()(int) const
+  {
+    const int team_size = omp_get_num_threads();
+    int current         = max_team_size->load();
+    while (current < team_size && !max_team_size->compare_exchange_weak(current, team_size))
+    {
+    }
+  }
+};
+
+void TestOmpParWithThreads()
+{
+  thrust::device_vector<int> data(1000);
+
+  {
+    std::atomic<int> max_team_size{0};
+    thrust::for_each(
+      thrust::omp::par.with(thrust::omp::threads(2)), data.begin(), data.end(), record_team_size{&max_team_size});
+    ASSERT_EQUAL(max_team_size.load() <= 2, true);
+  }
+
+  {
+    // a grain as large as the input keeps it on a single thread
+    std::atomic<int> max_team_size{0};
+    thrust::for_each(thrust::omp::par.with(thrust::omp::threads(4), thrust::omp::grain(1000)),
+                     data.begin(),
+                     data.end(),
+                     record_team_size{&max_team_size});
+    ASSERT_EQUAL(max_team_size.load(), 1);
+  }
+}
+DECLARE_UNITTEST(TestOmpParWithThreads);
+
+struct is_even
+{
+  template <typename T>
+  bool operator()(T x) const
+  {
+    return x % 2 == 0;
+  }
+};
+
+template <typename T, typename Policy>
+void check_algorithms(const Policy& policy, size_t n)
+{
+  thrust::host_vector<T> h_a = unittest::random_integers<T>(n);
+  thrust::host_vector<T> h_b = unittest::random_integers<T>(n / 2);
+  thrust::device_vector<T> d_a = h_a;
+  thrust::device_vector<T> d_b = h_b;
+
+  ASSERT_EQUAL(thrust::reduce(h_a.begin(), h_a.end()), thrust::reduce(policy, d_a.begin(), d_a.end()));
+
+  {
+    thrust::host_vector<T> h_result(n);
+    thrust::device_vector<T> d_result(n);
+    thrust::inclusive_scan(h_a.begin(), h_a.end(), h_result.begin());
+    thrust::inclusive_scan(policy, d_a.begin(), d_a.end(), d_result.begin());
+    ASSERT_EQUAL(h_result, d_result);
+  }
+
+  {
+    thrust::host_vector<T> h_result(n);
+    thrust::device_vector<T> d_result(n);
+    const auto h_end = thrust::copy_if(h_a.begin(), h_a.end(), h_result.begin(), is_even{});
+    const auto d_end = thrust::copy_if(policy, d_a.begin(), d_a.end(), d_result.begin(), is_even{});
+    ASSERT_EQUAL(h_end - h_result.begin(), d_end - d_result.begin());
+    ASSERT_EQUAL(h_result, d_result);
+  }
+
+  thrust::stable_sort(h_a.begin(), h_a.end());
+  thrust::stable_sort(policy, d_a.begin(), d_a.end());
+  ASSERT_EQUAL(h_a, d_a);
+
+  thrust::stable_sort(h_b.begin(), h_b.end(), ::cuda::std::greater<T>());
+  thrust::stable_sort(policy, d_b.begin(), d_b.end(), ::cuda::std::greater<T>());
+  ASSERT_EQUAL(h_b, d_b);
+  thrust::sort(h_b.begin(), h_b.end());
+  thrust::sort(policy, d_b.begin(), d_b.end());
+  ASSERT_EQUAL(h_b, d_b);
+
+  {
+    thrust::host_vector<T> h_result(h_a.size() + h_b.size());
+    thrust::device_vector<T> d_result(d_a.size() + d_b.size());
+    thrust::merge(h_a.begin(), h_a.end(), h_b.begin(), h_b.end(), h_result.begin());
+    thrust::merge(policy, d_a.begin(), d_a.end(), d_b.begin(), d_b.end(), d_result.begin());
+    ASSERT_EQUAL(h_result, d_result);
+  }
+
+  {
+    thrust::host_vector<T> h_result(h_a.size() + h_b.size());
+    thrust::device_vector<T> d_result(d_a.size() + d_b.size());
+    const auto h_end = thrust::set_union(h_a.begin(), h_a.end(), h_b.begin(), h_b.end(), h_result.begin());
+    const auto d_end = thrust::set_union(policy, d_a.begin(), d_a.end(), d_b.begin(), d_b.end(), d_result.begin());
+    ASSERT_EQUAL(h_end - h_result.begin(), d_end - d_result.begin());
+    ASSERT_EQUAL(h_result, d_result);
+  }
+
+  const auto h_end = thrust::unique(h_a.begin(), h_a.end());
+  const auto d_end = thrust::unique(policy, d_a.begin(), d_a.end());
+  ASSERT_EQUAL(h_end - h_a.begin(), d_end - d_a.begin());
+  ASSERT_EQUAL(h_a, d_a);
+}
+
+template <typename T>
+struct TestOmpParWithAlgorithms
+{
+  void operator()(const size_t n)
+  {
+    using thrust::omp::grain;
+    using thrust::omp::schedule;
+    using thrust::omp::threads;
+
+    check_algorithms<T>(thrust::omp::par.with(threads(1)), n);
+    check_algorithms<T>(thrust::omp::par.with(threads(3)), n);
+    check_algorithms<T>(thrust::omp::par.with(threads(4), grain(1000)), n);
+    check_algorithms<T>(thrust::omp::par.with(schedule::static_), n);
+    check_algorithms<T>(thrust::omp::par.with(schedule::static_, grain(7)), n);
+    check_algorithms<T>(thrust::omp::par.with(threads(3), schedule::dynamic, grain(100)), n);
+    check_algorithms<T>(thrust::omp::par.with(threads(2), schedule::guided), n);
+  }
+};
+VariableUnitTest<TestOmpParWithAlgorithms, IntegralTypes> TestOmpParWithAlgorithmsInstance;
@@ -27,6 +27,7 @@
 #include <thrust/mr/allocator.h>
 #include <thrust/mr/memory_resource.h>
 #include <thrust/mr/pool_options.h>
+#include <thrust/mr/statistics.h>
 
 #include <cuda/__cmath/ilog.h>
 #include <cuda/__memory/is_valid_alignment.h>
@@ -35,6 +36,7 @@
 #include <cuda/std/__host_stdlib/algorithm>
 #include <cuda/std/cassert>
 #include <cuda/std/cstdint>
+#include <cuda/std/limits>
 
 THRUST_NAMESPACE_BEGIN
 namespace mr
@@ -97,6 +99,10 @@ public:
     ret.cached_size_cutoff_factor      = 16;
     ret.cached_alignment_cutoff_factor = 16;
 
+    ret.max_cached_bytes = ::cuda::std::numeric_limits<std::size_t>::max();
+
+    ret.collect_statistics = false;
+
     return ret;
   }
 
@@ -115,7 +121,9 @@ public:
       , m_pools(m_bookkeeper)
       , m_allocated(m_bookkeeper)
       , m_cached_oversized(m_bookkeeper)
+      , m_cached_oversized_bytes(0)
       , m_oversized(m_bookkeeper)
+      , m_statistics(m_options)
   {
     assert(m_options.validate());
 
@@ -138,7 +146,9 @@ public:
       , m_pools(m_bookkeeper)
       , m_allocated(m_bookkeeper)
       , m_cached_oversized(m_bookkeeper)
+      , m_cached_oversized_bytes(0)
       , m_oversized(m_bookkeeper)
+      , m_statistics(m_options)
   {
     assert(m_options.validate());
 
@@ -256,9 +266,13 @@ private:
   chunk_vector m_allocated;
   // list of all cached oversized/overaligned blocks that have been returned to the pool to cache
   oversized_block_vector m_cached_oversized;
+  // total size of the blocks in the above
+  std::size_t m_cached_oversized_bytes;
   // list of all oversized/overaligned allocations from upstream
   oversized_block_vector m_oversized;
 
+  thrust::detail::pool_statistics_recorder m_statistics;
+
 public:
   /*! Releases all held memory to upstream.
    */
@@ -275,17 +289,36 @@ public:
     for (std::size_t i = 0; i < m_allocated.size(); ++i)
     {
       m_upstream->do_deallocate(m_allocated[i].pointer, m_allocated[i].size, m_options.alignment);
+      m_statistics.upstream_deallocated(m_allocated[i].size);
     }
 
     // deallocate cached oversized/overaligned memory
     for (std::size_t i = 0; i < m_oversized.size(); ++i)
     {
       m_upstream->do_deallocate(m_oversized[i].pointer, m_oversized[i].size, m_oversized[i].alignment);
+      m_statistics.upstream_deallocated(m_oversized[i].size);
     }
 
     m_allocated.clear();
     m_oversized.clear();
     m_cached_oversized.clear();
+    m_cached_oversized_bytes = 0;
+
+    m_statistics.released();
+  }
+
+  /*! Returns the statistics collected by the pool. Empty unless \p pool_options::collect_statistics is true.
+   */
+  pool_statistics statistics() const
+  {
+    return m_statistics.get();
+  }
+
+  /*! Resets the counts of the collected statistics, and the peaks to the current values.
+   */
+  void reset_statistics()
+  {
+    m_statistics.reset();
   }
 
   void squeeze()
@@ -323,6 +356,7 @@ public:
 
         // Deallocate and remove this chunk from the list of allocated chunks
         m_upstream->do_deallocate((*it).pointer, (*it).size, m_options.alignment);
+        m_statistics.upstream_deallocated((*it).size);
         it = m_allocated.erase(it);
       }
       else
@@ -335,9 +369,11 @@ public:
     for (auto it = m_cached_oversized.begin(); it != m_cached_oversized.end();)
     {
       m_upstream->do_deallocate((*it).pointer, (*it).size, (*it).alignment);
+      m_statistics.upstream_deallocated((*it).size);
       m_oversized.erase(find(m_oversized.begin(), m_oversized.end(), *it));
       it = m_cached_oversized.erase(it);
     }
+    m_cached_oversized_bytes = 0;
   }
 
   [[nodiscard]] virtual void_ptr
@@ -404,7 +440,12 @@ public:
         if (it != m_cached_oversized.end())
         {
           oversized.pointer = (*it).pointer;
+          m_cached_oversized_bytes -= (*it).size;
           m_cached_oversized.erase(it);
+
+          m_statistics.oversized_hit();
+          m_statistics.allocated(bytes);
+
           return oversized.pointer;
         }
       }
@@ -413,6 +454,10 @@ public:
       oversized.pointer = m_upstream->do_allocate(bytes, alignment);
       m_oversized.push_back(oversized);
 
+      m_statistics.oversized_miss();
+      m_statistics.upstream_allocated(bytes);
+      m_statistics.allocated(bytes);
+
       return oversized.pointer;
     }
 
@@ -455,11 +500,20 @@ public:
       m_allocated.push_back(allocated);
       bucket.previous_allocated_count = n;
 
+      m_statistics.bucket_miss(pool_idx);
+      m_statistics.upstream_allocated(bytes);
+
       for (std::size_t i = 0; i < n; ++i)
       {
         bucket.free_blocks.push_back(static_cast<void_ptr>(static_cast<char_ptr>(allocated.pointer) + i * bucket_size));
       }
     }
+    else
+    {
+      m_statistics.bucket_hit(pool_idx);
+    }
+
+    m_statistics.allocated(static_cast<std::size_t>(1) << bytes_log2);
 
     // allocate a block from the front of the bucket's free list
     void_ptr ret = bucket.free_blocks.back();
@@ -483,17 +537,34 @@ public:
 
       oversized_block_descriptor oversized = *it;
 
-      if (m_options.cache_oversized)
+      m_statistics.deallocated(n);
+
+      // blocks bigger than the cache itself are never cached
+      if (m_options.cache_oversized && oversized.size <= m_options.max_cached_bytes)
       {
+        // make room by returning the biggest cached blocks to upstream first
+        while (m_cached_oversized_bytes > m_options.max_cached_bytes - oversized.size)
+        {
+          oversized_block_descriptor evicted = m_cached_oversized.back();
+          m_cached_oversized.pop_back();
+          m_cached_oversized_bytes -= evicted.size;
+
+          m_oversized.erase(find(m_oversized.begin(), m_oversized.end(), evicted));
+          m_upstream->do_deallocate(evicted.pointer, evicted.size, evicted.alignment);
+          m_statistics.upstream_deallocated(evicted.size);
+        }
+
         typename oversized_block_vector::iterator position =
           lower_bound(m_cached_oversized.begin(), m_cached_oversized.end(), oversized);
         m_cached_oversized.insert(position, oversized);
+        m_cached_oversized_bytes += oversized.size;
         return;
       }
 
       m_oversized.erase(it);
 
       m_upstream->do_deallocate(p, oversized.size, oversized.alignment);
+      m_statistics.upstream_deallocated(oversized.size);
 
       return;
     }
@@ -503,6 +574,8 @@ public:
     std::size_t pool_idx = n_log2 - m_smallest_block_log2;
     pool& bucket         = m_pools[pool_idx];
 
+    m_statistics.deallocated(static_cast<std::size_t>(1) << n_log2);
+
     bucket.free_blocks.push_back(p);
   }
 };
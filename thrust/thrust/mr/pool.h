@@ -23,12 +23,14 @@
 #include <thrust/mr/allocator.h>
 #include <thrust/mr/memory_resource.h>
 #include <thrust/mr/pool_options.h>
+#include <thrust/mr/statistics.h>
 
 #include <cuda/__cmath/ilog.h>
 #include <cuda/__memory/is_valid_alignment.h>
 #include <cuda/std/__host_stdlib/algorithm>
 #include <cuda/std/cassert>
 #include <cuda/std/cstdint>
+#include <cuda/std/limits>
 
 THRUST_NAMESPACE_BEGIN
 namespace mr
@@ -89,6 +91,10 @@ public:
     ret.cached_size_cutoff_factor      = 16;
     ret.cached_alignment_cutoff_factor = 16;
 
+    ret.max_cached_bytes = ::cuda::std::numeric_limits<std::size_t>::max();
+
+    ret.collect_statistics = false;
+
     return ret;
   }
 
@@ -105,6 +111,8 @@ public:
       , m_allocated()
       , m_oversized()
       , m_cached_oversized()
+      , m_cached_oversized_bytes(0)
+      , m_statistics(m_options)
   {
     assert(m_options.validate());
 
@@ -126,6 +134,8 @@ public:
       , m_allocated()
       , m_oversized()
       , m_cached_oversized()
+      , m_cached_oversized_bytes(0)
+      , m_statistics(m_options)
   {
     assert(m_options.validate());
 
@@ -167,8 +177,8 @@ private:
 
   // this was originally a forward list, but I made it a doubly linked list
   // because that way deallocation when not caching is faster and doesn't require
-  // traversal of a linked list (it's still a forward list for the cached list,
-  // because allocation from that list already traverses)
+  // traversal of a linked list (the cached lists are still forward lists,
+  // because allocation from them already traverses)
   //
   // TODO: investigate whether it's better to have this be a doubly-linked list
   // with fast do_deallocate when !m_options.cache_oversized, or to have this be
@@ -200,10 +210,124 @@ private:
   pool_options m_options;
   std::size_t m_smallest_block_log2;
 
+  // cached oversized blocks are segregated into bins by the binary logarithm
+  // of their size, and every bin is kept sorted by size, so that the smallest
+  // fitting block is found without walking over all of the smaller ones
+  static constexpr std::size_t cached_oversized_bin_count = ::cuda::std::numeric_limits<std::size_t>::digits;
+
   pool_vector m_pools;
   chunk_descriptor_ptr m_allocated;
   oversized_block_descriptor_ptr m_oversized;
-  oversized_block_descriptor_ptr m_cached_oversized;
+  oversized_block_descriptor_ptr m_cached_oversized[cached_oversized_bin_count];
+  std::size_t m_cached_oversized_bytes;
+
+  thrust::detail::pool_statistics_recorder m_statistics;
+
+  static std::size_t cached_oversized_bin(std::size_t size)
+  {
+    return static_cast<std::size_t>(::cuda::ilog2(size));
+  }
+
+  // removes the smallest cached block that can fulfill the request within the
+  // cutoff factors from the cache and returns it, or returns a null pointer
+  oversized_block_descriptor_ptr take_cached_oversized(std::size_t bytes, std::size_t alignment)
+  {
+    for (std::size_t bin = cached_oversized_bin(bytes); bin < cached_oversized_bin_count; ++bin)
+    {
+      oversized_block_descriptor_ptr* previous = &m_cached_oversized[bin];
+      oversized_block_descriptor_ptr ptr       = *previous;
+
+      while (oversized_block_ptr_traits::get(ptr))
+      {
+        oversized_block_descriptor desc = *ptr;
+
+        if (desc.size >= bytes)
+        {
+          // if the size is bigger than the requested size by a factor
+          // bigger than or equal to the specified cutoff for size, so is the
+          // size of every block after this one
+          if (desc.size / bytes >= m_options.cached_size_cutoff_factor)
+          {
+            return oversized_block_descriptor_ptr();
+          }
+
+          // the alignment must not be bigger than the requested one by a factor
+          // bigger than or equal to the specified cutoff for alignment
+          if (desc.alignment >= alignment && desc.alignment / alignment < m_options.cached_alignment_cutoff_factor)
+          {
+            *previous = desc.next_cached;
+            m_cached_oversized_bytes -= desc.size;
+            return ptr;
+          }
+        }
+
+        previous = &thrust::raw_reference_cast(*ptr).next_cached;
+        ptr      = *previous;
+      }
+    }
+
+    return oversized_block_descriptor_ptr();
+  }
+
+  // inserts a block, whose descriptor is at the end of its full size, into its bin
+  void cache_oversized(oversized_block_descriptor_ptr block)
+  {
+    oversized_block_descriptor desc = *block;
+
+    oversized_block_descriptor_ptr* previous = &m_cached_oversized[cached_oversized_bin(desc.size)];
+    while (oversized_block_ptr_traits::get(*previous) && thrust::raw_reference_cast(**previous).size < desc.size)
+    {
+      previous = &thrust::raw_reference_cast(**previous).next_cached;
+    }
+
+    desc.next_cached = *previous;
+    *block           = desc;
+    *previous        = block;
+
+    m_cached_oversized_bytes += desc.size;
+  }
+
+  // returns cached blocks to upstream, starting with the biggest bin and the
+  // smallest block within a bin, until no more than `limit` bytes remain cached
+  void evict_cached_oversized(std::size_t limit)
+  {
+    for (std::size_t bin = cached_oversized_bin_count; bin-- > 0 && m_cached_oversized_bytes > limit;)
+    {
+      while (m_cached_oversized_bytes > limit && oversized_block_ptr_traits::get(m_cached_oversized[bin]))
+      {
+        oversized_block_descriptor_ptr block = m_cached_oversized[bin];
+        oversized_block_descriptor desc      = *block;
+
+        m_cached_oversized[bin] = desc.next_cached;
+        m_cached_oversized_bytes -= desc.size;
+
+        deallocate_oversized(block, desc);
+      }
+    }
+  }
+
+  // unlinks an oversized block from the list of all oversized blocks and
+  // returns it to upstream
+  void deallocate_oversized(oversized_block_descriptor_ptr block, const oversized_block_descriptor& desc)
+  {
+    if (oversized_block_ptr_traits::get(desc.prev))
+    {
+      thrust::raw_reference_cast(*desc.prev).next = desc.next;
+    }
+    else
+    {
+      m_oversized = desc.next;
+    }
+
+    if (oversized_block_ptr_traits::get(desc.next))
+    {
+      thrust::raw_reference_cast(*desc.next).prev = desc.prev;
+    }
+
+    void_ptr p = static_cast<void_ptr>(static_cast<char_ptr>(static_cast<void_ptr>(block)) - desc.current_size);
+    m_upstream->do_deallocate(p, desc.size + sizeof(oversized_block_descriptor), desc.alignment);
+    m_statistics.upstream_deallocated(desc.size + sizeof(oversized_block_descriptor));
+  }
 
 public:
   /*! Releases all held memory to upstream.
@@ -223,10 +347,13 @@ public:
       chunk_descriptor_ptr alloc = m_allocated;
       m_allocated                = thrust::raw_reference_cast(*m_allocated).next;
 
+      // the descriptor lives in the chunk, so its size must be read before the chunk is deallocated
+      const std::size_t chunk_size = thrust::raw_reference_cast(*alloc).size + sizeof(chunk_descriptor);
+
       void_ptr p = static_cast<void_ptr>(
         static_cast<char_ptr>(static_cast<void_ptr>(alloc)) - thrust::raw_reference_cast(*alloc).size);
-      m_upstream->do_deallocate(
-        p, thrust::raw_reference_cast(*alloc).size + sizeof(chunk_descriptor), m_options.alignment);
+      m_upstream->do_deallocate(p, chunk_size, m_options.alignment);
+      m_statistics.upstream_deallocated(chunk_size);
     }
 
     // deallocate cached oversized/overaligned memory
@@ -239,9 +366,30 @@ public:
 
       void_ptr p = static_cast<void_ptr>(static_cast<char_ptr>(static_cast<void_ptr>(alloc)) - desc.current_size);
       m_upstream->do_deallocate(p, desc.size + sizeof(oversized_block_descriptor), desc.alignment);
+      m_statistics.upstream_deallocated(desc.size + sizeof(oversized_block_descriptor));
+    }
+
+    for (std::size_t i = 0; i < cached_oversized_bin_count; ++i)
+    {
+      m_cached_oversized[i] = oversized_block_descriptor_ptr();
     }
+    m_cached_oversized_bytes = 0;
+
+    m_statistics.released();
+  }
+
+  /*! Returns the statistics collected by the pool. Empty unless \p pool_options::collect_statistics is true.
+   */
+  pool_statistics statistics() const
+  {
+    return m_statistics.get();
+  }
 
-    m_cached_oversized = oversized_block_descriptor_ptr();
+  /*! Resets the counts of the collected statistics, and the peaks to the current values.
+   */
+  void reset_statistics()
+  {
+    m_statistics.reset();
   }
 
   [[nodiscard]] virtual void_ptr
@@ -255,80 +403,42 @@ public:
     {
       if (m_options.cache_oversized)
       {
-        oversized_block_descriptor_ptr ptr       = m_cached_oversized;
-        oversized_block_descriptor_ptr* previous = &m_cached_oversized;
-        while (oversized_block_ptr_traits::get(ptr))
+        oversized_block_descriptor_ptr ptr = take_cached_oversized(bytes, alignment);
+
+        if (oversized_block_ptr_traits::get(ptr))
         {
           oversized_block_descriptor desc = *ptr;
-          bool is_good                    = desc.size >= bytes && desc.alignment >= alignment;
+          desc.next_cached                = oversized_block_descriptor_ptr();
 
-          // if the size is bigger than the requested size by a factor
-          // bigger than or equal to the specified cutoff for size,
-          // allocate a new block
-          if (is_good)
-          {
-            std::size_t size_factor = desc.size / bytes;
-            if (size_factor >= m_options.cached_size_cutoff_factor)
-            {
-              is_good = false;
-            }
-          }
+          auto ret = static_cast<char_ptr>(static_cast<void_ptr>(ptr)) - desc.size;
 
-          // if the alignment is bigger than the requested one by a factor
-          // bigger than or equal to the specified cutoff for alignment,
-          // allocate a new block
-          if (is_good)
+          if (bytes != desc.size)
           {
-            std::size_t alignment_factor = desc.alignment / alignment;
-            if (alignment_factor >= m_options.cached_alignment_cutoff_factor)
-            {
-              is_good = false;
-            }
-          }
+            desc.current_size = bytes;
 
-          if (is_good)
-          {
-            if (previous != &m_cached_oversized)
+            ptr = static_cast<oversized_block_descriptor_ptr>(static_cast<void_ptr>(ret + bytes));
+
+            if (oversized_block_ptr_traits::get(desc.prev))
             {
-              *previous = desc.next_cached;
+              thrust::raw_reference_cast(*desc.prev).next = ptr;
             }
             else
             {
-              m_cached_oversized = desc.next_cached;
+              m_oversized = ptr;
             }
 
-            desc.next_cached = oversized_block_descriptor_ptr();
-
-            auto ret = static_cast<char_ptr>(static_cast<void_ptr>(ptr)) - desc.size;
-
-            if (bytes != desc.size)
+            if (oversized_block_ptr_traits::get(desc.next))
             {
-              desc.current_size = bytes;
-
-              ptr = static_cast<oversized_block_descriptor_ptr>(static_cast<void_ptr>(ret + bytes));
-
-              if (oversized_block_ptr_traits::get(desc.prev))
-              {
-                thrust::raw_reference_cast(*desc.prev).next = ptr;
-              }
-              else
-              {
-                m_oversized = ptr;
-              }
-
-              if (oversized_block_ptr_traits::get(desc.next))
-              {
-                thrust::raw_reference_cast(*desc.next).prev = ptr;
-              }
+              thrust::raw_reference_cast(*desc.next).prev = ptr;
             }
+          }
 
-            *ptr = desc;
+          *ptr = desc;
 
-            return static_cast<void_ptr>(ret);
-          }
+          m_statistics.oversized_hit();
+          m_statistics.allocated(bytes);
 
-          previous = &thrust::raw_reference_cast(*ptr).next_cached;
-          ptr      = *previous;
+          return static_cast<void_ptr>(ret);
         }
       }
 
@@ -354,6 +464,10 @@ public:
         *desc.next                      = next;
       }
 
+      m_statistics.oversized_miss();
+      m_statistics.upstream_allocated(bytes + sizeof(oversized_block_descriptor));
+      m_statistics.allocated(bytes);
+
       return allocated;
     }
 
@@ -400,6 +514,9 @@ public:
       chunk_descriptor_ptr chunk =
         static_cast<chunk_descriptor_ptr>(static_cast<void_ptr>(static_cast<char_ptr>(allocated) + chunk_size));
 
+      m_statistics.bucket_miss(bucket_idx);
+      m_statistics.upstream_allocated(chunk_size + sizeof(chunk_descriptor));
+
       chunk_descriptor chunk_desc;
       chunk_desc.size = chunk_size;
       chunk_desc.next = m_allocated;
@@ -417,6 +534,12 @@ public:
         bucket.free_list = block;
       }
     }
+    else
+    {
+      m_statistics.bucket_hit(bucket_idx);
+    }
+
+    m_statistics.allocated(bytes);
 
     // allocate a block from the front of the bucket's free list
     block_descriptor_ptr block = bucket.free_list;
@@ -442,10 +565,11 @@ public:
       assert(desc.current_size == n);
       assert(desc.alignment == alignment);
 
-      if (m_options.cache_oversized)
-      {
-        desc.next_cached = m_cached_oversized;
+      m_statistics.deallocated(n);
 
+      // blocks bigger than the cache itself are never cached
+      if (m_options.cache_oversized && desc.size <= m_options.max_cached_bytes)
+      {
         if (desc.size != n)
         {
           desc.current_size = desc.size;
@@ -466,27 +590,17 @@ public:
           }
         }
 
-        m_cached_oversized = block;
-        *block             = desc;
+        // the descriptor must be in place before evicting, because evicting a
+        // neighbor in the list of all oversized blocks updates it
+        *block = desc;
 
-        return;
-      }
-
-      if (oversized_block_ptr_traits::get(desc.prev))
-      {
-        thrust::raw_reference_cast(*desc.prev).next = desc.next;
-      }
-      else
-      {
-        m_oversized = desc.next;
-      }
+        evict_cached_oversized(m_options.max_cached_bytes - desc.size);
+        cache_oversized(block);
 
-      if (oversized_block_ptr_traits::get(desc.next))
-      {
-        thrust::raw_reference_cast(*desc.next).prev = desc.prev;
+        return;
       }
 
-      m_upstream->do_deallocate(p, desc.size + sizeof(oversized_block_descriptor), desc.alignment);
+      deallocate_oversized(block, desc);
 
       return;
     }
@@ -498,6 +612,8 @@ public:
 
     n = static_cast<std::size_t>(1) << n_log2;
 
+    m_statistics.deallocated(n);
+
     block_descriptor_ptr block = static_cast<block_descriptor_ptr>(static_cast<void_ptr>(static_cast<char_ptr>(p) + n));
 
     block_descriptor desc;
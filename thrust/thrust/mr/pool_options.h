@@ -23,6 +23,7 @@
 #include <cuda/__cmath/pow2.h>
 #include <cuda/__memory/is_valid_alignment.h>
 #include <cuda/std/cstddef>
+#include <cuda/std/limits>
 
 THRUST_NAMESPACE_BEGIN
 namespace mr
@@ -85,6 +86,18 @@ struct pool_options
    */
   std::size_t cached_alignment_cutoff_factor;
 
+  /*! The maximal total size of the oversized and overaligned blocks kept cached when \p cache_oversized is true. When
+   *      caching a deallocated block would exceed this limit, other cached blocks, starting with the largest
+   *      power-of-two size class, are returned to the upstream resource first; a block bigger than the limit itself is
+   *      never cached. Unlimited by default.
+   */
+  std::size_t max_cached_bytes = ::cuda::std::numeric_limits<std::size_t>::max();
+
+  /*! Decides whether the pool resource collects statistics about its use, reported by its \p statistics member
+   *      function. Disabled by default.
+   */
+  bool collect_statistics = false;
+
   /*! Checks if the options are self-consistent.
    *
    *  /returns true if the options are self-consistent, false otherwise.
@@ -0,0 +1,260 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file
+ *  \brief Statistics reported by memory resources, to help with tuning their options.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/mr/pool_options.h>
+
+#include <cuda/__cmath/ilog.h>
+#include <cuda/std/cstddef>
+
+#include <vector>
+
+THRUST_NAMESPACE_BEGIN
+namespace mr
+{
+/*! \addtogroup memory_resources Memory Resources
+ *  \ingroup memory_management
+ *  \{
+ */
+
+/*! The statistics of a single pool, i.e. of the blocks of one size, of a pooling resource adaptor.
+ */
+struct pool_bucket_statistics
+{
+  /*! The size of the blocks of this pool.
+   */
+  std::size_t block_size = 0;
+  /*! The number of allocations fulfilled with a free block of this pool.
+   */
+  std::size_t hits = 0;
+  /*! The number of allocations that found no free block in this pool, and required a new chunk from upstream.
+   */
+  std::size_t misses = 0;
+};
+
+/*! The statistics of a pooling resource adaptor, collected when \p pool_options::collect_statistics is true.
+ *
+ *  The counts are accumulated since construction, or since the last call to \p reset_statistics of the resource;
+ *      the byte totals describe the current state of the resource, and their peaks are reset to the current values.
+ */
+struct pool_statistics
+{
+  /*! The number of allocations from the upstream resource.
+   */
+  std::size_t upstream_allocations = 0;
+  /*! The number of deallocations to the upstream resource.
+   */
+  std::size_t upstream_deallocations = 0;
+
+  /*! The number of bytes currently allocated from the upstream resource, including the bookkeeping that the resource
+   *      keeps in upstream memory.
+   */
+  std::size_t bytes_held = 0;
+  /*! The highest value of \p bytes_held.
+   */
+  std::size_t peak_bytes_held = 0;
+  /*! The number of bytes currently handed out to the users of the resource. Pooled blocks count with their full size,
+   *      oversized blocks with their requested size.
+   */
+  std::size_t bytes_in_use = 0;
+  /*! The highest value of \p bytes_in_use.
+   */
+  std::size_t peak_bytes_in_use = 0;
+
+  /*! The number of oversized or overaligned allocations fulfilled with a cached block.
+   */
+  std::size_t oversized_hits = 0;
+  /*! The number of oversized or overaligned allocations that required a new block from upstream.
+   */
+  std::size_t oversized_misses = 0;
+
+  /*! The statistics of every pool, from the smallest block size to the largest one.
+   */
+  std::vector<pool_bucket_statistics> buckets;
+};
+
+/*! The statistics of a \p tracing_resource.
+ *
+ *  The histograms have an entry for every power of two: a request for \p n bytes, or aligned to \p n bytes, is counted
+ *      in the entry of the smallest power of two that is not less than \p n, i.e. entry \p i counts the requests for
+ *      sizes in (2^(i-1), 2^i].
+ */
+struct tracing_statistics
+{
+  /*! The number of allocations.
+   */
+  std::size_t allocations = 0;
+  /*! The number of deallocations.
+   */
+  std::size_t deallocations = 0;
+
+  /*! The number of bytes currently allocated.
+   */
+  std::size_t bytes_in_use = 0;
+  /*! The highest value of \p bytes_in_use.
+   */
+  std::size_t peak_bytes_in_use = 0;
+  /*! The number of blocks currently allocated.
+   */
+  std::size_t blocks_in_use = 0;
+  /*! The highest value of \p blocks_in_use.
+   */
+  std::size_t peak_blocks_in_use = 0;
+
+  /*! The number of allocations, by the binary logarithm of their size, rounded up.
+   */
+  std::vector<std::size_t> size_histogram;
+  /*! The number of allocations, by the binary logarithm of their alignment.
+   */
+  std::vector<std::size_t> alignment_histogram;
+};
+
+/*! \} // memory_resources
+ */
+} // namespace mr
+
+namespace detail
+{
+// the statistics kept by the unsynchronized pools; does nothing unless
+// enabled by the options of the pool
+class pool_statistics_recorder
+{
+public:
+  pool_statistics_recorder(const mr::pool_options& options)
+      : m_enabled(options.collect_statistics)
+  {
+    if (m_enabled)
+    {
+      const std::size_t smallest_block_log2 = ::cuda::ceil_ilog2(options.smallest_block_size);
+      const std::size_t largest_block_log2  = ::cuda::ceil_ilog2(options.largest_block_size);
+
+      for (std::size_t i = smallest_block_log2; i <= largest_block_log2; ++i)
+      {
+        mr::pool_bucket_statistics bucket;
+        bucket.block_size = static_cast<std::size_t>(1) << i;
+        m_statistics.buckets.push_back(bucket);
+      }
+    }
+  }
+
+  void upstream_allocated(std::size_t bytes)
+  {
+    if (m_enabled)
+    {
+      ++m_statistics.upstream_allocations;
+      m_statistics.bytes_held += bytes;
+      if (m_statistics.peak_bytes_held < m_statistics.bytes_held)
+      {
+        m_statistics.peak_bytes_held = m_statistics.bytes_held;
+      }
+    }
+  }
+
+  void upstream_deallocated(std::size_t bytes)
+  {
+    if (m_enabled)
+    {
+      ++m_statistics.upstream_deallocations;
+      m_statistics.bytes_held -= bytes;
+    }
+  }
+
+  void allocated(std::size_t bytes)
+  {
+    if (m_enabled)
+    {
+      m_statistics.bytes_in_use += bytes;
+      if (m_statistics.peak_bytes_in_use < m_statistics.bytes_in_use)
+      {
+        m_statistics.peak_bytes_in_use = m_statistics.bytes_in_use;
+      }
+    }
+  }
+
+  void deallocated(std::size_t bytes)
+  {
+    if (m_enabled)
+    {
+      m_statistics.bytes_in_use -= bytes;
+    }
+  }
+
+  void bucket_hit(std::size_t bucket_idx)
+  {
+    if (m_enabled)
+    {
+      ++m_statistics.buckets[bucket_idx].hits;
+    }
+  }
+
+  void bucket_miss(std::size_t bucket_idx)
+  {
+    if (m_enabled)
+    {
+      ++m_statistics.buckets[bucket_idx].misses;
+    }
+  }
+
+  void oversized_hit()
+  {
+    if (m_enabled)
+    {
+      ++m_statistics.oversized_hits;
+    }
+  }
+
+  void oversized_miss()
+  {
+    if (m_enabled)
+    {
+      ++m_statistics.oversized_misses;
+    }
+  }
+
+  // all blocks handed out are invalidated by releasing the resource
+  void released()
+  {
+    m_statistics.bytes_in_use = 0;
+  }
+
+  const mr::pool_statistics& get() const
+  {
+    return m_statistics;
+  }
+
+  void reset()
+  {
+    m_statistics.upstream_allocations   = 0;
+    m_statistics.upstream_deallocations = 0;
+    m_statistics.peak_bytes_held        = m_statistics.bytes_held;
+    m_statistics.peak_bytes_in_use      = m_statistics.bytes_in_use;
+    m_statistics.oversized_hits         = 0;
+    m_statistics.oversized_misses       = 0;
+
+    for (std::size_t i = 0; i < m_statistics.buckets.size(); ++i)
+    {
+      m_statistics.buckets[i].hits   = 0;
+      m_statistics.buckets[i].misses = 0;
+    }
+  }
+
+private:
+  bool m_enabled;
+  mr::pool_statistics m_statistics;
+};
+} // namespace detail
+THRUST_NAMESPACE_END
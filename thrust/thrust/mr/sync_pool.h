@@ -88,8 +88,24 @@ public:
     upstream_pool.do_deallocate(p, n, alignment);
   }
 
+  /*! Returns the statistics collected by the pool. Empty unless \p pool_options::collect_statistics is true.
+   */
+  pool_statistics statistics() const
+  {
+    lock_t lock(mtx);
+    return upstream_pool.statistics();
+  }
+
+  /*! Resets the counts of the collected statistics, and the peaks to the current values.
+   */
+  void reset_statistics()
+  {
+    lock_t lock(mtx);
+    upstream_pool.reset_statistics();
+  }
+
 private:
-  std::mutex mtx;
+  mutable std::mutex mtx;
   unsync_pool upstream_pool;
 };
 
@@ -0,0 +1,448 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file
+ *  \brief A pool resource for many threads, with per-thread caches of free blocks in front of a pool sharded by block
+ *      size.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/mr/pool.h>
+
+#include <cuda/__cmath/ilog.h>
+#include <cuda/__memory/is_valid_alignment.h>
+#include <cuda/std/__host_stdlib/algorithm>
+#include <cuda/std/cassert>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+THRUST_NAMESPACE_BEGIN
+namespace mr
+{
+/*! \addtogroup memory_resources Memory Resources
+ *  \ingroup memory_management
+ *  \{
+ */
+
+/*! A pool resource meant to be shared by many threads. Where \p synchronized_pool_resource serializes every
+ *      allocation on a single mutex, this resource gives each thread its own small cache of free blocks for every
+ *      pooled block size, and only takes a lock when such a cache needs to be refilled from, or flushed to, the
+ *      underlying pool. The underlying pool is sharded by block size: each size has its own mutex-protected
+ *      \p unsynchronized_pool_resource, and the blocks move between it and the thread caches in batches.
+ *
+ *  Since all blocks of a given size come from the same shard, a block may be deallocated on a different thread than
+ *      the one it was allocated on; it then simply ends up in the cache of the deallocating thread. The cache of a
+ *      thread is returned to the shards when that thread exits.
+ *
+ *  A batch is as many blocks of a given size as fit in \p pool_options::min_bytes_per_chunk, but at least one and
+ *      at most \p pool_options::min_blocks_per_chunk, and a thread caches at most two batches of every size.
+ *      Oversized and overaligned allocations bypass the thread caches and are served by one more mutex-protected
+ *      \p unsynchronized_pool_resource, which caches them according to the same options.
+ *
+ *  \p release must not be called concurrently with allocations or deallocations on other threads.
+ *
+ *  \tparam Upstream the type of memory resources that will be used for allocating memory
+ */
+template <typename Upstream>
+struct thread_cached_pool_resource : public memory_resource<typename Upstream::pointer>
+{
+  using unsync_pool = unsynchronized_pool_resource<Upstream>;
+  using lock_t      = std::lock_guard<std::mutex>;
+
+  using void_ptr = typename Upstream::pointer;
+
+public:
+  /*! Get the default options for a pool. These are meant to be a sensible set of values for many use cases,
+   *      and as such, may be tuned in the future. This function is exposed so that creating a set of options that are
+   *      just a slight departure from the defaults is easy.
+   */
+  static pool_options get_default_options()
+  {
+    return unsync_pool::get_default_options();
+  }
+
+  /*! Constructor.
+   *
+   *  \param upstream the upstream memory resource for allocations
+   *  \param options pool options to use
+   */
+  thread_cached_pool_resource(Upstream* upstream, pool_options options = get_default_options())
+      : m_options(options)
+      , m_smallest_block_log2(::cuda::ceil_ilog2(m_options.smallest_block_size))
+      , m_oversized(upstream, options)
+  {
+    assert(m_options.validate());
+
+    const std::size_t bucket_count = ::cuda::ceil_ilog2(m_options.largest_block_size) - m_smallest_block_log2 + 1;
+
+    std::size_t offset = 0;
+    for (std::size_t i = 0; i < bucket_count; ++i)
+    {
+      const std::size_t bytes_log2 = m_smallest_block_log2 + i;
+
+      std::size_t batch = m_options.min_bytes_per_chunk >> bytes_log2;
+      if (batch > m_options.min_blocks_per_chunk)
+      {
+        batch = m_options.min_blocks_per_chunk;
+      }
+      if (batch == 0)
+      {
+        batch = 1;
+      }
+
+      m_shards.push_back(std::make_unique<shard>(upstream, options));
+      m_batch_sizes.push_back(batch);
+      m_cache_offsets.push_back(offset);
+      offset += 2 * batch;
+    }
+
+    m_cache_size = offset;
+  }
+
+  /*! Constructor. The upstream resource is obtained by calling \p get_global_resource<Upstream>.
+   *
+   *  \param options pool options to use
+   */
+  thread_cached_pool_resource(pool_options options = get_default_options())
+      : thread_cached_pool_resource(get_global_resource<Upstream>(), options)
+  {}
+
+  /*! Destructor. Releases all held memory to upstream.
+   */
+  ~thread_cached_pool_resource()
+  {
+    // detach the caches of all threads, so that they neither use nor flush to
+    // this resource anymore; a thread that is exiting right now holds the lock
+    // of its cache until it is done flushing
+    std::vector<std::shared_ptr<thread_cache>> caches;
+    {
+      lock_t lock(m_caches_mutex);
+      caches.swap(m_caches);
+    }
+
+    for (std::size_t i = 0; i < caches.size(); ++i)
+    {
+      lock_t lock(caches[i]->mutex);
+      caches[i]->owner.store(nullptr);
+    }
+
+    release();
+  }
+
+  /*! Releases all held memory to upstream, including the blocks cached by all threads.
+   */
+  void release()
+  {
+    std::vector<std::shared_ptr<thread_cache>> caches;
+    {
+      lock_t lock(m_caches_mutex);
+      caches = m_caches;
+    }
+
+    for (std::size_t i = 0; i < caches.size(); ++i)
+    {
+      lock_t lock(caches[i]->mutex);
+      std::fill(caches[i]->counts.begin(), caches[i]->counts.end(), std::size_t(0));
+    }
+
+    for (std::size_t i = 0; i < m_shards.size(); ++i)
+    {
+      lock_t lock(m_shards[i]->mutex);
+      m_shards[i]->pool.release();
+    }
+
+    lock_t lock(m_oversized_mutex);
+    m_oversized.release();
+  }
+
+  /*! Returns the statistics collected by the shards and by the pool of oversized blocks, combined. Empty unless
+   *      \p pool_options::collect_statistics is true. The blocks in the caches of the threads count as in use, the hits
+   *      and misses of the pools count the blocks moved to the thread caches, and the peaks are the sums of the peaks of
+   *      the shards.
+   */
+  pool_statistics statistics() const
+  {
+    pool_statistics ret;
+    {
+      lock_t lock(m_oversized_mutex);
+      ret = m_oversized.statistics();
+    }
+
+    for (std::size_t i = 0; i < m_shards.size(); ++i)
+    {
+      lock_t lock(m_shards[i]->mutex);
+      const pool_statistics shard_statistics = m_shards[i]->pool.statistics();
+
+      ret.upstream_allocations += shard_statistics.upstream_allocations;
+      ret.upstream_deallocations += shard_statistics.upstream_deallocations;
+      ret.bytes_held += shard_statistics.bytes_held;
+      ret.peak_bytes_held += shard_statistics.peak_bytes_held;
+      ret.bytes_in_use += shard_statistics.bytes_in_use;
+      ret.peak_bytes_in_use += shard_statistics.peak_bytes_in_use;
+
+      // every shard only serves the blocks of its own size
+      if (!ret.buckets.empty())
+      {
+        ret.buckets[i].hits += shard_statistics.buckets[i].hits;
+        ret.buckets[i].misses += shard_statistics.buckets[i].misses;
+      }
+    }
+
+    return ret;
+  }
+
+  /*! Resets the counts of the collected statistics, and the peaks to the current values.
+   */
+  void reset_statistics()
+  {
+    for (std::size_t i = 0; i < m_shards.size(); ++i)
+    {
+      lock_t lock(m_shards[i]->mutex);
+      m_shards[i]->pool.reset_statistics();
+    }
+
+    lock_t lock(m_oversized_mutex);
+    m_oversized.reset_statistics();
+  }
+
+  [[nodiscard]] virtual void_ptr
+  do_allocate(std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+  {
+    bytes = (std::max) (bytes, m_options.smallest_block_size);
+    assert(::cuda::__is_valid_alignment(alignment));
+
+    // an oversized and/or overaligned allocation requested; needs to be allocated separately
+    if (bytes > m_options.largest_block_size || alignment > m_options.alignment)
+    {
+      lock_t lock(m_oversized_mutex);
+      return m_oversized.do_allocate(bytes, alignment);
+    }
+
+    std::size_t bucket_idx = ::cuda::ceil_ilog2(bytes) - m_smallest_block_log2;
+    thread_cache& cache    = local_cache();
+
+    if (cache.counts[bucket_idx] == 0)
+    {
+      refill(cache, bucket_idx);
+    }
+
+    return cache.blocks[m_cache_offsets[bucket_idx] + --cache.counts[bucket_idx]];
+  }
+
+  virtual void do_deallocate(void_ptr p, std::size_t n, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+  {
+    n = (std::max) (n, m_options.smallest_block_size);
+    assert(::cuda::__is_valid_alignment(alignment));
+
+    // the deallocated block is oversized and/or overaligned
+    if (n > m_options.largest_block_size || alignment > m_options.alignment)
+    {
+      lock_t lock(m_oversized_mutex);
+      m_oversized.do_deallocate(p, n, alignment);
+      return;
+    }
+
+    std::size_t bucket_idx = ::cuda::ceil_ilog2(n) - m_smallest_block_log2;
+    thread_cache& cache    = local_cache();
+
+    if (cache.counts[bucket_idx] == 2 * m_batch_sizes[bucket_idx])
+    {
+      flush(cache, bucket_idx, m_batch_sizes[bucket_idx]);
+    }
+
+    cache.blocks[m_cache_offsets[bucket_idx] + cache.counts[bucket_idx]++] = p;
+  }
+
+private:
+  // one size of blocks of the underlying pool
+  struct shard
+  {
+    shard(Upstream* upstream, const pool_options& options)
+        : pool(upstream, options)
+    {}
+
+    std::mutex mutex;
+    unsync_pool pool;
+  };
+
+  // the free blocks of one thread; the blocks of every size are kept in
+  // their own range of `blocks`, in the order in which they were freed
+  struct thread_cache
+  {
+    thread_cache(thread_cached_pool_resource* resource, std::size_t cache_size, std::size_t bucket_count)
+        : owner(resource)
+        , blocks(cache_size)
+        , counts(bucket_count)
+    {}
+
+    // serializes flushing the cache when its thread exits with releasing and
+    // destroying the resource; not taken when allocating and deallocating
+    std::mutex mutex;
+    std::atomic<thread_cached_pool_resource*> owner;
+    std::vector<void_ptr> blocks;
+    std::vector<std::size_t> counts;
+  };
+
+  // the caches of a thread for all the resources it has used; returns the
+  // cached blocks to their resources when the thread exits
+  struct thread_cache_table
+  {
+    ~thread_cache_table()
+    {
+      for (std::size_t i = 0; i < caches.size(); ++i)
+      {
+        thread_cache& cache = *caches[i];
+
+        lock_t lock(cache.mutex);
+        thread_cached_pool_resource* owner = cache.owner.load();
+        if (owner)
+        {
+          for (std::size_t bucket_idx = 0; bucket_idx < cache.counts.size(); ++bucket_idx)
+          {
+            owner->flush(cache, bucket_idx, cache.counts[bucket_idx]);
+          }
+
+          owner->unregister(caches[i]);
+          cache.owner.store(nullptr);
+        }
+      }
+    }
+
+    thread_cache* last = nullptr;
+    std::vector<std::shared_ptr<thread_cache>> caches;
+  };
+
+  pool_options m_options;
+  std::size_t m_smallest_block_log2;
+
+  // the shards of the pool, per block size, with the number of blocks moved
+  // between a shard and a thread cache at a time, and where the blocks of that
+  // size are kept in a thread cache
+  std::vector<std::unique_ptr<shard>> m_shards;
+  std::vector<std::size_t> m_batch_sizes;
+  std::vector<std::size_t> m_cache_offsets;
+  std::size_t m_cache_size;
+
+  mutable std::mutex m_oversized_mutex;
+  unsync_pool m_oversized;
+
+  // the caches of all threads that have used this resource
+  std::mutex m_caches_mutex;
+  std::vector<std::shared_ptr<thread_cache>> m_caches;
+
+  static thread_cache_table& local_cache_table()
+  {
+    static thread_local thread_cache_table table;
+    return table;
+  }
+
+  thread_cache& local_cache()
+  {
+    thread_cache_table& table = local_cache_table();
+
+    if (table.last && table.last->owner.load(std::memory_order_relaxed) == this)
+    {
+      return *table.last;
+    }
+
+    // drop the caches of resources destroyed since the last lookup
+    for (std::size_t i = 0; i < table.caches.size();)
+    {
+      if (!table.caches[i]->owner.load(std::memory_order_relaxed))
+      {
+        table.caches[i] = table.caches.back();
+        table.caches.pop_back();
+      }
+      else if (table.caches[i]->owner.load(std::memory_order_relaxed) == this)
+      {
+        table.last = table.caches[i].get();
+        return *table.last;
+      }
+      else
+      {
+        ++i;
+      }
+    }
+
+    std::shared_ptr<thread_cache> cache = std::make_shared<thread_cache>(this, m_cache_size, m_shards.size());
+    {
+      lock_t lock(m_caches_mutex);
+      m_caches.push_back(cache);
+    }
+
+    table.caches.push_back(cache);
+    table.last = cache.get();
+    return *table.last;
+  }
+
+  void unregister(const std::shared_ptr<thread_cache>& cache)
+  {
+    lock_t lock(m_caches_mutex);
+    auto it = std::find(m_caches.begin(), m_caches.end(), cache);
+    if (it != m_caches.end())
+    {
+      m_caches.erase(it);
+    }
+  }
+
+  // moves a batch of blocks from the shard to the cache, which is empty for this size
+  void refill(thread_cache& cache, std::size_t bucket_idx)
+  {
+    shard& s           = *m_shards[bucket_idx];
+    std::size_t bytes  = static_cast<std::size_t>(1) << (m_smallest_block_log2 + bucket_idx);
+    void_ptr* blocks   = cache.blocks.data() + m_cache_offsets[bucket_idx];
+    std::size_t& count = cache.counts[bucket_idx];
+    std::size_t batch  = m_batch_sizes[bucket_idx];
+
+    lock_t lock(s.mutex);
+    // count every block as soon as it is obtained, so that none are lost if
+    // the upstream resource throws before the batch is complete
+    for (; count < batch; ++count)
+    {
+      blocks[count] = s.pool.do_allocate(bytes, m_options.alignment);
+    }
+  }
+
+  // moves the `n` least recently freed blocks of a size from the cache to the shard
+  void flush(thread_cache& cache, std::size_t bucket_idx, std::size_t n)
+  {
+    if (n == 0)
+    {
+      return;
+    }
+
+    shard& s           = *m_shards[bucket_idx];
+    std::size_t bytes  = static_cast<std::size_t>(1) << (m_smallest_block_log2 + bucket_idx);
+    void_ptr* blocks   = cache.blocks.data() + m_cache_offsets[bucket_idx];
+    std::size_t& count = cache.counts[bucket_idx];
+
+    {
+      lock_t lock(s.mutex);
+      for (std::size_t i = 0; i < n; ++i)
+      {
+        s.pool.do_deallocate(blocks[i], bytes, m_options.alignment);
+      }
+    }
+
+    std::copy(blocks + n, blocks + count, blocks);
+    count -= n;
+  }
+};
+
+/*! \} // memory_resources
+ */
+} // namespace mr
+THRUST_NAMESPACE_END
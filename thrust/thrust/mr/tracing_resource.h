@@ -0,0 +1,171 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file
+ *  \brief A resource adaptor that records the allocations passing through it.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/mr/memory_resource.h>
+#include <thrust/mr/statistics.h>
+
+#include <cuda/__cmath/ilog.h>
+#include <cuda/std/__host_stdlib/algorithm>
+#include <cuda/std/limits>
+
+#include <atomic>
+
+THRUST_NAMESPACE_BEGIN
+namespace mr
+{
+/*! \addtogroup memory_resources Memory Resources
+ *  \ingroup memory_management
+ *  \{
+ */
+
+/*! A memory resource adaptor that forwards all requests to an upstream resource, and records histograms of the sizes
+ *      and alignments of the allocations, as well as the current and peak usage. Placed in front of a pooling resource
+ *      adaptor, it shows the requests that the pool has to serve; placed between a pool and its upstream resource, it
+ *      shows what the pool requests in turn. The recording is thread safe, so the adaptor is as safe to share between
+ *      threads as its upstream resource is.
+ *
+ *  \tparam Upstream the type of memory resources that will be used for allocating memory
+ */
+template <typename Upstream>
+class tracing_resource final : public memory_resource<typename Upstream::pointer>
+{
+  using void_ptr = typename Upstream::pointer;
+
+public:
+  /*! Constructor.
+   *
+   *  \param upstream the upstream memory resource for allocations
+   */
+  tracing_resource(Upstream* upstream)
+      : m_upstream(upstream)
+  {}
+
+  /*! Constructor. The upstream resource is obtained by calling \p get_global_resource<Upstream>.
+   */
+  tracing_resource()
+      : m_upstream(get_global_resource<Upstream>())
+  {}
+
+  [[nodiscard]] virtual void_ptr
+  do_allocate(std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+  {
+    void_ptr ret = m_upstream->do_allocate(bytes, alignment);
+
+    m_allocations.fetch_add(1, std::memory_order_relaxed);
+    m_size_histogram[::cuda::ceil_ilog2((std::max) (bytes, std::size_t(1)))].fetch_add(1, std::memory_order_relaxed);
+    m_alignment_histogram[::cuda::ceil_ilog2((std::max) (alignment, std::size_t(1)))].fetch_add(
+      1, std::memory_order_relaxed);
+
+    update_peak(m_peak_bytes_in_use, m_bytes_in_use.fetch_add(bytes, std::memory_order_relaxed) + bytes);
+    update_peak(m_peak_blocks_in_use, m_blocks_in_use.fetch_add(1, std::memory_order_relaxed) + 1);
+
+    return ret;
+  }
+
+  virtual void do_deallocate(void_ptr p, std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+  {
+    m_upstream->do_deallocate(p, bytes, alignment);
+
+    m_deallocations.fetch_add(1, std::memory_order_relaxed);
+    m_bytes_in_use.fetch_sub(bytes, std::memory_order_relaxed);
+    m_blocks_in_use.fetch_sub(1, std::memory_order_relaxed);
+  }
+
+  /*! Returns the recorded statistics. The histograms are trimmed after their last non-zero entry.
+   */
+  tracing_statistics statistics() const
+  {
+    tracing_statistics ret;
+
+    ret.allocations        = m_allocations.load(std::memory_order_relaxed);
+    ret.deallocations      = m_deallocations.load(std::memory_order_relaxed);
+    ret.bytes_in_use       = m_bytes_in_use.load(std::memory_order_relaxed);
+    ret.peak_bytes_in_use  = m_peak_bytes_in_use.load(std::memory_order_relaxed);
+    ret.blocks_in_use      = m_blocks_in_use.load(std::memory_order_relaxed);
+    ret.peak_blocks_in_use = m_peak_blocks_in_use.load(std::memory_order_relaxed);
+
+    for (std::size_t i = 0; i < histogram_size; ++i)
+    {
+      ret.size_histogram.push_back(m_size_histogram[i].load(std::memory_order_relaxed));
+      ret.alignment_histogram.push_back(m_alignment_histogram[i].load(std::memory_order_relaxed));
+    }
+
+    while (!ret.size_histogram.empty() && ret.size_histogram.back() == 0)
+    {
+      ret.size_histogram.pop_back();
+    }
+    while (!ret.alignment_histogram.empty() && ret.alignment_histogram.back() == 0)
+    {
+      ret.alignment_histogram.pop_back();
+    }
+
+    return ret;
+  }
+
+  /*! Resets the counts and the histograms, and the peaks to the current values.
+   */
+  void reset_statistics()
+  {
+    m_allocations.store(0, std::memory_order_relaxed);
+    m_deallocations.store(0, std::memory_order_relaxed);
+    m_peak_bytes_in_use.store(m_bytes_in_use.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    m_peak_blocks_in_use.store(m_blocks_in_use.load(std::memory_order_relaxed), std::memory_order_relaxed);
+
+    for (std::size_t i = 0; i < histogram_size; ++i)
+    {
+      m_size_histogram[i].store(0, std::memory_order_relaxed);
+      m_alignment_histogram[i].store(0, std::memory_order_relaxed);
+    }
+  }
+
+  /*! Returns the upstream resource of this adaptor.
+   */
+  Upstream* upstream_resource() const
+  {
+    return m_upstream;
+  }
+
+private:
+  // one entry for every power of two up to the one past the largest std::size_t
+  static constexpr std::size_t histogram_size = ::cuda::std::numeric_limits<std::size_t>::digits + 1;
+
+  static void update_peak(std::atomic<std::size_t>& peak, std::size_t value)
+  {
+    std::size_t current = peak.load(std::memory_order_relaxed);
+    while (current < value && !peak.compare_exchange_weak(current, value, std::memory_order_relaxed))
+    {
+    }
+  }
+
+  Upstream* m_upstream;
+
+  std::atomic<std::size_t> m_allocations{0};
+  std::atomic<std::size_t> m_deallocations{0};
+  std::atomic<std::size_t> m_bytes_in_use{0};
+  std::atomic<std::size_t> m_peak_bytes_in_use{0};
+  std::atomic<std::size_t> m_blocks_in_use{0};
+  std::atomic<std::size_t> m_peak_blocks_in_use{0};
+
+  std::atomic<std::size_t> m_size_histogram[histogram_size]      = {};
+  std::atomic<std::size_t> m_alignment_histogram[histogram_size] = {};
+};
+
+/*! \} // memory_resources
+ */
+} // namespace mr
+THRUST_NAMESPACE_END
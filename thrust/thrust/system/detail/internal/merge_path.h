@@ -0,0 +1,56 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/function.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::detail::internal
+{
+// Returns the number of elements taken from [first1, first1 + size1) among the
+// first `diagonal` elements of the stable merge of [first1, first1 + size1) and
+// [first2, first2 + size2). Elements of the first range precede equivalent
+// elements of the second range, which matches thrust::merge.
+template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename Size, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE Size merge_path(
+  RandomAccessIterator1 first1,
+  Size size1,
+  RandomAccessIterator2 first2,
+  Size size2,
+  Size diagonal,
+  StrictWeakOrdering comp)
+{
+  thrust::detail::wrapped_function<StrictWeakOrdering, bool> wrapped_comp{comp};
+
+  Size begin = diagonal > size2 ? diagonal - size2 : Size(0);
+  Size end   = diagonal < size1 ? diagonal : size1;
+
+  while (begin < end)
+  {
+    const Size mid = begin + (end - begin) / 2;
+
+    if (wrapped_comp(first2[diagonal - 1 - mid], first1[mid]))
+    {
+      end = mid;
+    }
+    else
+    {
+      begin = mid + 1;
+    }
+  }
+
+  return begin;
+}
+} // namespace system::detail::internal
+THRUST_NAMESPACE_END
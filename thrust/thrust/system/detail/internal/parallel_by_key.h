@@ -0,0 +1,553 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/execution_policy.h>
+#include <thrust/detail/function.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/decompose.h>
+#include <thrust/system/detail/sequential/reduce_by_key.h>
+#include <thrust/system/detail/sequential/scan_by_key.h>
+
+#include <cuda/std/__iterator/distance.h>
+#include <cuda/std/__utility/pair.h>
+#include <cuda/std/cstddef>
+
+// Segmented reductions and scans for the host backends. The input is divided
+// into tiles which are processed in a single pass each; the segments crossing
+// a tile boundary are fixed up through one carry per tile, which is combined
+// sequentially in between. The outputs are written once and never read back,
+// and no temporary storage proportional to the input is needed. See
+// parallel_radix_sort.h for the contract of `for_each_tile`.
+
+THRUST_NAMESPACE_BEGIN
+namespace system::detail::internal
+{
+// segmented reductions and scans smaller than this are not worth a tile of their own
+inline constexpr size_t by_key_tile_granularity = 1 << 12;
+
+namespace parallel_by_key_detail
+{
+// whether element i belongs to the segment of element i - 1
+template <typename InputIterator, typename BinaryPredicate>
+struct continues_segment
+{
+  InputIterator keys;
+  thrust::detail::wrapped_function<BinaryPredicate, bool> binary_pred;
+
+  bool operator()(size_t i) const
+  {
+    return i != 0 && binary_pred(keys[i - 1], keys[i]);
+  }
+};
+
+template <typename Continues>
+struct count_segments_body
+{
+  uniform_decomposition<size_t> decomp;
+  size_t* counts;
+  Continues continues;
+
+  void operator()(size_t tile) const
+  {
+    const size_t end = decomp[tile].end();
+    size_t count     = 0;
+
+    for (size_t i = decomp[tile].begin(); i < end; ++i)
+    {
+      if (!continues(i))
+      {
+        ++count;
+      }
+    }
+
+    counts[tile] = count;
+  }
+};
+
+// the partial reductions of the segments crossing the boundaries of a tile
+template <typename ValueType>
+struct reduce_carry
+{
+  // the reduction of the leading elements of the tile that continue a segment of an earlier tile
+  ValueType head;
+
+  // the reduction of the last segment starting in the tile, if it continues into the next tile
+  ValueType tail;
+};
+
+template <typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename Continues,
+          typename BinaryFunction,
+          typename ValueType>
+struct reduce_by_key_body
+{
+  InputIterator1 keys_first;
+  InputIterator2 values_first;
+  OutputIterator1 keys_output;
+  OutputIterator2 values_output;
+  uniform_decomposition<size_t> decomp;
+  const size_t* offsets;
+  reduce_carry<ValueType>* carries;
+  Continues continues;
+  thrust::detail::wrapped_function<BinaryFunction, ValueType> binary_op;
+
+  void operator()(size_t tile) const
+  {
+    const size_t end = decomp[tile].end();
+    size_t i         = decomp[tile].begin();
+
+    // the part of a segment which started in an earlier tile is reduced into the head of this tile
+    if (continues(i))
+    {
+      ValueType head = values_first[i];
+
+      for (++i; i < end && continues(i); ++i)
+      {
+        head = binary_op(head, values_first[i]);
+      }
+
+      carries[tile].head = head;
+    }
+
+    // the value of a segment continuing into the next tile is only written once the carries are combined
+    const bool continued_in_next_tile = tile + 1 < decomp.size() && continues(end);
+
+    for (size_t out = offsets[tile]; i < end; ++out)
+    {
+      keys_output[out] = keys_first[i];
+
+      ValueType sum = values_first[i];
+
+      for (++i; i < end && continues(i); ++i)
+      {
+        sum = binary_op(sum, values_first[i]);
+      }
+
+      if (i == end && continued_in_next_tile)
+      {
+        carries[tile].tail = sum;
+      }
+      else
+      {
+        values_output[out] = sum;
+      }
+    }
+  }
+};
+
+// the reduction of the last segment of a tile, or of the part of it within the tile
+template <typename ValueType>
+struct scan_carry
+{
+  ValueType value;
+
+  // whether the last segment of the tile starts within the tile
+  bool starts_segment;
+
+  // whether the first element of the tile continues a segment of an earlier tile, recorded before an in-place scan
+  // can overwrite the keys
+  bool continues_segment;
+};
+
+template <typename InputIterator, typename Continues, typename BinaryFunction, typename ValueType>
+struct scan_carry_body
+{
+  InputIterator values_first;
+  uniform_decomposition<size_t> decomp;
+  scan_carry<ValueType>* carries;
+  Continues continues;
+  thrust::detail::wrapped_function<BinaryFunction, ValueType> binary_op;
+
+  void operator()(size_t tile) const
+  {
+    const size_t begin = decomp[tile].begin();
+    const size_t end   = decomp[tile].end();
+
+    // only the last segment of the tile is carried into the next tile
+    size_t first = end - 1;
+    while (first > begin && continues(first))
+    {
+      --first;
+    }
+
+    ValueType sum = values_first[first];
+
+    for (size_t i = first + 1; i < end; ++i)
+    {
+      sum = binary_op(sum, values_first[i]);
+    }
+
+    carries[tile] = scan_carry<ValueType>{sum, !continues(first), continues(begin)};
+  }
+};
+
+template <typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename BinaryPredicate,
+          typename BinaryFunction,
+          typename ValueType>
+struct inclusive_scan_by_key_body
+{
+  InputIterator1 keys_first;
+  InputIterator2 values_first;
+  OutputIterator result;
+  uniform_decomposition<size_t> decomp;
+  const scan_carry<ValueType>* carries;
+  thrust::detail::wrapped_function<BinaryPredicate, bool> binary_pred;
+  thrust::detail::wrapped_function<BinaryFunction, ValueType> binary_op;
+
+  void operator()(size_t tile) const
+  {
+    using key_type = thrust::detail::it_value_t<InputIterator1>;
+
+    // the first element of the input always starts a segment, so the first tile has no use for a carry
+    const size_t begin = decomp[tile].begin();
+    const size_t end   = decomp[tile].end();
+    ValueType sum      = carries[tile].value;
+    key_type prev_key  = keys_first[begin];
+
+    for (size_t i = begin; i < end; ++i)
+    {
+      // read before writing to permit in-place scans of the keys or the values
+      key_type key    = keys_first[i];
+      ValueType value = values_first[i];
+
+      const bool continues = i == begin ? carries[tile].continues_segment : binary_pred(prev_key, key);
+
+      sum       = continues ? binary_op(sum, value) : value;
+      result[i] = sum;
+      prev_key  = key;
+    }
+  }
+};
+
+template <typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename BinaryPredicate,
+          typename BinaryFunction,
+          typename ValueType>
+struct exclusive_scan_by_key_body
+{
+  InputIterator1 keys_first;
+  InputIterator2 values_first;
+  OutputIterator result;
+  uniform_decomposition<size_t> decomp;
+  const scan_carry<ValueType>* carries;
+  ValueType init;
+  thrust::detail::wrapped_function<BinaryPredicate, bool> binary_pred;
+  thrust::detail::wrapped_function<BinaryFunction, ValueType> binary_op;
+
+  void operator()(size_t tile) const
+  {
+    using key_type = thrust::detail::it_value_t<InputIterator1>;
+
+    const size_t begin = decomp[tile].begin();
+    const size_t end   = decomp[tile].end();
+    ValueType next     = carries[tile].value;
+    key_type prev_key  = keys_first[begin];
+
+    for (size_t i = begin; i < end; ++i)
+    {
+      // read before writing to permit in-place scans of the keys or the values
+      key_type key    = keys_first[i];
+      ValueType value = values_first[i];
+
+      if (!(i == begin ? carries[tile].continues_segment : binary_pred(prev_key, key)))
+      {
+        next = init;
+      }
+
+      result[i] = next;
+      next      = binary_op(next, value);
+      prev_key  = key;
+    }
+  }
+};
+
+// replaces the carry of every tile with the value the scan carries into the tile;
+// `start_segment` turns the reduction of a segment starting within a tile into
+// the value the scan carries out of the tile
+template <typename ValueType, typename BinaryFunction, typename StartSegment>
+void combine_scan_carries(
+  scan_carry<ValueType>* carries, size_t num_tiles, BinaryFunction binary_op, StartSegment start_segment)
+{
+  // the first tile always starts a segment
+  ValueType carry_out = start_segment(carries[0].value);
+
+  for (size_t tile = 1; tile < num_tiles; ++tile)
+  {
+    ValueType next_carry_out =
+      carries[tile].starts_segment ? start_segment(carries[tile].value) : binary_op(carry_out, carries[tile].value);
+
+    carries[tile].value = carry_out;
+    carry_out           = next_carry_out;
+  }
+}
+
+template <typename ValueType>
+struct inclusive_start_segment
+{
+  ValueType operator()(const ValueType& sum) const
+  {
+    return sum;
+  }
+};
+
+template <typename ValueType, typename BinaryFunction>
+struct exclusive_start_segment
+{
+  ValueType init;
+  thrust::detail::wrapped_function<BinaryFunction, ValueType> binary_op;
+
+  ValueType operator()(const ValueType& sum) const
+  {
+    return binary_op(init, sum);
+  }
+};
+} // namespace parallel_by_key_detail
+
+template <typename DerivedPolicy,
+          typename ForEachTile,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename BinaryPredicate,
+          typename BinaryFunction>
+::cuda::std::pair<OutputIterator1, OutputIterator2> parallel_reduce_by_key(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  ForEachTile for_each_tile,
+  size_t max_tiles,
+  InputIterator1 keys_first,
+  InputIterator1 keys_last,
+  InputIterator2 values_first,
+  OutputIterator1 keys_output,
+  OutputIterator2 values_output,
+  BinaryPredicate binary_pred,
+  BinaryFunction binary_op)
+{
+  using namespace parallel_by_key_detail;
+
+  // Use the input iterator's value type per https://wg21.link/P0571
+  using value_type = thrust::detail::it_value_t<InputIterator2>;
+  using continues  = continues_segment<InputIterator1, BinaryPredicate>;
+
+  const uniform_decomposition<size_t> decomp(
+    ::cuda::std::distance(keys_first, keys_last), by_key_tile_granularity, max_tiles);
+
+  if (decomp.size() <= 1)
+  {
+    return thrust::system::detail::sequential::reduce_by_key(
+      thrust::detail::derived_cast(exec),
+      keys_first,
+      keys_last,
+      values_first,
+      keys_output,
+      values_output,
+      binary_pred,
+      binary_op);
+  }
+
+  const continues continues_fn{keys_first, {binary_pred}};
+
+  // count the segments starting in every tile and turn the counts into output offsets
+  thrust::detail::temporary_array<size_t, DerivedPolicy> offsets(exec, decomp.size());
+  size_t* offsets_ptr = thrust::raw_pointer_cast(offsets.data());
+
+  for_each_tile(decomp.size(), count_segments_body<continues>{decomp, offsets_ptr, continues_fn});
+
+  size_t num_segments = 0;
+
+  for (size_t tile = 0; tile < decomp.size(); ++tile)
+  {
+    const size_t count = offsets_ptr[tile];
+
+    offsets_ptr[tile] = num_segments;
+
+    num_segments += count;
+  }
+
+  thrust::detail::temporary_array<reduce_carry<value_type>, DerivedPolicy> carries(exec, decomp.size());
+  reduce_carry<value_type>* carries_ptr = thrust::raw_pointer_cast(carries.data());
+
+  using reduce_body = reduce_by_key_body<InputIterator1,
+                                         InputIterator2,
+                                         OutputIterator1,
+                                         OutputIterator2,
+                                         continues,
+                                         BinaryFunction,
+                                         value_type>;
+
+  for_each_tile(decomp.size(),
+                reduce_body{keys_first,
+                            values_first,
+                            keys_output,
+                            values_output,
+                            decomp,
+                            offsets_ptr,
+                            carries_ptr,
+                            continues_fn,
+                            {binary_op}});
+
+  // complete the segments crossing tile boundaries in order and write each of them once; the first tile never has a
+  // head. The tail of a tile without a segment start becomes the segment still open at its end
+  thrust::detail::wrapped_function<BinaryFunction, value_type> wrapped_binary_op{binary_op};
+
+  for (size_t tile = 1; tile < decomp.size(); ++tile)
+  {
+    if (continues_fn(decomp[tile].begin()))
+    {
+      const value_type sum        = wrapped_binary_op(carries_ptr[tile - 1].tail, carries_ptr[tile].head);
+      const size_t next_offset    = tile + 1 < decomp.size() ? offsets_ptr[tile + 1] : num_segments;
+      const bool starts_segment   = next_offset != offsets_ptr[tile];
+      const bool continues_beyond = tile + 1 < decomp.size() && continues_fn(decomp[tile].end());
+
+      if (!starts_segment && continues_beyond)
+      {
+        carries_ptr[tile].tail = sum;
+      }
+      else
+      {
+        values_output[offsets_ptr[tile] - 1] = sum;
+      }
+    }
+  }
+
+  return ::cuda::std::make_pair(keys_output + num_segments, values_output + num_segments);
+}
+
+template <typename DerivedPolicy,
+          typename ForEachTile,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename BinaryPredicate,
+          typename BinaryFunction>
+OutputIterator parallel_inclusive_scan_by_key(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  ForEachTile for_each_tile,
+  size_t max_tiles,
+  InputIterator1 keys_first,
+  InputIterator1 keys_last,
+  InputIterator2 values_first,
+  OutputIterator result,
+  BinaryPredicate binary_pred,
+  BinaryFunction binary_op)
+{
+  using namespace parallel_by_key_detail;
+
+  using value_type = thrust::detail::it_value_t<InputIterator2>;
+  using continues  = continues_segment<InputIterator1, BinaryPredicate>;
+
+  const size_t n = ::cuda::std::distance(keys_first, keys_last);
+  const uniform_decomposition<size_t> decomp(n, by_key_tile_granularity, max_tiles);
+
+  if (decomp.size() <= 1)
+  {
+    return thrust::system::detail::sequential::inclusive_scan_by_key(
+      thrust::detail::derived_cast(exec), keys_first, keys_last, values_first, result, binary_pred, binary_op);
+  }
+
+  const continues continues_fn{keys_first, {binary_pred}};
+
+  thrust::detail::temporary_array<scan_carry<value_type>, DerivedPolicy> carries(exec, decomp.size());
+  scan_carry<value_type>* carries_ptr = thrust::raw_pointer_cast(carries.data());
+
+  for_each_tile(decomp.size(),
+                scan_carry_body<InputIterator2, continues, BinaryFunction, value_type>{
+                  values_first, decomp, carries_ptr, continues_fn, {binary_op}});
+
+  combine_scan_carries(carries_ptr,
+                       decomp.size(),
+                       thrust::detail::wrapped_function<BinaryFunction, value_type>{binary_op},
+                       inclusive_start_segment<value_type>{});
+
+  using scan_body = inclusive_scan_by_key_body<InputIterator1,
+                                               InputIterator2,
+                                               OutputIterator,
+                                               BinaryPredicate,
+                                               BinaryFunction,
+                                               value_type>;
+
+  for_each_tile(decomp.size(),
+                scan_body{keys_first, values_first, result, decomp, carries_ptr, {binary_pred}, {binary_op}});
+
+  return result + n;
+}
+
+template <typename DerivedPolicy,
+          typename ForEachTile,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename T,
+          typename BinaryPredicate,
+          typename BinaryFunction>
+OutputIterator parallel_exclusive_scan_by_key(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  ForEachTile for_each_tile,
+  size_t max_tiles,
+  InputIterator1 keys_first,
+  InputIterator1 keys_last,
+  InputIterator2 values_first,
+  OutputIterator result,
+  T init,
+  BinaryPredicate binary_pred,
+  BinaryFunction binary_op)
+{
+  using namespace parallel_by_key_detail;
+
+  using continues = continues_segment<InputIterator1, BinaryPredicate>;
+
+  const size_t n = ::cuda::std::distance(keys_first, keys_last);
+  const uniform_decomposition<size_t> decomp(n, by_key_tile_granularity, max_tiles);
+
+  if (decomp.size() <= 1)
+  {
+    return thrust::system::detail::sequential::exclusive_scan_by_key(
+      thrust::detail::derived_cast(exec), keys_first, keys_last, values_first, result, init, binary_pred, binary_op);
+  }
+
+  const continues continues_fn{keys_first, {binary_pred}};
+
+  thrust::detail::temporary_array<scan_carry<T>, DerivedPolicy> carries(exec, decomp.size());
+  scan_carry<T>* carries_ptr = thrust::raw_pointer_cast(carries.data());
+
+  for_each_tile(decomp.size(),
+                scan_carry_body<InputIterator2, continues, BinaryFunction, T>{
+                  values_first, decomp, carries_ptr, continues_fn, {binary_op}});
+
+  combine_scan_carries(carries_ptr,
+                       decomp.size(),
+                       thrust::detail::wrapped_function<BinaryFunction, T>{binary_op},
+                       exclusive_start_segment<T, BinaryFunction>{init, {binary_op}});
+
+  using scan_body =
+    exclusive_scan_by_key_body<InputIterator1, InputIterator2, OutputIterator, BinaryPredicate, BinaryFunction, T>;
+
+  for_each_tile(decomp.size(),
+                scan_body{keys_first, values_first, result, decomp, carries_ptr, init, {binary_pred}, {binary_op}});
+
+  return result + n;
+}
+} // namespace system::detail::internal
+THRUST_NAMESPACE_END
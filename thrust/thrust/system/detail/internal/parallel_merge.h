@@ -0,0 +1,211 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/seq.h>
+#include <thrust/merge.h>
+#include <thrust/system/detail/internal/decompose.h>
+#include <thrust/system/detail/internal/merge_path.h>
+
+#include <cuda/std/__iterator/distance.h>
+#include <cuda/std/__utility/pair.h>
+#include <cuda/std/cstddef>
+
+// Parallel merge for the host backends. The merged output is divided into
+// equally sized tiles, and the inputs consumed by each tile are located with a
+// merge path search, so every tile merges its part sequentially and
+// independently of the others. See parallel_radix_sort.h for the contract of
+// `for_each_tile`.
+
+THRUST_NAMESPACE_BEGIN
+namespace system::detail::internal
+{
+// merges smaller than this are not worth a tile of their own
+inline constexpr size_t merge_tile_granularity = 1 << 12;
+
+namespace parallel_merge_detail
+{
+template <typename InputIterator1, typename InputIterator2, typename OutputIterator, typename StrictWeakOrdering>
+struct merge_body
+{
+  InputIterator1 first1;
+  size_t n1;
+  InputIterator2 first2;
+  size_t n2;
+  OutputIterator result;
+  uniform_decomposition<size_t> decomp;
+  StrictWeakOrdering comp;
+
+  void operator()(size_t tile) const
+  {
+    const size_t diagonal_begin = decomp[tile].begin();
+    const size_t diagonal_end   = decomp[tile].end();
+
+    const size_t i_begin = merge_path(first1, n1, first2, n2, diagonal_begin, comp);
+    const size_t i_end   = merge_path(first1, n1, first2, n2, diagonal_end, comp);
+
+    thrust::merge(thrust::seq,
+                  first1 + i_begin,
+                  first1 + i_end,
+                  first2 + (diagonal_begin - i_begin),
+                  first2 + (diagonal_end - i_end),
+                  result + diagonal_begin,
+                  comp);
+  }
+};
+
+template <typename InputIterator1,
+          typename InputIterator2,
+          typename InputIterator3,
+          typename InputIterator4,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename StrictWeakOrdering>
+struct merge_by_key_body
+{
+  InputIterator1 keys_first1;
+  size_t n1;
+  InputIterator2 keys_first2;
+  size_t n2;
+  InputIterator3 values_first1;
+  InputIterator4 values_first2;
+  OutputIterator1 keys_result;
+  OutputIterator2 values_result;
+  uniform_decomposition<size_t> decomp;
+  StrictWeakOrdering comp;
+
+  void operator()(size_t tile) const
+  {
+    const size_t diagonal_begin = decomp[tile].begin();
+    const size_t diagonal_end   = decomp[tile].end();
+
+    const size_t i_begin = merge_path(keys_first1, n1, keys_first2, n2, diagonal_begin, comp);
+    const size_t i_end   = merge_path(keys_first1, n1, keys_first2, n2, diagonal_end, comp);
+
+    const size_t j_begin = diagonal_begin - i_begin;
+    const size_t j_end   = diagonal_end - i_end;
+
+    thrust::merge_by_key(
+      thrust::seq,
+      keys_first1 + i_begin,
+      keys_first1 + i_end,
+      keys_first2 + j_begin,
+      keys_first2 + j_end,
+      values_first1 + i_begin,
+      values_first2 + j_begin,
+      keys_result + diagonal_begin,
+      values_result + diagonal_begin,
+      comp);
+  }
+};
+} // namespace parallel_merge_detail
+
+template <typename ForEachTile,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator parallel_merge(
+  ForEachTile for_each_tile,
+  size_t max_tiles,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  InputIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp)
+{
+  const size_t n1 = ::cuda::std::distance(first1, last1);
+  const size_t n2 = ::cuda::std::distance(first2, last2);
+
+  const uniform_decomposition<size_t> decomp(n1 + n2, merge_tile_granularity, max_tiles);
+
+  if (decomp.size() <= 1)
+  {
+    return thrust::merge(thrust::seq, first1, last1, first2, last2, result, comp);
+  }
+
+  for_each_tile(
+    decomp.size(),
+    parallel_merge_detail::merge_body<InputIterator1, InputIterator2, OutputIterator, StrictWeakOrdering>{
+      first1, n1, first2, n2, result, decomp, comp});
+
+  return result + (n1 + n2);
+}
+
+template <typename ForEachTile,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename InputIterator3,
+          typename InputIterator4,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename StrictWeakOrdering>
+::cuda::std::pair<OutputIterator1, OutputIterator2> parallel_merge_by_key(
+  ForEachTile for_each_tile,
+  size_t max_tiles,
+  InputIterator1 keys_first1,
+  InputIterator1 keys_last1,
+  InputIterator2 keys_first2,
+  InputIterator2 keys_last2,
+  InputIterator3 values_first1,
+  InputIterator4 values_first2,
+  OutputIterator1 keys_result,
+  OutputIterator2 values_result,
+  StrictWeakOrdering comp)
+{
+  const size_t n1 = ::cuda::std::distance(keys_first1, keys_last1);
+  const size_t n2 = ::cuda::std::distance(keys_first2, keys_last2);
+
+  const uniform_decomposition<size_t> decomp(n1 + n2, merge_tile_granularity, max_tiles);
+
+  if (decomp.size() <= 1)
+  {
+    return thrust::merge_by_key(
+      thrust::seq,
+      keys_first1,
+      keys_last1,
+      keys_first2,
+      keys_last2,
+      values_first1,
+      values_first2,
+      keys_result,
+      values_result,
+      comp);
+  }
+
+  for_each_tile(decomp.size(),
+                parallel_merge_detail::merge_by_key_body<
+                  InputIterator1,
+                  InputIterator2,
+                  InputIterator3,
+                  InputIterator4,
+                  OutputIterator1,
+                  OutputIterator2,
+                  StrictWeakOrdering>{
+                  keys_first1,
+                  n1,
+                  keys_first2,
+                  n2,
+                  values_first1,
+                  values_first2,
+                  keys_result,
+                  values_result,
+                  decomp,
+                  comp});
+
+  return ::cuda::std::make_pair(keys_result + (n1 + n2), values_result + (n1 + n2));
+}
+} // namespace system::detail::internal
+THRUST_NAMESPACE_END
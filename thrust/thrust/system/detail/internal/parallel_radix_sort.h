@@ -0,0 +1,330 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/copy.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/seq.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/decompose.h>
+#include <thrust/system/detail/sequential/sort.h>
+#include <thrust/system/detail/sequential/stable_radix_sort.h>
+
+#include <cuda/std/__type_traits/is_same.h>
+#include <cuda/std/__utility/declval.h>
+#include <cuda/std/cstddef>
+
+// This is a least significant digit radix sort for the host backends. Every
+// pass counts the digits of each tile in parallel, scans the per-tile counts
+// digit-major so that equal digits keep the order of their tiles, and then
+// scatters each tile in parallel. The backends provide a `for_each_tile`
+// function object such that `for_each_tile(num_tiles, body)` calls `body(tile)`
+// for every tile in [0, num_tiles), in parallel, and returns once all calls
+// have completed.
+
+THRUST_NAMESPACE_BEGIN
+namespace system::detail::internal
+{
+// bool keys are better served by the comparison sort
+template <typename KeyType, typename Compare>
+inline constexpr bool use_parallel_radix_sort =
+  thrust::system::detail::sequential::sort_detail::use_primitive_sort<KeyType, Compare>
+  && !::cuda::std::is_same_v<KeyType, bool>;
+
+namespace parallel_radix_sort_detail
+{
+inline constexpr unsigned int radix_bits = 8;
+inline constexpr size_t num_buckets      = size_t{1} << radix_bits;
+
+// maps a key to its digit for a given pass; descending sorts invert the encoded
+// key so that equal keys keep their relative order
+template <typename KeyType, bool Descending>
+struct digit_extractor
+{
+  using encoder_type = thrust::system::detail::sequential::radix_sort_detail::RadixEncoder<KeyType>;
+  using encoded_type = decltype(::cuda::std::declval<encoder_type>()(::cuda::std::declval<KeyType>()));
+
+  static constexpr unsigned int num_passes = (8 * sizeof(encoded_type) + (radix_bits - 1)) / radix_bits;
+
+  size_t operator()(KeyType key, unsigned int pass) const
+  {
+    encoded_type x = encoder_type{}(key);
+
+    if constexpr (Descending)
+    {
+      x = static_cast<encoded_type>(~x);
+    }
+
+    return static_cast<size_t>((x >> (radix_bits * pass)) & (num_buckets - 1));
+  }
+};
+
+template <typename KeyIterator, typename DigitExtractor>
+struct histogram_body
+{
+  using key_type = thrust::detail::it_value_t<KeyIterator>;
+
+  KeyIterator keys;
+  uniform_decomposition<size_t> decomp;
+  size_t* histograms;
+  DigitExtractor digit;
+  unsigned int pass;
+
+  void operator()(size_t tile) const
+  {
+    size_t* histogram = histograms + tile * num_buckets;
+
+    for (size_t bucket = 0; bucket < num_buckets; ++bucket)
+    {
+      histogram[bucket] = 0;
+    }
+
+    for (size_t i = decomp[tile].begin(); i < decomp[tile].end(); ++i)
+    {
+      const key_type key = keys[i];
+      ++histogram[digit(key, pass)];
+    }
+  }
+};
+
+template <bool HasValues,
+          typename KeyIterator1,
+          typename ValueIterator1,
+          typename KeyIterator2,
+          typename ValueIterator2,
+          typename DigitExtractor>
+struct scatter_body
+{
+  using key_type = thrust::detail::it_value_t<KeyIterator1>;
+
+  KeyIterator1 keys_in;
+  ValueIterator1 values_in;
+  KeyIterator2 keys_out;
+  ValueIterator2 values_out;
+  uniform_decomposition<size_t> decomp;
+  size_t* offsets;
+  DigitExtractor digit;
+  unsigned int pass;
+
+  void operator()(size_t tile) const
+  {
+    size_t* tile_offsets = offsets + tile * num_buckets;
+
+    for (size_t i = decomp[tile].begin(); i < decomp[tile].end(); ++i)
+    {
+      const key_type key    = keys_in[i];
+      const size_t position = tile_offsets[digit(key, pass)]++;
+
+      keys_out[position] = key;
+
+      if constexpr (HasValues)
+      {
+        values_out[position] = values_in[i];
+      }
+    }
+  }
+};
+
+template <bool HasValues,
+          typename KeyIterator1,
+          typename ValueIterator1,
+          typename KeyIterator2,
+          typename ValueIterator2>
+struct copy_body
+{
+  KeyIterator1 keys_in;
+  ValueIterator1 values_in;
+  KeyIterator2 keys_out;
+  ValueIterator2 values_out;
+  uniform_decomposition<size_t> decomp;
+
+  void operator()(size_t tile) const
+  {
+    const size_t first = decomp[tile].begin();
+    const size_t last  = decomp[tile].end();
+
+    thrust::copy(thrust::seq, keys_in + first, keys_in + last, keys_out + first);
+
+    if constexpr (HasValues)
+    {
+      thrust::copy(thrust::seq, values_in + first, values_in + last, values_out + first);
+    }
+  }
+};
+
+// turns per-tile digit counts into per-tile scatter offsets; returns false if
+// all keys share the same digit, in which case the pass can be skipped
+inline bool scan_histograms(size_t* histograms, size_t num_tiles, size_t n)
+{
+  size_t sum = 0;
+
+  for (size_t bucket = 0; bucket < num_buckets; ++bucket)
+  {
+    const size_t bucket_begin = sum;
+
+    for (size_t tile = 0; tile < num_tiles; ++tile)
+    {
+      const size_t count = histograms[tile * num_buckets + bucket];
+
+      histograms[tile * num_buckets + bucket] = sum;
+
+      sum += count;
+    }
+
+    if (sum - bucket_begin == n)
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+template <bool HasValues,
+          typename ForEachTile,
+          typename KeyIterator1,
+          typename ValueIterator1,
+          typename KeyIterator2,
+          typename ValueIterator2,
+          typename DigitExtractor>
+bool radix_pass(
+  ForEachTile for_each_tile,
+  const uniform_decomposition<size_t>& decomp,
+  size_t* histograms,
+  DigitExtractor digit,
+  unsigned int pass,
+  KeyIterator1 keys_in,
+  ValueIterator1 values_in,
+  KeyIterator2 keys_out,
+  ValueIterator2 values_out,
+  size_t n)
+{
+  for_each_tile(decomp.size(), histogram_body<KeyIterator1, DigitExtractor>{keys_in, decomp, histograms, digit, pass});
+
+  if (!scan_histograms(histograms, decomp.size(), n))
+  {
+    return false;
+  }
+
+  for_each_tile(
+    decomp.size(),
+    scatter_body<HasValues, KeyIterator1, ValueIterator1, KeyIterator2, ValueIterator2, DigitExtractor>{
+      keys_in, values_in, keys_out, values_out, decomp, histograms, digit, pass});
+
+  return true;
+}
+
+template <bool Descending,
+          bool HasValues,
+          typename DerivedPolicy,
+          typename ForEachTile,
+          typename KeyIterator1,
+          typename KeyIterator2,
+          typename ValueIterator1,
+          typename ValueIterator2>
+void radix_sort(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  ForEachTile for_each_tile,
+  size_t num_tiles,
+  KeyIterator1 keys1,
+  KeyIterator2 keys2,
+  ValueIterator1 values1,
+  ValueIterator2 values2,
+  size_t n)
+{
+  using key_type       = thrust::detail::it_value_t<KeyIterator1>;
+  using extractor_type = digit_extractor<key_type, Descending>;
+
+  const uniform_decomposition<size_t> decomp(n, 1, num_tiles);
+
+  thrust::detail::temporary_array<size_t, DerivedPolicy> histograms(exec, decomp.size() * num_buckets);
+  size_t* histograms_ptr = thrust::raw_pointer_cast(histograms.data());
+
+  // false if the most recent data is stored in (keys1, values1)
+  bool flip = false;
+
+  for (unsigned int pass = 0; pass < extractor_type::num_passes; ++pass)
+  {
+    const bool shuffled =
+      flip
+        ? radix_pass<HasValues>(
+            for_each_tile, decomp, histograms_ptr, extractor_type{}, pass, keys2, values2, keys1, values1, n)
+        : radix_pass<HasValues>(
+            for_each_tile, decomp, histograms_ptr, extractor_type{}, pass, keys1, values1, keys2, values2, n);
+
+    if (shuffled)
+    {
+      flip = !flip;
+    }
+  }
+
+  // ensure final values are in (keys1, values1)
+  if (flip)
+  {
+    for_each_tile(decomp.size(),
+                  copy_body<HasValues, KeyIterator2, ValueIterator2, KeyIterator1, ValueIterator1>{
+                    keys2, values2, keys1, values1, decomp});
+  }
+}
+} // namespace parallel_radix_sort_detail
+
+template <typename DerivedPolicy, typename ForEachTile, typename RandomAccessIterator, typename StrictWeakOrdering>
+void parallel_stable_radix_sort(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  ForEachTile for_each_tile,
+  size_t num_tiles,
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  StrictWeakOrdering)
+{
+  using key_type = thrust::detail::it_value_t<RandomAccessIterator>;
+
+  const size_t n = last - first;
+
+  thrust::detail::temporary_array<key_type, DerivedPolicy> temp(exec, n);
+
+  parallel_radix_sort_detail::radix_sort<
+    thrust::system::detail::sequential::sort_detail::needs_reverse<key_type, StrictWeakOrdering>,
+    false>(exec, for_each_tile, num_tiles, first, temp.begin(), static_cast<int*>(0), static_cast<int*>(0), n);
+}
+
+template <typename DerivedPolicy,
+          typename ForEachTile,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename StrictWeakOrdering>
+void parallel_stable_radix_sort_by_key(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  ForEachTile for_each_tile,
+  size_t num_tiles,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator1 keys_last,
+  RandomAccessIterator2 values_first,
+  StrictWeakOrdering)
+{
+  using key_type   = thrust::detail::it_value_t<RandomAccessIterator1>;
+  using value_type = thrust::detail::it_value_t<RandomAccessIterator2>;
+
+  const size_t n = keys_last - keys_first;
+
+  thrust::detail::temporary_array<key_type, DerivedPolicy> keys_temp(exec, n);
+  thrust::detail::temporary_array<value_type, DerivedPolicy> values_temp(exec, n);
+
+  parallel_radix_sort_detail::radix_sort<
+    thrust::system::detail::sequential::sort_detail::needs_reverse<key_type, StrictWeakOrdering>,
+    true>(exec, for_each_tile, num_tiles, keys_first, keys_temp.begin(), values_first, values_temp.begin(), n);
+}
+} // namespace system::detail::internal
+THRUST_NAMESPACE_END
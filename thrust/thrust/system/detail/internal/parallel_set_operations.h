@@ -0,0 +1,260 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/binary_search.h>
+#include <thrust/detail/function.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/seq.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/set_operations.h>
+#include <thrust/system/detail/internal/decompose.h>
+#include <thrust/system/detail/internal/merge_path.h>
+
+#include <cuda/std/__iterator/distance.h>
+#include <cuda/std/__utility/pair.h>
+#include <cuda/std/cstddef>
+
+// Parallel set operations for the host backends. The inputs are partitioned
+// like a merge, except that every split is moved back to the start of the run
+// of elements equivalent to the next merged element. Equivalent elements of both
+// ranges therefore always land in the same tile, and each tile can apply the
+// sequential set operation to its part on its own. The size of every tile's
+// output is counted first, then the tiles write their results at the scanned
+// offsets. The by_key variants reach these through the generic implementations,
+// which zip the keys with their values. See parallel_radix_sort.h for the
+// contract of `for_each_tile`.
+
+THRUST_NAMESPACE_BEGIN
+namespace system::detail::internal
+{
+// set operations smaller than this are not worth a tile of their own
+inline constexpr size_t set_operation_tile_granularity = 1 << 12;
+
+struct set_difference_op
+{
+  template <typename InputIterator1, typename InputIterator2, typename OutputIterator, typename StrictWeakOrdering>
+  OutputIterator operator()(
+    InputIterator1 first1,
+    InputIterator1 last1,
+    InputIterator2 first2,
+    InputIterator2 last2,
+    OutputIterator result,
+    StrictWeakOrdering comp) const
+  {
+    return thrust::set_difference(thrust::seq, first1, last1, first2, last2, result, comp);
+  }
+};
+
+struct set_intersection_op
+{
+  template <typename InputIterator1, typename InputIterator2, typename OutputIterator, typename StrictWeakOrdering>
+  OutputIterator operator()(
+    InputIterator1 first1,
+    InputIterator1 last1,
+    InputIterator2 first2,
+    InputIterator2 last2,
+    OutputIterator result,
+    StrictWeakOrdering comp) const
+  {
+    return thrust::set_intersection(thrust::seq, first1, last1, first2, last2, result, comp);
+  }
+};
+
+struct set_symmetric_difference_op
+{
+  template <typename InputIterator1, typename InputIterator2, typename OutputIterator, typename StrictWeakOrdering>
+  OutputIterator operator()(
+    InputIterator1 first1,
+    InputIterator1 last1,
+    InputIterator2 first2,
+    InputIterator2 last2,
+    OutputIterator result,
+    StrictWeakOrdering comp) const
+  {
+    return thrust::set_symmetric_difference(thrust::seq, first1, last1, first2, last2, result, comp);
+  }
+};
+
+struct set_union_op
+{
+  template <typename InputIterator1, typename InputIterator2, typename OutputIterator, typename StrictWeakOrdering>
+  OutputIterator operator()(
+    InputIterator1 first1,
+    InputIterator1 last1,
+    InputIterator2 first2,
+    InputIterator2 last2,
+    OutputIterator result,
+    StrictWeakOrdering comp) const
+  {
+    return thrust::set_union(thrust::seq, first1, last1, first2, last2, result, comp);
+  }
+};
+
+namespace parallel_set_operations_detail
+{
+// returns the merge path split at `diagonal`, moved back to the start of the
+// run of elements equivalent to the element that the merge would output next
+template <typename InputIterator1, typename InputIterator2, typename StrictWeakOrdering>
+::cuda::std::pair<size_t, size_t> split(
+  InputIterator1 first1, size_t n1, InputIterator2 first2, size_t n2, size_t diagonal, StrictWeakOrdering comp)
+{
+  thrust::detail::wrapped_function<StrictWeakOrdering, bool> wrapped_comp{comp};
+
+  const size_t i = merge_path(first1, n1, first2, n2, diagonal, comp);
+  const size_t j = diagonal - i;
+
+  if (i < n1 && (j == n2 || !wrapped_comp(first2[j], first1[i])))
+  {
+    const thrust::detail::it_value_t<InputIterator1> next = first1[i];
+
+    return ::cuda::std::make_pair(
+      static_cast<size_t>(thrust::lower_bound(thrust::seq, first1, first1 + i, next, comp) - first1),
+      static_cast<size_t>(thrust::lower_bound(thrust::seq, first2, first2 + j, next, comp) - first2));
+  }
+  else if (j < n2)
+  {
+    const thrust::detail::it_value_t<InputIterator2> next = first2[j];
+
+    return ::cuda::std::make_pair(
+      static_cast<size_t>(thrust::lower_bound(thrust::seq, first1, first1 + i, next, comp) - first1),
+      static_cast<size_t>(thrust::lower_bound(thrust::seq, first2, first2 + j, next, comp) - first2));
+  }
+
+  return ::cuda::std::make_pair(i, j);
+}
+
+template <typename InputIterator1, typename InputIterator2, typename StrictWeakOrdering, typename SetOperation>
+struct count_body
+{
+  InputIterator1 first1;
+  size_t n1;
+  InputIterator2 first2;
+  size_t n2;
+  uniform_decomposition<size_t> decomp;
+  size_t* splits1;
+  size_t* splits2;
+  size_t* counts;
+  StrictWeakOrdering comp;
+  SetOperation op;
+
+  void operator()(size_t tile) const
+  {
+    const ::cuda::std::pair<size_t, size_t> begin = split(first1, n1, first2, n2, decomp[tile].begin(), comp);
+    const ::cuda::std::pair<size_t, size_t> end   = split(first1, n1, first2, n2, decomp[tile].end(), comp);
+
+    splits1[tile] = begin.first;
+    splits2[tile] = begin.second;
+
+    thrust::discard_iterator<> discard;
+
+    counts[tile] =
+      op(first1 + begin.first, first1 + end.first, first2 + begin.second, first2 + end.second, discard, comp) - discard;
+  }
+};
+
+template <typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering,
+          typename SetOperation>
+struct write_body
+{
+  InputIterator1 first1;
+  size_t n1;
+  InputIterator2 first2;
+  size_t n2;
+  OutputIterator result;
+  size_t num_tiles;
+  const size_t* splits1;
+  const size_t* splits2;
+  const size_t* offsets;
+  StrictWeakOrdering comp;
+  SetOperation op;
+
+  void operator()(size_t tile) const
+  {
+    const size_t end1 = tile + 1 < num_tiles ? splits1[tile + 1] : n1;
+    const size_t end2 = tile + 1 < num_tiles ? splits2[tile + 1] : n2;
+
+    op(first1 + splits1[tile], first1 + end1, first2 + splits2[tile], first2 + end2, result + offsets[tile], comp);
+  }
+};
+} // namespace parallel_set_operations_detail
+
+template <typename DerivedPolicy,
+          typename ForEachTile,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering,
+          typename SetOperation>
+OutputIterator parallel_set_operation(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  ForEachTile for_each_tile,
+  size_t max_tiles,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  InputIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp,
+  SetOperation op)
+{
+  const size_t n1 = ::cuda::std::distance(first1, last1);
+  const size_t n2 = ::cuda::std::distance(first2, last2);
+
+  const uniform_decomposition<size_t> decomp(n1 + n2, set_operation_tile_granularity, max_tiles);
+
+  if (decomp.size() <= 1)
+  {
+    return op(first1, last1, first2, last2, result, comp);
+  }
+
+  const size_t num_tiles = decomp.size();
+
+  thrust::detail::temporary_array<size_t, DerivedPolicy> storage(exec, 3 * num_tiles);
+
+  size_t* splits1 = thrust::raw_pointer_cast(storage.data());
+  size_t* splits2 = splits1 + num_tiles;
+  size_t* counts  = splits2 + num_tiles;
+
+  for_each_tile(
+    num_tiles,
+    parallel_set_operations_detail::count_body<InputIterator1, InputIterator2, StrictWeakOrdering, SetOperation>{
+      first1, n1, first2, n2, decomp, splits1, splits2, counts, comp, op});
+
+  // turn the counts into output offsets in place
+  size_t sum = 0;
+
+  for (size_t tile = 0; tile < num_tiles; ++tile)
+  {
+    const size_t count = counts[tile];
+
+    counts[tile] = sum;
+
+    sum += count;
+  }
+
+  for_each_tile(num_tiles,
+                parallel_set_operations_detail::
+                  write_body<InputIterator1, InputIterator2, OutputIterator, StrictWeakOrdering, SetOperation>{
+                    first1, n1, first2, n2, result, num_tiles, splits1, splits2, counts, comp, op});
+
+  return result + sum;
+}
+} // namespace system::detail::internal
+THRUST_NAMESPACE_END
@@ -0,0 +1,511 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/copy.h>
+#include <thrust/detail/execution_policy.h>
+#include <thrust/detail/function.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/decompose.h>
+#include <thrust/system/detail/sequential/copy_if.h>
+#include <thrust/system/detail/sequential/partition.h>
+#include <thrust/system/detail/sequential/remove.h>
+#include <thrust/system/detail/sequential/unique.h>
+
+#include <cuda/std/__functional/not_fn.h>
+#include <cuda/std/__iterator/distance.h>
+#include <cuda/std/__utility/pair.h>
+#include <cuda/std/cstddef>
+
+// Stream compaction for the host backends. The input is divided into tiles;
+// every tile first counts the elements it keeps, the counts are scanned into
+// output offsets, and every tile then writes its kept elements starting at its
+// offset. Whether an element is kept is decided twice rather than stored, so no
+// flag array the size of the input is needed. The in-place variants compact
+// into a temporary array and copy the result back. See parallel_radix_sort.h for
+// the contract of `for_each_tile`.
+
+THRUST_NAMESPACE_BEGIN
+namespace system::detail::internal
+{
+// compactions smaller than this are not worth a tile of their own
+inline constexpr size_t stream_compaction_tile_granularity = 1 << 12;
+
+namespace parallel_stream_compaction_detail
+{
+// keeps the elements whose stencil satisfies the predicate
+template <typename InputIterator, typename Predicate>
+struct stencil_selector
+{
+  InputIterator stencil;
+  thrust::detail::wrapped_function<Predicate, bool> pred;
+
+  bool operator()(size_t i) const
+  {
+    return pred(stencil[i]);
+  }
+};
+
+// keeps the first element of every run of equivalent elements
+template <typename InputIterator, typename BinaryPredicate>
+struct unique_selector
+{
+  InputIterator first;
+  thrust::detail::wrapped_function<BinaryPredicate, bool> binary_pred;
+
+  bool operator()(size_t i) const
+  {
+    return i == 0 || !binary_pred(first[i - 1], first[i]);
+  }
+};
+
+template <typename Selector>
+struct count_body
+{
+  uniform_decomposition<size_t> decomp;
+  size_t* counts;
+  Selector select;
+
+  void operator()(size_t tile) const
+  {
+    size_t count = 0;
+
+    for (size_t i = decomp[tile].begin(); i < decomp[tile].end(); ++i)
+    {
+      if (select(i))
+      {
+        ++count;
+      }
+    }
+
+    counts[tile] = count;
+  }
+};
+
+template <typename InputIterator, typename OutputIterator, typename Selector>
+struct write_body
+{
+  InputIterator first;
+  OutputIterator result;
+  uniform_decomposition<size_t> decomp;
+  const size_t* offsets;
+  Selector select;
+
+  void operator()(size_t tile) const
+  {
+    OutputIterator out = result + offsets[tile];
+
+    for (size_t i = decomp[tile].begin(); i < decomp[tile].end(); ++i)
+    {
+      if (select(i))
+      {
+        *out = first[i];
+        ++out;
+      }
+    }
+  }
+};
+
+template <typename InputIterator, typename OutputIterator1, typename OutputIterator2, typename Selector>
+struct partition_write_body
+{
+  InputIterator first;
+  OutputIterator1 out_true;
+  OutputIterator2 out_false;
+  uniform_decomposition<size_t> decomp;
+  const size_t* offsets;
+  Selector select;
+
+  void operator()(size_t tile) const
+  {
+    // the elements of earlier tiles which were not selected precede this tile's
+    OutputIterator1 true_out  = out_true + offsets[tile];
+    OutputIterator2 false_out = out_false + (decomp[tile].begin() - offsets[tile]);
+
+    for (size_t i = decomp[tile].begin(); i < decomp[tile].end(); ++i)
+    {
+      if (select(i))
+      {
+        *true_out = first[i];
+        ++true_out;
+      }
+      else
+      {
+        *false_out = first[i];
+        ++false_out;
+      }
+    }
+  }
+};
+
+// counts the selected elements of every tile and turns the counts into output
+// offsets in place; returns the total number of selected elements
+template <typename ForEachTile, typename Selector>
+size_t
+count_selected(ForEachTile for_each_tile, const uniform_decomposition<size_t>& decomp, size_t* offsets, Selector select)
+{
+  for_each_tile(decomp.size(), count_body<Selector>{decomp, offsets, select});
+
+  size_t sum = 0;
+
+  for (size_t tile = 0; tile < decomp.size(); ++tile)
+  {
+    const size_t count = offsets[tile];
+
+    offsets[tile] = sum;
+
+    sum += count;
+  }
+
+  return sum;
+}
+
+template <typename DerivedPolicy,
+          typename ForEachTile,
+          typename InputIterator,
+          typename OutputIterator,
+          typename Selector>
+OutputIterator compact(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  ForEachTile for_each_tile,
+  const uniform_decomposition<size_t>& decomp,
+  InputIterator first,
+  OutputIterator result,
+  Selector select)
+{
+  thrust::detail::temporary_array<size_t, DerivedPolicy> offsets(exec, decomp.size());
+  size_t* offsets_ptr = thrust::raw_pointer_cast(offsets.data());
+
+  const size_t num_selected = count_selected(for_each_tile, decomp, offsets_ptr, select);
+
+  for_each_tile(decomp.size(),
+                write_body<InputIterator, OutputIterator, Selector>{first, result, decomp, offsets_ptr, select});
+
+  return result + num_selected;
+}
+
+// compacts the decomposed range starting at `first` in place through a temporary array
+// holding only the selected elements
+template <typename DerivedPolicy, typename ForEachTile, typename ForwardIterator, typename Selector>
+ForwardIterator compact_in_place(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  ForEachTile for_each_tile,
+  const uniform_decomposition<size_t>& decomp,
+  ForwardIterator first,
+  Selector select)
+{
+  using value_type    = thrust::detail::it_value_t<ForwardIterator>;
+  using temp_iterator = typename thrust::detail::temporary_array<value_type, DerivedPolicy>::iterator;
+
+  thrust::detail::temporary_array<size_t, DerivedPolicy> offsets(exec, decomp.size());
+  size_t* offsets_ptr = thrust::raw_pointer_cast(offsets.data());
+
+  const size_t num_selected = count_selected(for_each_tile, decomp, offsets_ptr, select);
+
+  thrust::detail::temporary_array<value_type, DerivedPolicy> temp(exec, num_selected);
+
+  for_each_tile(
+    decomp.size(),
+    write_body<ForwardIterator, temp_iterator, Selector>{first, temp.begin(), decomp, offsets_ptr, select});
+
+  return thrust::copy(exec, temp.begin(), temp.end(), first);
+}
+
+template <typename DerivedPolicy,
+          typename ForEachTile,
+          typename InputIterator,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename Selector>
+::cuda::std::pair<OutputIterator1, OutputIterator2> partition_copy(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  ForEachTile for_each_tile,
+  const uniform_decomposition<size_t>& decomp,
+  size_t n,
+  InputIterator first,
+  OutputIterator1 out_true,
+  OutputIterator2 out_false,
+  Selector select)
+{
+  thrust::detail::temporary_array<size_t, DerivedPolicy> offsets(exec, decomp.size());
+  size_t* offsets_ptr = thrust::raw_pointer_cast(offsets.data());
+
+  const size_t num_true = count_selected(for_each_tile, decomp, offsets_ptr, select);
+
+  for_each_tile(decomp.size(),
+                partition_write_body<InputIterator, OutputIterator1, OutputIterator2, Selector>{
+                  first, out_true, out_false, decomp, offsets_ptr, select});
+
+  return ::cuda::std::make_pair(out_true + num_true, out_false + (n - num_true));
+}
+
+// partitions the decomposed range starting at `first` in place through a
+// temporary array holding the whole range
+template <typename DerivedPolicy, typename ForEachTile, typename ForwardIterator, typename Selector>
+ForwardIterator stable_partition_in_place(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  ForEachTile for_each_tile,
+  const uniform_decomposition<size_t>& decomp,
+  size_t n,
+  ForwardIterator first,
+  Selector select)
+{
+  using value_type    = thrust::detail::it_value_t<ForwardIterator>;
+  using temp_iterator = typename thrust::detail::temporary_array<value_type, DerivedPolicy>::iterator;
+
+  thrust::detail::temporary_array<size_t, DerivedPolicy> offsets(exec, decomp.size());
+  size_t* offsets_ptr = thrust::raw_pointer_cast(offsets.data());
+
+  const size_t num_true = count_selected(for_each_tile, decomp, offsets_ptr, select);
+
+  thrust::detail::temporary_array<value_type, DerivedPolicy> temp(exec, n);
+
+  // the false partition goes right behind the true partition
+  for_each_tile(decomp.size(),
+                partition_write_body<ForwardIterator, temp_iterator, temp_iterator, Selector>{
+                  first, temp.begin(), temp.begin() + num_true, decomp, offsets_ptr, select});
+
+  thrust::copy(exec, temp.begin(), temp.end(), first);
+
+  return first + num_true;
+}
+} // namespace parallel_stream_compaction_detail
+
+template <typename DerivedPolicy,
+          typename ForEachTile,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename Predicate>
+OutputIterator parallel_copy_if(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  ForEachTile for_each_tile,
+  size_t max_tiles,
+  InputIterator1 first,
+  InputIterator1 last,
+  InputIterator2 stencil,
+  OutputIterator result,
+  Predicate pred)
+{
+  const uniform_decomposition<size_t> decomp(
+    ::cuda::std::distance(first, last), stream_compaction_tile_granularity, max_tiles);
+
+  if (decomp.size() <= 1)
+  {
+    return thrust::system::detail::sequential::copy_if(
+      thrust::detail::derived_cast(exec), first, last, stencil, result, pred);
+  }
+
+  return parallel_stream_compaction_detail::compact(
+    exec,
+    for_each_tile,
+    decomp,
+    first,
+    result,
+    parallel_stream_compaction_detail::stencil_selector<InputIterator2, Predicate>{stencil, {pred}});
+}
+
+template <typename DerivedPolicy,
+          typename ForEachTile,
+          typename ForwardIterator,
+          typename InputIterator,
+          typename Predicate>
+ForwardIterator parallel_remove_if(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  ForEachTile for_each_tile,
+  size_t max_tiles,
+  ForwardIterator first,
+  ForwardIterator last,
+  InputIterator stencil,
+  Predicate pred)
+{
+  const uniform_decomposition<size_t> decomp(
+    ::cuda::std::distance(first, last), stream_compaction_tile_granularity, max_tiles);
+
+  if (decomp.size() <= 1)
+  {
+    return thrust::system::detail::sequential::remove_if(
+      thrust::detail::derived_cast(exec), first, last, stencil, pred);
+  }
+
+  auto not_pred = ::cuda::std::not_fn(pred);
+
+  return parallel_stream_compaction_detail::compact_in_place(
+    exec,
+    for_each_tile,
+    decomp,
+    first,
+    parallel_stream_compaction_detail::stencil_selector<InputIterator, decltype(not_pred)>{stencil, {not_pred}});
+}
+
+template <typename DerivedPolicy,
+          typename ForEachTile,
+          typename InputIterator,
+          typename OutputIterator,
+          typename BinaryPredicate>
+OutputIterator parallel_unique_copy(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  ForEachTile for_each_tile,
+  size_t max_tiles,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator result,
+  BinaryPredicate binary_pred)
+{
+  const uniform_decomposition<size_t> decomp(
+    ::cuda::std::distance(first, last), stream_compaction_tile_granularity, max_tiles);
+
+  if (decomp.size() <= 1)
+  {
+    return thrust::system::detail::sequential::unique_copy(
+      thrust::detail::derived_cast(exec), first, last, result, binary_pred);
+  }
+
+  return parallel_stream_compaction_detail::compact(
+    exec,
+    for_each_tile,
+    decomp,
+    first,
+    result,
+    parallel_stream_compaction_detail::unique_selector<InputIterator, BinaryPredicate>{first, {binary_pred}});
+}
+
+template <typename DerivedPolicy, typename ForEachTile, typename ForwardIterator, typename BinaryPredicate>
+ForwardIterator parallel_unique(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  ForEachTile for_each_tile,
+  size_t max_tiles,
+  ForwardIterator first,
+  ForwardIterator last,
+  BinaryPredicate binary_pred)
+{
+  const uniform_decomposition<size_t> decomp(
+    ::cuda::std::distance(first, last), stream_compaction_tile_granularity, max_tiles);
+
+  if (decomp.size() <= 1)
+  {
+    return thrust::system::detail::sequential::unique(thrust::detail::derived_cast(exec), first, last, binary_pred);
+  }
+
+  return parallel_stream_compaction_detail::compact_in_place(
+    exec,
+    for_each_tile,
+    decomp,
+    first,
+    parallel_stream_compaction_detail::unique_selector<ForwardIterator, BinaryPredicate>{first, {binary_pred}});
+}
+
+template <typename DerivedPolicy,
+          typename ForEachTile,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename Predicate>
+::cuda::std::pair<OutputIterator1, OutputIterator2> parallel_stable_partition_copy(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  ForEachTile for_each_tile,
+  size_t max_tiles,
+  InputIterator1 first,
+  InputIterator1 last,
+  InputIterator2 stencil,
+  OutputIterator1 out_true,
+  OutputIterator2 out_false,
+  Predicate pred)
+{
+  const size_t n = ::cuda::std::distance(first, last);
+
+  const uniform_decomposition<size_t> decomp(n, stream_compaction_tile_granularity, max_tiles);
+
+  if (decomp.size() <= 1)
+  {
+    return thrust::system::detail::sequential::stable_partition_copy(
+      thrust::detail::derived_cast(exec), first, last, stencil, out_true, out_false, pred);
+  }
+
+  return parallel_stream_compaction_detail::partition_copy(
+    exec,
+    for_each_tile,
+    decomp,
+    n,
+    first,
+    out_true,
+    out_false,
+    parallel_stream_compaction_detail::stencil_selector<InputIterator2, Predicate>{stencil, {pred}});
+}
+
+template <typename DerivedPolicy, typename ForEachTile, typename ForwardIterator, typename Predicate>
+ForwardIterator parallel_stable_partition(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  ForEachTile for_each_tile,
+  size_t max_tiles,
+  ForwardIterator first,
+  ForwardIterator last,
+  Predicate pred)
+{
+  const size_t n = ::cuda::std::distance(first, last);
+
+  const uniform_decomposition<size_t> decomp(n, stream_compaction_tile_granularity, max_tiles);
+
+  // the sequential overload taking a stencil must not be given the input as its stencil
+  if (decomp.size() <= 1)
+  {
+    return thrust::system::detail::sequential::stable_partition(thrust::detail::derived_cast(exec), first, last, pred);
+  }
+
+  return parallel_stream_compaction_detail::stable_partition_in_place(
+    exec,
+    for_each_tile,
+    decomp,
+    n,
+    first,
+    parallel_stream_compaction_detail::stencil_selector<ForwardIterator, Predicate>{first, {pred}});
+}
+
+template <typename DerivedPolicy,
+          typename ForEachTile,
+          typename ForwardIterator,
+          typename InputIterator,
+          typename Predicate>
+ForwardIterator parallel_stable_partition(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  ForEachTile for_each_tile,
+  size_t max_tiles,
+  ForwardIterator first,
+  ForwardIterator last,
+  InputIterator stencil,
+  Predicate pred)
+{
+  const size_t n = ::cuda::std::distance(first, last);
+
+  const uniform_decomposition<size_t> decomp(n, stream_compaction_tile_granularity, max_tiles);
+
+  if (decomp.size() <= 1)
+  {
+    return thrust::system::detail::sequential::stable_partition(
+      thrust::detail::derived_cast(exec), first, last, stencil, pred);
+  }
+
+  return parallel_stream_compaction_detail::stable_partition_in_place(
+    exec,
+    for_each_tile,
+    decomp,
+    n,
+    first,
+    parallel_stream_compaction_detail::stencil_selector<InputIterator, Predicate>{stencil, {pred}});
+}
+} // namespace system::detail::internal
+THRUST_NAMESPACE_END
@@ -0,0 +1,291 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/function.h>
+#include <thrust/detail/type_traits/minimum_type.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/decompose.h>
+
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/__functional/invoke.h>
+#include <cuda/std/__iterator/distance.h>
+#include <cuda/std/__type_traits/is_convertible.h>
+#include <cuda/std/cstddef>
+
+// Vectorized lower_bound, upper_bound and binary_search for the host backends.
+// The queries are divided into tiles. A tile of sorted queries is searched like
+// a merge: every query gallops forward from the result of the previous one, so
+// the haystack is traversed once and in order. Heterogeneous comparators that
+// cannot order two queries never take this path. The queries of the other tiles
+// are searched in groups with a branchless binary search whose steps are
+// interleaved across the group, so that their cache misses overlap instead of
+// following each other. See parallel_radix_sort.h for the contract of
+// `for_each_tile`.
+
+THRUST_NAMESPACE_BEGIN
+namespace system::detail::internal
+{
+// query sequences smaller than this are not worth a tile of their own
+inline constexpr size_t search_tile_granularity = 1 << 12;
+
+// the number of queries whose binary searches are interleaved
+inline constexpr size_t search_group_size = 8;
+
+// whether the haystack, the queries and the output of a vectorized search can be indexed into
+template <typename ForwardIterator, typename InputIterator, typename OutputIterator>
+inline constexpr bool is_random_access_search_v = ::cuda::std::is_convertible_v<
+  thrust::detail::minimum_type<typename iterator_traversal<ForwardIterator>::type,
+                               typename iterator_traversal<InputIterator>::type,
+                               typename iterator_traversal<OutputIterator>::type>,
+  random_access_traversal_tag>;
+
+// the result of lower_bound is the number of haystack elements ordered before the query
+struct lower_bound_op
+{
+  template <typename Compare, typename T, typename U>
+  static bool before(Compare& comp, const T& element, const U& value)
+  {
+    return comp(element, value);
+  }
+
+  template <typename RandomAccessIterator, typename Compare, typename U>
+  static size_t result(RandomAccessIterator, size_t, Compare&, const U&, size_t position)
+  {
+    return position;
+  }
+};
+
+// the result of upper_bound is the number of haystack elements not ordered after the query
+struct upper_bound_op
+{
+  template <typename Compare, typename T, typename U>
+  static bool before(Compare& comp, const T& element, const U& value)
+  {
+    return !comp(value, element);
+  }
+
+  template <typename RandomAccessIterator, typename Compare, typename U>
+  static size_t result(RandomAccessIterator, size_t, Compare&, const U&, size_t position)
+  {
+    return position;
+  }
+};
+
+// the result of binary_search is whether the element at the lower bound of the query is equivalent to it
+struct binary_search_op
+{
+  template <typename Compare, typename T, typename U>
+  static bool before(Compare& comp, const T& element, const U& value)
+  {
+    return comp(element, value);
+  }
+
+  template <typename RandomAccessIterator, typename Compare, typename U>
+  static bool result(RandomAccessIterator haystack, size_t n, Compare& comp, const U& value, size_t position)
+  {
+    return position != n && !comp(value, haystack[position]);
+  }
+};
+
+namespace parallel_vectorized_search_detail
+{
+template <typename SearchOp, typename StrictWeakOrdering>
+struct ordered_before
+{
+  mutable thrust::detail::wrapped_function<StrictWeakOrdering, bool> comp;
+
+  template <typename T, typename U>
+  bool operator()(const T& element, const U& value) const
+  {
+    return SearchOp::before(comp, element, value);
+  }
+};
+
+// returns whether the queries of [begin, end) are sorted, or false if the comparator cannot order two queries
+template <typename StrictWeakOrdering, typename InputIterator, typename Compare>
+bool is_sorted_tile(InputIterator queries, size_t begin, size_t end, Compare& comp)
+{
+  using reference = thrust::detail::it_reference_t<InputIterator>;
+  if constexpr (::cuda::std::is_invocable_v<StrictWeakOrdering&, reference, reference>)
+  {
+    for (size_t i = begin + 1; i < end; ++i)
+    {
+      if (comp(queries[i], queries[i - 1]))
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+  else
+  {
+    return false;
+  }
+}
+
+// returns the number of leading elements of [haystack, haystack + n) ordered before value
+template <typename RandomAccessIterator, typename T, typename Before>
+size_t branchless_search(RandomAccessIterator haystack, size_t n, const T& value, const Before& before)
+{
+  if (n == 0)
+  {
+    return 0;
+  }
+
+  size_t base = 0;
+  for (; n > 1; n -= n / 2)
+  {
+    base = before(haystack[base + n / 2], value) ? base + n / 2 : base;
+  }
+  return base + before(haystack[base], value);
+}
+
+// positions[j] = branchless_search(haystack, n, queries[j], before) for every j in [0, GroupSize). All searches take
+// the same steps, so they proceed in lockstep and their cache misses overlap
+template <size_t GroupSize, typename RandomAccessIterator, typename InputIterator, typename Before>
+void branchless_search_group(
+  RandomAccessIterator haystack, size_t n, InputIterator queries, size_t* positions, const Before& before)
+{
+  for (size_t j = 0; j < GroupSize; ++j)
+  {
+    positions[j] = 0;
+  }
+  if (n == 0)
+  {
+    return;
+  }
+
+  for (; n > 1; n -= n / 2)
+  {
+    for (size_t j = 0; j < GroupSize; ++j)
+    {
+      positions[j] = before(haystack[positions[j] + n / 2], queries[j]) ? positions[j] + n / 2 : positions[j];
+    }
+  }
+  for (size_t j = 0; j < GroupSize; ++j)
+  {
+    positions[j] += before(haystack[positions[j]], queries[j]);
+  }
+}
+
+template <typename SearchOp,
+          typename RandomAccessIterator,
+          typename InputIterator,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+struct search_body
+{
+  RandomAccessIterator haystack;
+  size_t n;
+  InputIterator queries;
+  OutputIterator output;
+  uniform_decomposition<size_t> decomp;
+  StrictWeakOrdering comp;
+
+  void operator()(size_t tile) const
+  {
+    const ordered_before<SearchOp, StrictWeakOrdering> before{comp};
+    thrust::detail::wrapped_function<StrictWeakOrdering, bool> wrapped_comp{comp};
+
+    const size_t begin = decomp[tile].begin();
+    const size_t end   = decomp[tile].end();
+
+    if (is_sorted_tile<StrictWeakOrdering>(queries, begin, end, wrapped_comp))
+    {
+      // the result of each query is at least the one of its predecessor, so gallop forward from there
+      size_t position = branchless_search(haystack, n, queries[begin], before);
+      output[begin]   = SearchOp::result(haystack, n, wrapped_comp, queries[begin], position);
+
+      for (size_t i = begin + 1; i < end; ++i)
+      {
+        size_t first = position;
+        size_t last  = position;
+        for (size_t step = 1; last < n && before(haystack[last], queries[i]); step *= 2)
+        {
+          first = last + 1;
+          last  = ::cuda::std::min(n, last + step);
+        }
+        position  = first + branchless_search(haystack + first, last - first, queries[i], before);
+        output[i] = SearchOp::result(haystack, n, wrapped_comp, queries[i], position);
+      }
+    }
+    else
+    {
+      size_t positions[search_group_size];
+
+      size_t i = begin;
+      for (; i + search_group_size <= end; i += search_group_size)
+      {
+        branchless_search_group<search_group_size>(haystack, n, queries + i, positions, before);
+        for (size_t j = 0; j < search_group_size; ++j)
+        {
+          output[i + j] = SearchOp::result(haystack, n, wrapped_comp, queries[i + j], positions[j]);
+        }
+      }
+      for (; i < end; ++i)
+      {
+        output[i] = SearchOp::result(
+          haystack, n, wrapped_comp, queries[i], branchless_search(haystack, n, queries[i], before));
+      }
+    }
+  }
+};
+} // namespace parallel_vectorized_search_detail
+
+template <typename ForEachTile,
+          typename RandomAccessIterator,
+          typename InputIterator,
+          typename OutputIterator,
+          typename StrictWeakOrdering,
+          typename SearchOp>
+OutputIterator parallel_vectorized_search(
+  ForEachTile for_each_tile,
+  size_t max_tiles,
+  RandomAccessIterator haystack_first,
+  RandomAccessIterator haystack_last,
+  InputIterator queries_first,
+  InputIterator queries_last,
+  OutputIterator output,
+  StrictWeakOrdering comp,
+  SearchOp)
+{
+  const size_t n           = ::cuda::std::distance(haystack_first, haystack_last);
+  const size_t num_queries = ::cuda::std::distance(queries_first, queries_last);
+
+  if (num_queries == 0)
+  {
+    return output;
+  }
+
+  const uniform_decomposition<size_t> decomp(num_queries, search_tile_granularity, max_tiles);
+
+  const parallel_vectorized_search_detail::
+    search_body<SearchOp, RandomAccessIterator, InputIterator, OutputIterator, StrictWeakOrdering>
+      body{haystack_first, n, queries_first, output, decomp, comp};
+
+  // there is no sequential vectorized search to fall back to, so a single tile is searched on the calling thread
+  if (decomp.size() <= 1)
+  {
+    body(0);
+  }
+  else
+  {
+    for_each_tile(decomp.size(), body);
+  }
+
+  return output + num_queries;
+}
+} // namespace system::detail::internal
+THRUST_NAMESPACE_END
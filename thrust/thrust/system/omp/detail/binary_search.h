@@ -13,12 +13,55 @@
 #  pragma system_header
 #endif // no system header
 
+#include <thrust/detail/static_assert.h>
 #include <thrust/system/detail/generic/binary_search.h>
+#include <thrust/system/detail/internal/parallel_vectorized_search.h>
 #include <thrust/system/omp/detail/execution_policy.h>
+#include <thrust/system/omp/detail/for_each_tile.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system::omp::detail
 {
+namespace binary_search_detail
+{
+template <typename DerivedPolicy,
+          typename ForwardIterator,
+          typename InputIterator,
+          typename OutputIterator,
+          typename StrictWeakOrdering,
+          typename SearchOp>
+OutputIterator vectorized_search(
+  execution_policy<DerivedPolicy>& exec,
+  ForwardIterator begin,
+  ForwardIterator end,
+  InputIterator values_begin,
+  InputIterator values_end,
+  OutputIterator output,
+  StrictWeakOrdering comp,
+  SearchOp search_op)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  static_assert(thrust::detail::depend_on_instantiation<ForwardIterator,
+                                                        (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
+                "OpenMP compiler support is not enabled");
+
+  return thrust::system::detail::internal::parallel_vectorized_search(
+    for_each_tile{exec.config()},
+    tile_parallelism(exec.config(), values_begin, values_end),
+    begin,
+    end,
+    values_begin,
+    values_end,
+    output,
+    comp,
+    search_op);
+}
+} // namespace binary_search_detail
+
 template <typename DerivedPolicy, typename ForwardIterator, typename T, typename StrictWeakOrdering>
 ForwardIterator lower_bound(
   execution_policy<DerivedPolicy>& exec,
@@ -53,5 +96,80 @@ bool binary_search(execution_policy<DerivedPolicy>& exec,
   // omp prefers generic::binary_search to cpp::binary_search
   return thrust::system::detail::generic::binary_search(exec, begin, end, value, comp);
 }
+
+template <typename DerivedPolicy,
+          typename ForwardIterator,
+          typename InputIterator,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator lower_bound(
+  execution_policy<DerivedPolicy>& exec,
+  ForwardIterator begin,
+  ForwardIterator end,
+  InputIterator values_begin,
+  InputIterator values_end,
+  OutputIterator output,
+  StrictWeakOrdering comp)
+{
+  if constexpr (system::detail::internal::is_random_access_search_v<ForwardIterator, InputIterator, OutputIterator>)
+  {
+    return binary_search_detail::vectorized_search(
+      exec, begin, end, values_begin, values_end, output, comp, thrust::system::detail::internal::lower_bound_op{});
+  }
+  else
+  {
+    return thrust::system::detail::generic::lower_bound(exec, begin, end, values_begin, values_end, output, comp);
+  }
+}
+
+template <typename DerivedPolicy,
+          typename ForwardIterator,
+          typename InputIterator,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator upper_bound(
+  execution_policy<DerivedPolicy>& exec,
+  ForwardIterator begin,
+  ForwardIterator end,
+  InputIterator values_begin,
+  InputIterator values_end,
+  OutputIterator output,
+  StrictWeakOrdering comp)
+{
+  if constexpr (system::detail::internal::is_random_access_search_v<ForwardIterator, InputIterator, OutputIterator>)
+  {
+    return binary_search_detail::vectorized_search(
+      exec, begin, end, values_begin, values_end, output, comp, thrust::system::detail::internal::upper_bound_op{});
+  }
+  else
+  {
+    return thrust::system::detail::generic::upper_bound(exec, begin, end, values_begin, values_end, output, comp);
+  }
+}
+
+template <typename DerivedPolicy,
+          typename ForwardIterator,
+          typename InputIterator,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator binary_search(
+  execution_policy<DerivedPolicy>& exec,
+  ForwardIterator begin,
+  ForwardIterator end,
+  InputIterator values_begin,
+  InputIterator values_end,
+  OutputIterator output,
+  StrictWeakOrdering comp)
+{
+  if constexpr (system::detail::internal::is_random_access_search_v<ForwardIterator, InputIterator, OutputIterator>)
+  {
+    return binary_search_detail::vectorized_search(
+      exec, begin, end, values_begin, values_end, output, comp, thrust::system::detail::internal::binary_search_op{});
+  }
+  else
+  {
+    return thrust::system::detail::generic::binary_search(exec, begin, end, values_begin, values_end, output, comp);
+  }
+}
 } // end namespace system::omp::detail
 THRUST_NAMESPACE_END
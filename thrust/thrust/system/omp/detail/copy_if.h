@@ -13,8 +13,10 @@
 #  pragma system_header
 #endif // no system header
 
-#include <thrust/system/detail/generic/copy_if.h>
+#include <thrust/detail/static_assert.h>
+#include <thrust/system/detail/internal/parallel_stream_compaction.h>
 #include <thrust/system/omp/detail/execution_policy.h>
+#include <thrust/system/omp/detail/for_each_tile.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system::omp::detail
@@ -32,8 +34,24 @@ OutputIterator copy_if(
   OutputIterator result,
   Predicate pred)
 {
-  // omp prefers generic::copy_if to cpp::copy_if
-  return thrust::system::detail::generic::copy_if(exec, first, last, stencil, result, pred);
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  static_assert(thrust::detail::depend_on_instantiation<InputIterator1,
+                                                        (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
+                "OpenMP compiler support is not enabled");
+
+  return thrust::system::detail::internal::parallel_copy_if(
+    exec,
+    for_each_tile{exec.config()},
+    tile_parallelism(exec.config(), first, last),
+    first,
+    last,
+    stencil,
+    result,
+    pred);
 } // end copy_if()
 } // end namespace system::omp::detail
 THRUST_NAMESPACE_END
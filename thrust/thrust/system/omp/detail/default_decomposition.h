@@ -17,6 +17,10 @@
 #  pragma system_header
 #endif // no system header
 #include <thrust/system/detail/internal/decompose.h>
+#include <thrust/system/omp/detail/execution_policy.h>
+
+#include <cuda/std/__algorithm/max.h>
+#include <cuda/std/__algorithm/min.h>
 
 // don't attempt to #include this file without omp support
 #if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
@@ -27,7 +31,8 @@ THRUST_NAMESPACE_BEGIN
 namespace system::omp::detail
 {
 template <typename IndexType>
-thrust::system::detail::internal::uniform_decomposition<IndexType> default_decomposition(IndexType n)
+thrust::system::detail::internal::uniform_decomposition<IndexType>
+default_decomposition(IndexType n, const execution_config& config = execution_config{})
 {
   // we're attempting to launch an omp kernel, assert we're compiling with omp support
   // ========================================================================
@@ -39,10 +44,20 @@ thrust::system::detail::internal::uniform_decomposition<IndexType> default_decom
     "OpenMP compiler support is not enabled");
 
 #if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
-  return thrust::system::detail::internal::uniform_decomposition<IndexType>(n, 1, omp_get_num_procs());
+  IndexType num_intervals =
+    config.num_threads != 0 ? static_cast<IndexType>(config.num_threads) : static_cast<IndexType>(omp_get_num_procs());
 #else
-  return thrust::system::detail::internal::uniform_decomposition<IndexType>(n, 1, 1);
+  IndexType num_intervals = 1;
 #endif
+
+  // at most one interval per grain of elements
+  if (config.grain_size != 0)
+  {
+    num_intervals =
+      ::cuda::std::max(IndexType{1}, ::cuda::std::min(num_intervals, n / static_cast<IndexType>(config.grain_size)));
+  }
+
+  return thrust::system::detail::internal::uniform_decomposition<IndexType>(n, 1, num_intervals);
 }
 } // end namespace system::omp::detail
 THRUST_NAMESPACE_END
@@ -20,6 +20,8 @@
 #include <thrust/system/omp/detail/execution_policy.h>
 #include <thrust/system/tbb/detail/execution_policy.h>
 
+#include <cuda/std/cstddef>
+
 THRUST_NAMESPACE_BEGIN
 namespace system::omp
 {
@@ -31,10 +33,67 @@ struct tag;
 template <typename Derived>
 struct execution_policy;
 
+// the loop schedules that can be requested with execution_policy::with
+enum class schedule
+{
+  automatic,
+  static_,
+  dynamic,
+  guided
+};
+
+// the thread count that can be requested with execution_policy::with
+struct threads
+{
+  constexpr explicit threads(size_t n)
+      : value(n)
+  {}
+
+  size_t value;
+};
+
+// the grain size, in elements, that can be requested with execution_policy::with
+struct grain
+{
+  constexpr explicit grain(size_t n)
+      : value(n)
+  {}
+
+  size_t value;
+};
+
+// the knobs carried by an execution policy; zero and schedule::automatic leave the choice to the algorithm
+struct execution_config
+{
+  size_t num_threads     = 0;
+  size_t grain_size      = 0;
+  schedule schedule_kind = schedule::automatic;
+
+  constexpr void apply(threads knob)
+  {
+    num_threads = knob.value;
+  }
+
+  constexpr void apply(grain knob)
+  {
+    grain_size = knob.value;
+  }
+
+  constexpr void apply(schedule knob)
+  {
+    schedule_kind = knob;
+  }
+};
+
 template <>
 struct execution_policy<tag> : cpp::execution_policy<tag>
 {
   using tag_type = tag;
+
+  constexpr execution_config config() const
+  {
+    return execution_config{};
+  }
 };
 
 struct tag : execution_policy<tag>
@@ -50,6 +109,23 @@ struct execution_policy : cpp::execution_policy<Derived>
   {
     return tag();
   }
+
+  // returns a copy of this policy whose algorithms run with the given threads, grain and schedule knobs
+  template <typename... Knobs>
+  Derived with(Knobs... knobs) const
+  {
+    Derived result = thrust::detail::derived_cast(*this);
+    (static_cast<execution_policy&>(result).m_config.apply(knobs), ...);
+    return result;
+  }
+
+  constexpr execution_config config() const
+  {
+    return m_config;
+  }
+
+private:
+  execution_config m_config{};
 };
 
 struct par_t
@@ -119,6 +195,45 @@ using detail::execution_policy;
 //! \endcode
 inline constexpr detail::par_t par;
 
+//! \p thrust::omp::schedule selects the schedule of the parallel loops of the OpenMP backend system, when passed to
+//! the \p with member function of an OpenMP execution policy:
+//!
+//! - \p automatic, the default, leaves the choice to each algorithm;
+//! - \p static_ divides the iterations into contiguous chunks, assigned to the threads in turn;
+//! - \p dynamic hands out chunks to the threads as they become idle;
+//! - \p guided hands out chunks to the threads as they become idle, starting with large ones.
+using detail::schedule;
+
+//! \p thrust::omp::threads requests the number of threads of the parallel regions of the OpenMP backend system, when
+//! passed to the \p with member function of an OpenMP execution policy. Zero, the default, uses as many threads as
+//! OpenMP provides, i.e. \p omp_get_max_threads.
+using detail::threads;
+
+//! \p thrust::omp::grain requests the smallest number of elements worth handing to a thread of the OpenMP backend
+//! system, when passed to the \p with member function of an OpenMP execution policy. Algorithms run an input of \p n
+//! elements on at most <tt>n / grain</tt> threads, so a large grain keeps small inputs on the calling thread, and the
+//! \p static_, \p dynamic and \p guided schedules hand out chunks of at least this many iterations. Zero, the
+//! default, leaves the choice to each algorithm.
+//!
+//! The following code snippet demonstrates how to run an invocation of \p thrust::for_each on eight threads, handing
+//! out chunks of 65536 elements to the threads as they become idle:
+//!
+//! \code
+//! #include <thrust/for_each.h>
+//! #include <thrust/system/omp/execution_policy.h>
+//! ...
+//! thrust::for_each(thrust::omp::par.with(thrust::omp::threads(8),
+//!                                        thrust::omp::grain(1 << 16),
+//!                                        thrust::omp::schedule::dynamic),
+//!                  vec.begin(),
+//!                  vec.end(),
+//!                  f);
+//! \endcode
+//!
+//! \p with returns a copy of the policy it is called on, so it combines with a temporary allocator as in
+//! <tt>thrust::omp::par(alloc).with(thrust::omp::threads(4))</tt>.
+using detail::grain;
+
 //! \}
 } // namespace system::omp
 
@@ -126,7 +241,10 @@ inline constexpr detail::par_t par;
 namespace omp
 {
 using system::omp::execution_policy;
+using system::omp::grain;
 using system::omp::par;
+using system::omp::schedule;
 using system::omp::tag;
+using system::omp::threads;
 } // namespace omp
 THRUST_NAMESPACE_END
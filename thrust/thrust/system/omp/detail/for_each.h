@@ -23,15 +23,33 @@
 #include <thrust/for_each.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/omp/detail/execution_policy.h>
-#include <thrust/system/omp/detail/pragma_omp.h>
+#include <thrust/system/omp/detail/for_each_tile.h>
 
 #include <cuda/std/__iterator/distance.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system::omp::detail
 {
+namespace for_each_detail
+{
+template <typename RandomAccessIterator, typename WrappedFunction>
+struct body
+{
+  RandomAccessIterator first;
+  WrappedFunction f;
+
+  template <typename DifferenceType>
+  void operator()(DifferenceType i)
+  {
+    RandomAccessIterator temp = first + i;
+    f(*temp);
+  }
+};
+} // namespace for_each_detail
+
 template <typename DerivedPolicy, typename RandomAccessIterator, typename Size, typename UnaryFunction>
-RandomAccessIterator for_each_n(execution_policy<DerivedPolicy>&, RandomAccessIterator first, Size n, UnaryFunction f)
+RandomAccessIterator
+for_each_n(execution_policy<DerivedPolicy>& exec, RandomAccessIterator first, Size n, UnaryFunction f)
 {
   // we're attempting to launch an omp kernel, assert we're compiling with omp support
   // ========================================================================
@@ -48,18 +66,14 @@ RandomAccessIterator for_each_n(execution_policy<DerivedPolicy>&, RandomAccessIt
   }
 
   // create a wrapped function for f
-  thrust::detail::wrapped_function<UnaryFunction, void> wrapped_f{f};
+  using wrapped_function_t = thrust::detail::wrapped_function<UnaryFunction, void>;
+  for_each_detail::body<RandomAccessIterator, wrapped_function_t> body{first, wrapped_function_t{f}};
 
   // use a signed type for the iteration variable or suffer the consequences of warnings
   using DifferenceType    = thrust::detail::it_difference_t<RandomAccessIterator>;
   DifferenceType signed_n = n;
 
-  THRUST_PRAGMA_OMP(parallel for)
-  for (DifferenceType i = 0; i < signed_n; ++i)
-  {
-    RandomAccessIterator temp = first + i;
-    wrapped_f(*temp);
-  }
+  omp::detail::parallel_for(exec.config(), signed_n, body);
 
   return first + n;
 } // end for_each_n()
@@ -0,0 +1,171 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file for_each_tile.h
+ *  \brief Runs the tiles of the shared host algorithms on OpenMP threads.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/system/omp/detail/execution_policy.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+
+// don't attempt to #include this file without omp support
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+#  include <omp.h>
+#endif // omp support
+
+#include <cuda/std/__algorithm/max.h>
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/__iterator/distance.h>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstdint>
+#include <cuda/std/limits>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::omp::detail
+{
+// the number of threads available to the parallel regions of an algorithm
+inline size_t max_tile_parallelism(const execution_config& config = execution_config{})
+{
+  if (config.num_threads != 0)
+  {
+    return config.num_threads;
+  }
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  return static_cast<size_t>(omp_get_max_threads());
+#else
+  return 1;
+#endif
+}
+
+// the number of threads worth giving n elements, i.e. at most one per element, or per grain of elements
+inline size_t tile_parallelism(const execution_config& config, size_t n)
+{
+  const size_t max_work = (config.grain_size == 0) ? n : n / config.grain_size;
+
+  return ::cuda::std::max(size_t{1}, ::cuda::std::min(max_tile_parallelism(config), max_work));
+}
+
+// the number of threads worth giving the elements of [first, last)
+template <typename Iterator>
+size_t tile_parallelism(const execution_config& config, Iterator first, Iterator last)
+{
+  return omp::detail::tile_parallelism(config, static_cast<size_t>(::cuda::std::distance(first, last)));
+}
+
+// the number of threads worth giving the elements of [first1, last1) and [first2, last2)
+template <typename Iterator1, typename Iterator2>
+size_t
+tile_parallelism(const execution_config& config, Iterator1 first1, Iterator1 last1, Iterator2 first2, Iterator2 last2)
+{
+  const size_t n1 = static_cast<size_t>(::cuda::std::distance(first1, last1));
+  const size_t n2 = static_cast<size_t>(::cuda::std::distance(first2, last2));
+
+  return omp::detail::tile_parallelism(config, n1 + n2);
+}
+
+// parallel_for(config, n, body) calls body(i) for every i in [0, n) on the threads of a parallel region, and
+// returns once all calls have completed; the region runs on the threads and with the schedule of config, and the
+// static_, dynamic and guided schedules hand out chunks of config.grain_size iterations
+template <typename Index, typename Body>
+void parallel_for(const execution_config& config, Index n, Body body)
+{
+  if (n <= 0)
+  {
+    return;
+  }
+
+  constexpr size_t int_max = static_cast<size_t>(::cuda::std::numeric_limits<int>::max());
+
+  [[maybe_unused]] const int num_threads =
+    static_cast<int>(::cuda::std::min(tile_parallelism(config, static_cast<size_t>(n)), int_max));
+  [[maybe_unused]] const int chunk_size =
+    static_cast<int>(::cuda::std::min(::cuda::std::max(config.grain_size, size_t{1}), int_max));
+
+  switch (config.schedule_kind)
+  {
+    case schedule::static_:
+      if (config.grain_size != 0)
+      {
+        THRUST_PRAGMA_OMP(parallel for num_threads(num_threads) schedule(static, chunk_size))
+        for (Index i = 0; i < n; ++i)
+        {
+          body(i);
+        }
+      }
+      else
+      {
+        THRUST_PRAGMA_OMP(parallel for num_threads(num_threads) schedule(static))
+        for (Index i = 0; i < n; ++i)
+        {
+          body(i);
+        }
+      }
+      break;
+    case schedule::dynamic:
+      THRUST_PRAGMA_OMP(parallel for num_threads(num_threads) schedule(dynamic, chunk_size))
+      for (Index i = 0; i < n; ++i)
+      {
+        body(i);
+      }
+      break;
+    case schedule::guided:
+      THRUST_PRAGMA_OMP(parallel for num_threads(num_threads) schedule(guided, chunk_size))
+      for (Index i = 0; i < n; ++i)
+      {
+        body(i);
+      }
+      break;
+    default:
+      THRUST_PRAGMA_OMP(parallel for num_threads(num_threads))
+      for (Index i = 0; i < n; ++i)
+      {
+        body(i);
+      }
+      break;
+  }
+}
+
+// for_each_tile(num_tiles, body) calls body(tile) for every tile in [0, num_tiles)
+// on the threads of a parallel region and returns once all calls have completed
+struct for_each_tile
+{
+  // the knobs of the execution policy; the grain is accounted for when choosing the number of tiles
+  execution_config config{};
+
+  template <typename Body>
+  void operator()(size_t num_tiles, Body body) const
+  {
+    execution_config tile_config = config;
+    tile_config.grain_size       = 0;
+
+    // use a signed type for the iteration variable or suffer the consequences of warnings
+    omp::detail::parallel_for(tile_config, static_cast<std::intptr_t>(num_tiles), tile_body<Body>{body});
+  }
+
+private:
+  template <typename Body>
+  struct tile_body
+  {
+    Body body;
+
+    void operator()(std::intptr_t tile)
+    {
+      body(static_cast<size_t>(tile));
+    }
+  };
+};
+} // end namespace system::omp::detail
+THRUST_NAMESPACE_END
@@ -17,8 +17,10 @@
 #  pragma system_header
 #endif // no system header
 
-#include <thrust/system/detail/generic/partition.h>
+#include <thrust/detail/static_assert.h>
+#include <thrust/system/detail/internal/parallel_stream_compaction.h>
 #include <thrust/system/omp/detail/execution_policy.h>
+#include <thrust/system/omp/detail/for_each_tile.h>
 
 #include <cuda/std/__utility/pair.h>
 
@@ -29,8 +31,17 @@ template <typename DerivedPolicy, typename ForwardIterator, typename Predicate>
 ForwardIterator
 stable_partition(execution_policy<DerivedPolicy>& exec, ForwardIterator first, ForwardIterator last, Predicate pred)
 {
-  // omp prefers generic::stable_partition to cpp::stable_partition
-  return thrust::system::detail::generic::stable_partition(exec, first, last, pred);
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  static_assert(thrust::detail::depend_on_instantiation<ForwardIterator,
+                                                        (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
+                "OpenMP compiler support is not enabled");
+
+  return thrust::system::detail::internal::parallel_stable_partition(
+    exec, for_each_tile{exec.config()}, tile_parallelism(exec.config(), first, last), first, last, pred);
 } // end stable_partition()
 
 template <typename DerivedPolicy, typename ForwardIterator, typename InputIterator, typename Predicate>
@@ -41,8 +52,17 @@ ForwardIterator stable_partition(
   InputIterator stencil,
   Predicate pred)
 {
-  // omp prefers generic::stable_partition to cpp::stable_partition
-  return thrust::system::detail::generic::stable_partition(exec, first, last, stencil, pred);
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  static_assert(thrust::detail::depend_on_instantiation<ForwardIterator,
+                                                        (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
+                "OpenMP compiler support is not enabled");
+
+  return thrust::system::detail::internal::parallel_stable_partition(
+    exec, for_each_tile{exec.config()}, tile_parallelism(exec.config(), first, last), first, last, stencil, pred);
 } // end stable_partition()
 
 template <typename DerivedPolicy,
@@ -58,8 +78,25 @@ template <typename DerivedPolicy,
   OutputIterator2 out_false,
   Predicate pred)
 {
-  // omp prefers generic::stable_partition_copy to cpp::stable_partition_copy
-  return thrust::system::detail::generic::stable_partition_copy(exec, first, last, out_true, out_false, pred);
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  static_assert(thrust::detail::depend_on_instantiation<InputIterator,
+                                                        (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
+                "OpenMP compiler support is not enabled");
+
+  return thrust::system::detail::internal::parallel_stable_partition_copy(
+    exec,
+    for_each_tile{exec.config()},
+    tile_parallelism(exec.config(), first, last),
+    first,
+    last,
+    first,
+    out_true,
+    out_false,
+    pred);
 } // end stable_partition_copy()
 
 template <typename DerivedPolicy,
@@ -77,8 +114,25 @@ template <typename DerivedPolicy,
   OutputIterator2 out_false,
   Predicate pred)
 {
-  // omp prefers generic::stable_partition_copy to cpp::stable_partition_copy
-  return thrust::system::detail::generic::stable_partition_copy(exec, first, last, stencil, out_true, out_false, pred);
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  static_assert(thrust::detail::depend_on_instantiation<InputIterator1,
+                                                        (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
+                "OpenMP compiler support is not enabled");
+
+  return thrust::system::detail::internal::parallel_stable_partition_copy(
+    exec,
+    for_each_tile{exec.config()},
+    tile_parallelism(exec.config(), first, last),
+    first,
+    last,
+    stencil,
+    out_true,
+    out_false,
+    pred);
 } // end stable_partition_copy()
 } // end namespace system::omp::detail
 THRUST_NAMESPACE_END
@@ -17,8 +17,13 @@
 #  pragma system_header
 #endif // no system header
 
+#include <thrust/detail/static_assert.h>
 #include <thrust/system/detail/generic/reduce_by_key.h>
+#include <thrust/system/detail/internal/parallel_by_key.h>
 #include <thrust/system/omp/detail/execution_policy.h>
+#include <thrust/system/omp/detail/for_each_tile.h>
+
+#include <cuda/std/__utility/pair.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system::omp::detail
@@ -40,9 +45,26 @@ template <typename DerivedPolicy,
   BinaryPredicate binary_pred,
   BinaryFunction binary_op)
 {
-  // omp prefers generic::reduce_by_key to cpp::reduce_by_key
-  return thrust::system::detail::generic::reduce_by_key(
-    exec, keys_first, keys_last, values_first, keys_output, values_output, binary_pred, binary_op);
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  static_assert(thrust::detail::depend_on_instantiation<InputIterator1,
+                                                        (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
+                "OpenMP compiler support is not enabled");
+
+  return thrust::system::detail::internal::parallel_reduce_by_key(
+    exec,
+    for_each_tile{exec.config()},
+    tile_parallelism(exec.config(), keys_first, keys_last),
+    keys_first,
+    keys_last,
+    values_first,
+    keys_output,
+    values_output,
+    binary_pred,
+    binary_op);
 } // end reduce_by_key()
 } // end namespace system::omp::detail
 THRUST_NAMESPACE_END
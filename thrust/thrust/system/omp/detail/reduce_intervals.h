@@ -21,8 +21,10 @@
 #include <thrust/detail/static_assert.h> // for depend_on_instantiation
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/omp/detail/execution_policy.h>
-#include <thrust/system/omp/detail/pragma_omp.h>
+#include <thrust/system/omp/detail/for_each_tile.h>
 
+#include <cuda/std/__algorithm/max.h>
+#include <cuda/std/__algorithm/min.h>
 #include <cuda/std/cstdint>
 
 THRUST_NAMESPACE_BEGIN
@@ -34,7 +36,7 @@ template <typename DerivedPolicy,
           typename BinaryFunction,
           typename Decomposition>
 void reduce_intervals(
-  execution_policy<DerivedPolicy>&,
+  execution_policy<DerivedPolicy>& exec,
   InputIterator input,
   OutputIterator output,
   BinaryFunction binary_op,
@@ -59,7 +61,11 @@ void reduce_intervals(
 
   index_type n = static_cast<index_type>(decomp.size());
 
-  THRUST_PRAGMA_OMP(parallel for)
+  // every interval is worth a thread of its own, up to the thread count of the policy
+  const index_type max_threads = static_cast<index_type>(max_tile_parallelism(exec.config()));
+  const int num_threads        = static_cast<int>(::cuda::std::max(index_type{1}, ::cuda::std::min(max_threads, n)));
+
+  THRUST_PRAGMA_OMP(parallel for num_threads(num_threads))
   for (index_type i = 0; i < n; i++)
   {
     InputIterator begin = input + decomp[i].begin();
@@ -13,8 +13,11 @@
 #  pragma system_header
 #endif // no system header
 
+#include <thrust/detail/static_assert.h>
 #include <thrust/system/detail/generic/remove.h>
+#include <thrust/system/detail/internal/parallel_stream_compaction.h>
 #include <thrust/system/omp/detail/execution_policy.h>
+#include <thrust/system/omp/detail/for_each_tile.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system::omp::detail
@@ -23,8 +26,17 @@ template <typename DerivedPolicy, typename ForwardIterator, typename Predicate>
 ForwardIterator
 remove_if(execution_policy<DerivedPolicy>& exec, ForwardIterator first, ForwardIterator last, Predicate pred)
 {
-  // omp prefers generic::remove_if to cpp::remove_if
-  return thrust::system::detail::generic::remove_if(exec, first, last, pred);
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  static_assert(thrust::detail::depend_on_instantiation<ForwardIterator,
+                                                        (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
+                "OpenMP compiler support is not enabled");
+
+  return thrust::system::detail::internal::parallel_remove_if(
+    exec, for_each_tile{exec.config()}, tile_parallelism(exec.config(), first, last), first, last, first, pred);
 }
 
 template <typename DerivedPolicy, typename ForwardIterator, typename InputIterator, typename Predicate>
@@ -35,15 +47,24 @@ ForwardIterator remove_if(
   InputIterator stencil,
   Predicate pred)
 {
-  // omp prefers generic::remove_if to cpp::remove_if
-  return thrust::system::detail::generic::remove_if(exec, first, last, stencil, pred);
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  static_assert(thrust::detail::depend_on_instantiation<ForwardIterator,
+                                                        (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
+                "OpenMP compiler support is not enabled");
+
+  return thrust::system::detail::internal::parallel_remove_if(
+    exec, for_each_tile{exec.config()}, tile_parallelism(exec.config(), first, last), first, last, stencil, pred);
 }
 
 template <typename DerivedPolicy, typename InputIterator, typename OutputIterator, typename Predicate>
 OutputIterator remove_copy_if(
   execution_policy<DerivedPolicy>& exec, InputIterator first, InputIterator last, OutputIterator result, Predicate pred)
 {
-  // omp prefers generic::remove_copy_if to cpp::remove_copy_if
+  // generic::remove_copy_if lowers to omp::copy_if
   return thrust::system::detail::generic::remove_copy_if(exec, first, last, result, pred);
 }
 
@@ -60,7 +81,7 @@ OutputIterator remove_copy_if(
   OutputIterator result,
   Predicate pred)
 {
-  // omp prefers generic::remove_copy_if to cpp::remove_copy_if
+  // generic::remove_copy_if lowers to omp::copy_if
   return thrust::system::detail::generic::remove_copy_if(exec, first, last, stencil, result, pred);
 }
 } // end namespace system::omp::detail
@@ -18,6 +18,7 @@
 #include <thrust/detail/temporary_array.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/omp/detail/execution_policy.h>
+#include <thrust/system/omp/detail/for_each_tile.h>
 #include <thrust/system/omp/detail/pragma_omp.h>
 
 #include <cuda/__cmath/ceil_div.h>
@@ -73,11 +74,12 @@ OutputIterator scan_impl(
 
   auto wrapped_binary_op = wrapped_function<BinaryFunction, accum_t>{binary_op};
 
-  const int num_threads = omp_get_max_threads();
+  // at most one block per thread of the policy, and per grain of elements
+  const execution_config config = exec.config();
+  const int num_threads         = static_cast<int>(tile_parallelism(config, static_cast<size_t>(n)));
 
-  // Use serial scan for small arrays where parallel overhead dominates
-  if (static_cast<size_t>(n) < ::cuda::std::max(parallel_scan_threshold, static_cast<size_t>(num_threads))
-      || num_threads <= 1)
+  // Use serial scan for small arrays where parallel overhead dominates, unless the grain of the policy says otherwise
+  if ((config.grain_size == 0 && static_cast<size_t>(n) < parallel_scan_threshold) || num_threads <= 1)
   {
     if constexpr (IsInclusive)
     {
@@ -13,11 +13,88 @@
 #  pragma system_header
 #endif // no system header
 
-// this system inherits this algorithm
-#include <thrust/system/cpp/detail/scan_by_key.h>
+#include <thrust/detail/static_assert.h>
+#include <thrust/system/detail/generic/scan_by_key.h>
+#include <thrust/system/detail/internal/parallel_by_key.h>
+#include <thrust/system/omp/detail/execution_policy.h>
+#include <thrust/system/omp/detail/for_each_tile.h>
 
-// Ensure OMP scan is available before using generic scan_by_key
-#include <thrust/system/omp/detail/scan.h>
+THRUST_NAMESPACE_BEGIN
+namespace system::omp::detail
+{
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename BinaryPredicate,
+          typename BinaryFunction>
+OutputIterator inclusive_scan_by_key(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  OutputIterator result,
+  BinaryPredicate binary_pred,
+  BinaryFunction binary_op)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  static_assert(thrust::detail::depend_on_instantiation<InputIterator1,
+                                                        (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
+                "OpenMP compiler support is not enabled");
 
-// use generic parallel implementation
-#include <thrust/system/detail/generic/scan_by_key.h>
+  return thrust::system::detail::internal::parallel_inclusive_scan_by_key(
+    exec,
+    for_each_tile{exec.config()},
+    tile_parallelism(exec.config(), first1, last1),
+    first1,
+    last1,
+    first2,
+    result,
+    binary_pred,
+    binary_op);
+} // end inclusive_scan_by_key()
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename T,
+          typename BinaryPredicate,
+          typename BinaryFunction>
+OutputIterator exclusive_scan_by_key(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  OutputIterator result,
+  T init,
+  BinaryPredicate binary_pred,
+  BinaryFunction binary_op)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  static_assert(thrust::detail::depend_on_instantiation<InputIterator1,
+                                                        (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
+                "OpenMP compiler support is not enabled");
+
+  return thrust::system::detail::internal::parallel_exclusive_scan_by_key(
+    exec,
+    for_each_tile{exec.config()},
+    tile_parallelism(exec.config(), first1, last1),
+    first1,
+    last1,
+    first2,
+    result,
+    init,
+    binary_pred,
+    binary_op);
+} // end exclusive_scan_by_key()
+} // end namespace system::omp::detail
+THRUST_NAMESPACE_END
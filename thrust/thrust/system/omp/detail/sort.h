@@ -20,59 +20,166 @@
 #  include <omp.h>
 #endif // omp support
 
+#include <thrust/copy.h>
 #include <thrust/detail/seq.h>
 #include <thrust/detail/temporary_array.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/merge.h>
 #include <thrust/sort.h>
 #include <thrust/system/detail/generic/select_system.h>
+#include <thrust/system/detail/internal/decompose.h>
+#include <thrust/system/detail/internal/merge_path.h>
+#include <thrust/system/detail/internal/parallel_radix_sort.h>
 #include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/for_each_tile.h>
+
+#include <cuda/std/__algorithm/max.h>
+#include <cuda/std/__algorithm/min.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system::omp::detail
 {
 namespace sort_detail
 {
-template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
-void inplace_merge(execution_policy<DerivedPolicy>& exec,
-                   RandomAccessIterator first,
-                   RandomAccessIterator middle,
-                   RandomAccessIterator last,
-                   StrictWeakOrdering comp)
+// below this size the tiled comparison sort, whose tiles are radix sorted
+// sequentially, is faster than the parallel radix sort
+const static int radix_sort_threshold = 1 << 16;
+
+// Merges every pair of adjacent sorted runs of `tiles_per_run` tiles of `decomp`.
+// Rather than assigning whole pairs to threads, the output of the round is
+// divided evenly among the `num_threads` threads of the enclosing parallel
+// region. Each thread locates the part of every pair that produces its slice of
+// the output with a merge path search and merges it sequentially, so that all
+// threads do an equal share of the work in every round.
+//
+// `merge_op(first1, last1, first2, last2, result)` receives indices into the
+// source and destination sequences.
+template <typename IndexType, typename KeyIterator, typename StrictWeakOrdering, typename MergeOp>
+void merge_round(const thrust::system::detail::internal::uniform_decomposition<IndexType>& decomp,
+                 IndexType tiles_per_run,
+                 KeyIterator keys,
+                 StrictWeakOrdering comp,
+                 IndexType thread_id,
+                 IndexType num_threads,
+                 MergeOp merge_op)
 {
-  using value_type = thrust::detail::it_value_t<RandomAccessIterator>;
+  const IndexType num_tiles = decomp.size();
+  const IndexType n         = decomp[num_tiles - 1].end();
+
+  thrust::system::detail::internal::uniform_decomposition<IndexType> output_decomp(n, 1, num_threads);
+
+  if (thread_id >= output_decomp.size())
+  {
+    return;
+  }
+
+  const IndexType output_begin = output_decomp[thread_id].begin();
+  const IndexType output_end   = output_decomp[thread_id].end();
+
+  for (IndexType tile = 0; tile < num_tiles; tile += 2 * tiles_per_run)
+  {
+    const IndexType middle_tile = (::cuda::std::min) (tile + tiles_per_run, num_tiles);
+    const IndexType last_tile   = (::cuda::std::min) (tile + 2 * tiles_per_run, num_tiles);
+
+    const IndexType first  = decomp[tile].begin();
+    const IndexType middle = decomp[middle_tile - 1].end();
+    const IndexType last   = decomp[last_tile - 1].end();
+
+    if (last <= output_begin)
+    {
+      continue;
+    }
+
+    if (first >= output_end)
+    {
+      break;
+    }
+
+    // the diagonals bounding this thread's part of the merged pair
+    const IndexType diagonal_begin = (::cuda::std::max) (output_begin, first) - first;
+    const IndexType diagonal_end   = (::cuda::std::min) (output_end, last) - first;
+
+    const IndexType size1 = middle - first;
+    const IndexType size2 = last - middle;
 
-  thrust::detail::temporary_array<value_type, DerivedPolicy> a(exec, first, middle);
-  thrust::detail::temporary_array<value_type, DerivedPolicy> b(exec, middle, last);
+    const IndexType i_begin = thrust::system::detail::internal::merge_path(
+      keys + first, size1, keys + middle, size2, diagonal_begin, comp);
+    const IndexType i_end =
+      thrust::system::detail::internal::merge_path(keys + first, size1, keys + middle, size2, diagonal_end, comp);
 
-  thrust::merge(thrust::seq, a.begin(), a.end(), b.begin(), b.end(), first, comp);
+    merge_op(first + i_begin,
+             first + i_end,
+             middle + (diagonal_begin - i_begin),
+             middle + (diagonal_end - i_end),
+             first + diagonal_begin);
+  }
 }
 
-template <typename DerivedPolicy,
-          typename RandomAccessIterator1,
-          typename RandomAccessIterator2,
-          typename StrictWeakOrdering>
-void inplace_merge_by_key(
-  execution_policy<DerivedPolicy>& exec,
-  RandomAccessIterator1 first1,
-  RandomAccessIterator1 middle1,
-  RandomAccessIterator1 last1,
-  RandomAccessIterator2 first2,
-  StrictWeakOrdering comp)
+template <typename InputIterator, typename OutputIterator, typename StrictWeakOrdering>
+struct merge_keys_op
 {
-  using value_type1 = thrust::detail::it_value_t<RandomAccessIterator1>;
-  using value_type2 = thrust::detail::it_value_t<RandomAccessIterator2>;
+  InputIterator input;
+  OutputIterator output;
+  StrictWeakOrdering comp;
 
-  RandomAccessIterator2 middle2 = first2 + (middle1 - first1);
-  RandomAccessIterator2 last2   = first2 + (last1 - first1);
+  template <typename IndexType>
+  void operator()(IndexType first1, IndexType last1, IndexType first2, IndexType last2, IndexType result) const
+  {
+    thrust::merge(thrust::seq, input + first1, input + last1, input + first2, input + last2, output + result, comp);
+  }
+};
 
-  thrust::detail::temporary_array<value_type1, DerivedPolicy> lhs1(exec, first1, middle1);
-  thrust::detail::temporary_array<value_type1, DerivedPolicy> rhs1(exec, middle1, last1);
-  thrust::detail::temporary_array<value_type2, DerivedPolicy> lhs2(exec, first2, middle2);
-  thrust::detail::temporary_array<value_type2, DerivedPolicy> rhs2(exec, middle2, last2);
+template <typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename StrictWeakOrdering>
+struct merge_pairs_op
+{
+  InputIterator1 keys_input;
+  InputIterator2 values_input;
+  OutputIterator1 keys_output;
+  OutputIterator2 values_output;
+  StrictWeakOrdering comp;
+
+  template <typename IndexType>
+  void operator()(IndexType first1, IndexType last1, IndexType first2, IndexType last2, IndexType result) const
+  {
+    thrust::merge_by_key(
+      thrust::seq,
+      keys_input + first1,
+      keys_input + last1,
+      keys_input + first2,
+      keys_input + last2,
+      values_input + first1,
+      values_input + first2,
+      keys_output + result,
+      values_output + result,
+      comp);
+  }
+};
 
-  thrust::merge_by_key(
-    thrust::seq, lhs1.begin(), lhs1.end(), rhs1.begin(), rhs1.end(), lhs2.begin(), rhs2.begin(), first1, first2, comp);
+template <typename InputIterator, typename OutputIterator, typename StrictWeakOrdering>
+merge_keys_op<InputIterator, OutputIterator, StrictWeakOrdering>
+make_merge_keys_op(InputIterator input, OutputIterator output, StrictWeakOrdering comp)
+{
+  return {input, output, comp};
+}
+
+template <typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename StrictWeakOrdering>
+merge_pairs_op<InputIterator1, InputIterator2, OutputIterator1, OutputIterator2, StrictWeakOrdering>
+make_merge_pairs_op(
+  InputIterator1 keys_input,
+  InputIterator2 values_input,
+  OutputIterator1 keys_output,
+  OutputIterator2 values_output,
+  StrictWeakOrdering comp)
+{
+  return {keys_input, values_input, keys_output, values_output, comp};
 }
 } // namespace sort_detail
 
@@ -91,16 +198,43 @@ void stable_sort(
 
   // Avoid issues on compilers that don't provide `omp_get_num_threads()`.
 #if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
-  using IndexType = thrust::detail::it_difference_t<RandomAccessIterator>;
+  using IndexType  = thrust::detail::it_difference_t<RandomAccessIterator>;
+  using value_type = thrust::detail::it_value_t<RandomAccessIterator>;
 
   if (first == last)
   {
     return;
   }
 
-  THRUST_PRAGMA_OMP(parallel)
+  const IndexType n = last - first;
+
+  // the merge sort runs on one thread per tile
+  const size_t max_threads = omp::detail::tile_parallelism(exec.config(), static_cast<size_t>(n));
+
+  if (max_threads == 1)
+  {
+    thrust::stable_sort(thrust::seq, first, last, comp);
+    return;
+  }
+
+  if constexpr (thrust::system::detail::internal::use_parallel_radix_sort<value_type, StrictWeakOrdering>)
+  {
+    if (n >= sort_detail::radix_sort_threshold)
+    {
+      thrust::system::detail::internal::parallel_stable_radix_sort(
+        exec, omp::detail::for_each_tile{exec.config()}, max_threads, first, last, comp);
+      return;
+    }
+  }
+
+  // the merge rounds ping-pong between the input and this buffer
+  thrust::detail::temporary_array<value_type, DerivedPolicy> buffer(exec, first, last);
+
+  THRUST_PRAGMA_OMP(parallel num_threads(static_cast<int>(max_threads)))
   {
-    thrust::system::detail::internal::uniform_decomposition<IndexType> decomp(last - first, 1, omp_get_num_threads());
+    const IndexType num_threads = omp_get_num_threads();
+
+    thrust::system::detail::internal::uniform_decomposition<IndexType> decomp(n, 1, num_threads);
 
     // process id
     IndexType p_i = omp_get_thread_num();
@@ -116,36 +250,49 @@ void stable_sort(
     // #5020: For some reason, MSVC may yield an error unless we include this meaningless semicolon here
     ;
 
-    IndexType nseg = decomp.size();
-    IndexType h    = 2;
-
-    // keep track of which sub-range we're processing
-    IndexType a = p_i, b = p_i, c = p_i + 1;
+    bool result_in_buffer = false;
 
-    while (nseg > 1)
+    // every thread participates in every merge round
+    for (IndexType tiles_per_run = 1; tiles_per_run < decomp.size(); tiles_per_run *= 2)
     {
-      if (c >= decomp.size())
+      if (result_in_buffer)
       {
-        c = decomp.size() - 1;
+        sort_detail::merge_round(
+          decomp,
+          tiles_per_run,
+          buffer.begin(),
+          comp,
+          p_i,
+          num_threads,
+          sort_detail::make_merge_keys_op(buffer.begin(), first, comp));
       }
-
-      if ((p_i % h) == 0 && c > b)
+      else
       {
-        sort_detail::inplace_merge(
-          exec, first + decomp[a].begin(), first + decomp[b].end(), first + decomp[c].end(), comp);
-
-        b = c;
-        c += h;
+        sort_detail::merge_round(
+          decomp,
+          tiles_per_run,
+          first,
+          comp,
+          p_i,
+          num_threads,
+          sort_detail::make_merge_keys_op(first, buffer.begin(), comp));
       }
 
-      nseg = (nseg + 1) / 2;
-      h *= 2;
+      result_in_buffer = !result_in_buffer;
 
       THRUST_PRAGMA_OMP(barrier)
 
       // #5020: For some reason, MSVC may yield an error unless we include this meaningless semicolon here
       ;
     }
+
+    if (result_in_buffer && p_i < decomp.size())
+    {
+      thrust::copy(thrust::seq,
+                   buffer.begin() + decomp[p_i].begin(),
+                   buffer.begin() + decomp[p_i].end(),
+                   first + decomp[p_i].begin());
+    }
   }
 #endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
 }
@@ -172,17 +319,51 @@ void stable_sort_by_key(
 
   // Avoid issues on compilers that don't provide `omp_get_num_threads()`.
 #if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
-  using IndexType = thrust::detail::it_difference_t<RandomAccessIterator1>;
+  using IndexType  = thrust::detail::it_difference_t<RandomAccessIterator1>;
+  using key_type   = thrust::detail::it_value_t<RandomAccessIterator1>;
+  using value_type = thrust::detail::it_value_t<RandomAccessIterator2>;
 
   if (keys_first == keys_last)
   {
     return;
   }
 
-  THRUST_PRAGMA_OMP(parallel)
+  const IndexType n = keys_last - keys_first;
+
+  // the merge sort runs on one thread per tile
+  const size_t max_threads = omp::detail::tile_parallelism(exec.config(), static_cast<size_t>(n));
+
+  if (max_threads == 1)
+  {
+    thrust::stable_sort_by_key(thrust::seq, keys_first, keys_last, values_first, comp);
+    return;
+  }
+
+  if constexpr (thrust::system::detail::internal::use_parallel_radix_sort<key_type, StrictWeakOrdering>)
   {
-    thrust::system::detail::internal::uniform_decomposition<IndexType> decomp(
-      keys_last - keys_first, 1, omp_get_num_threads());
+    if (n >= sort_detail::radix_sort_threshold)
+    {
+      thrust::system::detail::internal::parallel_stable_radix_sort_by_key(
+        exec,
+        omp::detail::for_each_tile{exec.config()},
+        max_threads,
+        keys_first,
+        keys_last,
+        values_first,
+        comp);
+      return;
+    }
+  }
+
+  // the merge rounds ping-pong between the input and these buffers
+  thrust::detail::temporary_array<key_type, DerivedPolicy> keys_buffer(exec, keys_first, keys_last);
+  thrust::detail::temporary_array<value_type, DerivedPolicy> values_buffer(exec, values_first, values_first + n);
+
+  THRUST_PRAGMA_OMP(parallel num_threads(static_cast<int>(max_threads)))
+  {
+    const IndexType num_threads = omp_get_num_threads();
+
+    thrust::system::detail::internal::uniform_decomposition<IndexType> decomp(n, 1, num_threads);
 
     // process id
     IndexType p_i = omp_get_thread_num();
@@ -203,41 +384,55 @@ void stable_sort_by_key(
     // #5020: For some reason, MSVC may yield an error unless we include this meaningless semicolon here
     ;
 
-    IndexType nseg = decomp.size();
-    IndexType h    = 2;
-
-    // keep track of which sub-range we're processing
-    IndexType a = p_i, b = p_i, c = p_i + 1;
+    bool result_in_buffer = false;
 
-    while (nseg > 1)
+    // every thread participates in every merge round
+    for (IndexType tiles_per_run = 1; tiles_per_run < decomp.size(); tiles_per_run *= 2)
     {
-      if (c >= decomp.size())
+      if (result_in_buffer)
       {
-        c = decomp.size() - 1;
+        sort_detail::merge_round(
+          decomp,
+          tiles_per_run,
+          keys_buffer.begin(),
+          comp,
+          p_i,
+          num_threads,
+          sort_detail::make_merge_pairs_op(
+            keys_buffer.begin(), values_buffer.begin(), keys_first, values_first, comp));
       }
-
-      if ((p_i % h) == 0 && c > b)
+      else
       {
-        sort_detail::inplace_merge_by_key(
-          exec,
-          keys_first + decomp[a].begin(),
-          keys_first + decomp[b].end(),
-          keys_first + decomp[c].end(),
-          values_first + decomp[a].begin(),
-          comp);
-
-        b = c;
-        c += h;
+        sort_detail::merge_round(
+          decomp,
+          tiles_per_run,
+          keys_first,
+          comp,
+          p_i,
+          num_threads,
+          sort_detail::make_merge_pairs_op(
+            keys_first, values_first, keys_buffer.begin(), values_buffer.begin(), comp));
       }
 
-      nseg = (nseg + 1) / 2;
-      h *= 2;
+      result_in_buffer = !result_in_buffer;
 
       THRUST_PRAGMA_OMP(barrier)
 
       // #5020: For some reason, MSVC may yield an error unless we include this meaningless semicolon here
       ;
     }
+
+    if (result_in_buffer && p_i < decomp.size())
+    {
+      thrust::copy(thrust::seq,
+                   keys_buffer.begin() + decomp[p_i].begin(),
+                   keys_buffer.begin() + decomp[p_i].end(),
+                   keys_first + decomp[p_i].begin());
+      thrust::copy(thrust::seq,
+                   values_buffer.begin() + decomp[p_i].begin(),
+                   values_buffer.begin() + decomp[p_i].end(),
+                   values_first + decomp[p_i].begin());
+    }
   }
 #endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
 }
@@ -13,5 +13,114 @@
 #  pragma system_header
 #endif // no system header
 
-// this system inherits binary_search
+#include <thrust/system/detail/generic/binary_search.h>
+#include <thrust/system/detail/internal/parallel_vectorized_search.h>
+#include <thrust/system/tbb/detail/execution_policy.h>
+#include <thrust/system/tbb/detail/for_each_tile.h>
+
+// this system inherits the scalar binary search algorithms
 #include <thrust/system/cpp/detail/binary_search.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::tbb::detail
+{
+template <typename DerivedPolicy,
+          typename ForwardIterator,
+          typename InputIterator,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator lower_bound(
+  execution_policy<DerivedPolicy>& exec,
+  ForwardIterator begin,
+  ForwardIterator end,
+  InputIterator values_begin,
+  InputIterator values_end,
+  OutputIterator output,
+  StrictWeakOrdering comp)
+{
+  if constexpr (system::detail::internal::is_random_access_search_v<ForwardIterator, InputIterator, OutputIterator>)
+  {
+    return thrust::system::detail::internal::parallel_vectorized_search(
+      for_each_tile{},
+      max_tile_parallelism(),
+      begin,
+      end,
+      values_begin,
+      values_end,
+      output,
+      comp,
+      thrust::system::detail::internal::lower_bound_op{});
+  }
+  else
+  {
+    return thrust::system::detail::generic::lower_bound(exec, begin, end, values_begin, values_end, output, comp);
+  }
+}
+
+template <typename DerivedPolicy,
+          typename ForwardIterator,
+          typename InputIterator,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator upper_bound(
+  execution_policy<DerivedPolicy>& exec,
+  ForwardIterator begin,
+  ForwardIterator end,
+  InputIterator values_begin,
+  InputIterator values_end,
+  OutputIterator output,
+  StrictWeakOrdering comp)
+{
+  if constexpr (system::detail::internal::is_random_access_search_v<ForwardIterator, InputIterator, OutputIterator>)
+  {
+    return thrust::system::detail::internal::parallel_vectorized_search(
+      for_each_tile{},
+      max_tile_parallelism(),
+      begin,
+      end,
+      values_begin,
+      values_end,
+      output,
+      comp,
+      thrust::system::detail::internal::upper_bound_op{});
+  }
+  else
+  {
+    return thrust::system::detail::generic::upper_bound(exec, begin, end, values_begin, values_end, output, comp);
+  }
+}
+
+template <typename DerivedPolicy,
+          typename ForwardIterator,
+          typename InputIterator,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator binary_search(
+  execution_policy<DerivedPolicy>& exec,
+  ForwardIterator begin,
+  ForwardIterator end,
+  InputIterator values_begin,
+  InputIterator values_end,
+  OutputIterator output,
+  StrictWeakOrdering comp)
+{
+  if constexpr (system::detail::internal::is_random_access_search_v<ForwardIterator, InputIterator, OutputIterator>)
+  {
+    return thrust::system::detail::internal::parallel_vectorized_search(
+      for_each_tile{},
+      max_tile_parallelism(),
+      begin,
+      end,
+      values_begin,
+      values_end,
+      output,
+      comp,
+      thrust::system::detail::internal::binary_search_op{});
+  }
+  else
+  {
+    return thrust::system::detail::generic::binary_search(exec, begin, end, values_begin, values_end, output, comp);
+  }
+}
+} // end namespace system::tbb::detail
+THRUST_NAMESPACE_END
@@ -0,0 +1,59 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA Corporation. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/cstddef>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::tbb::detail
+{
+namespace for_each_tile_detail
+{
+template <typename Body>
+struct range_body
+{
+  Body body;
+
+  void operator()(const ::tbb::blocked_range<size_t>& r) const
+  {
+    for (size_t tile = r.begin(); tile != r.end(); ++tile)
+    {
+      body(tile);
+    }
+  }
+};
+} // namespace for_each_tile_detail
+
+// the number of threads available to the tasks of for_each_tile
+inline size_t max_tile_parallelism()
+{
+  return static_cast<size_t>(::tbb::this_task_arena::max_concurrency());
+}
+
+// for_each_tile(num_tiles, body) calls body(tile) for every tile in [0, num_tiles)
+// as tbb tasks and returns once all calls have completed
+struct for_each_tile
+{
+  template <typename Body>
+  void operator()(size_t num_tiles, Body body) const
+  {
+    ::tbb::parallel_for(::tbb::blocked_range<size_t>(0, num_tiles, 1), for_each_tile_detail::range_body<Body>{body});
+  }
+};
+} // end namespace system::tbb::detail
+THRUST_NAMESPACE_END
@@ -18,7 +18,9 @@
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/merge.h>
 #include <thrust/sort.h>
+#include <thrust/system/detail/internal/parallel_radix_sort.h>
 #include <thrust/system/tbb/detail/execution_policy.h>
+#include <thrust/system/tbb/detail/for_each_tile.h>
 
 #include <cuda/std/__iterator/distance.h>
 
@@ -32,6 +34,9 @@ namespace sort_detail
 // TODO tune this based on data type and comp
 const static int threshold = 128 * 1024;
 
+// below this size a single sequential radix sort is faster than the parallel one
+const static int radix_sort_threshold = 1 << 16;
+
 template <typename DerivedPolicy, typename Iterator1, typename Iterator2, typename StrictWeakOrdering>
 void merge_sort(execution_policy<DerivedPolicy>& exec,
                 Iterator1 first1,
@@ -243,6 +248,16 @@ void stable_sort(
 {
   using key_type = thrust::detail::it_value_t<RandomAccessIterator>;
 
+  if constexpr (thrust::system::detail::internal::use_parallel_radix_sort<key_type, StrictWeakOrdering>)
+  {
+    if (::cuda::std::distance(first, last) >= sort_detail::radix_sort_threshold)
+    {
+      thrust::system::detail::internal::parallel_stable_radix_sort(
+        exec, tbb::detail::for_each_tile{}, tbb::detail::max_tile_parallelism(), first, last, comp);
+      return;
+    }
+  }
+
   thrust::detail::temporary_array<key_type, DerivedPolicy> temp(exec, first, last);
 
   sort_detail::merge_sort(exec, first, last, temp.begin(), comp, true);
@@ -262,6 +277,16 @@ void stable_sort_by_key(
   using key_type = thrust::detail::it_value_t<RandomAccessIterator1>;
   using val_type = thrust::detail::it_value_t<RandomAccessIterator2>;
 
+  if constexpr (thrust::system::detail::internal::use_parallel_radix_sort<key_type, StrictWeakOrdering>)
+  {
+    if (::cuda::std::distance(first1, last1) >= sort_detail::radix_sort_threshold)
+    {
+      thrust::system::detail::internal::parallel_stable_radix_sort_by_key(
+        exec, tbb::detail::for_each_tile{}, tbb::detail::max_tile_parallelism(), first1, last1, first2, comp);
+      return;
+    }
+  }
+
   RandomAccessIterator2 last2 = first2 + ::cuda::std::distance(first1, last1);
 
   thrust::detail::temporary_array<key_type, DerivedPolicy> temp1(exec, first1, last1);